@@ -131,11 +131,17 @@ public:
   struct Arguments {
     ElementD* ptr_D;
     StrideD dD;
+    // Optional per-output-channel scales applied to each accumulator before the elementwise op,
+    // e.g. to dequantize integer weights. Laid out as (N,L) with N contiguous.
+    ElementCompute const* ptr_scale0 = nullptr;
+    ElementCompute const* ptr_scale1 = nullptr;
   };
 
   // Device side epilogue params
   struct Params {
     XE_Copy_D xe_store_d;
+    ElementCompute const* ptr_scale0 = nullptr;
+    ElementCompute const* ptr_scale1 = nullptr;
   };
 
   //
@@ -162,7 +168,9 @@ public:
     }
 
     return {
-      xe_store_d
+      xe_store_d,
+      args.ptr_scale0,
+      args.ptr_scale1
     };
   }
 
@@ -256,6 +264,7 @@ public:
     auto [m_coord, n_coord, k_coord, l_coord] = tile_coord_mnkl;
     auto m_sg = get_sub_group_id() / ATOM_N;
     auto n_sg = get_sub_group_id() % ATOM_N;
+    int sg_local_id = compat::get_nd_item<1>().get_sub_group().get_local_id();
     
     // Represent the full output tensor
     Tensor mD_mnl = cute::get_xe_tensor(make_shape(M,N,L));
@@ -273,12 +282,18 @@ public:
 
     CUTLASS_PRAGMA_UNROLL
     for(int epi_n = 0; epi_n < FragsN; epi_n++) {
+      // Each work-item holds a single column of the MMA atom's accumulator
+      int n = n_coord * BLK_N + n_sg * SG_N + epi_n * get<1>(MmaAtomShape()) + sg_local_id;
+      bool n_in_bounds = n < N;
+      ElementCompute scale0 = params.ptr_scale0 != nullptr && n_in_bounds ? params.ptr_scale0[l_coord * N + n] : ElementCompute(1);
+      ElementCompute scale1 = params.ptr_scale1 != nullptr && n_in_bounds ? params.ptr_scale1[l_coord * N + n] : ElementCompute(1);
+
       CUTLASS_PRAGMA_UNROLL
       for(int epi_m = 0; epi_m < FragsM; epi_m++) {
         Tensor trD = make_tensor<ElementAccumulator>(Shape<Int<FragmentSize>>{});
         CUTLASS_PRAGMA_UNROLL
         for (int epi_v = 0; epi_v < FragmentSize; epi_v++) {
-          trD(epi_v) = elem_wise_binary(accumulators0(epi_v,epi_m,epi_n), accumulators1(epi_v,epi_m,epi_n));
+          trD(epi_v) = elem_wise_binary(scale0 * accumulators0(epi_v,epi_m,epi_n), scale1 * accumulators1(epi_v,epi_m,epi_n));
         }
 
         if constexpr (is_destination_supported) {
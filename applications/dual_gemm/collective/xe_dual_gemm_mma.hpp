@@ -33,6 +33,7 @@
 
 #include "cutlass/cutlass.h"
 #include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/numeric_conversion.h"
 
 #include "cute/algorithm/functional.hpp"
 #include "cute/atom/mma_atom.hpp"
@@ -43,16 +44,19 @@
 namespace cutlass::gemm::collective {
 using namespace cute;
 
+// When InterleavedB_ is set, B0 and B1 are read from a single (2N,K) tensor whose columns alternate
+// between BLK_N-wide blocks of B0 and B1 (e.g. the gate and up projections of a gated MLP). ptr_B0/dB0
+// then describe the whole interleaved tensor and ptr_B1/dB1 are ignored.
 template <class DispatchPolicy, class TileShape_, class ElementA_, class StrideA_, class ElementB_, class StrideB_,
-          class TiledMma_, class GmemTiledCopyA_, class GmemTiledCopyB_>
+          class TiledMma_, class GmemTiledCopyA_, class GmemTiledCopyB_, bool InterleavedB_ = false>
 struct DualGemmMma;
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 template <int Stages, class Schedule, class TileShape_, class ElementA_, class StrideA_, class ElementB_, class StrideB_,
-          class TiledMma_, class GmemTiledCopyA_, class GmemTiledCopyB_>
+          class TiledMma_, class GmemTiledCopyA_, class GmemTiledCopyB_, bool InterleavedB_>
 struct DualGemmMma<MainloopIntelXeXMX16<Stages, Schedule>, TileShape_, ElementA_, StrideA_, ElementB_, StrideB_, TiledMma_,
-                     GmemTiledCopyA_, GmemTiledCopyB_> {
+                     GmemTiledCopyA_, GmemTiledCopyB_, InterleavedB_> {
   //
   // Type Aliases
   //
@@ -67,8 +71,20 @@ struct DualGemmMma<MainloopIntelXeXMX16<Stages, Schedule>, TileShape_, ElementA_
   using GmemTiledCopyA = GmemTiledCopyA_;
   using GmemTiledCopyB = GmemTiledCopyB_;
   using ArchTag = typename DispatchPolicy::ArchTag;
+  using ElementMma = typename TiledMma::ValTypeB;
 
-  static_assert(platform::is_same<ElementA, ElementB>::value, "MainloopIntelXeXMX16 requires that A and B have same type.");
+  static constexpr bool InterleavedB = InterleavedB_;
+  // Narrow integer weights are loaded as stored and widened to the MMA type in registers
+  static constexpr bool IsMixedInput = not platform::is_same<ElementB, ElementMma>::value;
+
+  static_assert(platform::is_same<ElementA, ElementMma>::value, "MainloopIntelXeXMX16 requires that A matches the MMA type.");
+  static_assert(not IsMixedInput || (platform::numeric_limits<ElementB>::is_integer &&
+                                     (sizeof_bits_v<ElementB> == 8 || sizeof_bits_v<ElementB> == 4)),
+                "B must either match the MMA type or be an 8-bit or 4-bit integer type.");
+  // convert_B unpacks 4-bit B linearly from register storage, which only matches the MMA order for
+  // the transposed loads of a K-major B
+  static_assert(sizeof_bits_v<ElementB> != 4 || cutlass::gemm::detail::is_k_major<StrideB>(),
+                "4-bit B must be K-major (column-major B).");
 
   static constexpr int SubgroupSize = DispatchPolicy::SubgroupSize;
 
@@ -133,6 +149,12 @@ struct DualGemmMma<MainloopIntelXeXMX16<Stages, Schedule>, TileShape_, ElementA_
     auto mA_mkl = make_tensor(make_gmem_ptr(static_cast<ElementA const*>(args.ptr_A)),
                               make_layout(make_shape(M, K, L), args.dA));
 
+    if constexpr (InterleavedB) {
+      auto mB_nkl = make_tensor(make_gmem_ptr(static_cast<ElementB const*>(args.ptr_B0)),
+                                make_layout(make_shape(2 * N, K, L), args.dB0));
+      return Params{mA_mkl, mB_nkl, mB_nkl};
+    }
+
     auto mB0_nkl = make_tensor(make_gmem_ptr(static_cast<ElementB const*>(args.ptr_B0)),
                               make_layout(make_shape(N, K, L), args.dB0));
 
@@ -142,10 +164,49 @@ struct DualGemmMma<MainloopIntelXeXMX16<Stages, Schedule>, TileShape_, ElementA_
     return Params{mA_mkl, mB0_nkl, mB1_nkl};
   }
 
+  /// Widen a fragment of narrow B values to the MMA type. Both fragments share a layout, so the
+  /// conversion walks register storage linearly.
+  template <class EngineIn, class EngineOut, class FragLayout>
+  CUTLASS_DEVICE static void
+  convert_B(Tensor<EngineIn, FragLayout> const& in, Tensor<EngineOut, FragLayout>& out) {
+    static_assert(is_rmem<EngineIn>::value, "Input tensor for B conversion must come from registers");
+    static_assert(size_v<FragLayout> == cosize_v<FragLayout>);
+
+    constexpr int num_elements = decltype(size(in))::value;
+    auto pDst = raw_pointer_cast(out.data());
+
+    if constexpr (sizeof_bits_v<ElementB> == 8) {
+      using Converter = cutlass::NumericArrayConverter<ElementMma, ElementB, num_elements, cutlass::FloatRoundStyle::round_to_nearest>;
+      using SrcArray = cutlass::Array<ElementB, num_elements>;
+      using DstArray = cutlass::Array<ElementMma, num_elements>;
+      *reinterpret_cast<DstArray*>(pDst) = Converter::convert(*reinterpret_cast<SrcArray const*>(raw_pointer_cast(in.data())));
+    } else {
+      // 4-bit values are packed low nibble first; unpack one 16-bit word at a time
+      using format_type = ushort;
+      constexpr int scalar = sizeof_bits_v<format_type> / sizeof_bits_v<ElementB>;
+      static_assert(num_elements % scalar == 0);
+      auto pSrc = reinterpret_cast<format_type const*>(raw_pointer_cast(in.data()));
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int w = 0; w < num_elements / scalar; ++w) {
+        format_type format_data = pSrc[w];
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < scalar; ++i) {
+          int data = (format_data >> (sizeof_bits_v<ElementB> * i)) & 0xf;
+          if constexpr (platform::numeric_limits<ElementB>::is_signed) {
+            data = (data ^ 0x8) - 0x8;
+          }
+          pDst[w * scalar + i] = static_cast<ElementMma>(static_cast<float>(data));
+        }
+      }
+    }
+  }
+
   /// Perform a subgroup-scoped matrix multiply-accumulate
+  /// gB0 and gB1 are the coordinate tiles of the two B operands; they only differ for an interleaved B.
   template <class FrgTensorD0, class FrgTensorD1, class TensorA, class TensorB, class KTileIterator, class ResidueMNK,
             class BlkCoord>
-  CUTLASS_DEVICE void operator()(FrgTensorD0 &accum0, FrgTensorD1 &accum1, TensorA gA, TensorB gB,
+  CUTLASS_DEVICE void operator()(FrgTensorD0 &accum0, FrgTensorD1 &accum1, TensorA gA, TensorB gB0, TensorB gB1,
                                  KTileIterator k_tile_iter, int k_tile_count, ResidueMNK residue_mnk,
                                  BlkCoord const &blk_coord, int const &K_start, int thread_idx, char *smem_buf,
                                  Params const &mainloop) {
@@ -176,22 +237,38 @@ struct DualGemmMma<MainloopIntelXeXMX16<Stages, Schedule>, TileShape_, ElementA_
 
     // Partition
     Tensor tCgA = thr_mma.partition_A(gA);
-    Tensor tCgB = thr_mma.partition_B(gB);
+    Tensor tCgB0 = thr_mma.partition_B(gB0);
+    Tensor tCgB1 = thr_mma.partition_B(gB1);
 
     Tensor tCrA = make_tensor<ElementA> (make_fragment_layout(tiled_copy_a, tCgA(_,_,_,0).shape()));
 
-    Layout tCrBLayout = make_fragment_layout(tiled_copy_b, tCgB(_,_,_,0).shape());
-    Tensor tCrB0 = make_tensor<ElementB>(tCrBLayout);
-    Tensor tCrB1 = make_tensor<ElementB>(tCrBLayout);
+    Layout tCrBLayout = make_fragment_layout(tiled_copy_b, tCgB0(_,_,_,0).shape());
+    Tensor tCrB0 = make_tensor<ElementMma>(tCrBLayout);
+    Tensor tCrB1 = make_tensor<ElementMma>(tCrBLayout);
+    Tensor quant_frag_B0 = make_tensor<ElementB>(tCrBLayout);
+    Tensor quant_frag_B1 = make_tensor<ElementB>(tCrBLayout);
   
     // Retile registers for copies
     Tensor tArA = thr_copy_A.retile_D(tCrA);
-    Tensor tBrB0 = thr_copy_B.retile_D(tCrB0);
-    Tensor tBrB1 = thr_copy_B.retile_D(tCrB1);
+    Tensor tBrB0 = [&](){
+      if constexpr (IsMixedInput) {
+        return thr_copy_B.retile_D(quant_frag_B0);
+      } else {
+        return thr_copy_B.retile_D(tCrB0);
+      }
+    }();
+    Tensor tBrB1 = [&](){
+      if constexpr (IsMixedInput) {
+        return thr_copy_B.retile_D(quant_frag_B1);
+      } else {
+        return thr_copy_B.retile_D(tCrB1);
+      }
+    }();
     
     // Retile global counting tensors for copies
     Tensor tAgA = thr_copy_A.retile_S(tCgA);
-    Tensor tBgB = thr_copy_B.retile_S(tCgB);
+    Tensor tBgB0 = thr_copy_B.retile_S(tCgB0);
+    Tensor tBgB1 = thr_copy_B.retile_S(tCgB1);
 
     auto tiled_prefetch_a = cute::prefetch_selector<Shape<Int<BLK_M>,Int<BLK_K>>, Num_SGs>(tiled_copy_a);//256x32
     auto tiled_prefetch_b = cute::prefetch_selector<Shape<Int<BLK_N>,Int<BLK_K>>, Num_SGs>(tiled_copy_b);//32x128
@@ -200,7 +277,8 @@ struct DualGemmMma<MainloopIntelXeXMX16<Stages, Schedule>, TileShape_, ElementA_
     
     // Partition global tile for prefetch
     auto pAgA = thr_prefetch_A.partition_S(gA);
-    auto pBgB = thr_prefetch_B.partition_S(gB);
+    auto pBgB0 = thr_prefetch_B.partition_S(gB0);
+    auto pBgB1 = thr_prefetch_B.partition_S(gB1);
 
 #if CUTLASS_ENABLE_DEBUG_PRINTS
     if (cutlass::thread(LOG_THREAD, LOG_GROUP)) {
@@ -210,9 +288,9 @@ struct DualGemmMma<MainloopIntelXeXMX16<Stages, Schedule>, TileShape_, ElementA_
         print("tAgA : "); print(tAgA); print("\n");
 
         print("=====================  B :\n");
-        print("  gB : "); print(gB); print("\n");
-        print("tCgB : "); print(tCgB); print("\n");
-        print("tBgB : "); print(tBgB); print("\n");
+        print("  gB0 : "); print(gB0); print("\n");
+        print("tCgB0 : "); print(tCgB0); print("\n");
+        print("tBgB0 : "); print(tBgB0); print("\n");
 
         print("=====================  Config: \n");
         print("  threads per workgroup : "); print(MaxThreadsPerBlock); print("\n");
@@ -235,8 +313,8 @@ struct DualGemmMma<MainloopIntelXeXMX16<Stages, Schedule>, TileShape_, ElementA_
     CUTLASS_PRAGMA_UNROLL
     for (; prefetch_k < DispatchPolicy::Stages; prefetch_k++) {
       prefetch(tiled_prefetch_a, pAgA(_, _, _, prefetch_k));
-      prefetch(tiled_prefetch_b, pBgB(_, _, _, prefetch_k));
-      prefetch(tiled_prefetch_b.with(mainloop.mB1), pBgB(_, _, _, prefetch_k));
+      prefetch(tiled_prefetch_b, pBgB0(_, _, _, prefetch_k));
+      prefetch(tiled_prefetch_b.with(mainloop.mB1), pBgB1(_, _, _, prefetch_k));
     }
 
     CUTLASS_PRAGMA_UNROLL
@@ -244,13 +322,18 @@ struct DualGemmMma<MainloopIntelXeXMX16<Stages, Schedule>, TileShape_, ElementA_
       barrier_arrive(barrier_scope);
       // Copy gmem to rmem for the first k_tile
       copy(tiled_copy_a, tAgA(_,_,_,k_tile), tArA);
-      copy(tiled_copy_b, tBgB(_,_,_,k_tile), tBrB0);
-      copy(tiled_copy_b.with(mainloop.mB1), tBgB(_,_,_,k_tile), tBrB1);
+      copy(tiled_copy_b, tBgB0(_,_,_,k_tile), tBrB0);
+      copy(tiled_copy_b.with(mainloop.mB1), tBgB1(_,_,_,k_tile), tBrB1);
 
       if (prefetch_k < k_tile_count) {
         prefetch(tiled_prefetch_a, pAgA(_, _, _, prefetch_k));
-        prefetch(tiled_prefetch_b, pBgB(_, _, _, prefetch_k));
-        prefetch(tiled_prefetch_b.with(mainloop.mB1), pBgB(_, _, _, prefetch_k));
+        prefetch(tiled_prefetch_b, pBgB0(_, _, _, prefetch_k));
+        prefetch(tiled_prefetch_b.with(mainloop.mB1), pBgB1(_, _, _, prefetch_k));
+      }
+
+      if constexpr (IsMixedInput) {
+        convert_B(quant_frag_B0, tCrB0);
+        convert_B(quant_frag_B1, tCrB1);
       }
 
       cute::gemm(tiled_mma, tCrA, tCrB0, accum0);
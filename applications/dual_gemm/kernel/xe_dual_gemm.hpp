@@ -41,6 +41,25 @@
 
 namespace cutlass::gemm::kernel {
 
+namespace detail {
+
+// The per-GEMM epilogues of a DualGemm may be void, in which case only the elementwise epilogue runs
+template <class CollectiveEpilogue>
+struct DualGemmEpilogueTypes {
+  using Arguments = typename CollectiveEpilogue::Arguments;
+  using Params = typename CollectiveEpilogue::Params;
+  using TensorStorage = typename CollectiveEpilogue::TensorStorage;
+};
+
+template <>
+struct DualGemmEpilogueTypes<void> {
+  struct Arguments {};
+  struct Params {};
+  struct TensorStorage {};
+};
+
+} // namespace detail
+
 template <
   class ProblemShape_,
   class DualGemmMainloop_,
@@ -100,19 +119,26 @@ public:
   // Epilogue derived types
   using CollectiveEpilogue0 = CollectiveEpilogue0_;
   using CollectiveEpilogue1 = CollectiveEpilogue1_;
-  using ElementC = typename CollectiveEpilogue0::ElementC;
-  using StrideC  = typename CollectiveEpilogue0::StrideC;
-  using ElementD = typename CollectiveEpilogue0::ElementD;
-  using StrideD  = typename CollectiveEpilogue0::StrideD;
-  using EpilogueArguments0 = typename CollectiveEpilogue0::Arguments;
-  using EpilogueArguments1 = typename CollectiveEpilogue1::Arguments;
-  using EpilogueParams0 = typename CollectiveEpilogue0::Params;
-  using EpilogueParams1 = typename CollectiveEpilogue1::Params;
-
   using DualGemmElemActEpilogue = DualGemmElemActEpilogue_;
+
+  // Without per-GEMM epilogues D0 and D1 are never written; only the elementwise result is stored
+  static constexpr bool HasGemmEpilogues = not cute::is_void_v<CollectiveEpilogue0>;
+  static_assert(HasGemmEpilogues == not cute::is_void_v<CollectiveEpilogue1>,
+    "CollectiveEpilogue0 and CollectiveEpilogue1 must either both be set or both be void.");
+  using PrimaryEpilogue = cute::conditional_t<HasGemmEpilogues, CollectiveEpilogue0, DualGemmElemActEpilogue>;
+
+  using ElementC = typename PrimaryEpilogue::ElementC;
+  using StrideC  = typename PrimaryEpilogue::StrideC;
+  using ElementD = typename PrimaryEpilogue::ElementD;
+  using StrideD  = typename PrimaryEpilogue::StrideD;
+  using EpilogueArguments0 = typename detail::DualGemmEpilogueTypes<CollectiveEpilogue0>::Arguments;
+  using EpilogueArguments1 = typename detail::DualGemmEpilogueTypes<CollectiveEpilogue1>::Arguments;
+  using EpilogueParams0 = typename detail::DualGemmEpilogueTypes<CollectiveEpilogue0>::Params;
+  using EpilogueParams1 = typename detail::DualGemmEpilogueTypes<CollectiveEpilogue1>::Params;
+
   using DualGemmElemActEpilogueArguments = typename DualGemmElemActEpilogue::Arguments;
   using DualGemmElemActEpilogueParams = typename DualGemmElemActEpilogue::Params;
-  static_assert(cute::is_same_v<ElementAccumulator, typename CollectiveEpilogue0::ElementAccumulator>,
+  static_assert(cute::is_same_v<ElementAccumulator, typename PrimaryEpilogue::ElementAccumulator>,
     "Mainloop and epilogue do not agree on accumulator value type.");
 
   // MSVC requires the cast to fix a warning-as-error.
@@ -131,8 +157,8 @@ public:
 
   // Kernel level shared memory storage
   struct SharedStorage {
-    using EpilogueTensorStorage0 = typename CollectiveEpilogue0::TensorStorage;
-    using EpilogueTensorStorage1 = typename CollectiveEpilogue1::TensorStorage;
+    using EpilogueTensorStorage0 = typename detail::DualGemmEpilogueTypes<CollectiveEpilogue0>::TensorStorage;
+    using EpilogueTensorStorage1 = typename detail::DualGemmEpilogueTypes<CollectiveEpilogue1>::TensorStorage;
     EpilogueTensorStorage0 epilogue0;
     EpilogueTensorStorage1 epilogue1;
   };
@@ -175,12 +201,18 @@ public:
     auto mainloop_args = DualGemmMainloop::to_underlying_arguments(args.problem_shape, args.mainloop, workspace);
     TileSchedulerParams scheduler = TileScheduler::to_underlying_arguments(
       problem_shape_MNKL, TileShape{}, ClusterShape{}, args.hw_info, args.scheduler, &workspace);
+    EpilogueParams0 epilogue0{};
+    EpilogueParams1 epilogue1{};
+    if constexpr (HasGemmEpilogues) {
+      epilogue0 = CollectiveEpilogue0::to_underlying_arguments(args.problem_shape, args.epilogue0, workspace);
+      epilogue1 = CollectiveEpilogue1::to_underlying_arguments(args.problem_shape, args.epilogue1, workspace);
+    }
     return {
       args.mode,
       args.problem_shape,
       mainloop_args,
-      CollectiveEpilogue0::to_underlying_arguments(args.problem_shape, args.epilogue0, workspace),
-      CollectiveEpilogue1::to_underlying_arguments(args.problem_shape, args.epilogue1, workspace),
+      epilogue0,
+      epilogue1,
       DualGemmElemActEpilogue::to_underlying_arguments(args.problem_shape, args.elem_act_epilogue, workspace),
       args.hw_info,
       scheduler
@@ -195,6 +227,10 @@ public:
     // TODO(codeplay): base *_valid on the atom shapes
     bool m_valid = m > 0;
     bool n_valid = n > 0 && n % 4 == 0;
+    if constexpr (DualGemmMainloop::InterleavedB) {
+      // Gate and up column blocks must line up with the workgroup tiles
+      n_valid = n_valid && n % get<1>(TileShape{}) == 0;
+    }
     bool k_valid = k > 0 && k % get<2>(TileShape{}) == 0;
     bool shape_implementable = (m_valid && n_valid && k_valid);
 
@@ -233,7 +269,7 @@ public:
   CUTLASS_DEVICE
   void
   operator()(Params const& params, char* smem_buf) {
-    SharedStorage& shared_storage = *reinterpret_cast<SharedStorage*>(smem_buf);
+    [[maybe_unused]] SharedStorage& shared_storage = *reinterpret_cast<SharedStorage*>(smem_buf);
     // Preconditions
     CUTE_STATIC_ASSERT(is_static<WorkgroupTileShape>::value);
 
@@ -270,10 +306,13 @@ public:
     constexpr auto subgroup_shape = SubgroupTileShape{};                   
 
     Tensor mA_mkl = cute::get_xe_tensor(make_shape(M,K,L));   //(m,k,l)
-    Tensor mB_nkl = cute::get_xe_tensor(make_shape(N,K,L));   //(n,k,l)
+    // An interleaved B holds the B0 and B1 blocks of output tile n at tiles 2n and 2n+1 of a (2N,K) tensor
+    constexpr int BTilesPerN = DualGemmMainloop::InterleavedB ? 2 : 1;
+    Tensor mB_nkl = cute::get_xe_tensor(make_shape(BTilesPerN * N,K,L));   //(n,k,l)
 
     Tensor gA = local_tile(mA_mkl, select<0,2>(blk_shape), make_coord(m_coord,_,l_coord));
-    Tensor gB = local_tile(mB_nkl, select<1,2>(blk_shape), make_coord(n_coord,_,l_coord));
+    Tensor gB0 = local_tile(mB_nkl, select<1,2>(blk_shape), make_coord(BTilesPerN * n_coord,_,l_coord));
+    Tensor gB1 = local_tile(mB_nkl, select<1,2>(blk_shape), make_coord(BTilesPerN * n_coord + BTilesPerN - 1,_,l_coord));
 
     // Compute tile residues for predication
     auto m_max_coord = M - get<0>(subgroup_shape) * m_coord;                             // M - SUB_M * m_coord
@@ -298,7 +337,8 @@ public:
       accumulators0,
       accumulators1,
       gA,
-      gB,
+      gB0,
+      gB1,
       k_tile_iter, k_tile_count,
       residue_mnk,
       blk_coord_mnkl,
@@ -308,29 +348,31 @@ public:
       params.mainloop
     );
 
-    CollectiveEpilogue0 epilogue0{params.epilogue0, shared_storage.epilogue0};
-    epilogue0(
-      problem_shape_MNKL,
-      subgroup_shape,
-      blk_coord_mnkl,
-      accumulators0,
-      tiled_mma,
-      residue_mnk,
-      thread_idx,
-      smem_buf
-    );
-
-    CollectiveEpilogue1 epilogue1{params.epilogue1, shared_storage.epilogue1};
-    epilogue1(
-      problem_shape_MNKL,
-      subgroup_shape,
-      blk_coord_mnkl,
-      accumulators1,
-      tiled_mma,
-      residue_mnk,
-      thread_idx,
-      smem_buf
-    );
+    if constexpr (HasGemmEpilogues) {
+      CollectiveEpilogue0 epilogue0{params.epilogue0, shared_storage.epilogue0};
+      epilogue0(
+        problem_shape_MNKL,
+        subgroup_shape,
+        blk_coord_mnkl,
+        accumulators0,
+        tiled_mma,
+        residue_mnk,
+        thread_idx,
+        smem_buf
+      );
+
+      CollectiveEpilogue1 epilogue1{params.epilogue1, shared_storage.epilogue1};
+      epilogue1(
+        problem_shape_MNKL,
+        subgroup_shape,
+        blk_coord_mnkl,
+        accumulators1,
+        tiled_mma,
+        residue_mnk,
+        thread_idx,
+        smem_buf
+      );
+    }
 
     DualGemmElemActEpilogue elem_act_epilogue{params.elem_act_epilogue};
     elem_act_epilogue(
@@ -153,11 +153,26 @@ struct FlashDecodeMma<gemm::MainloopIntelXeXMX16<Stages>, ProblemShapeType_, Ele
 
   template <typename T>
   static constexpr bool is_fp8_v = cute::is_any_of_v<T, float_e4m3_t, float_e5m2_t>;
+  template <typename T>
+  static constexpr bool is_quant_v = cute::is_any_of_v<T, int8_t, uint8_t, int4_t, uint4_t>;
+  static_assert(!is_quant_v<ElementQ>, "Integer Q is not supported, only K and V can be quantized.");
+  // The legacy Xe copy atoms have no 4-bit VNNI load, so V cannot be loaded in the PV MMA layout as INT4.
+  static_assert(sizeof_bits_v<ElementV> >= 8, "4-bit V is not supported, quantize V to INT8 (INT4 is supported for K only).");
+  static constexpr bool QuantKV = is_quant_v<ElementK> || is_quant_v<ElementV>;
   using traits_load_V = Copy_Traits<GmemTiledCopyV, StrideV>;
   using atom_load_V = Copy_Atom<traits_load_V, ElementV>;
   using val_layout_load_V = decltype(make_layout(shape_div(typename traits_load_V::BlockShape{}, CopyThreadShape{})));
   using XE_Copy_V = decltype(make_tiled_copy(atom_load_V{}, Layout<CopyThreadShape>{}, val_layout_load_V{}));
 
+  // Group-wise dequantization data of an INT8/INT4 K or INT8 V tensor. Every quant_group_size consecutive tokens
+  // of a KV head share one scale and one zero point, x = (q - zero) * scale. Both are stored row-major as
+  // [batch * num_heads_kv][quant_groups], with groups counted over the physical token index, so a paged cache
+  // has round_up(seq_len_kv_cache, page_size) / quant_group_size groups per row. A null ptr_zero means zero = 0.
+  struct KVGroupQuant {
+    float const* ptr_scale = nullptr;
+    float const* ptr_zero = nullptr;
+  };
+
   // Host side kernel arguments
   struct Arguments {
     ElementQ const *ptr_Q;
@@ -174,6 +189,17 @@ struct FlashDecodeMma<gemm::MainloopIntelXeXMX16<Stages>, ProblemShapeType_, Ele
     int const* ptr_page_table;
     int page_size;
     int const* num_pages_per_seq;
+    // Sliding window: each query attends to at most the window_size most recent keys. <= 0 disables it.
+    int window_size = 0;
+    // FP8 K/V dequantization scales, one per KV head. nullptr means a scale of 1.
+    float const* ptr_K_scale = nullptr;
+    float const* ptr_V_scale = nullptr;
+    // INT8/INT4 K/V group-wise dequantization, see KVGroupQuant.
+    KVGroupQuant quant_K{};
+    KVGroupQuant quant_V{};
+    KVGroupQuant quant_K_cache{};
+    KVGroupQuant quant_V_cache{};
+    int quant_group_size = 0;
   };
 
   struct Params {
@@ -186,6 +212,16 @@ struct FlashDecodeMma<gemm::MainloopIntelXeXMX16<Stages>, ProblemShapeType_, Ele
     int const* ptr_page_table;
     int page_size;
     int const* num_pages_per_seq;
+    int window_size;
+    float const* ptr_K_scale;
+    float const* ptr_V_scale;
+    KVGroupQuant quant_K;
+    KVGroupQuant quant_V;
+    KVGroupQuant quant_K_cache;
+    KVGroupQuant quant_V_cache;
+    int quant_group_size;
+    int quant_groups;
+    int quant_groups_cache;
   };
 
   //
@@ -194,6 +230,16 @@ struct FlashDecodeMma<gemm::MainloopIntelXeXMX16<Stages>, ProblemShapeType_, Ele
 
   FlashDecodeMma() = default;
 
+  // Packed INT4 K/V are addressed through a sub-byte iterator so that element offsets are counted in nibbles.
+  template <class Element>
+  CUTLASS_HOST_DEVICE static constexpr auto make_kv_gmem_ptr(Element const* ptr) {
+    if constexpr (sizeof_bits_v<Element> < 8) {
+      return cute::subbyte_iterator<const Element>(ptr);
+    } else {
+      return make_gmem_ptr(ptr);
+    }
+  }
+
   static constexpr Params to_underlying_arguments(ProblemShapeType const &problem_shape, Arguments const &args,
                                                   void *workspace) {
     (void)workspace;
@@ -201,24 +247,57 @@ struct FlashDecodeMma<gemm::MainloopIntelXeXMX16<Stages>, ProblemShapeType_, Ele
     auto [batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, seq_len_kv_cache, head_size_qk, head_size_vo] = problem_shape;
 
     auto tensorQ = make_tensor(make_gmem_ptr(args.ptr_Q), make_layout(make_shape(seq_len_qo, head_size_qk, batch * num_heads_q), args.dQ));
-    auto tensorK = make_tensor(make_gmem_ptr(args.ptr_K), make_layout(make_shape(seq_len_kv, head_size_qk, batch * num_heads_kv), args.dK));
-    auto tensorV = make_tensor(make_gmem_ptr(args.ptr_V), make_layout(make_shape(head_size_vo, seq_len_kv, batch * num_heads_kv), args.dV));
-    auto tensorK_cache = make_tensor(make_gmem_ptr(args.ptr_K_cache), make_layout(make_shape(seq_len_kv_cache, head_size_qk, batch * num_heads_kv), args.dK_cache));
-    auto tensorV_cache = make_tensor(make_gmem_ptr(args.ptr_V_cache), make_layout(make_shape(head_size_vo, seq_len_kv_cache, batch * num_heads_kv), args.dV_cache));
+    auto tensorK = make_tensor(make_kv_gmem_ptr(args.ptr_K), make_layout(make_shape(seq_len_kv, head_size_qk, batch * num_heads_kv), args.dK));
+    auto tensorV = make_tensor(make_kv_gmem_ptr(args.ptr_V), make_layout(make_shape(head_size_vo, seq_len_kv, batch * num_heads_kv), args.dV));
+    auto tensorK_cache = make_tensor(make_kv_gmem_ptr(args.ptr_K_cache), make_layout(make_shape(seq_len_kv_cache, head_size_qk, batch * num_heads_kv), args.dK_cache));
+    auto tensorV_cache = make_tensor(make_kv_gmem_ptr(args.ptr_V_cache), make_layout(make_shape(head_size_vo, seq_len_kv_cache, batch * num_heads_kv), args.dV_cache));
 
     XE_Copy_Q copyQ{XE_Copy_Q{}.with(tensorQ)};
     XE_Copy_K copyK{XE_Copy_K{}.with(tensorK)};
     XE_Copy_V copyV{XE_Copy_V{}.with(tensorV)};
     XE_Copy_K copyK_cache{XE_Copy_K{}.with(tensorK_cache)};
     XE_Copy_V copyV_cache{XE_Copy_V{}.with(tensorV_cache)};
+
+    // Varlen shapes convert to their max length, which sizes the group rows of every batch.
+    int quant_groups = 0;
+    int quant_groups_cache = 0;
+    if (args.quant_group_size > 0) {
+      int seq_len_cache_physical = PagedKV ? cutlass::round_up(static_cast<int>(seq_len_kv_cache), args.page_size)
+                                           : static_cast<int>(seq_len_kv_cache);
+      quant_groups = ceil_div(static_cast<int>(seq_len_kv), args.quant_group_size);
+      quant_groups_cache = ceil_div(seq_len_cache_physical, args.quant_group_size);
+    }
   
-    return Params{copyQ, copyK, copyV, copyK_cache, copyV_cache, args.ptr_page_table, args.page_size, args.num_pages_per_seq};
+    return Params{copyQ, copyK, copyV, copyK_cache, copyV_cache, args.ptr_page_table, args.page_size, args.num_pages_per_seq, args.window_size,
+                  args.ptr_K_scale, args.ptr_V_scale, args.quant_K, args.quant_V, args.quant_K_cache, args.quant_V_cache,
+                  args.quant_group_size, quant_groups, quant_groups_cache};
+  }
+
+  // FP8 K/V tiles are widened to the MMA input type in registers. Their per-head scales are folded into
+  // the S accumulator (K) and into P (V) rather than into every dequantized element.
+  CUTLASS_DEVICE static float kv_scale(float const* ptr_scale, int kv_head) {
+    return ptr_scale == nullptr ? 1.f : ptr_scale[kv_head];
+  }
+
+  // Scale and zero point of the group holding `token` of row quant_l (batch * num_heads_kv + kv_head).
+  // Tokens past the last group belong to masked or out-of-bounds columns and get the identity.
+  CUTLASS_DEVICE static cute::tuple<float, float> group_scale_zero(Params const& params, bool is_KV_cache, bool is_V,
+                                                                   int quant_l, int token) {
+    auto const& quant = is_V ? (is_KV_cache ? params.quant_V_cache : params.quant_V)
+                             : (is_KV_cache ? params.quant_K_cache : params.quant_K);
+    int groups = is_KV_cache ? params.quant_groups_cache : params.quant_groups;
+    int group = token / params.quant_group_size;
+    if (group >= groups) {
+      return cute::make_tuple(1.f, 0.f);
+    }
+    int idx = quant_l * groups + group;
+    return cute::make_tuple(quant.ptr_scale[idx], quant.ptr_zero == nullptr ? 0.f : quant.ptr_zero[idx]);
   }
 
   template <class FragAccum, class TensorQ, class TensorK, class FragSrc>
   CUTLASS_DEVICE void mmaQK(FragAccum &accum, TensorQ gQ, TensorK gK, FragSrc const &frag_src,
                             int const &k_tile_count, Params const &params, bool is_KV_cache,
-                            int const& kv_tile_idx) {
+                            int const& kv_tile_idx, float const k_scale = 1.f, int const quant_l = 0, int const quant_token = 0) {
 
     auto& gmem_tiled_copy_k = is_KV_cache ? params.gmem_tiled_copy_k_cache : params.gmem_tiled_copy_k;
 
@@ -242,7 +321,7 @@ struct FlashDecodeMma<gemm::MainloopIntelXeXMX16<Stages>, ProblemShapeType_, Ele
 
     // Create fragments
     using TCrQ_Type = cute::conditional_t<is_fp8_v<ElementQ>, uint8_t, ElementQ>;
-    using TCrK_Type = cute::conditional_t<is_fp8_v<ElementQ>, uint8_t, ElementK>;
+    using TCrK_Type = cute::conditional_t<is_fp8_v<ElementK>, uint8_t, ElementK>;
     Tensor tCrQ = make_tensor<TCrQ_Type>(make_fragment_layout(params.gmem_tiled_copy_q, take<0,3>(tCgQ.shape())));
     Tensor tCrK = make_tensor<TCrK_Type>(make_fragment_layout(gmem_tiled_copy_k, take<0,3>(tCgK.shape())));
 
@@ -279,6 +358,19 @@ struct FlashDecodeMma<gemm::MainloopIntelXeXMX16<Stages>, ProblemShapeType_, Ele
   #undef PRINT
 #endif
 
+    // INT8/INT4 keys are dequantized in registers. Each N fragment of K holds one token per work-item
+    // (token = quant_token + n * MMA_N + lane), so its scale and zero point are loaded once up front.
+    constexpr int FragsNK = decltype(size<1>(tCrK))::value;
+    cute::array<float, FragsNK> k_group_scale;
+    cute::array<float, FragsNK> k_group_zero;
+    if constexpr (is_quant_v<ElementK>) {
+      int token = quant_token + static_cast<int>(sg.get_local_id()[0]);
+      CUTLASS_PRAGMA_UNROLL
+      for (int n = 0; n < FragsNK; ++n, token += get<1>(MmaAtomShape())) {
+        cute::tie(k_group_scale[n], k_group_zero[n]) = group_scale_zero(params, is_KV_cache, false, quant_l, token);
+      }
+    }
+
     //
     // Mainloop
     //
@@ -286,30 +378,51 @@ struct FlashDecodeMma<gemm::MainloopIntelXeXMX16<Stages>, ProblemShapeType_, Ele
     for (int k_tile = 0; k_tile < k_tile_count; ++k_tile) {
       copy(params.gmem_tiled_copy_q, tQgQ(_,_,_,k_tile), tQrQ);
       copy(gmem_tiled_copy_k, tKgK(_,_,_,k_tile), tKrK);
-      if constexpr (is_fp8_v<ElementQ> && is_fp8_v<ElementK>) {
-        auto tCrQ_ = make_fragment_like<half_t>(tCrQ);
+      if constexpr (is_quant_v<ElementK>) {
+        using MmaTypeK = typename TiledMmaQK::ValTypeB;
+        auto tCrK_ = make_fragment_like<MmaTypeK>(tCrK);
+        CUTLASS_PRAGMA_UNROLL
+        for (int n = 0; n < FragsNK; ++n) {
+          auto tCrK_n = tCrK(_, n, _);
+          auto tCrK_n_ = tCrK_(_, n, _);
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < size(tCrK_n); ++i) {
+            float q = static_cast<float>(static_cast<ElementK>(tCrK_n(i)));
+            tCrK_n_(i) = static_cast<MmaTypeK>((q - k_group_zero[n]) * k_group_scale[n]);
+          }
+        }
+        cute::gemm(tiled_mma, accum, tCrQ, tCrK_, frag_src);
+      } else if constexpr (is_fp8_v<ElementQ> && is_fp8_v<ElementK>) {
+        auto tCrQ_ = make_fragment_like<typename TiledMmaQK::ValTypeA>(tCrQ);
         convert_FP8_to_FP16<ElementQ>(tCrQ, tCrQ_);
-        auto tCrK_ = make_fragment_like<half_t>(tCrK);
+        auto tCrK_ = make_fragment_like<typename TiledMmaQK::ValTypeB>(tCrK);
         convert_FP8_to_FP16<ElementK>(tCrK, tCrK_);
         cute::gemm(tiled_mma, accum, tCrQ_, tCrK_, frag_src);
       } else if constexpr (is_fp8_v<ElementQ> && !is_fp8_v<ElementK>) {
-        auto tCrQ_ = make_fragment_like<half_t>(tCrQ);
+        auto tCrQ_ = make_fragment_like<typename TiledMmaQK::ValTypeA>(tCrQ);
         convert_FP8_to_FP16<ElementQ>(tCrQ, tCrQ_);
         cute::gemm(tiled_mma, accum, tCrQ_ , tCrK, frag_src);
       } else if constexpr (!is_fp8_v<ElementQ> && is_fp8_v<ElementK>) {
-        auto tCrK_ = make_fragment_like<half_t>(tCrK);
+        auto tCrK_ = make_fragment_like<typename TiledMmaQK::ValTypeB>(tCrK);
         convert_FP8_to_FP16<ElementK>(tCrK, tCrK_);
         cute::gemm(tiled_mma, accum, tCrQ , tCrK_, frag_src);
       } else {
         cute::gemm(tiled_mma, accum, tCrQ , tCrK, frag_src);
       }
     }
+
+    if constexpr (is_fp8_v<ElementK>) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(accum); ++i) {
+        accum(i) *= k_scale;
+      }
+    }
   }
 
   template <int tile_count, class FragAccum, class FragS, class TensorV, class FragSrc>
   CUTLASS_DEVICE void mmaPV(FragAccum &accum, FragS const &tSr, TensorV gV,
                             FragSrc const &frag_src, Params const &params, bool is_KV_cache,
-                            int const& kv_tile_idx) {
+                            int const& kv_tile_idx, float const v_scale = 1.f, int const quant_l = 0, int const quant_token = 0) {
 
     auto& gmem_tiled_copy_v = is_KV_cache ? params.gmem_tiled_copy_v_cache : params.gmem_tiled_copy_v;
 
@@ -348,6 +461,31 @@ struct FlashDecodeMma<gemm::MainloopIntelXeXMX16<Stages>, ProblemShapeType_, Ele
 
     // 7) Convert S to P (FP32 -> BF16)
     Tensor tPr = convert_type<typename TiledMmaPV::ValTypeA>(tSr);
+    if constexpr (is_fp8_v<ElementV>) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(tPr); ++i) {
+        tPr(i) = static_cast<typename TiledMmaPV::ValTypeA>(static_cast<float>(tPr(i)) * v_scale);
+      }
+    }
+
+    // INT8/INT4 values: V's groups run along the reduction dim, so the group scales are folded into P
+    // (column n of P is token quant_token + n * MMA_N + lane) and V only gets widened. The zero points give
+    // sum_t P'[t] * zero[t] per row, subtracted from every output column once the tile is done.
+    constexpr int RowsP = decltype(size<0>(tPr) * size<1>(tPr))::value;
+    cute::array<float, RowsP> v_zero_sum{};
+    if constexpr (is_quant_v<ElementV>) {
+      int token = quant_token + static_cast<int>(sg.get_local_id()[0]);
+      CUTLASS_PRAGMA_UNROLL
+      for (int n = 0; n < size<2>(tPr); ++n, token += get<1>(MmaAtomShape())) {
+        auto [scale, zero] = group_scale_zero(params, is_KV_cache, true, quant_l, token);
+        CUTLASS_PRAGMA_UNROLL
+        for (int r = 0; r < RowsP; ++r) {
+          auto& p = tPr(r % size<0>(tPr), r / size<0>(tPr), n);
+          p = static_cast<typename TiledMmaPV::ValTypeA>(static_cast<float>(tSr(r % size<0>(tPr), r / size<0>(tPr), n)) * scale);
+          v_zero_sum[r] += static_cast<float>(p) * zero;
+        }
+      }
+    }
 
     //
     // Mainloop
@@ -356,14 +494,34 @@ struct FlashDecodeMma<gemm::MainloopIntelXeXMX16<Stages>, ProblemShapeType_, Ele
     for(int v = 0; v < tile_count; v++) {
       int v_coord = v + (sg.get_group_id()[0] % ATOM_N) * ATOM_N;
       copy(gmem_tiled_copy_v, tVgV(_,_,_,v_coord), tVrV);
-      if constexpr (is_fp8_v<ElementV>) {
-        auto tCrV_ = make_fragment_like<half_t>(tCrV);
+      if constexpr (is_quant_v<ElementV>) {
+        using MmaTypeV = typename TiledMmaPV::ValTypeB;
+        auto tCrV_ = make_fragment_like<MmaTypeV>(tCrV);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(tCrV); ++i) {
+          tCrV_(i) = static_cast<MmaTypeV>(static_cast<float>(static_cast<ElementV>(tCrV(i))));
+        }
+        cute::gemm(tiled_mma, accum(_,_,_,v), tPr, tCrV_, frag_src(_,_,_,v));
+      } else if constexpr (is_fp8_v<ElementV>) {
+        auto tCrV_ = make_fragment_like<typename TiledMmaPV::ValTypeB>(tCrV);
         convert_FP8_to_FP16<ElementV>(tCrV, tCrV_);
         cute::gemm(tiled_mma, accum(_,_,_,v), tPr, tCrV_, frag_src(_,_,_,v));
       } else {
         cute::gemm(tiled_mma, accum(_,_,_,v), tPr, tCrV, frag_src(_,_,_,v));
       }    
     }
+
+    if constexpr (is_quant_v<ElementV>) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int r = 0; r < RowsP; ++r) {
+        float zero_sum = reduce_over_group(sg, v_zero_sum[r], sycl::plus<>());
+        auto accum_r = accum(r % size<0>(tPr), r / size<0>(tPr), _, _);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(accum_r); ++i) {
+          accum_r(i) -= zero_sum;
+        }
+      }
+    }
   }
 
   // SequenceLengthShape = Shape<int, int, int>
@@ -419,10 +577,10 @@ struct FlashDecodeMma<gemm::MainloopIntelXeXMX16<Stages>, ProblemShapeType_, Ele
       StrideV stride_v_cache = cutlass::make_cute_packed_stride(StrideV{}, shape_v_cache);
 
       auto tensorQ = make_tensor(make_gmem_ptr(q_ptr + offset_q), make_layout(shape_q, stride_q));
-      auto tensorK = make_tensor(make_gmem_ptr(k_ptr + offset_k), make_layout(shape_k, stride_k));
-      auto tensorV = make_tensor(make_gmem_ptr(v_ptr + offset_v), make_layout(shape_v, stride_v));
-      auto tensorK_cache = make_tensor(make_gmem_ptr(k_cache_ptr + offset_k_cache), make_layout(shape_k_cache, stride_k_cache));
-      auto tensorV_cache = make_tensor(make_gmem_ptr(v_cache_ptr + offset_v_cache), make_layout(shape_v_cache, stride_v_cache));
+      auto tensorK = make_tensor(make_kv_gmem_ptr(k_ptr) + offset_k, make_layout(shape_k, stride_k));
+      auto tensorV = make_tensor(make_kv_gmem_ptr(v_ptr) + offset_v, make_layout(shape_v, stride_v));
+      auto tensorK_cache = make_tensor(make_kv_gmem_ptr(k_cache_ptr) + offset_k_cache, make_layout(shape_k_cache, stride_k_cache));
+      auto tensorV_cache = make_tensor(make_kv_gmem_ptr(v_cache_ptr) + offset_v_cache, make_layout(shape_v_cache, stride_v_cache));
 
       XE_Copy_Q copyQ{XE_Copy_Q{}.with(tensorQ)};
       XE_Copy_K copyK{XE_Copy_K{}.with(tensorK)};
@@ -430,7 +588,9 @@ struct FlashDecodeMma<gemm::MainloopIntelXeXMX16<Stages>, ProblemShapeType_, Ele
       XE_Copy_K copyK_cache{XE_Copy_K{}.with(tensorK_cache)};
       XE_Copy_V copyV_cache{XE_Copy_V{}.with(tensorV_cache)};
 
-      return Params{copyQ, copyK, copyV, copyK_cache, copyV_cache, params.ptr_page_table, params.page_size, params.num_pages_per_seq};
+      return Params{copyQ, copyK, copyV, copyK_cache, copyV_cache, params.ptr_page_table, params.page_size, params.num_pages_per_seq, params.window_size,
+                    params.ptr_K_scale, params.ptr_V_scale, params.quant_K, params.quant_V, params.quant_K_cache, params.quant_V_cache,
+                    params.quant_group_size, params.quant_groups, params.quant_groups_cache};
     }
   }
 };
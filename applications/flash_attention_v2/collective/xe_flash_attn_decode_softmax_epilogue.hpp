@@ -41,6 +41,7 @@
 #include "cutlass/epilogue/collective/collective_epilogue.hpp"
 #include "cutlass/epilogue/collective/detail.hpp"
 #include "cutlass/detail/layout.hpp"
+#include "flash_attention_v2/collective/xe_flash_attn_score_mod.hpp"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -55,8 +56,8 @@ template <bool CausalMask_, class DispatchPolicy, class... Args> class FlashDeco
 };
 
 
-template <bool CausalMask_, class Element_>
-class FlashDecodeSoftmaxEpilogue<CausalMask_, epilogue::IntelXeXMX16, Element_> {
+template <bool CausalMask_, class Element_, class ScoreMod_>
+class FlashDecodeSoftmaxEpilogue<CausalMask_, epilogue::IntelXeXMX16, Element_, ScoreMod_> {
 public:
 
   //
@@ -67,15 +68,22 @@ public:
 
   static constexpr bool CausalMask = CausalMask_;
 
+  // Applied to S before the max/sum reductions, see xe_flash_attn_score_mod.hpp
+  using ScoreMod = ScoreMod_;
+
   using GmemTiledCopyOut = void;
 
   // Host side epilogue arguments
   struct Arguments {
     Element const scale;
+    typename ScoreMod::Arguments score_mod{};
   };
 
   // Device side epilogue params
-  using Params = Arguments;
+  struct Params {
+    Element scale;
+    typename ScoreMod::Params score_mod;
+  };
 
   //
   // Methods
@@ -84,7 +92,7 @@ public:
   static constexpr Params to_underlying_arguments(Arguments const &args) {
     constexpr double kLog2e = 1.4426950408889634074; // log_2(e) = M_LOG2E
     Element val = args.scale * static_cast<Element>(kLog2e);
-    return Params{val};
+    return Params{val, ScoreMod::to_underlying_arguments(args.score_mod, static_cast<float>(args.scale))};
   }
 
   template <class ProblemShape>
@@ -188,9 +196,23 @@ public:
     }
   }
 
+  // Element (v, m, n) of frag_s holds query row_base + m * Vec + v and key col_base + n * ColStride.
+  template <int ColStride, class FragAcc>
+  CUTLASS_DEVICE void apply_score_mod(FragAcc &frag_s, int row_base, int col_base, int head) {
+    cutlass::flash_attention::collective::apply_score_mod<ScoreMod, ColStride>(params.score_mod, frag_s, row_base, col_base, head);
+  }
+
   Params params;
 };
 
+template <bool CausalMask_, class Element_>
+class FlashDecodeSoftmaxEpilogue<CausalMask_, epilogue::IntelXeXMX16, Element_>
+    : public FlashDecodeSoftmaxEpilogue<CausalMask_, epilogue::IntelXeXMX16, Element_, NoScoreMod> {
+  using Base = FlashDecodeSoftmaxEpilogue<CausalMask_, epilogue::IntelXeXMX16, Element_, NoScoreMod>;
+public:
+  using Base::Base;
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 } // namespace collective
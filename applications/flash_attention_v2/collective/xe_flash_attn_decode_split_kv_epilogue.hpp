@@ -0,0 +1,306 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 Codeplay Software Ltd. All rights reserved.
+ * Copyright (C) 2025 Intel Corporation, All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Epilogue for split-KV (flash-decoding) attention: stores the partial output, max and exp-sum of
+         every KV partition to workspace and merges them with a log-sum-exp reduction.
+*/
+
+#pragma once
+
+#include <sycl/sycl.hpp>
+#include "cutlass/cutlass.h"
+#include "cutlass/epilogue/dispatch_policy.hpp"
+#include "cutlass/epilogue/collective/collective_epilogue.hpp"
+#include "cutlass/epilogue/collective/detail.hpp"
+#include "cutlass/detail/layout.hpp"
+#include "flash_attention_v2/collective/fmha_fusion.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace flash_attention {
+namespace collective {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class DispatchPolicy, class MMAOp_, class TileShapeOutput_, class SubgroupLayout_, class... Args> class FlashDecodeSplitKVEpilogue {
+  static_assert(cutlass::detail::dependent_false<DispatchPolicy>, "Could not find an epilogue specialization.");
+};
+
+template <class MMAOp_, class TileShapeOutput_, class SubgroupLayout_, class ElementCompute_, class ElementO_, class StrideO_, class ElementLSE_, class CopyOpO_>
+class FlashDecodeSplitKVEpilogue<epilogue::IntelXeXMX16, MMAOp_, TileShapeOutput_, SubgroupLayout_, ElementCompute_, ElementO_, StrideO_, ElementLSE_, CopyOpO_> {
+public:
+  //
+  // Type Aliases
+  //
+  using DispatchPolicy = epilogue::IntelXeXMX16;
+  using ElementO = ElementO_;
+  using StrideO = StrideO_;
+  using ElementLSE = ElementLSE_;
+  using CopyOpO = CopyOpO_;
+
+  using SubgroupLayout = SubgroupLayout_;
+  using TileShapeOutput = TileShapeOutput_;
+  using MmaAtom = MMA_Atom<MMAOp_>;
+  using MmaAtomShape = typename MmaAtom::Shape_MNK;
+  using TiledMmaOutput = typename TiledMMAHelper<MmaAtom, Layout<TileShapeOutput>, SubgroupLayout>::TiledMMA;
+
+  static constexpr int ATOM_M = get<1>(typename TiledMmaOutput::ThrLayoutVMNK{}.shape());
+  static constexpr int ATOM_N = get<2>(typename TiledMmaOutput::ThrLayoutVMNK{}.shape());
+  static constexpr int SubgroupSize = DispatchPolicy::SubgroupSize;
+
+  using SubgroupTileShape = decltype(cute::make_shape(get<0>(TileShapeOutput{}), Int<get<1>(TileShapeOutput{}) / ATOM_N>{}, Int<get<2>(TileShapeOutput{}) / ATOM_M>{}));
+  using FragsShape = decltype(cute::shape_div(take<0, 2>(SubgroupTileShape{}), take<0, 2>(MmaAtomShape())));
+  static constexpr int Vec = (get<0>(MmaAtomShape()) * get<1>(MmaAtomShape())) / SubgroupSize; // 8
+  static constexpr int FragsM = get<0>(FragsShape{});
+  static constexpr int FragsN = get<1>(FragsShape{});
+
+  using GmemTiledCopyO = CopyOpO;
+  using ElementOutput = ElementO_;
+  using ElementCompute = ElementCompute_;
+  using ElementAccumulator = ElementCompute_;
+
+  static_assert(cute::rank(TileShapeOutput{}) == 3, "TileShapeOutput must be rank-3: [CTA_M_Q, CTA_N_O, CTA_K_PV]");
+  static_assert(cute::rank(StrideO{}) == 3, "StrideO must be rank-3: [seq_len_qo, head_size_vo, batch * num_heads]");
+  static_assert(Vec * FragsM == 1, "Split-KV decode stores one query row per work-group.");
+
+  using EmptyType = cute::tuple<>;
+
+  struct TensorStorageImpl : cute::tuple<EmptyType, EmptyType> {};
+
+  struct SharedStorage {
+    using TensorStorage = TensorStorageImpl;
+
+    TensorStorage tensors;
+  };
+  using TensorStorage = typename SharedStorage::TensorStorage;
+
+  // Host side epilogue arguments
+  struct Arguments {
+    ElementO const *ptr_O;
+    StrideO dO;
+  };
+
+  // Device side epilogue params
+  struct Params {
+    ElementO *ptr_O;
+    StrideO dO;
+    // Workspace, indexed by ((batch * num_heads_q + head) * seq_len_qo + row) * num_partitions + partition
+    ElementAccumulator *ptr_partial_O;    // [..., head_size_vo]
+    ElementAccumulator *ptr_partial_max;  // running max, already multiplied by the log2 softmax scale
+    ElementAccumulator *ptr_partial_sum;
+    int num_partitions;
+  };
+
+  //
+  // Methods
+  //
+
+  template <class ProblemShape>
+  static size_t get_num_partial_rows(ProblemShape const &problem_shape, int num_partitions) {
+    auto [batch, num_heads_q, seq_len_qo] = select<0, 1, 3>(problem_shape);
+    return static_cast<size_t>(batch) * num_heads_q * static_cast<int>(seq_len_qo) * num_partitions;
+  }
+
+  template <class ProblemShape>
+  static Params to_underlying_arguments(ProblemShape const &problem_shape, Arguments const &args,
+                                        void *workspace, int num_partitions) {
+    auto head_size_vo = get<7>(problem_shape);
+    size_t num_rows = get_num_partial_rows(problem_shape, num_partitions);
+
+    auto ptr_partial_O = reinterpret_cast<ElementAccumulator *>(workspace);
+    auto ptr_partial_max = ptr_partial_O + num_rows * head_size_vo;
+    auto ptr_partial_sum = ptr_partial_max + num_rows;
+    return {const_cast<ElementO *>(args.ptr_O), args.dO, ptr_partial_O, ptr_partial_max, ptr_partial_sum, num_partitions};
+  }
+
+  template <class ProblemShape>
+  static size_t get_workspace_size(ProblemShape const &problem_shape, Arguments const &args, int num_partitions) {
+    auto head_size_vo = get<7>(problem_shape);
+    return get_num_partial_rows(problem_shape, num_partitions) * (head_size_vo + 2) * sizeof(ElementAccumulator);
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status initialize_workspace(ProblemShape const &problem_shape, Arguments const &args, void *workspace,
+                                              cudaStream_t stream, CudaHostAdapter *cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  template <class ProblemShape>
+  CUTLASS_HOST_DEVICE static bool can_implement(ProblemShape const &problem_shape,
+                                                [[maybe_unused]] Arguments const &args) {
+    return true;
+  }
+
+  CUTLASS_HOST_DEVICE
+  FlashDecodeSplitKVEpilogue(Params const &params_, TensorStorage const &) : params(params_) {}
+
+  // Reduces the work-group's partial output like FlashDecodeEpilogue, but stores it unnormalized together
+  // with the partition's max and exp-sum instead of writing O.
+  template <class ProblemShape, class SequenceLengthShape, class TileCoord, class STensorOut, class FragMax, class FragSum, class STensorSum>
+  CUTLASS_DEVICE void operator()(ProblemShape problem_shape, SequenceLengthShape sequence_length_shape, TileCoord tile_coord,
+                                 int batch_head_coord, int partition, STensorOut &shmem_tensor_out, FragMax const &max_scaled,
+                                 FragSum &sum, STensorSum& shmem_tensor_sum) {
+
+    using namespace cute;
+
+    auto sg = compat::get_nd_item<1>().get_sub_group();
+    auto group = compat::get_nd_item<1>().get_group();
+    const int sg_local_id = sg.get_local_id()[0];
+    const int sg_group_id = sg.get_group_id()[0];
+
+    auto cur_sum = reduce_over_group(sg, sum, sycl::plus<>());
+
+    if(sg_local_id == 0) {
+      shmem_tensor_sum(sg_group_id) = cur_sum;
+    }
+
+    sycl::group_barrier(group);
+
+    if(sg_group_id==0) {
+
+      ElementCompute cur_sum = ElementCompute{0};
+      CUTLASS_PRAGMA_UNROLL
+      for(int i = 0; i < ATOM_M; i++) {
+          cur_sum += shmem_tensor_sum(i);
+      }
+
+      auto [seq_len_qo_max, head_size_vo] = select<3, 7>(problem_shape);
+      auto [seq_len_qo] = select<0>(sequence_length_shape);
+      auto [m_coord, n_coord, k_coord, l_coord] = tile_coord;
+
+      const int row = m_coord * get<0>(TileShapeOutput{});
+      if (row >= seq_len_qo) {
+        return;
+      }
+
+      const int64_t partial_row = (static_cast<int64_t>(batch_head_coord) * static_cast<int>(seq_len_qo_max) + row) *
+                                  params.num_partitions + partition;
+      ElementAccumulator *partial_O = params.ptr_partial_O + partial_row * head_size_vo;
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int z = 0; z < FragsN; z++) {
+        const int slm_curr_idx = sg_local_id + z * SubgroupSize;
+
+        ElementCompute out_val_curr = ElementCompute{0};
+        CUTLASS_PRAGMA_UNROLL
+        for(int i = 0; i < ATOM_M; i++) {
+            out_val_curr += shmem_tensor_out(slm_curr_idx + i * (Vec * FragsM * FragsN) * SubgroupSize);
+        }
+
+        const int col = n_coord * get<1>(TileShapeOutput{}) + slm_curr_idx;
+        if (col < head_size_vo) {
+          partial_O[col] = out_val_curr;
+        }
+      }
+
+      if (sg_local_id == 0) {
+        params.ptr_partial_max[partial_row] = max_scaled;
+        params.ptr_partial_sum[partial_row] = cur_sum;
+      }
+    }
+  }
+
+  // Merges the partitions of one query row with a log-sum-exp reduction and writes the normalized output.
+  // Threads of the work-group stride over head_size_vo.
+  template <class ProblemShape>
+  CUTLASS_DEVICE static void combine(Params const &params, ProblemShape const &problem_shape, int batch_head_coord,
+                                     int row, int thread_idx, int num_threads) {
+    using namespace cute;
+    static constexpr bool is_var_len = cutlass::fmha::collective::is_variable_length_v<tuple_element_t<3, ProblemShape>>;
+
+    auto [num_heads_q, seq_len_qo_max, head_size_vo] = select<1, 3, 7>(problem_shape);
+    const int batch_coord = batch_head_coord / num_heads_q;
+    const int head_coord = batch_head_coord % num_heads_q;
+
+    int seq_len_qo = seq_len_qo_max;
+    ElementO *ptr_O = params.ptr_O;
+    int64_t stride_row = get<0>(params.dO);
+    int64_t stride_head = get<2>(params.dO);
+    if constexpr (is_var_len) {
+      // Same packed [num_heads_q, seq_len_qo, head_size_vo] layout per batch as FlashDecodeEpilogue::get_updated_copies
+      auto qo_cumulative_length = get<3>(problem_shape).cumulative_length;
+      seq_len_qo = qo_cumulative_length[batch_coord + 1] - qo_cumulative_length[batch_coord];
+      ptr_O += static_cast<int64_t>(num_heads_q) * head_size_vo * qo_cumulative_length[batch_coord];
+      stride_row = head_size_vo;
+      stride_head = static_cast<int64_t>(seq_len_qo) * head_size_vo;
+    } else {
+      ptr_O += static_cast<int64_t>(batch_coord) * num_heads_q * stride_head;
+    }
+
+    if (row >= seq_len_qo) {
+      return;
+    }
+
+    const int64_t partial_row = (static_cast<int64_t>(batch_head_coord) * static_cast<int>(seq_len_qo_max) + row) * params.num_partitions;
+    ElementAccumulator const *partial_max = params.ptr_partial_max + partial_row;
+    ElementAccumulator const *partial_sum = params.ptr_partial_sum + partial_row;
+    ElementAccumulator const *partial_O = params.ptr_partial_O + partial_row * head_size_vo;
+
+    ElementAccumulator global_max = ElementAccumulator{-INFINITY};
+    for (int p = 0; p < params.num_partitions; p++) {
+      global_max = sycl::max(global_max, partial_max[p]);
+    }
+
+    // Partitions without any unmasked score have max == -inf and contribute nothing
+    auto rescale = [&](int p) {
+      return partial_max[p] == ElementAccumulator{-INFINITY} ? ElementAccumulator{0}
+                                                              : sycl::native::exp2(partial_max[p] - global_max);
+    };
+
+    ElementAccumulator global_sum = ElementAccumulator{0};
+    for (int p = 0; p < params.num_partitions; p++) {
+      global_sum += partial_sum[p] * rescale(p);
+    }
+    auto cur_scale = (global_sum == 0.0f || global_sum != global_sum) ? 1.0f : sycl::native::recip(global_sum);
+
+    ElementO *out = ptr_O + row * stride_row + head_coord * stride_head;
+    for (int col = thread_idx; col < head_size_vo; col += num_threads) {
+      ElementAccumulator out_val = ElementAccumulator{0};
+      for (int p = 0; p < params.num_partitions; p++) {
+        out_val += partial_O[p * head_size_vo + col] * rescale(p);
+      }
+      out[col * get<1>(params.dO)] = static_cast<ElementOutput>(out_val * cur_scale);
+    }
+  }
+
+private:
+  Params const &params;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace collective
+} // namespace flash_attention
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -158,12 +158,15 @@ struct FlashPrefillMma<gemm::MainloopIntelXeXMX16<Stages>, ProblemShapeType_, El
     StrideK dK;
     ElementV const *ptr_V;
     StrideV dV;
+    // Sliding window: each query attends to at most the window_size most recent keys. <= 0 disables it.
+    int window_size = 0;
   };
 
   struct Params {
     XE_Copy_Q gmem_tiled_copy_q;
     XE_Copy_K gmem_tiled_copy_k;
     XE_Copy_V gmem_tiled_copy_v;
+    int window_size;
   };
 
   //
@@ -185,7 +188,7 @@ struct FlashPrefillMma<gemm::MainloopIntelXeXMX16<Stages>, ProblemShapeType_, El
     XE_Copy_K copyK{XE_Copy_K{}.with(tensorK)};
     XE_Copy_V copyV{XE_Copy_V{}.with(tensorV)};
   
-    return Params{copyQ, copyK, copyV};
+    return Params{copyQ, copyK, copyV, args.window_size};
   }
 
   template <class FragQccum, class TensorQ, class TensorK, class FragSrc>
@@ -376,7 +379,7 @@ struct FlashPrefillMma<gemm::MainloopIntelXeXMX16<Stages>, ProblemShapeType_, El
       XE_Copy_K copyK{XE_Copy_K{}.with(tensorK)};
       XE_Copy_V copyV{XE_Copy_V{}.with(tensorV)};
 
-      return Params{copyQ, copyK, copyV};
+      return Params{copyQ, copyK, copyV, params.window_size};
     }
   }
 };
@@ -33,6 +33,7 @@
 
 #include "cutlass/cutlass.h"
 #include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/fp8_to_fp16.h"
 
 #include "cute/algorithm/functional.hpp"
 #include "cute/atom/mma_atom.hpp"
@@ -144,6 +145,8 @@ struct FlashPrefillCachedMma<gemm::MainloopIntelXeXMX16<Stages>, ProblemShapeTyp
   using val_layout_load_K = decltype(make_layout(shape_div(typename traits_load_K::BlockShape{}, CopyThreadShape{})));
   using XE_Copy_K = decltype(make_tiled_copy(atom_load_K{}, Layout<CopyThreadShape>{}, val_layout_load_K{}));
 
+  template <typename T>
+  static constexpr bool is_fp8_v = cute::is_any_of_v<T, float_e4m3_t, float_e5m2_t>;
   using traits_load_V = Copy_Traits<GmemTiledCopyV, StrideV>;
   using atom_load_V = Copy_Atom<traits_load_V, ElementV>;
   using val_layout_load_V = decltype(make_layout(shape_div(typename traits_load_V::BlockShape{}, CopyThreadShape{})));
@@ -165,6 +168,11 @@ struct FlashPrefillCachedMma<gemm::MainloopIntelXeXMX16<Stages>, ProblemShapeTyp
     int const* ptr_page_table;
     int page_size;
     int const* num_pages_per_seq;
+    // Sliding window: each query attends to at most the window_size most recent keys. <= 0 disables it.
+    int window_size = 0;
+    // FP8 K/V dequantization scales, one per KV head. nullptr means a scale of 1.
+    float const* ptr_K_scale = nullptr;
+    float const* ptr_V_scale = nullptr;
   };
 
   struct Params {
@@ -177,6 +185,9 @@ struct FlashPrefillCachedMma<gemm::MainloopIntelXeXMX16<Stages>, ProblemShapeTyp
     int const* ptr_page_table;
     int page_size;
     int const* num_pages_per_seq;
+    int window_size;
+    float const* ptr_K_scale;
+    float const* ptr_V_scale;
   };
 
   //
@@ -203,12 +214,39 @@ struct FlashPrefillCachedMma<gemm::MainloopIntelXeXMX16<Stages>, ProblemShapeTyp
     XE_Copy_K copyK_cache{XE_Copy_K{}.with(tensorK_cache)};
     XE_Copy_V copyV_cache{XE_Copy_V{}.with(tensorV_cache)};
 
-    return Params{copyQ, copyK, copyV, copyK_cache, copyV_cache, args.ptr_page_table, args.page_size, args.num_pages_per_seq};
+    return Params{copyQ, copyK, copyV, copyK_cache, copyV_cache, args.ptr_page_table, args.page_size, args.num_pages_per_seq, args.window_size,
+                  args.ptr_K_scale, args.ptr_V_scale};
+  }
+
+  // FP8 K/V tiles are widened to the MMA input type in registers. Their per-head scales are folded into
+  // the S accumulator (K) and into P (V) rather than into every dequantized element.
+  CUTLASS_DEVICE static float kv_scale(float const* ptr_scale, int kv_head) {
+    return ptr_scale == nullptr ? 1.f : ptr_scale[kv_head];
+  }
+
+  // Maps a logical KV cache tile to the tile of gK_cache/gV_cache holding it. A paged cache keeps the pages of a
+  // sequence in its own slice, in the order given by the page table. Tiles past the last page map out of bounds,
+  // where loads and prefetches are dropped.
+  CUTLASS_DEVICE static int kv_cache_tile(Params const& params, int batch_coord, int seq_len_kv_cache, int logical_tile) {
+    if constexpr (!PagedKV) {
+      return logical_tile;
+    } else {
+      int tiles_per_page = params.page_size / QK_BLK_N;
+      int batch_pages = is_var_len ? params.num_pages_per_seq[batch_coord + 1] - params.num_pages_per_seq[batch_coord]
+                                   : ceil_div(seq_len_kv_cache, params.page_size);
+      int batch_offset = is_var_len ? params.num_pages_per_seq[batch_coord] : batch_coord * batch_pages;
+      int logical_page = logical_tile / tiles_per_page;
+      if (logical_page >= batch_pages) {
+        return batch_pages * tiles_per_page;
+      }
+      return params.ptr_page_table[batch_offset + logical_page] * tiles_per_page + logical_tile % tiles_per_page;
+    }
   }
 
   template <class FragQccum, class TensorQ, class TensorK, class FragSrc>
   CUTLASS_DEVICE void mmaQK(FragQccum &accum, TensorQ gQ, TensorK gK, FragSrc const &frag_src,
-                            int const &k_tile_count, Params const &params, bool is_KV_cache) {
+                            int const &k_tile_count, Params const &params, bool is_KV_cache,
+                            float const k_scale = 1.f) {
 
     auto& gmem_tiled_copy_k = is_KV_cache ? params.gmem_tiled_copy_k_cache : params.gmem_tiled_copy_k;
 
@@ -229,8 +267,10 @@ struct FlashPrefillCachedMma<gemm::MainloopIntelXeXMX16<Stages>, ProblemShapeTyp
 
     // Create fragments
     // TODO(Codeplay): fix this, this is probably not general
-    Tensor tCrQ = make_tensor<ElementQ>(make_fragment_layout(params.gmem_tiled_copy_q, take<0,3>(tCgQ.shape())));
-    Tensor tCrK = make_tensor<ElementK>(make_fragment_layout(gmem_tiled_copy_k, take<0,3>(tCgK.shape())));
+    using TCrQ_Type = cute::conditional_t<is_fp8_v<ElementQ>, uint8_t, ElementQ>;
+    using TCrK_Type = cute::conditional_t<is_fp8_v<ElementK>, uint8_t, ElementK>;
+    Tensor tCrQ = make_tensor<TCrQ_Type>(make_fragment_layout(params.gmem_tiled_copy_q, take<0,3>(tCgQ.shape())));
+    Tensor tCrK = make_tensor<TCrK_Type>(make_fragment_layout(gmem_tiled_copy_k, take<0,3>(tCgK.shape())));
     
     // Retile registers for copies
     Tensor tQrQ = thr_copy_Q.retile_D(tCrQ);
@@ -271,13 +311,37 @@ struct FlashPrefillCachedMma<gemm::MainloopIntelXeXMX16<Stages>, ProblemShapeTyp
     for (int k_tile = 0; k_tile < k_tile_count; ++k_tile) {
       copy(params.gmem_tiled_copy_q, tQgQ(_,_,_,k_tile), tQrQ);
       copy(gmem_tiled_copy_k, tKgK(_,_,_,k_tile), tKrK);
-      cute::gemm(tiled_mma, accum, tCrQ, tCrK, frag_src);
+      if constexpr (is_fp8_v<ElementQ> && is_fp8_v<ElementK>) {
+        auto tCrQ_ = make_fragment_like<typename TiledMmaQK::ValTypeA>(tCrQ);
+        convert_FP8_to_FP16<ElementQ>(tCrQ, tCrQ_);
+        auto tCrK_ = make_fragment_like<typename TiledMmaQK::ValTypeB>(tCrK);
+        convert_FP8_to_FP16<ElementK>(tCrK, tCrK_);
+        cute::gemm(tiled_mma, accum, tCrQ_, tCrK_, frag_src);
+      } else if constexpr (is_fp8_v<ElementQ> && !is_fp8_v<ElementK>) {
+        auto tCrQ_ = make_fragment_like<typename TiledMmaQK::ValTypeA>(tCrQ);
+        convert_FP8_to_FP16<ElementQ>(tCrQ, tCrQ_);
+        cute::gemm(tiled_mma, accum, tCrQ_, tCrK, frag_src);
+      } else if constexpr (!is_fp8_v<ElementQ> && is_fp8_v<ElementK>) {
+        auto tCrK_ = make_fragment_like<typename TiledMmaQK::ValTypeB>(tCrK);
+        convert_FP8_to_FP16<ElementK>(tCrK, tCrK_);
+        cute::gemm(tiled_mma, accum, tCrQ, tCrK_, frag_src);
+      } else {
+        cute::gemm(tiled_mma, accum, tCrQ, tCrK, frag_src);
+      }
+    }
+
+    if constexpr (is_fp8_v<ElementK>) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(accum); ++i) {
+        accum(i) *= k_scale;
+      }
     }
   }
 
   template <int tile_count, class FragQccum, class FragS, class TensorV, class FragSrc>
   CUTLASS_DEVICE void mmaPV(FragQccum &accum, FragS const &tSr, TensorV gV,
-                            FragSrc const &frag_src, Params const &params, bool is_KV_cache) {
+                            FragSrc const &frag_src, Params const &params, bool is_KV_cache,
+                            float const v_scale = 1.f) {
 
     auto& gmem_tiled_copy_v = is_KV_cache ? params.gmem_tiled_copy_v_cache : params.gmem_tiled_copy_v;
 
@@ -290,7 +354,8 @@ struct FlashPrefillCachedMma<gemm::MainloopIntelXeXMX16<Stages>, ProblemShapeTyp
     auto first_thread_in_sg_idx = sg.get_group_id()[0] * DispatchPolicy::SubgroupSize;
     auto thread_mma = tiled_mma.get_slice(first_thread_in_sg_idx);  
     Tensor tCgV = thread_mma.partition_B(gV_);
-    Tensor tCrV = make_tensor<ElementV>(make_fragment_layout(gmem_tiled_copy_v, take<0,3>(tCgV.shape())));
+    using TCrV_Type = cute::conditional_t<is_fp8_v<ElementV>, uint8_t, ElementV>;
+    Tensor tCrV = make_tensor<TCrV_Type>(make_fragment_layout(gmem_tiled_copy_v, take<0,3>(tCgV.shape())));
 
     // Partition the copying of A and B tiles across the threads
     auto gmem_thr_copy_V = gmem_tiled_copy_v.get_slice(thread_idx);
@@ -316,13 +381,25 @@ struct FlashPrefillCachedMma<gemm::MainloopIntelXeXMX16<Stages>, ProblemShapeTyp
 
     // 7) Convert S to P (FP32 -> BF16)
     Tensor tPr = convert_type<typename TiledMmaPV::ValTypeA>(tSr); 
+    if constexpr (is_fp8_v<ElementV>) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(tPr); ++i) {
+        tPr(i) = static_cast<typename TiledMmaPV::ValTypeA>(static_cast<float>(tPr(i)) * v_scale);
+      }
+    }
     //
     // Mainloop
     //
     CUTLASS_PRAGMA_UNROLL
     for(int i = 0; i< tile_count; i++) {
       copy(gmem_tiled_copy_v, tVgV(_,_,_,i), tVrV);
-      cute::gemm(tiled_mma, accum(_,_,_,i), tPr, tCrV, frag_src(_,_,_,i));
+      if constexpr (is_fp8_v<ElementV>) {
+        auto tCrV_ = make_fragment_like<typename TiledMmaPV::ValTypeB>(tCrV);
+        convert_FP8_to_FP16<ElementV>(tCrV, tCrV_);
+        cute::gemm(tiled_mma, accum(_,_,_,i), tPr, tCrV_, frag_src(_,_,_,i));
+      } else {
+        cute::gemm(tiled_mma, accum(_,_,_,i), tPr, tCrV, frag_src(_,_,_,i));
+      }
     }
   }
 
@@ -390,7 +467,8 @@ struct FlashPrefillCachedMma<gemm::MainloopIntelXeXMX16<Stages>, ProblemShapeTyp
       XE_Copy_K copyK_cache{XE_Copy_K{}.with(tensorK_cache)};
       XE_Copy_V copyV_cache{XE_Copy_V{}.with(tensorV_cache)};
 
-      return Params{copyQ, copyK, copyV, copyK_cache, copyV_cache, params.ptr_page_table, params.page_size, params.num_pages_per_seq};
+      return Params{copyQ, copyK, copyV, copyK_cache, copyV_cache, params.ptr_page_table, params.page_size, params.num_pages_per_seq, params.window_size,
+                    params.ptr_K_scale, params.ptr_V_scale};
     }
   }
 };
@@ -41,6 +41,7 @@
 #include "cutlass/epilogue/collective/collective_epilogue.hpp"
 #include "cutlass/epilogue/collective/detail.hpp"
 #include "cutlass/detail/layout.hpp"
+#include "flash_attention_v2/collective/xe_flash_attn_score_mod.hpp"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -55,8 +56,8 @@ template <bool CausalMask_, class DispatchPolicy, class... Args> class FlashPref
 };
 
 
-template <bool CausalMask_, class Element_>
-class FlashPrefillSoftmaxEpilogue<CausalMask_, epilogue::IntelXeXMX16, Element_> {
+template <bool CausalMask_, class Element_, class ScoreMod_>
+class FlashPrefillSoftmaxEpilogue<CausalMask_, epilogue::IntelXeXMX16, Element_, ScoreMod_> {
 public:
 
   //
@@ -67,15 +68,22 @@ public:
 
   static constexpr bool CausalMask = CausalMask_;
 
+  // Applied to S before the max/sum reductions, see xe_flash_attn_score_mod.hpp
+  using ScoreMod = ScoreMod_;
+
   using GmemTiledCopyOut = void;
 
   // Host side epilogue arguments
   struct Arguments {
     Element const scale;
+    typename ScoreMod::Arguments score_mod{};
   };
 
   // Device side epilogue params
-  using Params = Arguments;
+  struct Params {
+    Element scale;
+    typename ScoreMod::Params score_mod;
+  };
 
   //
   // Methods
@@ -84,7 +92,7 @@ public:
   static constexpr Params to_underlying_arguments(Arguments const &args) {
     constexpr double kLog2e = 1.4426950408889634074; // log_2(e) = M_LOG2E
     Element val = args.scale * static_cast<Element>(kLog2e);
-    return Params{val};
+    return Params{val, ScoreMod::to_underlying_arguments(args.score_mod, static_cast<float>(args.scale))};
   }
 
   template <class ProblemShape>
@@ -105,10 +113,17 @@ public:
   CUTLASS_HOST_DEVICE
   FlashPrefillSoftmaxEpilogue(Params const &params_) : params(params_) {}
 
+  // A row whose scores are all masked (e.g. every key of the tile is outside the sliding window) keeps
+  // max = -inf; subtracting 0 instead lets exp2 produce 0 rather than NaN for that row.
+  template <class FragMax>
+  CUTLASS_DEVICE Element masked_max_scale(FragMax const &max) {
+    return max == Element{-INFINITY} ? Element{0} : static_cast<Element>(max * params.scale);
+  }
+
   template <int Vec, int FragsM, int FragsN, class FragAcc, class FragMax, class FragSum>
   CUTLASS_DEVICE void scale_exp_log2(FragAcc &frag_s, FragMax const &max, FragSum &sum) {
     auto g = compat::get_nd_item<1>().get_sub_group();
-    const auto max_scale = max * params.scale;
+    const auto max_scale = masked_max_scale(max);
     CUTLASS_PRAGMA_UNROLL
     for (int indx = 0; indx < Vec * FragsM; indx++) {
       const auto max_scale_bcast = group_broadcast(g, max_scale, indx);
@@ -154,7 +169,7 @@ public:
     static_assert(Vec * FragsM  % 8 ==0, " No. of attention rows per subgroup should be >= 1 MMA Atom worth of rows.");
     if (!is_first) {
       auto g = compat::get_nd_item<1>().get_sub_group();
-      Element max_scale{max * params.scale};
+      Element max_scale{masked_max_scale(max)};
       Element exp_scale{sycl::native::exp2(max_prev * params.scale - max_scale)};
       CUTLASS_PRAGMA_UNROLL
       for (int indx = 0; indx < Vec * FragsM; indx++) {
@@ -177,9 +192,23 @@ public:
       scale_exp_log2<Vec, FragsM, FragsNAcc>(frag_s, max, sum);
     }
   }
+  // Element (v, m, n) of frag_s holds query row_base + m * Vec + v and key col_base + n * ColStride.
+  template <int ColStride, class FragAcc>
+  CUTLASS_DEVICE void apply_score_mod(FragAcc &frag_s, int row_base, int col_base, int head) {
+    cutlass::flash_attention::collective::apply_score_mod<ScoreMod, ColStride>(params.score_mod, frag_s, row_base, col_base, head);
+  }
+
   Params params;
 };
 
+template <bool CausalMask_, class Element_>
+class FlashPrefillSoftmaxEpilogue<CausalMask_, epilogue::IntelXeXMX16, Element_>
+    : public FlashPrefillSoftmaxEpilogue<CausalMask_, epilogue::IntelXeXMX16, Element_, NoScoreMod> {
+  using Base = FlashPrefillSoftmaxEpilogue<CausalMask_, epilogue::IntelXeXMX16, Element_, NoScoreMod>;
+public:
+  using Base::Base;
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 } // namespace collective
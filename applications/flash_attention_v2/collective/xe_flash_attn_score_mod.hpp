@@ -0,0 +1,174 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 Codeplay Software Ltd. All rights reserved.
+ * Copyright (C) 2025 Intel Corporation, All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Score modifiers applied to S = Q * K^T before the online softmax (logit soft-capping, ALiBi and
+         user-defined functors).
+*/
+
+#pragma once
+
+#include <sycl/sycl.hpp>
+#include "cutlass/cutlass.h"
+#include <cute/tensor.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace flash_attention {
+namespace collective {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// A score modifier rewrites the unscaled score s of query row `row` and key `col` for query head `head`.
+// Rows and columns share the key coordinate system, i.e. the last query is aligned with the last key.
+// The softmax scale is applied after the modifier, so modifiers that are defined on scaled logits
+// fold the scale into their params in to_underlying_arguments.
+struct NoScoreMod {
+  static constexpr bool Enabled = false;
+
+  struct Arguments {};
+  using Params = Arguments;
+
+  static constexpr Params to_underlying_arguments(Arguments const &args, float /* scale */) {
+    return args;
+  }
+
+  template <class Element>
+  CUTLASS_DEVICE static Element apply(Params const &, Element s, int, int, int) {
+    return s;
+  }
+};
+
+// Gemma-2 style logit soft-capping: softcap * tanh(scale * s / softcap). A softcap <= 0 disables the cap.
+struct SoftCapScoreMod {
+  static constexpr bool Enabled = true;
+
+  struct Arguments {
+    float softcap = 0.f;
+  };
+
+  struct Params {
+    float scale_over_cap;
+    float cap_over_scale;
+  };
+
+  static constexpr Params to_underlying_arguments(Arguments const &args, float scale) {
+    if (args.softcap <= 0.f) {
+      return Params{0.f, 0.f};
+    }
+    return Params{scale / args.softcap, args.softcap / scale};
+  }
+
+  template <class Element>
+  CUTLASS_DEVICE static Element apply(Params const &params, Element s, int, int, int) {
+    if (params.cap_over_scale == 0.f) {
+      return s;
+    }
+    return params.cap_over_scale * sycl::tanh(s * params.scale_over_cap);
+  }
+};
+
+// ALiBi: adds -slope[head] * |row - col| to the scaled logits. ptr_slopes holds one slope per query head.
+struct AlibiScoreMod {
+  static constexpr bool Enabled = true;
+
+  struct Arguments {
+    float const *ptr_slopes = nullptr;
+  };
+
+  struct Params {
+    float const *ptr_slopes;
+    float inv_scale;
+  };
+
+  static constexpr Params to_underlying_arguments(Arguments const &args, float scale) {
+    return Params{args.ptr_slopes, 1.f / scale};
+  }
+
+  template <class Element>
+  CUTLASS_DEVICE static Element apply(Params const &params, Element s, int row, int col, int head) {
+    int dist = row > col ? row - col : col - row;
+    return s - params.ptr_slopes[head] * params.inv_scale * static_cast<Element>(dist);
+  }
+};
+
+// Generic hook: Fn is a trivially copyable functor called as fn(s, row, col, head) on the unscaled score,
+// e.g. to add a positional bias read from global memory.
+template <class Fn>
+struct FunctorScoreMod {
+  static constexpr bool Enabled = true;
+
+  using Arguments = Fn;
+  using Params = Fn;
+
+  static constexpr Params to_underlying_arguments(Arguments const &args, float /* scale */) {
+    return args;
+  }
+
+  template <class Element>
+  CUTLASS_DEVICE static Element apply(Params const &fn, Element s, int row, int col, int head) {
+    return static_cast<Element>(fn(s, row, col, head));
+  }
+};
+
+// Applies ScoreMod to a (Vec, FragsM, FragsN) fragment of S whose element (v, m, n) holds query
+// row_base + m * Vec + v and key col_base + n * ColStride. Compiles to nothing for NoScoreMod.
+template <class ScoreMod, int ColStride, class FragAcc>
+CUTLASS_DEVICE void apply_score_mod(typename ScoreMod::Params const &params, FragAcc &frag_s,
+                                    int row_base, int col_base, int head) {
+  if constexpr (ScoreMod::Enabled) {
+    using FragAccLayout = typename FragAcc::layout_type;
+    constexpr int Vec = cute::get<0>(FragAccLayout{}.shape());
+    constexpr int FragsM = cute::get<1>(FragAccLayout{}.shape());
+    constexpr int FragsN = cute::get<2>(FragAccLayout{}.shape());
+    int col_idx = col_base;
+    CUTLASS_PRAGMA_UNROLL
+    for (int n = 0; n < FragsN; n++, col_idx += ColStride) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int m = 0; m < FragsM; m++) {
+        int row_idx = m * Vec + row_base;
+        CUTLASS_PRAGMA_UNROLL
+        for (int v = 0; v < Vec; v++, row_idx++) {
+          frag_s(v, m, n) = ScoreMod::apply(params, frag_s(v, m, n), row_idx, col_idx, head);
+        }
+      }
+    }
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace collective
+} // namespace flash_attention
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,781 @@
+/***************************************************************************************************
+ * Copyright (C) 2025 Intel Corporation, All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+
+#include "cute/algorithm/functional.hpp"
+#include "cute/algorithm/gemm.hpp"
+#include "cute/algorithm/subgroup_algorithms.hpp"
+#include "cute/atom/mma_atom.hpp"
+#include "fmha_fusion.hpp"
+#include "xe_fmha_fwd_mainloop.hpp"
+
+namespace cutlass::fmha::collective {
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Flash attention backward pass. Softmax probabilities are recomputed from the row-wise log-sum-exp
+//   saved by the forward kernel, so neither S nor P is ever written to memory:
+//
+//    P  = exp(scale * Q*K^T - LSE)
+//    dV = P^T * dO
+//    dP = dO * V^T
+//    dS = P o (dP - D),     D = rowsum(dO o O)
+//    dQ = scale * dS * K
+//    dK = scale * dS^T * Q
+//
+// FMHABwdDQMainloop accumulates dQ for one Q block, iterating over K blocks.
+// FMHABwdDKDVMainloop accumulates dK/dV for one K block, iterating over Q blocks.
+// Each output block is owned by a single work-group, so no atomics are needed.
+
+template <class DispatchPolicy_,
+          bool CausalMask_,
+          class TiledMMAQK_,          // Tiling for Q*K^T and dO*V^T GEMMs: (q,k,d)
+          class TiledMMADQ_,          // Tiling for dS*K GEMM: (q,d,k)
+          int DTiles_,                // # of tiles in dQ head size dimension
+          class TensorQ_,             // Global Q/K/V/dO tensors
+          class TensorK_,
+          class TensorV_,
+          class TensorDO_>
+struct FMHABwdDQMainloop {
+  static_assert(cutlass::detail::dependent_false<DispatchPolicy_>, "Could not find a mainloop specialization.");
+};
+
+template <class DispatchPolicy_,
+          bool CausalMask_,
+          class TiledMMAKQ_,          // Tiling for K*Q^T and V*dO^T GEMMs: (k,q,d)
+          class TiledMMADKV_,         // Tiling for P^T*dO and dS^T*Q GEMMs: (k,d,q)
+          int DTiles_,                // # of tiles in dK head size dimension
+          int VTiles_,                // # of tiles in dV head size dimension
+          class TensorQ_,             // Global Q/K/V/dO tensors
+          class TensorK_,
+          class TensorV_,
+          class TensorDO_>
+struct FMHABwdDKDVMainloop {
+  static_assert(cutlass::detail::dependent_false<DispatchPolicy_>, "Could not find a mainloop specialization.");
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Swap the two modes of a 2D tensor, e.g. view (k,d) as (d,k). Block 2D copies pick
+//   transposing or VNNI loads from the resulting strides.
+template <class Tensor2D>
+CUTLASS_HOST_DEVICE
+constexpr auto
+transpose_2d(Tensor2D const& t) {
+  return make_tensor(t.data(), select<1,0>(t.layout()));
+}
+
+// Write an accumulator tile, possibly split in the column dimension, to global memory.
+template <class TiledMMA, class FragC, class Tensor2D, class TileShape, class Coord>
+CUTLASS_DEVICE
+void
+store_tile(Tensor2D  const& T,        // Global output tensor
+           FragC          & tCrC,     // Accumulator tile
+           TileShape const& tile,     // WG output tile shape
+           Coord     const& blk,      // WG tile indices
+           int              thr_id) {
+  using TiledCopyT = decltype(make_block_2d_copy_D(TiledMMA{}, Tensor2D{}));
+  TiledCopyT copy_t{T};
+  auto thr_copy_t = copy_t.get_slice(thr_id);
+
+  Tensor cT = make_identity_tensor(T.shape());
+  Tensor gT = local_tile(cT, tile, blk);
+
+  auto tTrT = thr_copy_t.partition_sg_fragment_S(gT);
+  auto tTgT = thr_copy_t.partition_D(gT);
+
+  reorder(tCrC, tTrT);
+  copy(copy_t, tTrT, tTgT);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <int Stages,
+          bool CausalMask_,
+          class TiledMMAQK_, class TiledMMADQ_, int DTiles_,
+          class TensorQ_, class TensorK_, class TensorV_, class TensorDO_>
+struct FMHABwdDQMainloop<XeDefault<Stages>, CausalMask_,
+                         TiledMMAQK_, TiledMMADQ_, DTiles_,
+                         TensorQ_, TensorK_, TensorV_, TensorDO_> {
+  //
+  // Type Aliases
+  //
+  using TiledMMAQK = TiledMMAQK_;
+  using TiledMMADQ = TiledMMADQ_;
+  using TileShapeQK = decltype(TiledMMAQK{}.tile_mnk());
+  using TileShapeDQ = decltype(TiledMMADQ{}.tile_mnk());
+  static constexpr int DTiles = DTiles_;
+  using SubgroupLayoutQK = decltype(TiledMMAQK{}.get_atom_layout_mnk());
+  using SGPerWG = decltype(product(take<1,4>(shape(typename TiledMMAQK::ThrLayoutVMNK{}))));
+
+  using TensorQ = TensorQ_;
+  using TensorK = TensorK_;
+  using TensorV = TensorV_;
+  using TensorDO = TensorDO_;
+
+  using TensorQ2D  = decltype(TensorQ_{}(append<rank_v<TensorQ_>>(make_coord(_,_),0)));
+  using TensorK2D  = decltype(TensorK_{}(append<rank_v<TensorK_>>(make_coord(_,_),0)));
+  using TensorV2D  = decltype(TensorV_{}(append<rank_v<TensorV_>>(make_coord(_,_),0)));
+  using TensorDO2D = decltype(TensorDO_{}(append<rank_v<TensorDO_>>(make_coord(_,_),0)));
+  using TensorVt2D = decltype(transpose_2d(TensorV2D{}));        // (k,v)
+  using TensorKt2D = decltype(transpose_2d(TensorK2D{}));        // (d,k)
+
+  using TiledCopyQ  = decltype(make_block_2d_copy_A(TiledMMAQK{}, TensorQ2D{}));
+  using TiledCopyK  = decltype(make_block_2d_copy_B(TiledMMAQK{}, TensorK2D{}));
+  using TiledCopyDO = decltype(make_block_2d_copy_A(TiledMMAQK{}, TensorDO2D{}));
+  using TiledCopyVt = decltype(make_block_2d_copy_B(TiledMMAQK{}, TensorVt2D{}));
+  using TiledCopyKt = decltype(make_block_2d_copy_B(TiledMMADQ{}, TensorKt2D{}));
+
+  //
+  // Accumulator types
+  //
+  // FragS:  accumulator for Q*K^T and dO*V^T MMAs
+  // FragDQ: accumulator for dS*K MMAs, split in the d mode
+  //
+  template <typename TiledMMA>
+  using FragC = decltype(TiledMMA{}.get_slice(0).partition_sg_fragment_C(
+                           make_identity_tensor(select<0,1>(TiledMMA{}.tile_mnk()))));
+
+  using FragS = FragC<TiledMMAQK>;
+  using FragSRow = decltype(reduce<1>(FragS{}, sycl::plus<void>{}));
+  using ElementS = typename TiledMMAQK::ValTypeD;
+
+  using SingleFragDQ = FragC<TiledMMADQ>;                           // (atom val,q',d')
+  using FragDQ = expand_sg_fragment_t<SingleFragDQ, 1, DTiles>;     // (atom val,q',d',DD)
+
+  static constexpr bool CausalMask = CausalMask_;
+
+  // User-facing arguments
+  struct Arguments {
+    ElementS const scale;
+  };
+
+  // Kernel-facing parameters
+  struct Params {
+    ElementS scale;
+    ElementS scale_log2;      // scale * log2(e)
+  };
+
+  // SLM data
+  struct SharedStorage {};
+
+  Params params;
+
+  //
+  // Methods
+  //
+
+  FMHABwdDQMainloop(Params const& params_, SharedStorage&) : params(params_) {}
+
+  static constexpr
+  Params to_underlying_arguments(Arguments const &args, void * /* workspace */) {
+    constexpr double kLog2e = 1.4426950408889634074;            // log_2(e)
+    return Params{args.scale, args.scale * static_cast<ElementS>(kLog2e)};
+  }
+
+  CUTLASS_HOST_DEVICE static
+  bool can_implement(Arguments const&) {
+    return true;
+  }
+
+  // Compute D = rowsum(dO o O) for the rows of this subgroup, save it for the dK/dV kernel,
+  //   and load the matching log-sum-exp (converted to log2) alongside.
+  template <typename TensorO2D>
+  CUTLASS_DEVICE
+  void
+  load_row_stats(TensorO2D  const& O_2D,      // (q,v)
+                 TensorDO2D const& dO_2D,     // (q,v)
+                 ElementS   const* LSE,       // (q), natural log
+                 ElementS        * Delta,     // (q), output
+                 FragSRow        & tLSE,      // Row-wise LSE (log2)
+                 FragSRow        & tD,        // Row-wise D
+                 int               blk_q,
+                 int               thr_id,
+                 int               seq_len_qo) {
+    using namespace sycl::ext::oneapi::this_work_item;
+    constexpr double kLog2e = 1.4426950408889634074;
+    constexpr int SGTileQ = get<0>(shape_div(TileShapeQK{}, shape(SubgroupLayoutQK{})))();
+
+    auto sg = get_sub_group();
+    auto cS = make_identity_tensor(take<0,2>(TileShapeQK{}));
+    auto q_offset_wi = get<0>(TiledMMAQK{}.get_slice(thr_id).partition_C(cS)(0));
+    int q0 = blk_q * get<0>(TileShapeQK{}) + group_broadcast(sg, q_offset_wi, 0);
+    int lane = sg.get_local_id()[0];
+    int head_size_vo = size<1>(O_2D);
+
+    /* Row r of the subgroup tile lives in work-item r % sg_size, element r / sg_size. */
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < tD.size(); i++) {
+      int q = q0 + i * intel::sg_size + lane;
+      tD(i) = ElementS(0);
+      tLSE(i) = ElementS(0);
+      if (i * intel::sg_size + lane < SGTileQ && q < seq_len_qo) {
+        ElementS acc = ElementS(0);
+        for (int v = 0; v < head_size_vo; v++) {
+          acc += static_cast<ElementS>(dO_2D(q,v)) * static_cast<ElementS>(O_2D(q,v));
+        }
+        Delta[q] = acc;
+        tD(i) = acc;
+        tLSE(i) = LSE[q] * static_cast<ElementS>(kLog2e);
+      }
+    }
+  }
+
+  CUTLASS_DEVICE
+  void
+  operator()(TensorQ2D  const& Q_2D,      // (q,d)
+             TensorK2D  const& K_2D,      // (k,d)
+             TensorV2D  const& V_2D,      // (v,k)
+             TensorDO2D const& dO_2D,     // (q,v)
+             FragDQ          & tDQrDQ,    // Output accumulator (q,d)
+             FragSRow   const& tLSE,      // Row-wise LSE (log2)
+             FragSRow   const& tD,        // Row-wise D
+             int               blk_q,     // WG tile index in q
+             int               blk_k0,    // K block range: [K0,K1)
+             int               blk_k1,
+             int               thr_id,
+             int               seq_len_kv,
+             int               full_tile_offset,
+             int               discard_seq_coord) {
+    using namespace sycl::ext::oneapi::this_work_item;
+
+    // Short dimension names:
+    //    q = sequence len dimension for Q
+    //    k = sequence len dimension for K
+    //    d = head size dimension for K/Q
+    //    v = head size dimension for V
+    //   DD = MMA tile indices for dQ
+    // Capital letters (Q, K, ...) refer to WG block indices.
+    // Primed letters (q', k', ...) refer to atom block indices.
+
+    auto tile_shape_d = make_shape(get<1>(TileShapeDQ{}) * C<DTiles>{}, get<2>(TileShapeDQ{}));
+
+    Tensor Vt_2D = transpose_2d(V_2D);                            // (k,v)
+    Tensor Kt_2D = transpose_2d(K_2D);                            // (d,k)
+
+    /* Create proxy coordinate tensors */
+    Tensor cQ  = make_identity_tensor(Q_2D.shape());              // (q,d)
+    Tensor cK  = make_identity_tensor(K_2D.shape());              // (k,d)
+    Tensor cdO = make_identity_tensor(dO_2D.shape());             // (q,v)
+    Tensor cVt = make_identity_tensor(Vt_2D.shape());             // (k,v)
+    Tensor cKt = make_identity_tensor(Kt_2D.shape());             // (d,k)
+    Tensor cP  = make_identity_tensor(take<0,2>(TileShapeQK{}));  // (q,k)
+
+    /* Partition global tensors into workgroup tiles */
+    Tensor gQ  = local_tile(cQ,  TileShapeQK{}, make_coord(blk_q,_,_), Step<_1,X,_1>{});   // (q,d,D)
+    Tensor gK  = local_tile(cK,  TileShapeQK{}, make_coord(_,_,_),     Step<X,_1,_1>{});   // (k,d,K,D)
+    Tensor gdO = local_tile(cdO, TileShapeQK{}, make_coord(blk_q,_,_), Step<_1,X,_1>{});   // (q,v,VB)
+    Tensor gVt = local_tile(cVt, TileShapeQK{}, make_coord(_,_,_),     Step<X,_1,_1>{});   // (k,v,K,VB)
+    Tensor gKt       = local_tile(cKt, tile_shape_d,  make_coord(0,_));                     // (d,k,K)
+    Tensor gKt_split = local_tile(gKt, TileShapeDQ{}, make_coord(_,_,0), Step<X,_1,_1>{}); // (d,k,DD,K)
+
+    /* Create global -> register copies */
+    TiledCopyQ  copy_q{Q_2D};
+    TiledCopyK  copy_k{K_2D};
+    TiledCopyDO copy_do{dO_2D};
+    TiledCopyVt copy_vt{Vt_2D};
+    TiledCopyKt copy_kt{Kt_2D};
+
+    /* Create MMAs */
+    TiledMMAQK mma_qk{};
+    TiledMMADQ mma_dq{};
+
+    /* Slice TiledCopy/TiledMMA operations down to to work-item level */
+    auto thr_copy_q  = copy_q.get_slice(thr_id);
+    auto thr_copy_k  = copy_k.get_slice(thr_id);
+    auto thr_copy_do = copy_do.get_slice(thr_id);
+    auto thr_copy_vt = copy_vt.get_slice(thr_id);
+    auto thr_copy_kt = copy_kt.get_slice(thr_id);
+    auto thr_mma_qk  = mma_qk.get_slice(thr_id);
+    auto thr_mma_dq  = mma_dq.get_slice(thr_id);
+
+    /* Partition coordinate tensors for copy */
+    auto tQgQ   = thr_copy_q.partition_S(gQ);             // (atom_val,q',d',D)
+    auto tKgK   = thr_copy_k.partition_S(gK);             // (atom_val,k',d',K,D)
+    auto tdOgdO = thr_copy_do.partition_S(gdO);           // (atom_val,q',v',VB)
+    auto tVgVt  = thr_copy_vt.partition_S(gVt);           // (atom_val,k',v',K,VB)
+    auto tKgKt  = thr_copy_kt.partition_S(gKt_split);     // (atom_val,d',k',DD,K)
+
+    /* Create register fragments for MMA and copies */
+    auto tQrQ = thr_copy_q.partition_sg_fragment_D(gQ(_,_,0));
+    auto tSrQ = thr_mma_qk.partition_sg_fragment_A(gQ(_,_,0));
+
+    auto tKrK = thr_copy_k.partition_sg_fragment_D(gK(_,_,0,0));
+    auto tSrK = thr_mma_qk.partition_sg_fragment_B(gK(_,_,0,0));
+
+    auto tdOrdO = thr_copy_do.partition_sg_fragment_D(gdO(_,_,0));
+    auto tSrdO  = thr_mma_qk.partition_sg_fragment_A(gdO(_,_,0));
+
+    auto tVrVt = thr_copy_vt.partition_sg_fragment_D(gVt(_,_,0,0));
+    auto tSrVt = thr_mma_qk.partition_sg_fragment_B(gVt(_,_,0,0));
+
+    auto tSrS  = thr_mma_qk.partition_sg_fragment_C(cP);   // S, then P
+    auto tSrdP = thr_mma_qk.partition_sg_fragment_C(cP);   // dP, then dS
+    auto tDrdS = thr_mma_dq.partition_sg_fragment_A(cP);
+
+    auto tKrKt = thr_copy_kt.partition_sg_fragment_D(gKt_split(_,_,0,0));
+    auto tDrKt = thr_mma_dq.partition_sg_fragment_B(gKt_split(_,_,0,0));
+
+    /* Create TiledCopy objects for prefetches */
+    auto prefetch_k  = make_block_2d_prefetch(copy_k);
+    auto prefetch_vt = make_block_2d_prefetch(copy_vt);
+
+    /* Partition global tensors for prefetch */
+    auto pKgK  = prefetch_k.get_slice(thr_id).partition_S(gK);
+    auto pVgVt = prefetch_vt.get_slice(thr_id).partition_S(gVt);
+
+    // ------
+    // Kernel
+    // ------
+
+    for (int K = blk_k0; K < blk_k0 + Stages && K < blk_k1; K++) {
+      for (int D = 0; D < size<4>(pKgK); D++) {
+        prefetch(prefetch_k, pKgK(_,_,_,K,D));
+      }
+      for (int VB = 0; VB < size<4>(pVgVt); VB++) {
+        prefetch(prefetch_vt, pVgVt(_,_,_,K,VB));
+      }
+    }
+
+    clear(tDQrDQ);
+
+    /* Main loop, blocked in k. */
+    for (int K = blk_k0; K < blk_k1; K++) {
+      /* Split barrier to keep threads together */
+      barrier_arrive(ScopeWorkgroup);
+
+      /* GEMM 1: S = Q * K^T */
+      clear(tSrS);
+      for (int D = 0; D < size<4>(tKgK); D++) {
+        copy(copy_q, tQgQ(_,_,_,D),   tQrQ);
+        copy(copy_k, tKgK(_,_,_,K,D), tKrK);
+
+        reorder(tQrQ, tSrQ);
+        reorder(tKrK, tSrK);
+
+        cute::gemm(mma_qk, tSrQ, tSrK, tSrS);
+      }
+
+      /* GEMM 2: dP = dO * V^T */
+      clear(tSrdP);
+      for (int VB = 0; VB < size<4>(tVgVt); VB++) {
+        copy(copy_do, tdOgdO(_,_,_,VB),  tdOrdO);
+        copy(copy_vt, tVgVt(_,_,_,K,VB), tVrVt);
+
+        reorder(tdOrdO, tSrdO);
+        reorder(tVrVt, tSrVt);
+
+        cute::gemm(mma_qk, tSrdO, tSrVt, tSrdP);
+      }
+
+      /* Recompute P from the saved log-sum-exp */
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < tSrS.size(); i++) {
+        tSrS(i) = sycl::native::exp2(params.scale_log2 * tSrS(i) - broadcast<0>(tLSE, tSrS, i));
+      }
+
+      /* Causal and k remainder masking */
+      bool mask_block = ((K + 1) * get<1>(TileShapeQK{}) > seq_len_kv)
+                     || (CausalMask && (K + 1) * get<1>(TileShapeQK{}) - 1 - full_tile_offset
+                                     > blk_q * get<0>(TileShapeQK{}) - discard_seq_coord);
+      if (mask_block) {
+        Tensor cPgP = make_identity_tensor(make_shape(int(size<0>(Q_2D)), seq_len_kv));
+        Tensor gP = local_tile(cPgP, take<0,2>(TileShapeQK{}), make_coord(blk_q, K));
+        auto cS_thread = thr_mma_qk.partition_C(gP);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < tSrS.size(); ++i) {
+          int row_idx = get<0>(cS_thread(i));
+          int col_idx = get<1>(cS_thread(i));
+          bool masked = (col_idx >= seq_len_kv)
+                     || (CausalMask && col_idx - full_tile_offset > row_idx - discard_seq_coord);
+          tSrS(i) = masked ? ElementS(0) : tSrS(i);
+        }
+      }
+
+      /* dS = P o (dP - D) */
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < tSrdP.size(); i++) {
+        tSrdP(i) = tSrS(i) * (tSrdP(i) - broadcast<0>(tD, tSrdP, i));
+      }
+      reorder(tSrdP, tDrdS);
+
+      /* GEMM 3: dQ += dS * K, split in d dimension */
+      CUTLASS_PRAGMA_UNROLL
+      for (int DD = 0; DD < DTiles; DD++) {
+        copy(copy_kt, tKgKt(_,_,_,DD,K), tKrKt);
+        reorder(tKrKt, tDrKt);
+        cute::gemm(mma_dq, tDrdS, tDrKt, tDQrDQ(_,_,_,DD));
+      }
+
+      /* K/V prefetch */
+      for (int D = 0; D < size<4>(pKgK); D++) {
+        prefetch(prefetch_k, pKgK(_,_,_,K+Stages,D));
+      }
+      for (int VB = 0; VB < size<4>(pVgVt); VB++) {
+        prefetch(prefetch_vt, pVgVt(_,_,_,K+Stages,VB));
+      }
+
+      barrier_wait(ScopeWorkgroup);
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <int Stages,
+          bool CausalMask_,
+          class TiledMMAKQ_, class TiledMMADKV_, int DTiles_, int VTiles_,
+          class TensorQ_, class TensorK_, class TensorV_, class TensorDO_>
+struct FMHABwdDKDVMainloop<XeDefault<Stages>, CausalMask_,
+                           TiledMMAKQ_, TiledMMADKV_, DTiles_, VTiles_,
+                           TensorQ_, TensorK_, TensorV_, TensorDO_> {
+  //
+  // Type Aliases
+  //
+  using TiledMMAKQ = TiledMMAKQ_;
+  using TiledMMADKV = TiledMMADKV_;
+  using TileShapeKQ = decltype(TiledMMAKQ{}.tile_mnk());
+  using TileShapeDKV = decltype(TiledMMADKV{}.tile_mnk());
+  static constexpr int DTiles = DTiles_;
+  static constexpr int VTiles = VTiles_;
+  using SGPerWG = decltype(product(take<1,4>(shape(typename TiledMMAKQ::ThrLayoutVMNK{}))));
+
+  using TensorQ = TensorQ_;
+  using TensorK = TensorK_;
+  using TensorV = TensorV_;
+  using TensorDO = TensorDO_;
+
+  using TensorQ2D  = decltype(TensorQ_{}(append<rank_v<TensorQ_>>(make_coord(_,_),0)));
+  using TensorK2D  = decltype(TensorK_{}(append<rank_v<TensorK_>>(make_coord(_,_),0)));
+  using TensorV2D  = decltype(TensorV_{}(append<rank_v<TensorV_>>(make_coord(_,_),0)));
+  using TensorDO2D = decltype(TensorDO_{}(append<rank_v<TensorDO_>>(make_coord(_,_),0)));
+  using TensorVt2D  = decltype(transpose_2d(TensorV2D{}));       // (k,v)
+  using TensorQt2D  = decltype(transpose_2d(TensorQ2D{}));       // (d,q)
+  using TensorDOt2D = decltype(transpose_2d(TensorDO2D{}));      // (v,q)
+
+  using TiledCopyK   = decltype(make_block_2d_copy_A(TiledMMAKQ{}, TensorK2D{}));
+  using TiledCopyQ   = decltype(make_block_2d_copy_B(TiledMMAKQ{}, TensorQ2D{}));
+  using TiledCopyVt  = decltype(make_block_2d_copy_A(TiledMMAKQ{}, TensorVt2D{}));
+  using TiledCopyDO  = decltype(make_block_2d_copy_B(TiledMMAKQ{}, TensorDO2D{}));
+  using TiledCopyQt  = decltype(make_block_2d_copy_B(TiledMMADKV{}, TensorQt2D{}));
+  using TiledCopyDOt = decltype(make_block_2d_copy_B(TiledMMADKV{}, TensorDOt2D{}));
+
+  //
+  // Accumulator types
+  //
+  // FragS:     accumulator for K*Q^T and V*dO^T MMAs, i.e. S^T and dP^T
+  // FragSCol:  per-column (i.e. per query) values of FragS
+  // FragDK/DV: accumulators for dS^T*Q and P^T*dO MMAs, split in the head size mode
+  //
+  template <typename TiledMMA>
+  using FragC = decltype(TiledMMA{}.get_slice(0).partition_sg_fragment_C(
+                           make_identity_tensor(select<0,1>(TiledMMA{}.tile_mnk()))));
+
+  using FragS = FragC<TiledMMAKQ>;
+  using FragSCol = decltype(reduce<0>(FragS{}, sycl::plus<void>{}));
+  using ElementS = typename TiledMMAKQ::ValTypeD;
+
+  using SingleFragDKV = FragC<TiledMMADKV>;                         // (atom val,k',d')
+  using FragDK = expand_sg_fragment_t<SingleFragDKV, 1, DTiles>;    // (atom val,k',d',DD)
+  using FragDV = expand_sg_fragment_t<SingleFragDKV, 1, VTiles>;    // (atom val,k',v',VV)
+
+  static constexpr bool CausalMask = CausalMask_;
+
+  // User-facing arguments
+  struct Arguments {
+    ElementS const scale;
+  };
+
+  // Kernel-facing parameters
+  struct Params {
+    ElementS scale;
+    ElementS scale_log2;      // scale * log2(e)
+  };
+
+  // SLM data
+  struct SharedStorage {};
+
+  Params params;
+
+  //
+  // Methods
+  //
+
+  FMHABwdDKDVMainloop(Params const& params_, SharedStorage&) : params(params_) {}
+
+  static constexpr
+  Params to_underlying_arguments(Arguments const &args, void * /* workspace */) {
+    constexpr double kLog2e = 1.4426950408889634074;            // log_2(e)
+    return Params{args.scale, args.scale * static_cast<ElementS>(kLog2e)};
+  }
+
+  CUTLASS_HOST_DEVICE static
+  bool can_implement(Arguments const&) {
+    return true;
+  }
+
+  // Accumulate the dK/dV contributions of one query head. Called once per query head sharing
+  //   this KV head; accumulators are cleared by the caller.
+  CUTLASS_DEVICE
+  void
+  operator()(TensorQ2D  const& Q_2D,      // (q,d)
+             TensorK2D  const& K_2D,      // (k,d)
+             TensorV2D  const& V_2D,      // (v,k)
+             TensorDO2D const& dO_2D,     // (q,v)
+             ElementS   const* LSE,       // (q), natural log
+             ElementS   const* Delta,     // (q), rowsum(dO o O)
+             FragDK          & tDKrDK,    // Output accumulators (k,d), (k,v)
+             FragDV          & tDVrDV,
+             int               blk_k,     // WG tile index in k
+             int               blk_q0,    // Q block range: [Q0,Q1)
+             int               blk_q1,
+             int               thr_id,
+             int               seq_len_qo,
+             int               full_tile_offset,
+             int               discard_seq_coord) {
+    using namespace sycl::ext::oneapi::this_work_item;
+    constexpr double kLog2e = 1.4426950408889634074;
+
+    // Short dimension names as in FMHABwdDQMainloop.
+    //   DD/VV = MMA tile indices for dK/dV
+
+    auto tile_shape_d = make_shape(get<1>(TileShapeDKV{}) * C<DTiles>{}, get<2>(TileShapeDKV{}));
+    auto tile_shape_v = make_shape(get<1>(TileShapeDKV{}) * C<VTiles>{}, get<2>(TileShapeDKV{}));
+
+    Tensor Vt_2D  = transpose_2d(V_2D);                           // (k,v)
+    Tensor Qt_2D  = transpose_2d(Q_2D);                           // (d,q)
+    Tensor dOt_2D = transpose_2d(dO_2D);                          // (v,q)
+
+    /* Create proxy coordinate tensors */
+    Tensor cK   = make_identity_tensor(K_2D.shape());             // (k,d)
+    Tensor cQ   = make_identity_tensor(Q_2D.shape());             // (q,d)
+    Tensor cVt  = make_identity_tensor(Vt_2D.shape());            // (k,v)
+    Tensor cdO  = make_identity_tensor(dO_2D.shape());            // (q,v)
+    Tensor cQt  = make_identity_tensor(Qt_2D.shape());            // (d,q)
+    Tensor cdOt = make_identity_tensor(dOt_2D.shape());           // (v,q)
+    Tensor cP   = make_identity_tensor(take<0,2>(TileShapeKQ{})); // (k,q)
+
+    /* Partition global tensors into workgroup tiles */
+    Tensor gK   = local_tile(cK,  TileShapeKQ{}, make_coord(blk_k,_,_), Step<_1,X,_1>{});  // (k,d,D)
+    Tensor gQ   = local_tile(cQ,  TileShapeKQ{}, make_coord(_,_,_),     Step<X,_1,_1>{});  // (q,d,Q,D)
+    Tensor gVt  = local_tile(cVt, TileShapeKQ{}, make_coord(blk_k,_,_), Step<_1,X,_1>{});  // (k,v,VB)
+    Tensor gdO  = local_tile(cdO, TileShapeKQ{}, make_coord(_,_,_),     Step<X,_1,_1>{});  // (q,v,Q,VB)
+    Tensor gQt        = local_tile(cQt,  tile_shape_d, make_coord(0,_));                    // (d,q,Q)
+    Tensor gQt_split  = local_tile(gQt,  TileShapeDKV{}, make_coord(_,_,0), Step<X,_1,_1>{}); // (d,q,DD,Q)
+    Tensor gdOt       = local_tile(cdOt, tile_shape_v, make_coord(0,_));                    // (v,q,Q)
+    Tensor gdOt_split = local_tile(gdOt, TileShapeDKV{}, make_coord(_,_,0), Step<X,_1,_1>{}); // (v,q,VV,Q)
+
+    /* Create global -> register copies */
+    TiledCopyK   copy_k{K_2D};
+    TiledCopyQ   copy_q{Q_2D};
+    TiledCopyVt  copy_vt{Vt_2D};
+    TiledCopyDO  copy_do{dO_2D};
+    TiledCopyQt  copy_qt{Qt_2D};
+    TiledCopyDOt copy_dot{dOt_2D};
+
+    /* Create MMAs */
+    TiledMMAKQ mma_kq{};
+    TiledMMADKV mma_dkv{};
+
+    /* Slice TiledCopy/TiledMMA operations down to to work-item level */
+    auto thr_copy_k   = copy_k.get_slice(thr_id);
+    auto thr_copy_q   = copy_q.get_slice(thr_id);
+    auto thr_copy_vt  = copy_vt.get_slice(thr_id);
+    auto thr_copy_do  = copy_do.get_slice(thr_id);
+    auto thr_copy_qt  = copy_qt.get_slice(thr_id);
+    auto thr_copy_dot = copy_dot.get_slice(thr_id);
+    auto thr_mma_kq   = mma_kq.get_slice(thr_id);
+    auto thr_mma_dkv  = mma_dkv.get_slice(thr_id);
+
+    /* Partition coordinate tensors for copy */
+    auto tKgK    = thr_copy_k.partition_S(gK);            // (atom_val,k',d',D)
+    auto tQgQ    = thr_copy_q.partition_S(gQ);            // (atom_val,q',d',Q,D)
+    auto tVgVt   = thr_copy_vt.partition_S(gVt);          // (atom_val,k',v',VB)
+    auto tdOgdO  = thr_copy_do.partition_S(gdO);          // (atom_val,q',v',Q,VB)
+    auto tQgQt   = thr_copy_qt.partition_S(gQt_split);    // (atom_val,d',q',DD,Q)
+    auto tdOgdOt = thr_copy_dot.partition_S(gdOt_split);  // (atom_val,v',q',VV,Q)
+
+    /* Create register fragments for MMA and copies */
+    auto tKrK = thr_copy_k.partition_sg_fragment_D(gK(_,_,0));
+    auto tSrK = thr_mma_kq.partition_sg_fragment_A(gK(_,_,0));
+
+    auto tQrQ = thr_copy_q.partition_sg_fragment_D(gQ(_,_,0,0));
+    auto tSrQ = thr_mma_kq.partition_sg_fragment_B(gQ(_,_,0,0));
+
+    auto tVrVt = thr_copy_vt.partition_sg_fragment_D(gVt(_,_,0));
+    auto tSrVt = thr_mma_kq.partition_sg_fragment_A(gVt(_,_,0));
+
+    auto tdOrdO = thr_copy_do.partition_sg_fragment_D(gdO(_,_,0,0));
+    auto tSrdO  = thr_mma_kq.partition_sg_fragment_B(gdO(_,_,0,0));
+
+    auto tSrS  = thr_mma_kq.partition_sg_fragment_C(cP);   // S^T, then P^T
+    auto tSrdP = thr_mma_kq.partition_sg_fragment_C(cP);   // dP^T, then dS^T
+    auto tArP  = thr_mma_dkv.partition_sg_fragment_A(cP);
+    auto tArdS = thr_mma_dkv.partition_sg_fragment_A(cP);
+
+    auto tQrQt = thr_copy_qt.partition_sg_fragment_D(gQt_split(_,_,0,0));
+    auto tArQt = thr_mma_dkv.partition_sg_fragment_B(gQt_split(_,_,0,0));
+
+    auto tdOrdOt = thr_copy_dot.partition_sg_fragment_D(gdOt_split(_,_,0,0));
+    auto tArdOt  = thr_mma_dkv.partition_sg_fragment_B(gdOt_split(_,_,0,0));
+
+    /* Create TiledCopy objects for prefetches */
+    auto prefetch_q  = make_block_2d_prefetch(copy_q);
+    auto prefetch_do = make_block_2d_prefetch(copy_do);
+
+    /* Partition global tensors for prefetch */
+    auto pQgQ   = prefetch_q.get_slice(thr_id).partition_S(gQ);
+    auto pdOgdO = prefetch_do.get_slice(thr_id).partition_S(gdO);
+
+    // ------
+    // Kernel
+    // ------
+
+    for (int Q = blk_q0; Q < blk_q0 + Stages && Q < blk_q1; Q++) {
+      for (int D = 0; D < size<4>(pQgQ); D++) {
+        prefetch(prefetch_q, pQgQ(_,_,_,Q,D));
+      }
+      for (int VB = 0; VB < size<4>(pdOgdO); VB++) {
+        prefetch(prefetch_do, pdOgdO(_,_,_,Q,VB));
+      }
+    }
+
+    int lane = get_sub_group().get_local_id()[0];
+
+    /* Main loop, blocked in q. */
+    for (int Q = blk_q0; Q < blk_q1; Q++) {
+      /* Split barrier to keep threads together */
+      barrier_arrive(ScopeWorkgroup);
+
+      /* GEMM 1: S^T = K * Q^T */
+      clear(tSrS);
+      for (int D = 0; D < size<3>(tKgK); D++) {
+        copy(copy_k, tKgK(_,_,_,D),   tKrK);
+        copy(copy_q, tQgQ(_,_,_,Q,D), tQrQ);
+
+        reorder(tKrK, tSrK);
+        reorder(tQrQ, tSrQ);
+
+        cute::gemm(mma_kq, tSrK, tSrQ, tSrS);
+      }
+
+      /* Load per-query LSE (log2) and D. Out-of-range queries get an infinite LSE, so P^T = 0. */
+      FragSCol tLSE, tD;
+      int q = Q * get<1>(TileShapeKQ{}) + lane;
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < tLSE.size(); i++, q += intel::sg_size) {
+        bool valid = (q < seq_len_qo);
+        tLSE(i) = valid ? LSE[q] * static_cast<ElementS>(kLog2e) : ElementS(INFINITY);
+        tD(i) = valid ? Delta[q] : ElementS(0);
+      }
+
+      /* Recompute P^T from the saved log-sum-exp */
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < tSrS.size(); i++) {
+        tSrS(i) = sycl::native::exp2(params.scale_log2 * tSrS(i) - broadcast<1>(tLSE, tSrS, i));
+      }
+
+      /* Causal masking */
+      if constexpr (CausalMask) {
+        bool mask_block = (blk_k + 1) * get<0>(TileShapeKQ{}) - 1 - full_tile_offset
+                        > Q * get<1>(TileShapeKQ{}) - discard_seq_coord;
+        if (mask_block) {
+          Tensor cPgP = make_identity_tensor(make_shape(int(size<0>(K_2D)), seq_len_qo));
+          Tensor gP = local_tile(cPgP, take<0,2>(TileShapeKQ{}), make_coord(blk_k, Q));
+          auto cS_thread = thr_mma_kq.partition_C(gP);
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < tSrS.size(); ++i) {
+            int k_idx = get<0>(cS_thread(i));
+            int q_idx = get<1>(cS_thread(i));
+            tSrS(i) = (k_idx - full_tile_offset > q_idx - discard_seq_coord) ? ElementS(0) : tSrS(i);
+          }
+        }
+      }
+      reorder(tSrS, tArP);
+
+      /* GEMM 2: dV += P^T * dO, split in v dimension */
+      CUTLASS_PRAGMA_UNROLL
+      for (int VV = 0; VV < VTiles; VV++) {
+        copy(copy_dot, tdOgdOt(_,_,_,VV,Q), tdOrdOt);
+        reorder(tdOrdOt, tArdOt);
+        cute::gemm(mma_dkv, tArP, tArdOt, tDVrDV(_,_,_,VV));
+      }
+
+      /* GEMM 3: dP^T = V * dO^T */
+      clear(tSrdP);
+      for (int VB = 0; VB < size<3>(tVgVt); VB++) {
+        copy(copy_vt, tVgVt(_,_,_,VB),    tVrVt);
+        copy(copy_do, tdOgdO(_,_,_,Q,VB), tdOrdO);
+
+        reorder(tVrVt, tSrVt);
+        reorder(tdOrdO, tSrdO);
+
+        cute::gemm(mma_kq, tSrVt, tSrdO, tSrdP);
+      }
+
+      /* dS^T = P^T o (dP^T - D) */
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < tSrdP.size(); i++) {
+        tSrdP(i) = tSrS(i) * (tSrdP(i) - broadcast<1>(tD, tSrdP, i));
+      }
+      reorder(tSrdP, tArdS);
+
+      /* GEMM 4: dK += dS^T * Q, split in d dimension */
+      CUTLASS_PRAGMA_UNROLL
+      for (int DD = 0; DD < DTiles; DD++) {
+        copy(copy_qt, tQgQt(_,_,_,DD,Q), tQrQt);
+        reorder(tQrQt, tArQt);
+        cute::gemm(mma_dkv, tArdS, tArQt, tDKrDK(_,_,_,DD));
+      }
+
+      /* Q/dO prefetch */
+      for (int D = 0; D < size<4>(pQgQ); D++) {
+        prefetch(prefetch_q, pQgQ(_,_,_,Q+Stages,D));
+      }
+      for (int VB = 0; VB < size<4>(pdOgdO); VB++) {
+        prefetch(prefetch_do, pdOgdO(_,_,_,Q+Stages,VB));
+      }
+
+      barrier_wait(ScopeWorkgroup);
+    }
+  }
+};
+
+} // namespace cutlass::fmha::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -103,6 +103,9 @@ public:
   using DefaultTiledCopyO = decltype(default_tiled_copy_O_helper());
   using TiledCopyO = conditional_t<is_void_v<TiledCopyO_>, DefaultTiledCopyO, TiledCopyO_>;
 
+  // Row-wise log-sum-exp output (for the backward pass) requires each subgroup to own complete rows.
+  static constexpr bool SupportsLSE = (ReduceK{} == _1{});
+
   // Stateless design -- no arguments or parameters.
   struct Arguments {};
   struct Params {};
@@ -143,7 +146,9 @@ public:
              FragARow       & tA_max,   // Softmax row-wise max accumulator
              FragARow       & tA_sum,   // Softmax row-wise sum accumulator
              QVCoord          blk_qv,   // WG tile indices: (q,v)
-             int              thr_id) { // Work-item ID
+             int              thr_id,   // Work-item ID
+             ElementA       * LSE = nullptr,  // Optional row-wise log-sum-exp output: (q)
+             int              seq_len_qo = 0) {
 
     using namespace cute;
     using ElementA = typename FragA::element_type;
@@ -154,6 +159,12 @@ public:
     /* Some subgroups may not have any work to do; if so, quit early. */
     if (!active) return;
 
+    if constexpr (SupportsLSE) {
+      if (LSE != nullptr && get<1>(blk_qv) == 0) {
+        store_lse(LSE, tA_max, rA_sum, get<0>(blk_qv), seq_len_qo, thr_id);
+      }
+    }
+
     /* Complete softmax, dividing out sums. */
     CUTLASS_PRAGMA_UNROLL
     for (int i = 0; i < rA_sum.size(); i++)
@@ -179,6 +190,39 @@ public:
     copy(copy_o, tOrO, tOgO);
   }
 
+  // Write the natural-log log-sum-exp of each row, LSE = ln(sum_k exp(scale * s_k)).
+  // The maxima are kept in the scaled log2 domain by the mainloop.
+  template <typename FragARow_>
+  CUTLASS_DEVICE
+  void
+  store_lse(ElementA       * LSE,         // Global LSE for this head: (q)
+            FragARow  const& tA_max,      // Softmax row-wise max
+            FragARow_ const& tA_sum,      // Softmax row-wise sum
+            int              blk_q,       // WG tile index in q
+            int              seq_len_qo,
+            int              thr_id) {
+    using namespace sycl::ext::oneapi::this_work_item;
+    constexpr double kLn2 = 0.69314718055994530942;             // ln(2)
+    constexpr int SGTileQ = size<0>(SGTileShapeA{});
+
+    auto sg = get_sub_group();
+    auto cA = make_identity_tensor(select<0,1>(TileShapePV{}));
+    auto q_offset_wi = get<0>(TiledMMAPV{}.get_slice(thr_id).partition_C(cA)(0));
+    int q0 = blk_q * get<0>(TileShapeO{}) + group_broadcast(sg, q_offset_wi, 0);
+
+    /* Row r of the subgroup tile lives in work-item r % sg_size, element r / sg_size. */
+    int lane = sg.get_local_id()[0];
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < tA_sum.size(); i++) {
+      int r = i * intel::sg_size + lane;
+      if (r < SGTileQ && q0 + r < seq_len_qo) {
+        /* Fully masked rows get +inf, so that the backward pass recomputes P = 0 for them. */
+        LSE[q0 + r] = (tA_sum(i) > ElementA(0)) ? (tA_max(i) + sycl::log2(tA_sum(i))) * ElementA(kLn2)
+                                                : ElementA(INFINITY);
+      }
+    }
+  }
+
   // Reduce k-blocks of A and A_sum across WG, if needed.
   // Note that each k block has its own scale factor based on A_max,
   //   so A/A_sum contributions need to be rescaled to match.
@@ -175,7 +175,8 @@ struct FMHAFwdMainloop<XeDefault<Stages>, CausalMask_,
              int              thr_id,
              int              seq_len,
              int              full_tile_offset,
-             int              discard_seq_coord) {
+             int              discard_seq_coord,
+             int              packed_seq_len_qo = 0) { // > 0: Q rows stack query heads of this many tokens each
     using namespace sycl::ext::oneapi::this_work_item;
 
     // Short dimension names:
@@ -293,7 +294,10 @@ struct FMHAFwdMainloop<XeDefault<Stages>, CausalMask_,
 
       /* Causal masking */
       if constexpr (CausalMask) {
-        if (K == blk_k1 - 1) {
+        // Packed Q rows cover every token of the tile, so each block past the first masked key is masked.
+        bool mask_block = (K == blk_k1 - 1)
+                       || (packed_seq_len_qo > 0 && (K + 1) * get<1>(TileShapeQK{}) > full_tile_offset - discard_seq_coord + 1);
+        if (mask_block) {
           // Need to get global col and row indices to mask the elements
           Tensor cPgP = make_identity_tensor(make_shape(seq_len, seq_len));
           Tensor gP = local_tile(cPgP, take<0,2>(TileShapeQK{}), make_coord(get<0>(blk_qv), K));
@@ -301,6 +305,9 @@ struct FMHAFwdMainloop<XeDefault<Stages>, CausalMask_,
           CUTLASS_PRAGMA_UNROLL
           for (int i = 0; i < tSrS.size(); ++i) {
             int row_idx = get<0>(cS_thread(i));
+            if (packed_seq_len_qo > 0) {
+              row_idx %= packed_seq_len_qo;
+            }
             int col_idx = get<1>(cS_thread(i));
             if (col_idx - full_tile_offset > row_idx - discard_seq_coord) {
               tSrS(i) = ElementS(-INFINITY);
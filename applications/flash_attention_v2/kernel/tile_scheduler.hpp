@@ -34,9 +34,15 @@
 #pragma once
 
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 #include "cutlass/cutlass.h"
+#include "cutlass/arch/arch.h"
 #include "cutlass/fast_math.h"
 #include "cutlass/kernel_hardware_info.h"
+#include "flash_attention_v2/collective/fmha_fusion.hpp"
 
 namespace cutlass::flash_attention {
 
@@ -146,6 +152,101 @@ struct XeFlashDecodeIndividualTileScheduler {
 
 ////////////////////////////////////////////////////////////////////////////////
 
+// Decode scheduler that additionally partitions the KV sequence across work-groups (flash-decoding).
+// Work-group (x, y, z) processes head size block x, query block y and
+// z = (batch * num_heads_q + head) * num_partitions + partition.
+struct XeFlashDecodeSplitKVTileScheduler {
+
+  static constexpr int MaxPartitions = 64;
+
+  struct Params {
+    dim3 grid;
+    FastDivmod divmod_num_heads;
+    FastDivmod divmod_num_partitions;
+    int num_partitions;
+  };
+
+  bool valid_ = true;
+  Params params;
+
+  CUTLASS_DEVICE
+  XeFlashDecodeSplitKVTileScheduler(Params const& params) : params(params) {}
+
+  // Choose enough KV partitions to fill every Xe-core, without giving any partition less than one KV tile.
+  template<int Num_SGs, class ProblemSize, class TileShape>
+  static int get_num_partitions(
+      ProblemSize const& problem_size, KernelHardwareInfo hw_info,
+      TileShape const& tile_shape) {
+    using namespace cute;
+    int sm_count = hw_info.sm_count;
+    if (sm_count <= 0) {
+      CUTLASS_TRACE_HOST("  WARNING: Arguments do not include a valid SM count.\n"
+          "  For optimal performance, populate the arguments KernelHardwareInfo struct with the SM count.");
+      sm_count = KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+    }
+
+    auto queue = compat::get_default_queue();
+    auto dev = queue.get_device();
+    const int maxSubgroups = static_cast<int>(
+      dev.template get_info<sycl::info::device::max_num_sub_groups>());
+    const int wg_slots = sm_count * std::max(1, maxSubgroups / Num_SGs);
+
+    // problem_size = [batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, seq_len_kv_cache, head_size_qk, head_size_vo]
+    const int num_tiles = size(ceil_div(shape<7>(problem_size), shape<1>(tile_shape))) *
+                          size(ceil_div(shape<3>(problem_size), 8)) *
+                          size(shape<0>(problem_size) * shape<1>(problem_size));
+    const int kv_tile = size<2>(tile_shape);
+    const int kv_splits = ceil_div(static_cast<int>(get<4>(problem_size)), kv_tile) +
+                          ceil_div(static_cast<int>(get<5>(problem_size)), kv_tile);
+
+    int num_partitions = ceil_div(wg_slots, num_tiles);
+    num_partitions = std::min(num_partitions, std::min(kv_splits, MaxPartitions));
+    CUTLASS_TRACE_HOST("get_num_partitions(): Splitting " << kv_splits << " KV tiles into " << num_partitions << " partitions");
+    return std::max(num_partitions, 1);
+  }
+
+  template<class ProblemSize, class TileShape>
+  static Params to_underlying_arguments(
+      ProblemSize const& problem_size, KernelHardwareInfo hw_info,
+      TileShape const& tile_shape, int num_partitions) {
+    using namespace cute;
+    // problem_size = [batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, seq_len_kv_cache, head_size_qk, head_size_vo]
+    dim3 grid(size(ceil_div(shape<7>(problem_size), shape<1>(tile_shape))),
+              size(ceil_div(shape<3>(problem_size), 8)), // we want to process only 8 tokens per workgroup
+              size(shape<0>(problem_size) * shape<1>(problem_size) * num_partitions));
+    return Params{ grid, {shape<1>(problem_size)}, {num_partitions}, num_partitions };
+  }
+
+  template <int Num_SGs>
+  static dim3 get_grid_shape(Params const& params) {
+    return params.grid;
+  }
+
+  CUTLASS_DEVICE
+  bool is_valid() {
+    return valid_;
+  }
+
+  // Returns (head_size_blk_idx, seq_len_blk_idx, batch_blk_idx, num_heads_blk_idx, partition_idx)
+  CUTLASS_DEVICE
+  auto get_block_coord() {
+    using namespace cute;
+    int block_decode = BlockIdxZ();
+    int bidh, partition;
+    params.divmod_num_partitions(block_decode, partition, block_decode);
+    params.divmod_num_heads(block_decode, bidh, block_decode);
+    return make_coord(BlockIdxX(), BlockIdxY(), block_decode, bidh, partition);
+  }
+
+  CUTLASS_DEVICE
+  XeFlashDecodeSplitKVTileScheduler& operator++() {
+    valid_ = false;
+    return *this;
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
 struct XeFlashPersistentTileScheduler {
 
   struct Params {
@@ -227,12 +328,204 @@ struct XeFlashPersistentTileScheduler {
 };
 
 
+////////////////////////////////////////////////////////////////////////////////
+
+// Persistent scheduler that hands out work longest first (longest-processing-time first), so that with
+// variable-length batches the long sequences start early instead of trailing behind the short ones.
+// initialize_workspace ranks every (batch, query block) pair by the number of keys it visits, reading the
+// cumulative VariableLength offsets on the given stream, and stores the ranking in the kernel workspace.
+// Pairs past the end of a shorter sequence are ranked last and skipped by the kernel. Block i processes head size block
+// i % num_head_size_blocks and head (i / num_head_size_blocks) % num_heads of ranked pair
+// i / (num_head_size_blocks * num_heads); work-groups stride through the blocks by the grid size.
+struct XeFlashPersistentLPTTileScheduler {
+
+  struct Params {
+    int num_blocks;
+    FastDivmod divmod_seq_len_block;
+    FastDivmod divmod_head_size_block;
+    FastDivmod divmod_num_heads;
+    int const* work_list;
+
+    KernelHardwareInfo hw_info;
+  };
+
+  int block_idx = 0;
+  Params params;
+
+  CUTLASS_DEVICE
+  XeFlashPersistentLPTTileScheduler(Params const& params) : block_idx(BlockIdxX()), params(params) {}
+
+  // Ranks the (batch, query block) pairs by the number of keys they visit, longest first. Pairs of equal cost
+  // keep their (batch, query block) order. Each entry is batch * num_seq_len_blocks + seq_len_block.
+  static std::vector<int> make_work_list(std::vector<int> const& seq_len_qo, std::vector<int> const& seq_len_kv,
+                                         std::vector<int> const& seq_len_kv_cache, int seq_len_block_size,
+                                         int num_seq_len_blocks, bool causal) {
+    std::vector<int> work_list;
+    std::vector<int> cost;
+    for (int b = 0; b < static_cast<int>(seq_len_qo.size()); b++) {
+      // Bottom-right aligned causal mask, as in the prefill kernel.
+      int offset = std::min(seq_len_qo[b], seq_len_kv[b]);
+      int discard_seq_coord = seq_len_qo[b] - offset;
+      int full_tile_offset = seq_len_kv[b] - offset;
+      for (int m = 0; m * seq_len_block_size < seq_len_qo[b]; m++) {
+        int last_row = std::min((m + 1) * seq_len_block_size, seq_len_qo[b]) - 1;
+        int visible_kv = causal ? std::clamp(full_tile_offset + last_row - discard_seq_coord + 1, 0, seq_len_kv[b])
+                                : seq_len_kv[b];
+        work_list.push_back(b * num_seq_len_blocks + m);
+        cost.push_back(seq_len_kv_cache[b] + visible_kv);
+      }
+    }
+    std::vector<int> order(work_list.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return cost[a] > cost[b]; });
+    std::vector<int> ranked(order.size());
+    for (size_t i = 0; i < order.size(); i++) {
+      ranked[i] = work_list[order[i]];
+    }
+    return ranked;
+  }
+
+  // Appends the (batch, query block) pairs missing from a ranked work list, so that it covers all
+  // num_entries pairs launched by to_underlying_arguments. The kernel skips the blocks it appended.
+  static void pad_work_list(std::vector<int>& work_list, int num_entries) {
+    std::vector<bool> listed(num_entries, false);
+    for (int entry : work_list) {
+      listed[entry] = true;
+    }
+    for (int entry = 0; entry < num_entries; entry++) {
+      if (!listed[entry]) {
+        work_list.push_back(entry);
+      }
+    }
+  }
+
+  // One entry per (batch, query block) pair of the longest sequence.
+  template<class ProblemSize>
+  static size_t get_workspace_size(ProblemSize const& problem_size, int seq_len_block_size) {
+    using namespace cute;
+    return static_cast<size_t>(get<0>(problem_size)) *
+           ceil_div(static_cast<int>(get<3>(problem_size)), seq_len_block_size) * sizeof(int);
+  }
+
+  // Ranks the query blocks into the workspace. Variable lengths are read back and the ranking is written on `stream`.
+  // problem_size = [batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, (seq_len_kv_cache,) head_size_qk, head_size_vo]
+  template<class ProblemSize>
+  static Status initialize_workspace(ProblemSize const& problem_size, int seq_len_block_size, bool causal,
+                                     void* workspace, cudaStream_t stream) {
+    using namespace cute;
+    constexpr bool HasKVCache = tuple_size<ProblemSize>::value == 8;
+    int batch = get<0>(problem_size);
+    int num_seq_len_blocks = ceil_div(static_cast<int>(get<3>(problem_size)), seq_len_block_size);
+    int num_entries = batch * num_seq_len_blocks;
+    if (num_entries == 0) {
+      return Status::kSuccess;
+    }
+    if (workspace == nullptr) {
+      return Status::kErrorWorkspaceNull;
+    }
+    sycl::queue q = stream ? *stream : compat::get_default_queue();
+
+    // Per-batch lengths, read back from the device for variable-length batches.
+    auto get_seq_lens = [&](auto const& seq_len) {
+      std::vector<int> seq_lens(batch, static_cast<int>(seq_len));
+      if constexpr (cutlass::fmha::collective::is_variable_length_v<cute::remove_cvref_t<decltype(seq_len)>>) {
+        std::vector<int> cumulative_length(batch + 1);
+        q.memcpy(cumulative_length.data(), seq_len.cumulative_length, (batch + 1) * sizeof(int)).wait();
+        for (int b = 0; b < batch; b++) {
+          seq_lens[b] = cumulative_length[b + 1] - cumulative_length[b];
+        }
+      }
+      return seq_lens;
+    };
+    std::vector<int> seq_len_qo = get_seq_lens(get<3>(problem_size));
+    std::vector<int> seq_len_kv = get_seq_lens(get<4>(problem_size));
+    std::vector<int> seq_len_kv_cache(batch, 0);
+    if constexpr (HasKVCache) {
+      seq_len_kv_cache = get_seq_lens(get<5>(problem_size));
+    }
+
+    std::vector<int> work_list = make_work_list(seq_len_qo, seq_len_kv, seq_len_kv_cache, seq_len_block_size,
+                                                num_seq_len_blocks, causal);
+    CUTLASS_TRACE_HOST("initialize_workspace(): Ranked " << work_list.size() << " of " << num_entries << " query blocks");
+    pad_work_list(work_list, num_entries);
+    // The host copy of the ranking goes out of scope on return.
+    q.memcpy(workspace, work_list.data(), work_list.size() * sizeof(int)).wait();
+    return Status::kSuccess;
+  }
+
+  // Launches every (batch, query block) pair of the longest sequence, so this does not read the sequence lengths.
+  // problem_size = [batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, (seq_len_kv_cache,) head_size_qk, head_size_vo]
+  template<class ProblemSize>
+  static Params to_underlying_arguments(
+      ProblemSize const& problem_size, KernelHardwareInfo hw_info,
+      int seq_len_block_size, int head_size_block_size, void* workspace) {
+    using namespace cute;
+    constexpr bool HasKVCache = tuple_size<ProblemSize>::value == 8;
+    int sm_count = hw_info.sm_count;
+    if (sm_count <= 0) {
+      CUTLASS_TRACE_HOST("  WARNING: Arguments do not include a valid SM count.\n"
+          "  For optimal performance, populate the arguments KernelHardwareInfo struct with the SM count.");
+      sm_count = KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+    }
+    hw_info.sm_count = sm_count;
+
+    int batch = get<0>(problem_size);
+    int num_heads = get<1>(problem_size);
+    int head_size_vo = get<HasKVCache ? 7 : 6>(problem_size);
+    int num_seq_len_blocks = ceil_div(static_cast<int>(get<3>(problem_size)), seq_len_block_size);
+    int num_head_size_blocks = ceil_div(head_size_vo, head_size_block_size);
+    int num_blocks = batch * num_seq_len_blocks * num_heads * num_head_size_blocks;
+
+    return Params {
+      num_blocks,
+      {num_seq_len_blocks}, {num_head_size_blocks}, {num_heads},
+      reinterpret_cast<int const*>(workspace),
+      hw_info
+    };
+  }
+
+  template <int Num_SGs>
+  static dim3 get_grid_shape(Params const& params) {
+    auto queue = compat::get_default_queue();
+    auto dev = queue.get_device();
+    const size_t maxSubgroups =
+      dev.template get_info<sycl::info::device::max_num_sub_groups>();
+    dim3 grid(std::max(1, std::min(params.num_blocks, static_cast<int>(ceil_div(params.hw_info.sm_count * maxSubgroups, Num_SGs)))), 1, 1);
+    return grid;
+  }
+
+  CUTLASS_DEVICE
+  bool is_valid() {
+    return block_idx < params.num_blocks;
+  }
+
+  CUTLASS_DEVICE
+  auto get_block_coord() {
+    using namespace cute;
+    int block_decode = block_idx;
+    int head_size_block, bidh, seq_len_block;
+    params.divmod_head_size_block(block_decode, head_size_block, block_decode);
+    params.divmod_num_heads(block_decode, bidh, block_decode);
+    int bidb = params.work_list[block_decode];
+    params.divmod_seq_len_block(bidb, seq_len_block, bidb);
+    return make_coord(head_size_block, seq_len_block, bidb, bidh);
+  }
+
+  CUTLASS_DEVICE
+  XeFlashPersistentLPTTileScheduler& operator++() {
+    block_idx += GridDimX();
+    return *this;
+  }
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 }  // namespace kernel
 
   struct IndividualScheduler{};
   struct PersistentScheduler{};
   struct FlashDecodeIndividualScheduler{};
+  struct FlashDecodeSplitKVScheduler{};
+  struct PersistentLPTScheduler{};
 
   namespace detail
   {
@@ -285,6 +578,24 @@ struct XeFlashPersistentTileScheduler {
     {
       using Scheduler = kernel::XeFlashDecodeIndividualTileScheduler;
     };
+
+    template <class ArchTag>
+    struct TileSchedulerSelector<
+        FlashDecodeSplitKVScheduler,
+        ArchTag,
+        cute::enable_if_t<cute::is_same_v<ArchTag, cutlass::arch::IntelXe>>>
+    {
+      using Scheduler = kernel::XeFlashDecodeSplitKVTileScheduler;
+    };
+
+    template <class ArchTag>
+    struct TileSchedulerSelector<
+        PersistentLPTScheduler,
+        ArchTag,
+        cute::enable_if_t<cute::is_same_v<ArchTag, cutlass::arch::IntelXe>>>
+    {
+      using Scheduler = kernel::XeFlashPersistentLPTTileScheduler;
+    };
   } // namespace detail
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -94,6 +94,8 @@ public:
   // Tile scheduler derived types
   using TileScheduler = TileScheduler_;
   using TileSchedulerParams = typename TileScheduler::Params;
+  // Each work-group handles a KV head, with the query heads sharing it stacked along the Q tile.
+  static constexpr bool PackGQA = is_same_v<TileScheduler, XeFHMAPackedGQATileScheduler>;
 
   // Epilogue derived types
   using CollectiveEpilogue = CollectiveEpilogue_;
@@ -103,6 +105,7 @@ public:
   using TileShapeO = typename CollectiveEpilogue::TileShapeO;
   using ElementO = typename CollectiveEpilogue::TensorO::element_type;
   using StrideO = decltype(stride(typename CollectiveEpilogue::TensorO{}));
+  using ElementLSE = typename CollectiveMainloop::ElementA;
 
   // Kernel level shared memory storage
   using MainloopSharedStorage = typename CollectiveMainloop::SharedStorage;
@@ -126,6 +129,9 @@ public:
     StrideV dV;
     ElementO *O;
     StrideO dO;
+    // Optional log-sum-exp of each softmax row, [batch, num_heads_q, seq_len_qo] with seq_len_qo
+    // the maximum sequence length for variable length problems. Saved for the backward pass.
+    ElementLSE *LSE = nullptr;
   };
   using KernelParams = KernelArguments;
 
@@ -156,10 +162,41 @@ public:
   }
 
   static bool can_implement(Arguments const &args) {
+    if (args.kernel.LSE != nullptr && (PackGQA || !CollectiveEpilogue::SupportsLSE)) {
+      return false;
+    }
+    if constexpr (PackGQA) {
+      // The query heads of a KV head are read as one matrix, so consecutive heads must follow each other
+      // in Q and O ([b, h, q, d] layout). Varlen strides are always packed.
+      auto const& s = args.kernel.shape;
+      if (s.num_heads_q % s.num_heads_kv != 0) {
+        return false;
+      }
+      if constexpr (!is_var_len) {
+        if (get<2>(args.kernel.dQ) != s.seq_len_qo * get<0>(args.kernel.dQ) ||
+            get<2>(args.kernel.dO) != s.seq_len_qo * get<0>(args.kernel.dO)) {
+          return false;
+        }
+        // Every draft token needs at least one visible key.
+        if (CollectiveMainloop::CausalMask && s.seq_len_qo > s.seq_len_kv) {
+          return false;
+        }
+      }
+    }
     return CollectiveMainloop::can_implement(args.mainloop)
         && CollectiveEpilogue::can_implement(args.epilogue);
   }
 
+  // Views the head_group_q consecutive query heads starting at head_q as a single
+  // (head_group_q * seq_len, d) matrix; row r holds token r % seq_len of head head_q + r / seq_len.
+  template <class Tensor4D>
+  CUTLASS_DEVICE static auto
+  pack_gqa_heads(Tensor4D const& T, int head_q, int head_group_q, int l_coord) {
+    auto T2D = T(_,_,head_q,l_coord);
+    return make_tensor(T2D.data(), make_layout(make_shape(int(size<0>(T2D)) * head_group_q, int(size<1>(T2D))),
+                                               T2D.stride()));
+  }
+
   static int get_workspace_size(Arguments const &args) { return 0; }
 
   static cutlass::Status initialize_workspace(Arguments const &args, void *workspace = nullptr,
@@ -206,21 +243,28 @@ public:
 
     CUTLASS_PRAGMA_NO_UNROLL
     for (; tile_scheduler.is_valid(); ++tile_scheduler) {
-      auto [blk_q, blk_v, head_q, idx_b] = tile_scheduler.get_block_coord(); // (Q,V,h,b)
+      auto [blk_q, blk_v, head_q, idx_b] = tile_scheduler.get_block_coord(); // (Q,V,h,b), h is the KV head when PackGQA
       auto blk_qv = make_coord(blk_q, blk_v);
-      int head = head_q / head_group_q;
+      int head = PackGQA ? head_q : head_q / head_group_q;
+      if constexpr (PackGQA) {
+        head_q = head * head_group_q;   // first query head of the packed group
+      }
 
       auto sequence_length_shape = get_sequence_length_shape(s, idx_b);
       auto [seq_len_qo, seq_len_kv] = sequence_length_shape;
-      if (blk_q * get<0>(TileShapeQK{}) >= seq_len_qo) continue;
+      int q_rows = PackGQA ? seq_len_qo * head_group_q : seq_len_qo;
+      if (blk_q * get<0>(TileShapeQK{}) >= q_rows) continue;
 
       auto offset = cute::min(seq_len_qo, seq_len_kv);
       auto discard_seq_coord = seq_len_qo - offset;
       auto full_tile_offset = seq_len_kv - offset;
       int seq_coord = cute::min(seq_len_qo, (blk_q * get<0>(TileShapeQK{}) + q_offset_sg));
 
-      if (CollectiveMainloop::CausalMask && seq_coord < discard_seq_coord) continue;
-      const int seq_len = CollectiveMainloop::CausalMask ? full_tile_offset + cute::min(seq_len_kv, seq_coord - discard_seq_coord) + q_sg_tile : seq_len_kv;
+      // A packed tile holds every token, so it visits all keys and masks the last seq_len_qo - 1 in the mainloop.
+      if (!PackGQA && CollectiveMainloop::CausalMask && seq_coord < discard_seq_coord) continue;
+      const int seq_len = (CollectiveMainloop::CausalMask && !PackGQA)
+                        ? full_tile_offset + cute::min(seq_len_kv, seq_coord - discard_seq_coord) + q_sg_tile
+                        : seq_len_kv;
       const int k_blocks = cute::ceil_div(seq_len, get<1>(TileShapeQK{}));
 
       int offset_q = 0, offset_k = 0, offset_v = 0, offset_o = 0;
@@ -263,22 +307,40 @@ public:
       // Main loop
       int l_coord = is_var_len ? 0 : idx_b;
       CollectiveMainloop mainloop(params.mainloop, shared_storage.mainloop);
-      mainloop(Q(_,_,head_q,l_coord),
-               K(_,_,head,l_coord),
-               V(_,_,head,l_coord),
-               tArA, tA_max, tA_sum,
-               blk_qv, 0, k_blocks, k_blocks,
-               thr_id, seq_len,
-               full_tile_offset, discard_seq_coord);
+      if constexpr (PackGQA) {
+        mainloop(pack_gqa_heads(Q, head_q, head_group_q, l_coord),
+                 K(_,_,head,l_coord),
+                 V(_,_,head,l_coord),
+                 tArA, tA_max, tA_sum,
+                 blk_qv, 0, k_blocks, k_blocks,
+                 thr_id, seq_len,
+                 full_tile_offset, discard_seq_coord, seq_len_qo);
+      } else {
+        mainloop(Q(_,_,head_q,l_coord),
+                 K(_,_,head,l_coord),
+                 V(_,_,head,l_coord),
+                 tArA, tA_max, tA_sum,
+                 blk_qv, 0, k_blocks, k_blocks,
+                 thr_id, seq_len,
+                 full_tile_offset, discard_seq_coord);
+      }
       if constexpr (!is_empty_v<MainloopSharedStorage> && !is_empty_v<EpilogueSharedStorage>) {
         sycl::group_barrier(get_work_group<3>());
       }
 
       // Epilogue
       CollectiveEpilogue epilogue{params.epilogue, shared_storage.epilogue};
-      epilogue(O(_,_,head_q,l_coord),
-               tArA, tA_max, tA_sum,
-               blk_qv, thr_id);
+      if constexpr (PackGQA) {
+        epilogue(pack_gqa_heads(O, head_q, head_group_q, l_coord),
+                 tArA, tA_max, tA_sum,
+                 blk_qv, thr_id);
+      } else {
+        ElementLSE *ptrLSE = p.LSE ? p.LSE + (size_t(idx_b) * s.num_heads_q + head_q) * int(s.seq_len_qo) : nullptr;
+        epilogue(O(_,_,head_q,l_coord),
+                 tArA, tA_max, tA_sum,
+                 blk_qv, thr_id,
+                 ptrLSE, seq_len_qo);
+      }
     }
   }
 };
@@ -346,7 +408,6 @@ public:
   // Important: make sure multiple of 16 element for each copy
   // this is for storing partial results from different KV partitions
   static constexpr int num_elem_per_thread = (size(FragA{}.shape()) + 2 * size(FragARow{}.shape()) + 15) / 16 * 16;
-  static const int max_num_partitions = 8;
 
   // Device side arguments
   struct KernelArguments {
@@ -379,12 +440,24 @@ public:
     ElementA *partial_results_ptr = nullptr;
     // for atomic add
     int32_t *atomic_reduce_cnt_ptr = nullptr;
+    // upper bound on the number of wgs sharing one batch head, see get_max_num_partitions()
+    int max_num_partitions = 1;
   };
 
   //
   // Methods
   //
 
+  // The persistent scheduler spreads all KV blocks evenly over the grid, so the number of wgs
+  // contributing to one batch head is bounded by its share of that work budget.
+  static int get_max_num_partitions(Arguments const &args) {
+    int num_batch_heads = args.kernel.shape.batch * args.kernel.shape.num_heads_q;
+    int num_wgs = TileScheduler::to_underlying_arguments(args.kernel.shape, args.hw_info, TileShapeO{}).grid.z;
+    int local_k_blocks = cute::ceil_div(args.kernel.shape.seq_len_kv, get<1>(TileShapeQK{}));
+    int num_blocks_per_wg = cute::ceil_div(local_k_blocks * num_batch_heads, num_wgs);
+    return cute::max(1, cute::min(num_wgs, cute::ceil_div(local_k_blocks, num_blocks_per_wg) + 1));
+  }
+
   static Params to_underlying_arguments(Arguments const &args, void *workspace) {
     int num_batch_heads = args.kernel.shape.batch * args.kernel.shape.num_heads_q;
     int32_t *atomic_reduce_cnt_ptr = reinterpret_cast<int32_t *>(workspace);
@@ -393,7 +466,7 @@ public:
             CollectiveMainloop::to_underlying_arguments(args.mainloop, workspace),
             CollectiveEpilogue::to_underlying_arguments(args.epilogue, workspace),
             TileScheduler::to_underlying_arguments(args.kernel.shape, args.hw_info, TileShapeO{}),
-            partial_results_ptr, atomic_reduce_cnt_ptr
+            partial_results_ptr, atomic_reduce_cnt_ptr, get_max_num_partitions(args)
           };
   }
 
@@ -416,7 +489,7 @@ public:
     const int wg_size = SGPerWG::value * intel::sg_size;
 
     // partial attn outputs, exp sum and max logits
-    ws_size += (max_num_partitions * num_batch_heads) * wg_size * num_elem_per_thread * sizeof(ElementA);
+    ws_size += (get_max_num_partitions(args) * num_batch_heads) * wg_size * num_elem_per_thread * sizeof(ElementA);
     // atomic counter
     ws_size += num_batch_heads * sizeof(int32_t);
     return ws_size;
@@ -462,35 +535,53 @@ public:
     return num_partitions;
   }
 
-  template <class Params, class FragA, class FragARow>
   CUTLASS_DEVICE
-  void reduce_split2(const Params &params, FragA &out1, FragARow& max_val1, FragARow& exp_sum_val1, FragA &out2, FragARow& max_val2, FragARow& exp_sum_val2) {
-    // global max value
-    FragARow max_prev1 = max_val1;
-    FragARow max_prev2 = max_val2;
-
-    auto scale = params.mainloop.scale;
+  ElementA *get_partial_ptr(Params const &params, int batch_head_id, int partition_id, int sg_id, int tid_in_sg) {
+    int offset = batch_head_id * params.max_num_partitions * num_elem_per_thread * SGPerWG::value * intel::sg_size
+               + partition_id * num_elem_per_thread * SGPerWG::value * intel::sg_size
+               + sg_id * intel::sg_size * num_elem_per_thread
+               + tid_in_sg * num_elem_per_thread;
+    return params.partial_results_ptr + offset;
+  }
 
+  // Merge any number of partial results of one batch head. The first pass finds the global max logits,
+  // so each partial result is rescaled exactly once while streaming through them in the second pass.
+  CUTLASS_DEVICE
+  void reduce_partitions(Params const &params, int batch_head_id, int num_partitions, int sg_id, int tid_in_sg,
+                         FragA &out, FragARow &max_val, FragARow &exp_sum_val) {
     CUTLASS_PRAGMA_UNROLL
-    for (int i = 0; i < max_val1.size(); i++) {
-      max_val1(i) = sycl::max(max_val1(i), max_val2(i));
+    for (int i = 0; i < max_val.size(); i++) {
+      max_val(i) = ElementA(-INFINITY);
     }
 
-    FragARow rescale1, rescale2;
-    CUTLASS_PRAGMA_UNROLL
-    for (int i = 0; i < max_val1.size(); i++) {
-      rescale1(i) = sycl::native::exp2(max_prev1(i) - max_val1(i));
-      rescale2(i) = sycl::native::exp2(max_prev2(i) - max_val1(i));
+    for (int p = 0; p < num_partitions; ++p) {
+      ElementA *partial = get_partial_ptr(params, batch_head_id, p, sg_id, tid_in_sg);
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < max_val.size(); i++) {
+        max_val(i) = sycl::max(max_val(i), partial[2 * i + size(FragA{}.shape())]);
+      }
     }
 
-    CUTLASS_PRAGMA_UNROLL
-    for (int i = 0; i < exp_sum_val1.size(); i++) {
-      exp_sum_val1(i) = exp_sum_val1(i) * rescale1(i) + exp_sum_val2(i) * rescale2(i);
-    }
+    clear(out);
+    clear(exp_sum_val);
 
-    CUTLASS_PRAGMA_UNROLL
-    for (int i = 0; i < out1.size(); i++)
-      out1(i) = out1(i) * broadcast<0>(rescale1, out1, i) + out2(i) * broadcast<0>(rescale2, out2, i);
+    for (int p = 0; p < num_partitions; ++p) {
+      Tensor tPartial = make_tensor(get_partial_ptr(params, batch_head_id, p, sg_id, tid_in_sg), make_shape(Int<num_elem_per_thread>{}));
+      Tensor merged_res = make_tensor<ElementA>(Int<num_elem_per_thread>{});
+      copy(tPartial, merged_res);
+
+      FragARow rescale;
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < max_val.size(); i++) {
+        rescale(i) = sycl::native::exp2(merged_res(2 * i + size(FragA{}.shape())) - max_val(i));
+        exp_sum_val(i) += merged_res(2 * i + 1 + size(FragA{}.shape())) * rescale(i);
+      }
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < out.size(); i++) {
+        out(i) += merged_res(i) * broadcast<0>(rescale, out, i);
+      }
+    }
   }
 
   CUTLASS_DEVICE
@@ -549,11 +640,6 @@ public:
       // worker wg only to compute partial results
       bool is_leader_wg = wg_id < num_batch_heads;
 
-      if (thr_id == 0 && is_leader_wg) {
-        // reset atomic counter before computation
-        *(params.atomic_reduce_cnt_ptr + wg_id) = 0;
-      }
-
       // Main loop
       CollectiveMainloop mainloop(params.mainloop, shared_storage.mainloop);
 
@@ -561,7 +647,8 @@ public:
       int block_budget_remained = num_blocks_per_wg;
       int batch_head_id = start_batch_head_id;
       bool is_update_batch_head_id = false;
-      while (block_budget_remained > 0) {
+      // wgs past the last KV block (more wgs than blocks) have no work of their own
+      while (block_budget_remained > 0 && batch_head_id < num_batch_heads) {
         int num_new_blocks = local_k_blocks - num_computed_blocks;
         if (num_new_blocks <= block_budget_remained) {
           // finished current batch head id
@@ -596,11 +683,7 @@ public:
         int partition_id = get_partition_id(wg_id, batch_head_id, num_blocks_per_wg, local_k_blocks);
 
         // store partial result: tArA, tA_max and tA_sum
-        int offset = batch_head_id * max_num_partitions * num_elem_per_thread * SGPerWG::value * intel::sg_size
-                    + partition_id * num_elem_per_thread * SGPerWG::value * intel::sg_size
-                    + sg_id * intel::sg_size * num_elem_per_thread
-                    + tid_in_sg * num_elem_per_thread;
-        Tensor tPartial = make_tensor(params.partial_results_ptr + offset, make_shape(Int<num_elem_per_thread>{}));
+        Tensor tPartial = make_tensor(get_partial_ptr(params, batch_head_id, partition_id, sg_id, tid_in_sg), make_shape(Int<num_elem_per_thread>{}));
         Tensor merged_res = make_tensor<ElementA>(Int<num_elem_per_thread>{});
 
         CUTLASS_PRAGMA_UNROLL
@@ -634,53 +717,13 @@ public:
         // check atomic to wait for partial results ready
         while(atomicLoad(params.atomic_reduce_cnt_ptr + wg_id) != num_partitions) {}
 
-        clear(tArA);
-        clear(tA_max);
-        clear(tA_sum);
-
-        for (int i = 0; i < num_partitions; ++i) {
-          int offset = wg_id * max_num_partitions * SGPerWG::value * intel::sg_size * num_elem_per_thread
-                     + i * SGPerWG::value * intel::sg_size * num_elem_per_thread
-                     + sg_id * intel::sg_size * num_elem_per_thread
-                     + tid_in_sg * num_elem_per_thread;
-          Tensor tPartial = make_tensor(params.partial_results_ptr + offset, make_shape(Int<num_elem_per_thread>{}));
-          Tensor merged_res = make_tensor<ElementA>(Int<num_elem_per_thread>{});
-          copy(tPartial, merged_res);
-
-          if (i == 0) {
-            CUTLASS_PRAGMA_UNROLL
-            for(int i = 0; i < size(FragA{}.shape()); ++i) {
-              tArA(i) = merged_res(i);
-            }
-
-            CUTLASS_PRAGMA_UNROLL
-            for (int i = 0; i < size(FragARow{}.shape()); ++i) {
-              tA_max(i) = merged_res(2 * i + size(FragA{}.shape()));
-              tA_sum(i) = merged_res(2 * i + 1 + size(FragA{}.shape()));
-            }
-
-            continue;
-          }
-
-          FragA tArA_2;
-          FragARow tA_max_2, tA_sum_2;
-          CUTLASS_PRAGMA_UNROLL
-          for(int i = 0; i < size(FragA{}.shape()); ++i) {
-            tArA_2(i) = merged_res(i);
-          }
-
-          CUTLASS_PRAGMA_UNROLL
-          for (int i = 0; i < size(FragARow{}.shape()); ++i) {
-            tA_max_2(i) = merged_res(2 * i + size(FragA{}.shape()));
-            tA_sum_2(i) = merged_res(2 * i + 1 + size(FragA{}.shape()));
-          }
+        reduce_partitions(params, wg_id, num_partitions, sg_id, tid_in_sg, tArA, tA_max, tA_sum);
 
-          reduce_split2(params, tArA, tA_max, tA_sum, tArA_2, tA_max_2, tA_sum_2);
-        }
-
-        // require group barrier if using SLM
-        if constexpr (!is_empty_v<MainloopSharedStorage> && !is_empty_v<EpilogueSharedStorage>) {
-          sycl::group_barrier(get_work_group<3>());
+        // all partial results are consumed: reset the counter for the next launch once every thread
+        // has left the wait loop above. The barrier also covers the SLM handover to the epilogue.
+        sycl::group_barrier(get_work_group<3>());
+        if (thr_id == 0) {
+          *(params.atomic_reduce_cnt_ptr + wg_id) = 0;
         }
 
         head_q = wg_id % s.num_heads_q;
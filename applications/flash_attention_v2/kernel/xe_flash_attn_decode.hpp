@@ -78,9 +78,12 @@ public:
   using SoftmaxArguments = typename CollectiveSoftmaxEpilogue::Arguments;
   using SoftmaxParams = typename CollectiveSoftmaxEpilogue::Params;
 
-  static_assert(cute::is_void_v<TileScheduler_> or cute::is_same_v<TileScheduler_, FlashDecodeIndividualScheduler>,
+  static_assert(cute::is_void_v<TileScheduler_> or cute::is_same_v<TileScheduler_, FlashDecodeIndividualScheduler> or
+                cute::is_same_v<TileScheduler_, PersistentLPTScheduler>,
                 "Unsupported TileScheduler for Intel PVC.");
   using TileSchedulerTag = TileScheduler_;
+  // The LPT scheduler ranks the query blocks on the host and keeps the ranking in the workspace.
+  static constexpr bool LPTScheduler = cute::is_same_v<TileScheduler_, PersistentLPTScheduler>;
   using TileScheduler =
       typename detail::TileSchedulerSelector<TileScheduler_, ArchTag>::Scheduler;
   using TileSchedulerParams = typename TileScheduler::Params;
@@ -170,26 +173,45 @@ public:
 
   // Convert to underlying arguments. In this case, a simple copy for the aliased type.
   static Params to_underlying_arguments(Arguments const &args, void *workspace) {
-    (void)workspace;
+    TileSchedulerParams scheduler;
+    if constexpr (LPTScheduler) {
+      // Query blocks hold 8 tokens, as with XeFlashDecodeIndividualTileScheduler.
+      scheduler = TileScheduler::to_underlying_arguments(args.problem_shape, args.hw_info, 8, get<1>(TileShapeOutput{}),
+                                                         workspace);
+    } else {
+      scheduler = TileScheduler::to_underlying_arguments(args.problem_shape, args.hw_info, TileShapeOutput{});
+    }
     return {args.mode, args.problem_shape,
             CollectiveMainloop::to_underlying_arguments(args.problem_shape, args.mainloop, workspace),
             CollectiveSoftmaxEpilogue::to_underlying_arguments(args.softmax),
             CollectiveEpilogue::to_underlying_arguments(args.problem_shape, args.epilogue, workspace),
-            TileScheduler::to_underlying_arguments(args.problem_shape, args.hw_info, TileShapeOutput{})};
+            scheduler};
   }
 
   static bool can_implement(Arguments const &args) {
     bool mode_implementable = args.mode == gemm::GemmUniversalMode::kGemm or
                               (args.mode == gemm::GemmUniversalMode::kBatched && rank(ProblemShape{}) == 4);
     bool valid_page_size = !PagedKV ? true : args.mainloop.page_size >= QK_SG_N && args.mainloop.page_size % QK_SG_N == 0;
-    return mode_implementable && valid_page_size;
+    bool valid_quant = !CollectiveMainloop::QuantKV || args.mainloop.quant_group_size > 0;
+    return mode_implementable && valid_page_size && valid_quant;
   }
 
-  static int get_workspace_size(Arguments const &args) { return 0; }
+  static int get_workspace_size(Arguments const &args) {
+    if constexpr (LPTScheduler) {
+      return TileScheduler::get_workspace_size(args.problem_shape, 8);
+    } else {
+      return 0;
+    }
+  }
 
   static cutlass::Status initialize_workspace(Arguments const &args, void *workspace = nullptr,
                                               cudaStream_t stream = nullptr, CudaHostAdapter *cuda_adapter = nullptr) {
-    return Status::kSuccess;
+    if constexpr (LPTScheduler) {
+      // Every query block visits all KV splits, so the ranking ignores the causal mask.
+      return TileScheduler::initialize_workspace(args.problem_shape, 8, false, workspace, stream);
+    } else {
+      return Status::kSuccess;
+    }
   }
 
   static dim3 get_grid_shape(Params const &params) {
@@ -258,6 +280,13 @@ public:
 
       auto [seq_len_qo, seq_len_kv, seq_len_kv_cache] = sequence_length_shape;
 
+      if constexpr (LPTScheduler) {
+        // The LPT work list ends with the 8-token query blocks past the end of shorter sequences.
+        if (blk_q_coord * 8 >= seq_len_qo) {
+          continue;
+        }
+      }
+
       Tensor mQ_mkl = cute::get_xe_tensor(make_shape(seq_len_qo, head_size_qk, (is_var_len ? 1 : batch) * num_heads_q));   //(m,k,l)
       Tensor mK_nkl = cute::get_xe_tensor(make_shape(cute::max(seq_len_kv, seq_len_kv_cache), head_size_qk, (is_var_len ? 1 : batch) * num_heads_kv));   //(n,k,l)
       Tensor mV_nkl = cute::get_xe_tensor(make_shape(head_size_vo, cute::max(seq_len_kv, seq_len_kv_cache), (is_var_len ? 1 : batch) * num_heads_kv));   //(n,k,l)
@@ -278,7 +307,27 @@ public:
       const int kv_splits_cache = ceil_div(seq_len_kv_cache, QK_BLK_N);
       const int kv_splits = kv_splits_new + kv_splits_cache;
 
+      // The query sits at key position query_kv_pos of the concatenated [cache, new] keys.
+      const int query_kv_pos = seq_len_kv_cache + seq_len_kv - seq_len_qo + blk_q_coord * QK_SG_M;
+
+      // Sliding window over the concatenated [cache, new] keys: the query only sees keys from window_begin on,
+      // so whole splits below it are skipped and the split holding window_begin is masked.
+      const int window_size = params.mainloop.window_size;
+      const bool LocalMask = window_size > 0;
+      const int window_begin = query_kv_pos - window_size + 1;
+      const int window_tile_begin = cute::max(window_begin, 0);
+      const int split_start = !LocalMask ? 0
+                            : cute::min(window_tile_begin < seq_len_kv_cache ? window_tile_begin / QK_BLK_N
+                                                                             : kv_splits_cache + (window_tile_begin - seq_len_kv_cache) / QK_BLK_N,
+                                        kv_splits - 1);
+
       auto mainloop_params = CollectiveMainloop::get_updated_copies(params.mainloop, params.problem_shape, sequence_length_shape, batch_coord);
+      // Per-KV-head FP8 dequantization scales (1 for non-FP8 K/V or when no scales are given).
+      int kv_head_coord = num_heads_coord / group_heads_q;
+      float const k_scale = CollectiveMainloop::kv_scale(mainloop_params.ptr_K_scale, kv_head_coord);
+      float const v_scale = CollectiveMainloop::kv_scale(mainloop_params.ptr_V_scale, kv_head_coord);
+      // Row of the INT8/INT4 group scales; a subgroup tile starts at token curr_kv_tile_idx * QK_SG_N.
+      int quant_l = batch_coord * num_heads_kv + kv_head_coord;
       // For Decode, QK_BLK_M is set to 1 MMA Atom worth of data (in our case 8), this is because seq_len_qo == 1.
       // So we need to perform atleast 1 MMA op to calculate the output properly. The size required for prefetching
       // Q is small (8 x QK_BLK_K), which leads to the use of a smaller size Prefetch Atom that throws a runtime error on
@@ -299,15 +348,15 @@ public:
       auto pVgV = thr_prefetch_V.partition_S(gV_prefetch);
 
       int kv_tile_idx = sub_group_id / ATOM_N;
-      int kv_cache_tile_idx = kv_tile_idx;
+      int kv_cache_tile_idx = split_start * ATOM_M + kv_tile_idx;
       int tiles_per_page = ceil_div(mainloop_params.page_size, QK_SG_N);
 
       if constexpr (PagedKV) {
-        if (seq_len_kv_cache != 0) {
+        if (split_start < kv_splits_cache) {
           // get physical page idx from page table
           int curr_batch_pages = is_var_len ? mainloop_params.num_pages_per_seq[batch_coord + 1] - mainloop_params.num_pages_per_seq[batch_coord]
                                             : ceil_div(seq_len_kv_cache, mainloop_params.page_size);
-          int curr_page_logical_idx = kv_tile_idx * QK_SG_N / mainloop_params.page_size;
+          int curr_page_logical_idx = (split_start * QK_BLK_N + kv_tile_idx * QK_SG_N) / mainloop_params.page_size;
           int batch_offset = is_var_len ? mainloop_params.num_pages_per_seq[batch_coord] : batch_coord * curr_batch_pages;
           bool valid_page = curr_page_logical_idx < curr_batch_pages;
           if (valid_page) {
@@ -332,8 +381,8 @@ public:
       // required data for matrix K.
       CUTLASS_PRAGMA_UNROLL
       for (int j = 0; j < size<4>(pKgK); j++) {
-        seq_len_kv_cache == 0 ? prefetch(tiled_prefetch_k, pKgK(_, _, _, kv_tile_idx, j))
-                              : prefetch(tiled_prefetch_k_cache, pKgK(_, _, _, kv_cache_tile_idx, j));
+        split_start >= kv_splits_cache ? prefetch(tiled_prefetch_k, pKgK(_, _, _, (split_start - kv_splits_cache) * ATOM_M + kv_tile_idx, j))
+                                       : prefetch(tiled_prefetch_k_cache, pKgK(_, _, _, kv_cache_tile_idx, j));
       }
 
       // Perform the collective scoped MMA
@@ -347,10 +396,21 @@ public:
       auto smem = compat::local_mem<ElementAccumulator[((Int<size(AccumShape{}) + 1>{}) * Num_SGs * SubgroupSize)]>();
       Tensor shmem_max_tensor = make_tensor(make_smem_ptr(smem), make_shape(Int<Num_SGs * FragsM>{}));
 
-      bool is_KV_cache = seq_len_kv_cache != 0;
+      bool is_KV_cache = split_start < kv_splits_cache;
+
+      // mask the keys of a split that lie below window_begin
+      auto apply_window_mask = [&](auto &tSr, int column_offset) {
+        int col_idx = column_offset + kv_tile_idx * QK_SG_N + thread_idx % SubgroupSize;
+        CUTLASS_PRAGMA_UNROLL
+        for (int n = 0; n < FragsN; n++, col_idx += get<1>(MmaAtomShape())) {
+          if (col_idx < window_begin) {
+            tSr(0, 0, n) = ElementAccumulator{-INFINITY};
+          }
+        }
+      };
 
       CUTLASS_PRAGMA_UNROLL
-      for(int split = 0; split < kv_splits - 1; split++) {
+      for(int split = split_start; split < kv_splits - 1; split++) {
         int curr_kv_tile_idx = is_KV_cache ? PagedKV ? kv_cache_tile_idx : split * ATOM_M + kv_tile_idx 
                                            : (split - kv_splits_cache) * ATOM_M + kv_tile_idx;
 
@@ -358,7 +418,8 @@ public:
         clear(tSr);
 
         // Perform GEMM S = Q*K
-        collective_mma.mmaQK(tSr, gQ, gK(_, _, curr_kv_tile_idx / ATOM_M, _), tSr, ceil_div(head_size_qk, QK_BLK_K), mainloop_params, is_KV_cache, curr_kv_tile_idx % ATOM_M);
+        collective_mma.mmaQK(tSr, gQ, gK(_, _, curr_kv_tile_idx / ATOM_M, _), tSr, ceil_div(head_size_qk, QK_BLK_K), mainloop_params, is_KV_cache, curr_kv_tile_idx % ATOM_M, k_scale,
+                             quant_l, curr_kv_tile_idx * QK_SG_N);
 
         // each sub-group gets a different base offset for prefetch to load it's own
         // required data for matrix V.
@@ -390,10 +451,19 @@ public:
           }
         }
 
+        int tile_col_offset = is_KV_cache ? split * QK_BLK_N : seq_len_kv_cache + (split - kv_splits_cache) * QK_BLK_N;
         CollectiveSoftmaxEpilogue softmax(params.softmax);
-        softmax.template operator()<Num_SGs>(split == 0, tSr, max_reg, sum_reg, shmem_max_tensor, out_reg);
+        softmax.template apply_score_mod<get<1>(MmaAtomShape())>(tSr, query_kv_pos, tile_col_offset + kv_tile_idx * QK_SG_N + thread_idx % SubgroupSize,
+                                                                 num_heads_coord);
+
+        if (LocalMask && tile_col_offset < window_begin) {
+          apply_window_mask(tSr, tile_col_offset);
+        }
+
+        softmax.template operator()<Num_SGs>(split == split_start, tSr, max_reg, sum_reg, shmem_max_tensor, out_reg);
 
-        collective_mma.template mmaPV<VSlicer>(out_reg, tSr, gV, out_reg, mainloop_params, is_KV_cache, curr_kv_tile_idx);
+        collective_mma.template mmaPV<VSlicer>(out_reg, tSr, gV, out_reg, mainloop_params, is_KV_cache, curr_kv_tile_idx, v_scale,
+                                                  quant_l, curr_kv_tile_idx * QK_SG_N);
 
         // Prefetch the next Q tile
         CUTLASS_PRAGMA_UNROLL
@@ -418,7 +488,8 @@ public:
 
       int curr_kv_tile_idx = (kv_splits_new - 1) * ATOM_M + kv_tile_idx;
       // Perform GEMM S = Q*K
-      collective_mma.mmaQK(tSr, gQ, gK(_, _, kv_splits_new - 1, _), tSr, ceil_div(head_size_qk, QK_BLK_K), mainloop_params, false, kv_tile_idx);
+      collective_mma.mmaQK(tSr, gQ, gK(_, _, kv_splits_new - 1, _), tSr, ceil_div(head_size_qk, QK_BLK_K), mainloop_params, false, kv_tile_idx, k_scale,
+                           quant_l, curr_kv_tile_idx * QK_SG_N);
 
       // each sub-group gets a different base offset for prefetch to load it's own
       // required data for matrix V.
@@ -427,6 +498,11 @@ public:
         prefetch(tiled_prefetch_v, pVgV(_, _, _, v, curr_kv_tile_idx));
       }
 
+      CollectiveSoftmaxEpilogue softmax(params.softmax);
+      softmax.template apply_score_mod<get<1>(MmaAtomShape())>(tSr, query_kv_pos,
+                                                               seq_len_kv_cache + (kv_splits_new - 1) * QK_BLK_N + kv_tile_idx * QK_SG_N + thread_idx % SubgroupSize,
+                                                               num_heads_coord);
+
       if constexpr (CausalMask) {
         const int required_sgs = ceil_div(seq_len_kv, QK_SG_N);
         if(kv_tile_idx == (required_sgs % ATOM_M) - 1) {
@@ -454,10 +530,14 @@ public:
         }
       }
 
-      CollectiveSoftmaxEpilogue softmax(params.softmax);
-      softmax.template operator()<Num_SGs>((kv_splits - 1) == 0, tSr, max_reg, sum_reg, shmem_max_tensor, out_reg);
+      if (LocalMask && seq_len_kv_cache + (kv_splits_new - 1) * QK_BLK_N < window_begin) {
+        apply_window_mask(tSr, seq_len_kv_cache + (kv_splits_new - 1) * QK_BLK_N);
+      }
 
-      collective_mma.template mmaPV<VSlicer>(out_reg, tSr, gV, out_reg, mainloop_params, false, curr_kv_tile_idx);
+      softmax.template operator()<Num_SGs>((kv_splits - 1) == split_start, tSr, max_reg, sum_reg, shmem_max_tensor, out_reg);
+
+      collective_mma.template mmaPV<VSlicer>(out_reg, tSr, gV, out_reg, mainloop_params, false, curr_kv_tile_idx, v_scale,
+                                                quant_l, curr_kv_tile_idx * QK_SG_N);
 
       // need to apply barrier here to avoid race condition
       auto group = compat::get_nd_item<1>().get_group();
@@ -479,6 +559,11 @@ public:
       Tensor shmem_sum_tensor = make_tensor(make_smem_ptr(shmem_out_tensor.data() + shmem_out_tensor.size()), make_shape(Int<Num_SGs * FragsM>{}));
 
       epilogue(params.problem_shape, sequence_length_shape, blk_coord_mnkl, shmem_out_tensor, sum_reg, shmem_sum_tensor);
+
+      if constexpr (LPTScheduler) {
+        // A persistent work-group reuses the SLM for its next block only once the epilogue has read it.
+        sycl::group_barrier(group);
+      }
     }
   }
 };
@@ -0,0 +1,536 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * Copyright (C) 2025 Intel Corporation, All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/gemm.h"
+#include "cutlass/kernel_hardware_info.hpp"
+
+#include "flash_attention_v2/collective/xe_flash_attn_decode_mma.hpp"
+#include "flash_attention_v2/collective/xe_flash_attn_decode_split_kv_epilogue.hpp"
+#include "flash_attention_v2/kernel/tile_scheduler.hpp"
+
+namespace cutlass::flash_attention::kernel {
+
+template <class ProblemShape, class CollectiveEpilogue>
+class FMHADecodeSplitKVCombine;
+
+template <class ProblemShape, class CollectiveMainloop, class CollectiveSoftmaxEpilogue_, class CollectiveEpilogue, class TileScheduler_ = FlashDecodeSplitKVScheduler>
+class FMHADecodeSplitKV;
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Split-KV (flash-decoding) variant of FMHADecode. The KV sequence of every (batch, head) is partitioned
+// across num_partitions work-groups, each of which stores its unnormalized partial output together with its
+// softmax max and exp-sum to workspace. FMHADecodeSplitKVCombine then merges the partitions.
+template <class ProblemShape_, class CollectiveMainloop_, class CollectiveSoftmaxEpilogue_, class CollectiveEpilogue_, class TileScheduler_>
+class FMHADecodeSplitKV {
+
+public:
+  //
+  // Type Aliases
+  //
+  using ProblemShape = ProblemShape_;
+
+  static_assert(rank(ProblemShape{}) == 8, "ProblemShape{} should be <batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, seq_len_kv_cache, head_size_qk, head_size_vo>");
+
+  // Mainloop derived types
+  using CollectiveMainloop = CollectiveMainloop_;
+  using TileShapeQK = typename CollectiveMainloop::TileShapeQK;
+  using TileShapePV = typename CollectiveMainloop::TileShapePV;
+  using TiledMmaQK = typename CollectiveMainloop::TiledMmaQK;
+  using TiledMmaPV = typename CollectiveMainloop::TiledMmaPV;
+  using ArchTag = typename CollectiveMainloop::ArchTag;
+  using ElementQ = typename CollectiveMainloop::ElementQ;
+  using StrideQ = typename CollectiveMainloop::StrideQ;
+  using ElementK = typename CollectiveMainloop::ElementK;
+  using StrideK = typename CollectiveMainloop::StrideK;
+  using ElementV = typename CollectiveMainloop::ElementV;
+  using StrideV = typename CollectiveMainloop::StrideV;
+  using DispatchPolicy = typename CollectiveMainloop::DispatchPolicy;
+  using ElementAccumulator = typename CollectiveMainloop::ElementAccumulator;
+  using MainloopArguments = typename CollectiveMainloop::Arguments;
+  using MainloopParams = typename CollectiveMainloop::Params;
+
+  using CollectiveSoftmaxEpilogue = CollectiveSoftmaxEpilogue_;
+  using SoftmaxArguments = typename CollectiveSoftmaxEpilogue::Arguments;
+  using SoftmaxParams = typename CollectiveSoftmaxEpilogue::Params;
+
+  static_assert(cute::is_same_v<TileScheduler_, FlashDecodeSplitKVScheduler>,
+                "Unsupported TileScheduler for Intel PVC.");
+  using TileSchedulerTag = TileScheduler_;
+  using TileScheduler =
+      typename detail::TileSchedulerSelector<TileScheduler_, ArchTag>::Scheduler;
+  using TileSchedulerParams = typename TileScheduler::Params;
+
+  // Epilogue derived types
+  using CollectiveEpilogue = CollectiveEpilogue_;
+  using ElementO = typename CollectiveEpilogue::ElementO;
+  using StrideO = typename CollectiveEpilogue::StrideO;
+  using ElementLSE = typename CollectiveEpilogue::ElementLSE;
+  using EpilogueArguments = typename CollectiveEpilogue::Arguments;
+  using EpilogueParams = typename CollectiveEpilogue::Params;
+  using TileShapeOutput = typename CollectiveEpilogue::TileShapeOutput;
+  using TiledMmaOutput = typename CollectiveEpilogue::TiledMmaOutput;
+  static_assert(cute::is_same_v<ElementAccumulator, typename CollectiveEpilogue::ElementAccumulator>,
+                "Mainloop and epilogue do not agree on accumulator value type.");
+
+  using CombineKernel = FMHADecodeSplitKVCombine<ProblemShape, CollectiveEpilogue>;
+
+  static constexpr int SharedStorageSize = 0;
+
+  static constexpr bool CausalMask = CollectiveMainloop::CausalMask;
+  static constexpr bool PagedKV = CollectiveMainloop::PagedKV;
+  static constexpr int SubgroupSize = CollectiveMainloop::SubgroupSize; // sub_group size
+  static constexpr uint32_t MaxThreadsPerBlock = CollectiveMainloop::MaxThreadsPerBlock;
+  using MmaAtomShape = typename CollectiveMainloop::MmaAtomShape;           // 8,16,16
+
+  static constexpr int QK_BLK_M = CollectiveMainloop::QK_BLK_M;
+  static constexpr int QK_BLK_N = CollectiveMainloop::QK_BLK_N;
+  static constexpr int QK_BLK_K = CollectiveMainloop::QK_BLK_K;
+
+  static constexpr int QK_ATOM_N = CollectiveMainloop::QK_ATOM_N;
+  static constexpr int QK_ATOM_K = CollectiveMainloop::QK_ATOM_K;
+
+  using SubgroupTileShapeQK = typename CollectiveMainloop::SubgroupTileShapeQK;
+  using SubgroupTileShapePV = typename CollectiveMainloop::SubgroupTileShapePV;
+  static constexpr int QK_SG_M = CollectiveMainloop::QK_SG_M;
+  static constexpr int QK_SG_N = CollectiveMainloop::QK_SG_N;
+
+  static constexpr int ATOM_M = CollectiveMainloop::ATOM_M;
+  static constexpr int ATOM_N = CollectiveMainloop::ATOM_N;
+  static constexpr int ATOM_K = CollectiveMainloop::ATOM_K;
+
+  static constexpr int Num_SGs = ATOM_N * ATOM_M * ATOM_K;
+  static constexpr int Vec = CollectiveMainloop::Vec; // 8
+  static constexpr int FragsM = CollectiveMainloop::FragsM;  // 1
+  static constexpr int FragsN = CollectiveMainloop::FragsNS; // 4
+
+  static constexpr int VSlicer = get<1>(TileShapeOutput{}) / (get<1>(TileShapePV{}) * ATOM_N);
+  using AccumShape =  decltype(make_shape(Int<Vec>{}, Int<FragsM>{}, get<1>(TileShapePV{}) / get<1>(MmaAtomShape()), Int<VSlicer>{}));
+
+  static_assert(FragsM == 1, "Limit the seq_len_qo to 1 MMA Atom worth of data per work-group.");
+
+  static constexpr bool is_var_len = CollectiveMainloop::is_var_len;
+
+  // Kernel level shared memory storage
+  struct SharedStorage {
+    using EpilogueTensorStorage = typename CollectiveEpilogue::TensorStorage;
+    EpilogueTensorStorage epilogue;
+  };
+
+  // Device side arguments
+  struct Arguments {
+    gemm::GemmUniversalMode mode{};
+    ProblemShape problem_shape{};
+    MainloopArguments mainloop{};
+    SoftmaxArguments softmax{};
+    EpilogueArguments epilogue{};
+    KernelHardwareInfo hw_info{};
+    int num_kv_partitions = 0; // <= 0 selects the partition count from hw_info.sm_count
+  };
+
+  // Kernel entry point API
+  struct Params {
+    gemm::GemmUniversalMode mode;
+    ProblemShape problem_shape;
+    MainloopParams mainloop;
+    SoftmaxParams softmax;
+    EpilogueParams epilogue;
+    TileSchedulerParams scheduler;
+  };
+
+  //
+  // Methods
+  //
+
+  static int get_num_partitions(Arguments const &args) {
+    if (args.num_kv_partitions > 0) {
+      return args.num_kv_partitions;
+    }
+    return TileScheduler::template get_num_partitions<Num_SGs>(args.problem_shape, args.hw_info, TileShapeOutput{});
+  }
+
+  static Params to_underlying_arguments(Arguments const &args, void *workspace) {
+    int num_partitions = get_num_partitions(args);
+    return {args.mode, args.problem_shape,
+            CollectiveMainloop::to_underlying_arguments(args.problem_shape, args.mainloop, workspace),
+            CollectiveSoftmaxEpilogue::to_underlying_arguments(args.softmax),
+            CollectiveEpilogue::to_underlying_arguments(args.problem_shape, args.epilogue, workspace, num_partitions),
+            TileScheduler::to_underlying_arguments(args.problem_shape, args.hw_info, TileShapeOutput{}, num_partitions)};
+  }
+
+  // Parameters of the combine pass that has to run after this kernel
+  static typename CombineKernel::Params to_combine_params(Params const &params) {
+    return {params.problem_shape, params.epilogue};
+  }
+
+  static bool can_implement(Arguments const &args) {
+    bool mode_implementable = args.mode == gemm::GemmUniversalMode::kGemm or
+                              (args.mode == gemm::GemmUniversalMode::kBatched && rank(ProblemShape{}) == 4);
+    bool valid_page_size = !PagedKV ? true : args.mainloop.page_size >= QK_SG_N && args.mainloop.page_size % QK_SG_N == 0;
+    bool valid_quant = !CollectiveMainloop::QuantKV || args.mainloop.quant_group_size > 0;
+    return mode_implementable && valid_page_size && valid_quant;
+  }
+
+  static int get_workspace_size(Arguments const &args) {
+    return CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue, get_num_partitions(args));
+  }
+
+  static cutlass::Status initialize_workspace(Arguments const &args, void *workspace = nullptr,
+                                              cudaStream_t stream = nullptr, CudaHostAdapter *cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  static dim3 get_grid_shape(Params const &params) {
+    return TileScheduler::template get_grid_shape<Num_SGs>(params.scheduler);
+  }
+
+  static dim3 get_block_shape() { return dim3(MaxThreadsPerBlock, 1, 1); }
+
+  CUTLASS_DEVICE
+  Shape<int, int, int> get_sequence_length_shape(ProblemShape const& problem_shape, int const& batch) {
+    if constexpr (is_var_len) {
+      return cutlass::fmha::collective::apply_variable_length(select<3, 4, 5>(problem_shape), batch);
+    } else {
+      return select<3, 4, 5>(problem_shape);
+    }
+  }
+
+  CUTLASS_DEVICE
+  void operator()(Params const &params, char *smem_buf) {
+    SharedStorage &shared_storage = *reinterpret_cast<SharedStorage *>(smem_buf);
+    // Preconditions
+    CUTE_STATIC_ASSERT(is_static<TileShapeQK>::value);
+    CUTE_STATIC_ASSERT(is_static<TileShapePV>::value);
+    // Separate out problem shape for convenience
+    auto& batch = get<0>(params.problem_shape);
+    auto& num_heads_q = get<1>(params.problem_shape);
+    auto& num_heads_kv = get<2>(params.problem_shape);
+    auto group_heads_q = num_heads_q / num_heads_kv;
+    auto& head_size_qk = get<6>(params.problem_shape);
+    auto& head_size_vo = get<7>(params.problem_shape);
+    // Preconditions
+    static_assert(cute::rank(StrideQ{}) == 3, "StrideQ must be rank-3: [seq_len_qo, head_size_qk, batch * num_heads_q].");
+    static_assert(cute::rank(StrideK{}) == 3, "StrideK must be rank-3: [head_size_qk, seq_len_kv, batch * num_heads_kv].");
+    static_assert(cute::rank(StrideV{}) == 3, "StrideV must be rank-3: [seq_len_kv, head_size_vo, batch * num_heads_kv].");
+
+    // Assuming Tiling for cached and new key-value pairs is same and they use the same copy atom.
+    static_assert(cute::is_same_v<decltype(params.mainloop.gmem_tiled_copy_k), decltype(params.mainloop.gmem_tiled_copy_k_cache)>, "Copy Atom for new and cached keys needs to be the same.");
+    static_assert(cute::is_same_v<decltype(params.mainloop.gmem_tiled_copy_v), decltype(params.mainloop.gmem_tiled_copy_v_cache)>, "Copy Atom for new and cached values needs to be the same.");
+
+    int thread_idx = int(ThreadIdxX());
+    int sub_group_id = thread_idx / SubgroupSize;
+
+    TileScheduler tile_scheduler{params.scheduler};
+
+    CUTLASS_PRAGMA_NO_UNROLL
+    for (; tile_scheduler.is_valid(); ++tile_scheduler) {
+      auto blk_coord = tile_scheduler.get_block_coord(); // head_size_blk_idx, seq_len_blk_idx, batch_blk_idx, num_heads_blk_idx, partition_idx
+
+      auto blk_q_coord = get<1>(blk_coord); // seq_len_q_blk_idx
+      auto blk_v_coord = get<0>(blk_coord); // head_size_blk_idx
+      auto batch_coord = get<2>(blk_coord); // batch_blk_idx
+      auto num_heads_coord = get<3>(blk_coord); // num_heads_blk_idx
+      auto partition_coord = get<4>(blk_coord); // partition_idx
+
+      // See FMHADecode for the meaning of blk_l_coord. The workspace is always indexed by batch and head.
+      auto blk_l_coord = is_var_len ? num_heads_coord : batch_coord * num_heads_q + num_heads_coord;
+      int batch_head_coord = batch_coord * num_heads_q + num_heads_coord;
+
+      // sequence_length_shape = [seq_len_qo, seq_len_kv, seq_len_kv_cache]
+      auto sequence_length_shape = get_sequence_length_shape(params.problem_shape, batch_coord);
+
+      auto [seq_len_qo, seq_len_kv, seq_len_kv_cache] = sequence_length_shape;
+
+      Tensor mQ_mkl = cute::get_xe_tensor(make_shape(seq_len_qo, head_size_qk, (is_var_len ? 1 : batch) * num_heads_q));   //(m,k,l)
+      Tensor mK_nkl = cute::get_xe_tensor(make_shape(cute::max(seq_len_kv, seq_len_kv_cache), head_size_qk, (is_var_len ? 1 : batch) * num_heads_kv));   //(n,k,l)
+      Tensor mV_nkl = cute::get_xe_tensor(make_shape(head_size_vo, cute::max(seq_len_kv, seq_len_kv_cache), (is_var_len ? 1 : batch) * num_heads_kv));   //(n,k,l)
+
+      Tensor mQ_mk = mQ_mkl(_, _, blk_l_coord);                                                    // (m,k)
+      Tensor mK_nk = mK_nkl(_, _, blk_l_coord / group_heads_q);                                    // (n,k)
+      Tensor mV_nk = mV_nkl(_, _, blk_l_coord / group_heads_q);                                    // (n,k)
+
+      auto gQ = local_tile(mQ_mk, TileShapeQK{}, make_coord(blk_q_coord, _, _), Step<_1,  X, _1>{});
+      auto gK = local_tile(mK_nk, TileShapeQK{}, make_coord(_, _, _), Step<X, _1, _1>{});
+      auto gV = local_tile(mV_nk, TileShapeOutput{}, make_coord(_, blk_v_coord, _), Step<X, _1, _1>{});
+
+      auto gK_prefetch = local_tile(mK_nk, SubgroupTileShapeQK{}, make_coord(_, _, _), Step<X, _1, _1>{});
+      auto gV_prefetch = local_tile(mV_nk, SubgroupTileShapePV{}, make_coord(_, _, _), Step<X, _1, _1>{});
+
+      // Cached tiles come first, followed by the new tiles. Each partition processes a contiguous range of
+      // splits; only the partition owning the last split applies the causal and remainder masks.
+      const int kv_splits_new = ceil_div(seq_len_kv, QK_BLK_N);
+      const int kv_splits_cache = ceil_div(seq_len_kv_cache, QK_BLK_N);
+      const int kv_splits = kv_splits_new + kv_splits_cache;
+
+      // The query sits at key position query_kv_pos of the concatenated [cache, new] keys.
+      const int query_kv_pos = seq_len_kv_cache + seq_len_kv - seq_len_qo + blk_q_coord * QK_SG_M;
+
+      // Sliding window, see FMHADecode: splits below window_begin are dropped before partitioning.
+      const int window_size = params.mainloop.window_size;
+      const bool LocalMask = window_size > 0;
+      const int window_begin = query_kv_pos - window_size + 1;
+      const int window_tile_begin = cute::max(window_begin, 0);
+      const int split_start = !LocalMask ? 0
+                            : cute::min(window_tile_begin < seq_len_kv_cache ? window_tile_begin / QK_BLK_N
+                                                                             : kv_splits_cache + (window_tile_begin - seq_len_kv_cache) / QK_BLK_N,
+                                        kv_splits - 1);
+
+      const int splits_per_partition = ceil_div(kv_splits - split_start, params.epilogue.num_partitions);
+      const int split_begin = cute::min(split_start + partition_coord * splits_per_partition, kv_splits);
+      const int split_end = cute::min(split_begin + splits_per_partition, kv_splits);
+
+      auto mainloop_params = CollectiveMainloop::get_updated_copies(params.mainloop, params.problem_shape, sequence_length_shape, batch_coord);
+      // Per-KV-head FP8 dequantization scales (1 for non-FP8 K/V or when no scales are given).
+      int kv_head_coord = num_heads_coord / group_heads_q;
+      float const k_scale = CollectiveMainloop::kv_scale(mainloop_params.ptr_K_scale, kv_head_coord);
+      float const v_scale = CollectiveMainloop::kv_scale(mainloop_params.ptr_V_scale, kv_head_coord);
+      // Row of the INT8/INT4 group scales; a subgroup tile starts at token curr_kv_tile_idx * QK_SG_N.
+      int quant_l = batch_coord * num_heads_kv + kv_head_coord;
+      // Redundant Q prefetch, see FMHADecode.
+      auto tiled_prefetch_q = cute::prefetch_selector<Shape<Int<QK_BLK_M * ATOM_M>, Int<QK_BLK_K>>, Num_SGs>(mainloop_params.gmem_tiled_copy_q);
+      auto tiled_prefetch_k = cute::prefetch_selector<decltype(take<1,3>(SubgroupTileShapeQK{})), Num_SGs>(mainloop_params.gmem_tiled_copy_k);
+      auto tiled_prefetch_v = cute::prefetch_selector<decltype(take<1,3>(SubgroupTileShapePV{})), Num_SGs>(mainloop_params.gmem_tiled_copy_v);
+
+      auto tiled_prefetch_k_cache = cute::prefetch_selector<decltype(take<1,3>(SubgroupTileShapeQK{})), Num_SGs>(mainloop_params.gmem_tiled_copy_k_cache);
+      auto tiled_prefetch_v_cache = cute::prefetch_selector<decltype(take<1,3>(SubgroupTileShapePV{})), Num_SGs>(mainloop_params.gmem_tiled_copy_v_cache);
+
+      auto thr_prefetch_Q = tiled_prefetch_q.get_slice(thread_idx);
+      auto thr_prefetch_K = tiled_prefetch_k.get_slice(thread_idx);
+      auto thr_prefetch_V = tiled_prefetch_v.get_slice(thread_idx);
+      auto pQgQ = thr_prefetch_Q.partition_S(gQ);
+      auto pKgK = thr_prefetch_K.partition_S(gK_prefetch);
+      auto pVgV = thr_prefetch_V.partition_S(gV_prefetch);
+
+      int kv_tile_idx = sub_group_id / ATOM_N;
+      int tiles_per_page = ceil_div(mainloop_params.page_size, QK_SG_N);
+      int curr_batch_pages = 0;
+      int batch_offset = 0;
+      if constexpr (PagedKV) {
+        curr_batch_pages = is_var_len ? mainloop_params.num_pages_per_seq[batch_coord + 1] - mainloop_params.num_pages_per_seq[batch_coord]
+                                      : ceil_div(seq_len_kv_cache, mainloop_params.page_size);
+        batch_offset = is_var_len ? mainloop_params.num_pages_per_seq[batch_coord] : batch_coord * curr_batch_pages;
+      }
+
+      // Tile of K/V processed by this subgroup for the given split
+      auto get_kv_tile_idx = [&](int split) -> int {
+        if (split >= kv_splits_cache) {
+          return (split - kv_splits_cache) * ATOM_M + kv_tile_idx;
+        }
+        if constexpr (PagedKV) {
+          // get physical page idx from page table
+          int curr_page_logical_idx = (split * QK_BLK_N + kv_tile_idx * QK_SG_N) / mainloop_params.page_size;
+          if (curr_page_logical_idx < curr_batch_pages) {
+            return mainloop_params.ptr_page_table[
+                      batch_offset +                     // page table for this batch
+                      curr_page_logical_idx              // tile idx to logical page idx
+                  ] * tiles_per_page +               // base block idx of physical page
+                  kv_tile_idx % tiles_per_page;    // offset within page
+          }
+          return curr_batch_pages * tiles_per_page; // push idx out of bounds to respect the boundary between batches
+        } else {
+          return split * ATOM_M + kv_tile_idx;
+        }
+      };
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size<3>(pQgQ); i++) {
+        prefetch(tiled_prefetch_q, pQgQ(_, _, _, i));
+      }
+
+      int curr_kv_tile_idx = get_kv_tile_idx(split_begin);
+      if (split_begin < split_end) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int j = 0; j < size<4>(pKgK); j++) {
+          split_begin < kv_splits_cache ? prefetch(tiled_prefetch_k_cache, pKgK(_, _, _, curr_kv_tile_idx, j))
+                                        : prefetch(tiled_prefetch_k, pKgK(_, _, _, curr_kv_tile_idx, j));
+        }
+      }
+
+      // Perform the collective scoped MMA
+      CollectiveMainloop collective_mma;
+
+      ElementAccumulator max_reg = ElementAccumulator{-INFINITY};
+      auto sum_reg = ElementAccumulator{0};
+      Tensor out_reg = make_tensor<ElementAccumulator>(AccumShape{});
+      clear(out_reg);
+
+      auto smem = compat::local_mem<ElementAccumulator[((Int<size(AccumShape{}) + 1>{}) * Num_SGs * SubgroupSize)]>();
+      Tensor shmem_max_tensor = make_tensor(make_smem_ptr(smem), make_shape(Int<Num_SGs * FragsM>{}));
+
+      CUTLASS_PRAGMA_NO_UNROLL
+      for (int split = split_begin; split < split_end; split++) {
+        bool is_KV_cache = split < kv_splits_cache;
+
+        Tensor tSr = make_tensor<ElementAccumulator>(Shape<Int<Vec>, Int<FragsM>, Int<FragsN>>{});
+        clear(tSr);
+
+        // Perform GEMM S = Q*K
+        collective_mma.mmaQK(tSr, gQ, gK(_, _, curr_kv_tile_idx / ATOM_M, _), tSr, ceil_div(head_size_qk, QK_BLK_K), mainloop_params, is_KV_cache, curr_kv_tile_idx % ATOM_M, k_scale,
+                             quant_l, curr_kv_tile_idx * QK_SG_N);
+
+        // each sub-group gets a different base offset for prefetch to load it's own
+        // required data for matrix V.
+        CUTLASS_PRAGMA_UNROLL
+        for(int v = 0; v < VSlicer; v++) {
+          is_KV_cache ? prefetch(tiled_prefetch_v_cache, pVgV(_, _, _, v, curr_kv_tile_idx))
+                      : prefetch(tiled_prefetch_v, pVgV(_, _, _, v, curr_kv_tile_idx));
+        }
+
+        int tile_col_offset = is_KV_cache ? split * QK_BLK_N : seq_len_kv_cache + (split - kv_splits_cache) * QK_BLK_N;
+        CollectiveSoftmaxEpilogue softmax(params.softmax);
+        softmax.template apply_score_mod<get<1>(MmaAtomShape())>(tSr, query_kv_pos, tile_col_offset + kv_tile_idx * QK_SG_N + thread_idx % SubgroupSize,
+                                                                 num_heads_coord);
+
+        if (split == kv_splits - 1) {
+          if constexpr (CausalMask) {
+            const int required_sgs = ceil_div(seq_len_kv, QK_SG_N);
+            if(kv_tile_idx == (required_sgs % ATOM_M) - 1) {
+              int column_offset = seq_len_kv - seq_len_qo + seq_len_kv_cache;
+              int col_idx = (kv_tile_idx + (kv_splits_new - 1) * ATOM_M) * QK_SG_N + thread_idx % SubgroupSize;
+              int row_idx = blk_q_coord * QK_SG_M; // Use Vec based on seq_len_qo
+              CUTLASS_PRAGMA_UNROLL
+              for (int n = 0; n < FragsN; n++, col_idx += get<1>(MmaAtomShape())) { // 4
+                if (col_idx - column_offset > row_idx + seq_len_kv_cache) {
+                  tSr(0, 0, n) = ElementAccumulator{-INFINITY};
+                }
+              }
+            }
+          }
+
+          if (seq_len_kv % QK_BLK_N != 0) {
+            int col_idx = (kv_tile_idx + (kv_splits_new - 1) * ATOM_M) * QK_SG_N + thread_idx % SubgroupSize;
+            int remainder = seq_len_kv % QK_BLK_N;
+            int column_offset = (kv_splits_new - 1) * QK_BLK_N + kv_splits_cache * QK_BLK_N;
+            CUTLASS_PRAGMA_UNROLL
+            for (int n = 0; n < FragsN; n++, col_idx += get<1>(MmaAtomShape())) {
+              if (col_idx - column_offset >= remainder) {
+                tSr(0, 0, n) = ElementAccumulator{-INFINITY};
+              }
+            }
+          }
+        }
+
+        if (LocalMask && tile_col_offset < window_begin) {
+          int col_idx = tile_col_offset + kv_tile_idx * QK_SG_N + thread_idx % SubgroupSize;
+          CUTLASS_PRAGMA_UNROLL
+          for (int n = 0; n < FragsN; n++, col_idx += get<1>(MmaAtomShape())) {
+            if (col_idx < window_begin) {
+              tSr(0, 0, n) = ElementAccumulator{-INFINITY};
+            }
+          }
+        }
+
+        softmax.template operator()<Num_SGs>(split == split_begin, tSr, max_reg, sum_reg, shmem_max_tensor, out_reg);
+
+        collective_mma.template mmaPV<VSlicer>(out_reg, tSr, gV, out_reg, mainloop_params, is_KV_cache, curr_kv_tile_idx, v_scale,
+                                                  quant_l, curr_kv_tile_idx * QK_SG_N);
+
+        if (split + 1 < split_end) {
+          curr_kv_tile_idx = get_kv_tile_idx(split + 1);
+          // each sub-group gets a different base offset for prefetch to load it's own
+          // required data for matrix K.
+          CUTLASS_PRAGMA_UNROLL
+          for (int j = 0; j < size<4>(pKgK); j++) {
+            split + 1 < kv_splits_cache ? prefetch(tiled_prefetch_k_cache, pKgK(_, _, _, curr_kv_tile_idx, j))
+                                        : prefetch(tiled_prefetch_k, pKgK(_, _, _, curr_kv_tile_idx, j));
+          }
+        }
+      }
+
+      // need to apply barrier here to avoid race condition
+      auto group = compat::get_nd_item<1>().get_group();
+      sycl::group_barrier(group);
+
+      Tensor shmem_out_tensor = make_tensor(make_smem_ptr(smem), make_shape(Int<(size(AccumShape{})) * SubgroupSize * Num_SGs>{}));
+      // write output to SLM
+      int idx = (thread_idx % SubgroupSize) + (sub_group_id * out_reg.size() * SubgroupSize);
+      // only the first row has actual data, rest of the rows are invalid.
+      CUTLASS_PRAGMA_UNROLL
+      for(int i = 0; i < Int<size(AccumShape{})>{}; i++) {
+        shmem_out_tensor(idx + i * SubgroupSize) = out_reg(i);
+      }
+
+      CollectiveEpilogue epilogue{params.epilogue, shared_storage.epilogue};
+      auto blk_coord_mnkl = make_coord(blk_q_coord, blk_v_coord, _, blk_l_coord);
+
+      Tensor shmem_sum_tensor = make_tensor(make_smem_ptr(shmem_out_tensor.data() + shmem_out_tensor.size()), make_shape(Int<Num_SGs * FragsM>{}));
+
+      // An empty partition stores max = -inf and sum = 0, which the combine pass ignores.
+      ElementAccumulator max_scaled = max_reg * params.softmax.scale;
+      epilogue(params.problem_shape, sequence_length_shape, blk_coord_mnkl, batch_head_coord, partition_coord,
+               shmem_out_tensor, max_scaled, sum_reg, shmem_sum_tensor);
+    }
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Merges the partial results of FMHADecodeSplitKV. One work-group per (batch * head, query row).
+template <class ProblemShape_, class CollectiveEpilogue_>
+class FMHADecodeSplitKVCombine {
+
+public:
+  using ProblemShape = ProblemShape_;
+  using CollectiveEpilogue = CollectiveEpilogue_;
+  using EpilogueParams = typename CollectiveEpilogue::Params;
+  using DispatchPolicy = typename CollectiveEpilogue::DispatchPolicy;
+
+  static constexpr int SharedStorageSize = 0;
+  static constexpr int SubgroupSize = CollectiveEpilogue::SubgroupSize;
+  static constexpr uint32_t MaxThreadsPerBlock = 4 * SubgroupSize;
+
+  struct Params {
+    ProblemShape problem_shape;
+    EpilogueParams epilogue;
+  };
+
+  static dim3 get_grid_shape(Params const &params) {
+    auto [batch, num_heads_q, seq_len_qo] = select<0, 1, 3>(params.problem_shape);
+    return dim3(batch * num_heads_q, static_cast<int>(seq_len_qo), 1);
+  }
+
+  static dim3 get_block_shape() { return dim3(MaxThreadsPerBlock, 1, 1); }
+
+  CUTLASS_DEVICE
+  void operator()(Params const &params, char *smem_buf) {
+    (void)smem_buf;
+    CollectiveEpilogue::combine(params.epilogue, params.problem_shape, BlockIdxX(), BlockIdxY(),
+                                int(ThreadIdxX()), MaxThreadsPerBlock);
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::flash_attention::kernel
@@ -78,8 +78,11 @@ public:
   using SoftmaxParams = typename CollectiveSoftmaxEpilogue::Params;
   
   static_assert(cute::is_void_v<TileScheduler_> or cute::is_same_v<TileScheduler_, PersistentScheduler> or 
-    cute::is_same_v<TileScheduler_, IndividualScheduler>, "Unsupported TileScheduler for Intel Xe.");
+    cute::is_same_v<TileScheduler_, IndividualScheduler> or cute::is_same_v<TileScheduler_, PersistentLPTScheduler>,
+    "Unsupported TileScheduler for Intel Xe.");
   using TileSchedulerTag = TileScheduler_;
+  // The LPT scheduler ranks the query blocks on the host and keeps the ranking in the workspace.
+  static constexpr bool LPTScheduler = cute::is_same_v<TileScheduler_, PersistentLPTScheduler>;
   using TileScheduler = typename detail::TileSchedulerSelector<TileScheduler_, ArchTag>::Scheduler;
   using TileSchedulerParams = typename TileScheduler::Params;
   
@@ -165,12 +168,18 @@ public:
 
   // Convert to underlying arguments. In this case, a simple copy for the aliased type.
   static Params to_underlying_arguments(Arguments const &args, void *workspace) {
-    (void)workspace;
+    TileSchedulerParams scheduler;
+    if constexpr (LPTScheduler) {
+      scheduler = TileScheduler::to_underlying_arguments(args.problem_shape, args.hw_info, get<0>(TileShapeOutput{}),
+                                                         get<1>(TileShapeOutput{}), workspace);
+    } else {
+      scheduler = TileScheduler::to_underlying_arguments(args.problem_shape, args.hw_info, TileShapeOutput{});
+    }
     return {args.mode, args.problem_shape,
             CollectiveMainloop::to_underlying_arguments(args.problem_shape, args.mainloop, workspace),
             CollectiveSoftmaxEpilogue::to_underlying_arguments(args.softmax),
             CollectiveEpilogue::to_underlying_arguments(args.problem_shape, args.epilogue, workspace),
-            TileScheduler::to_underlying_arguments(args.problem_shape, args.hw_info, TileShapeOutput{})};
+            scheduler};
   }
 
   static bool can_implement(Arguments const &args) {
@@ -179,11 +188,21 @@ public:
     return mode_implementable;
   }
 
-  static int get_workspace_size(Arguments const &args) { return 0; }
+  static int get_workspace_size(Arguments const &args) {
+    if constexpr (LPTScheduler) {
+      return TileScheduler::get_workspace_size(args.problem_shape, get<0>(TileShapeOutput{}));
+    } else {
+      return 0;
+    }
+  }
 
   static cutlass::Status initialize_workspace(Arguments const &args, void *workspace = nullptr,
                                               cudaStream_t stream = nullptr, CudaHostAdapter *cuda_adapter = nullptr) {
-    return Status::kSuccess;
+    if constexpr (LPTScheduler) {
+      return TileScheduler::initialize_workspace(args.problem_shape, get<0>(TileShapeOutput{}), CausalMask, workspace, stream);
+    } else {
+      return Status::kSuccess;
+    }
   }
 
   static dim3 get_grid_shape(Params const &params) {
@@ -265,6 +284,14 @@ public:
         continue;
       }
 
+      // Sliding window: the first row of this subgroup only sees keys from window_begin on, so whole KV tiles
+      // below it are skipped. Tiles starting before window_mask_end still hold out-of-window keys for some row.
+      const int window_size = params.mainloop.window_size;
+      const bool LocalMask = window_size > 0;
+      const int window_begin = seq_coord - discard_seq_coord + full_tile_offset - window_size + 1;
+      const int window_mask_end = window_begin + QK_SG_M - 1;
+      const int nblock_start = LocalMask ? cute::min(cute::max(window_begin, 0) / QK_BLK_N, nblock_limit - 1) : 0;
+
       Tensor mQ_mkl = cute::get_xe_tensor(make_shape(seq_len_qo, head_size_qk, (is_var_len ? 1 : batch) * num_heads_q));   //(m,k,l)
       Tensor mK_nkl = cute::get_xe_tensor(make_shape(seq_len_kv, head_size_qk, (is_var_len ? 1 : batch) * num_head_kv));   //(n,k,l)
       Tensor mV_nkl = cute::get_xe_tensor(make_shape(head_size_vo, seq_len_kv, (is_var_len ? 1 : batch) * num_head_kv));   //(n,k,l)
@@ -295,7 +322,7 @@ public:
       for (int j = 0; j < size<4>(pKgK); j++) {
         CUTLASS_PRAGMA_UNROLL
         for (int i = 0; i < DispatchPolicy::Stages; i++) {
-          prefetch(tiled_prefetch_k, pKgK(_, _, _ , i, j));
+          prefetch(tiled_prefetch_k, pKgK(_, _, _ , nblock_start + i, j));
         }
       }
 
@@ -314,10 +341,30 @@ public:
       CollectiveMainloop collective_mma;
       // when causal mask is true. It is not possible to set the scope
       // of the barrier to workgroup level as the number n block is
-      // different for each subgroup due to triangular nature of causal based operation
-      static constexpr int barrier_scope = CausalMask ? 3 : 2;
+      // different for each subgroup due to triangular nature of causal based operation.
+      // The same holds for the first n block of a sliding window.
+      const int barrier_scope = (CausalMask || LocalMask) ? 3 : 2;
+
+      // mask the elements of a tile where i - j >= window_size
+      auto apply_window_mask = [&](auto &tSr, int nblock) {
+        const int item_id = thread_idx % SubgroupSize;
+        int col_idx = item_id + nblock * QK_BLK_N;
+        CUTLASS_PRAGMA_UNROLL
+        for (int n = 0; n < FragsN; n++, col_idx += get<1>(MmaAtomShape())) {
+          CUTLASS_PRAGMA_UNROLL
+          for (int m = 0; m < FragsM; m++) {
+            int row_idx = m * Vec + seq_coord;
+            CUTLASS_PRAGMA_UNROLL
+            for (int row = 0; row < Vec; row++, row_idx++) {
+              if (row_idx - discard_seq_coord + full_tile_offset - col_idx >= window_size) {
+                tSr(row, m, n) = ElementAccumulator{-INFINITY};
+              }
+            }
+          }
+        }
+      };
       // MAIN LOOP: loop over K and V, perform fused attention + online softmax
-      for (int nblock = 0; nblock < nblock_limit - 1; nblock++) {
+      for (int nblock = nblock_start; nblock < nblock_limit - 1; nblock++) {
         barrier_arrive(barrier_scope);
         // 1) Load K (performed inside mmaQK)
         // 2) Create Tensor S
@@ -334,7 +381,14 @@ public:
         }
 
         CollectiveSoftmaxEpilogue softmax(params.softmax);
-        softmax(nblock == 0, tSr, max_reg, sum_reg, out_reg);
+        softmax.template apply_score_mod<get<1>(MmaAtomShape())>(tSr, seq_coord - discard_seq_coord + full_tile_offset,
+                                                                 nblock * QK_BLK_N + thread_idx % SubgroupSize, num_heads_coord);
+
+        if (LocalMask && nblock * QK_BLK_N < window_mask_end) {
+          apply_window_mask(tSr, nblock);
+        }
+
+        softmax(nblock == nblock_start, tSr, max_reg, sum_reg, out_reg);
 
         collective_mma.template mmaPV<VSlicer>(out_reg, tSr, gV(_, _ , nblock), out_reg, mainloop_params);
         
@@ -357,6 +411,9 @@ public:
       for(int i=0; i< size<1>(pVgV); i++) {
         prefetch(tiled_prefetch_v, pVgV(_, i, _ , nblock_limit - 1));
       }
+      CollectiveSoftmaxEpilogue softmax(params.softmax);
+      softmax.template apply_score_mod<get<1>(MmaAtomShape())>(tSr, seq_coord - discard_seq_coord + full_tile_offset,
+                                                               (nblock_limit - 1) * QK_BLK_N + thread_idx % SubgroupSize, num_heads_coord);
       if constexpr (CausalMask) {
         // BAND Matrix
         // mask the elements of each tile where j > i
@@ -376,6 +433,9 @@ public:
           }
         }
       }
+      if (LocalMask && (nblock_limit - 1) * QK_BLK_N < window_mask_end) {
+        apply_window_mask(tSr, nblock_limit - 1);
+      }
       // Add masking for partial tiles at the end block
       if (seq_len % QK_BLK_N != 0) {
         const int remainder = seq_len % QK_BLK_N;
@@ -395,8 +455,7 @@ public:
           }
         }
       }
-      CollectiveSoftmaxEpilogue softmax(params.softmax);
-      softmax((nblock_limit - 1) == 0, tSr, max_reg, sum_reg, out_reg);
+      softmax((nblock_limit - 1) == nblock_start, tSr, max_reg, sum_reg, out_reg);
 
       collective_mma.template mmaPV<VSlicer>(out_reg, tSr,  gV(_, _ , nblock_limit - 1), out_reg, mainloop_params);
 
@@ -268,11 +268,25 @@ public:
       const int nblock_cache = cute::ceil_div(seq_len_kv_cache, QK_BLK_N);
       const int nblock_limit = nblock_cache + nblock_new;
 
-      int tiles_per_page = params.mainloop.page_size / QK_BLK_N;
-
       if(CausalMask && seq_coord < discard_seq_coord ) { // 1024 =0
         continue;
       }
+
+      // Query row r sits at key position r + query_kv_offset of the concatenated [cache, new] keys.
+      const int query_kv_offset = seq_len_kv_cache - discard_seq_coord + full_tile_offset;
+
+      // Sliding window over the concatenated [cache, new] keys: the first row of this subgroup only sees keys from
+      // window_begin on, so whole KV tiles below it are skipped. Tiles starting before window_mask_end still hold
+      // out-of-window keys for some row.
+      const int window_size = params.mainloop.window_size;
+      const bool LocalMask = window_size > 0;
+      const int window_begin = seq_coord + query_kv_offset - window_size + 1;
+      const int window_mask_end = window_begin + QK_SG_M - 1;
+      const int window_tile_begin = cute::max(window_begin, 0);
+      const int nblock_start = !LocalMask ? 0
+                             : cute::min(window_tile_begin < seq_len_kv_cache ? window_tile_begin / QK_BLK_N
+                                                                              : nblock_cache + (window_tile_begin - seq_len_kv_cache) / QK_BLK_N,
+                                         nblock_limit - 1);
     
       Tensor mQ_mkl = cute::get_xe_tensor(make_shape(seq_len_qo, head_size_qk, (is_var_len ? 1 : batch) * num_heads_q));   //(m,k,l)
       Tensor mK_nkl = cute::get_xe_tensor(make_shape(seq_len_kv, head_size_qk, (is_var_len ? 1 : batch) * num_head_kv));   //(n,k,l)
@@ -293,6 +307,10 @@ public:
       auto gV_cache = local_tile(mV_cache_nk, TileShapeOutput{}, make_coord(_, blk_n_coord, _), Step<X, _1, _1>{});
 
       auto mainloop_params = CollectiveMainloop::get_updated_copies(params.mainloop, params.problem_shape, sequence_length_shape, batch_coord);
+      // Per-KV-head FP8 dequantization scales (1 for non-FP8 K/V or when no scales are given).
+      int kv_head_coord = num_heads_coord / group_heads_q;
+      float const k_scale = CollectiveMainloop::kv_scale(mainloop_params.ptr_K_scale, kv_head_coord);
+      float const v_scale = CollectiveMainloop::kv_scale(mainloop_params.ptr_V_scale, kv_head_coord);
       // we limit the horisontal size to two subgroup, the empirical resutls show that reading the two cacheline side by side in gives better performance and 
       // anything after that does not have an effect on performance. // (64 here for float b float when possible and loop over to cover all the data needed)
       auto tiled_prefetch_q = cute::prefetch_selector<Shape<Int<QK_BLK_M>, Int<cute::max(cute::gcd(QK_BLK_K, 64), 32)>>, Num_SGs>(mainloop_params.gmem_tiled_copy_q);
@@ -313,25 +331,21 @@ public:
       for (int i = 0; i < size<3>(pQgQ); i++) {
         prefetch(tiled_prefetch_q, pQgQ(_, _, _, i));
       }
-      auto& prefetch_K = (seq_len_kv_cache == 0) ? tiled_prefetch_k: tiled_prefetch_k_cache;
-      auto& pKgK1_ = (seq_len_kv_cache == 0) ? pKgK: pKgK_cache;
-
-      int cached_nblock = 0;
-      if constexpr (PagedKV) {
-        if (seq_len_kv_cache != 0) {
-          int curr_batch_pages = is_var_len ? mainloop_params.num_pages_per_seq[batch_coord + 1] - mainloop_params.num_pages_per_seq[batch_coord]
-                                            : ceil_div(seq_len_kv_cache, mainloop_params.page_size);
-          int batch_offset = is_var_len ? mainloop_params.num_pages_per_seq[batch_coord] : batch_coord * curr_batch_pages;
-          cached_nblock = mainloop_params.ptr_page_table[
-                    batch_offset                     // page table for this batch
-                ] * tiles_per_page;               // base block idx of physical page
-        }
-      }
-       // The headsize for both cached and non-cached version is the same
-      for (int j = 0; j < size<4>(pKgK1_); j++) {
-        CUTLASS_PRAGMA_UNROLL
-        for (int i = cached_nblock; i < cached_nblock + DispatchPolicy::Stages; i++) {
-          prefetch(prefetch_K, pKgK1_(_, _, _ , i, j));
+      // A paged cache is read through the page table: cached_nblock is the physical tile of the current KV cache block.
+      bool is_start_KV_cache = nblock_start < nblock_cache;
+      int cached_nblock = is_start_KV_cache ? CollectiveMainloop::kv_cache_tile(mainloop_params, batch_coord, seq_len_kv_cache, nblock_start)
+                                            : nblock_start;
+      // The headsize for both cached and non-cached version is the same. The first Stages tiles may straddle
+      // several pages and the end of the cache, so each one is looked up on its own.
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = nblock_start; i < nblock_start + DispatchPolicy::Stages; i++) {
+        bool is_prefetch_KV_cache = i < nblock_cache;
+        auto& prefetch_K = is_prefetch_KV_cache ? tiled_prefetch_k_cache : tiled_prefetch_k;
+        auto& pKgK1_ = is_prefetch_KV_cache ? pKgK_cache : pKgK;
+        int k_prefetch_idx = is_prefetch_KV_cache ? CollectiveMainloop::kv_cache_tile(mainloop_params, batch_coord, seq_len_kv_cache, i)
+                                                  : i - nblock_cache;
+        for (int j = 0; j < size<4>(pKgK1_); j++) {
+          prefetch(prefetch_K, pKgK1_(_, _, _ , k_prefetch_idx, j));
         }
       }
 
@@ -350,10 +364,30 @@ public:
       CollectiveMainloop collective_mma;
       // when causal mask is true. It is not possible to set the scope
       // of the barrier to workgroup level as the number n block is
-      // different for each subgroup due to triangular nature of causal based operation
-      static constexpr int barrier_scope = CausalMask ? 3 : 2;
+      // different for each subgroup due to triangular nature of causal based operation.
+      // The same holds for the first n block of a sliding window.
+      const int barrier_scope = (CausalMask || LocalMask) ? 3 : 2;
+
+      // mask the elements of a tile where i - j >= window_size, with j counted over [cache, new] keys
+      auto apply_window_mask = [&](auto &tSr, int column_offset) {
+        const int item_id = thread_idx % SubgroupSize;
+        int col_idx = item_id + column_offset;
+        CUTLASS_PRAGMA_UNROLL
+        for (int n = 0; n < FragsN; n++, col_idx += get<1>(MmaAtomShape())) {
+          CUTLASS_PRAGMA_UNROLL
+          for (int m = 0; m < FragsM; m++) {
+            int row_idx = m * Vec + seq_coord;
+            CUTLASS_PRAGMA_UNROLL
+            for (int row = 0; row < Vec; row++, row_idx++) {
+              if (row_idx + query_kv_offset - col_idx >= window_size) {
+                tSr(row, m, n) = ElementAccumulator{-INFINITY};
+              }
+            }
+          }
+        }
+      };
       // MAIN LOOP: loop over K and V, perform fused attention + online softmax
-      for (int nblock = 0; nblock < nblock_limit - static_cast<int>(CausalMask); nblock++) {
+      for (int nblock = nblock_start; nblock < nblock_limit - static_cast<int>(CausalMask); nblock++) {
         barrier_arrive(barrier_scope);
 
         bool is_KV_cache = nblock < nblock_cache;
@@ -367,46 +401,37 @@ public:
         clear(tSr);
 
         // 3) Perform GEMM S = Q*K
-        collective_mma.mmaQK(tSr, gQ, gK_, tSr, ceil_div(head_size_qk, QK_BLK_K), mainloop_params, is_KV_cache);
+        collective_mma.mmaQK(tSr, gQ, gK_, tSr, ceil_div(head_size_qk, QK_BLK_K), mainloop_params, is_KV_cache, k_scale);
 
         // we only need one block ahead, there is enough gap to prefetch it while doing softmax. because the gap between the two MMA is big,
         // prefetching it the same way as cutlass K matrix does not make sense
         auto& tiled_prefetch_v_ = is_KV_cache ? tiled_prefetch_v_cache : tiled_prefetch_v;
         auto& pVgV_ = is_KV_cache  ? pVgV_cache : pVgV;
-        int v_prefetch_idx = is_KV_cache ? PagedKV ? cached_nblock : nblock
-                                         : nblock - nblock_cache;
+        int v_prefetch_idx = is_KV_cache ? cached_nblock : nblock - nblock_cache;
         for(int i = 0; i < size<1>(pVgV_); i++) {
           prefetch(tiled_prefetch_v_, pVgV_(_, i, _ , v_prefetch_idx));
         }
 
         int next_cached_nblock = nblock + 1;
         bool is_next_KV_cache = next_cached_nblock < nblock_cache;
-        if constexpr (PagedKV) {
-          if (is_next_KV_cache) {
-            int curr_batch_pages = is_var_len ? mainloop_params.num_pages_per_seq[batch_coord + 1] - mainloop_params.num_pages_per_seq[batch_coord]
-                                              : ceil_div(seq_len_kv_cache, mainloop_params.page_size);
-            int next_page_logical_idx = next_cached_nblock * QK_BLK_N / params.mainloop.page_size;
-            int batch_offset = is_var_len ? mainloop_params.num_pages_per_seq[batch_coord] : batch_coord * curr_batch_pages;
-            bool valid_page = next_page_logical_idx < curr_batch_pages;
-            // get physical page idx from page table
-            if (valid_page) {
-              next_cached_nblock = params.mainloop.ptr_page_table[
-                    batch_offset +                  // page table for this batch
-                    next_page_logical_idx           // nblock (tile idx) to logical page idx
-                    ] * tiles_per_page +            // base block idx of physical page
-                    next_cached_nblock % tiles_per_page;        // offset within page
-            } else {
-              next_cached_nblock = curr_batch_pages * tiles_per_page; // push idx out of bounds to respect the boundary between batches
-            }
-          }
+        if (is_next_KV_cache) {
+          next_cached_nblock = CollectiveMainloop::kv_cache_tile(mainloop_params, batch_coord, seq_len_kv_cache, next_cached_nblock);
         }
 
         // 4) Fused softmax
+        int column_offset = nblock < nblock_cache ? nblock * QK_BLK_N : seq_len_kv_cache + (nblock - nblock_cache) * QK_BLK_N;
         CollectiveSoftmaxEpilogue softmax(params.softmax);
-        softmax(nblock == 0, tSr, max_reg, sum_reg, out_reg);
+        softmax.template apply_score_mod<get<1>(MmaAtomShape())>(tSr, seq_coord + query_kv_offset,
+                                                                 column_offset + thread_idx % SubgroupSize, num_heads_coord);
+
+        if (LocalMask && column_offset < window_mask_end) {
+          apply_window_mask(tSr, column_offset);
+        }
+
+        softmax(nblock == nblock_start, tSr, max_reg, sum_reg, out_reg);
 
         // 5) Perform GEMM O = S*V
-        collective_mma.template mmaPV<VSlicer>(out_reg, tSr, gV_, out_reg, mainloop_params, is_KV_cache);
+        collective_mma.template mmaPV<VSlicer>(out_reg, tSr, gV_, out_reg, mainloop_params, is_KV_cache, v_scale);
 
         // Prefetch the next Q tile
         CUTLASS_PRAGMA_UNROLL
@@ -416,13 +441,13 @@ public:
 
         is_KV_cache = is_next_KV_cache;
         cached_nblock = next_cached_nblock;
-        // Prefetch the next K tile
+        // Prefetch the K tile Stages ahead; for a paged cache this is where the next physical page is fetched
         // there is no need to gaurd it with if statememt as prefetch will ignore out of bound reading
-       
         bool sel_prefetch_k = (nblock + DispatchPolicy::Stages) < nblock_cache;
         auto& prefetch_k_selector = sel_prefetch_k ? tiled_prefetch_k_cache: tiled_prefetch_k;
         auto& pKgK_ = sel_prefetch_k  ? pKgK_cache : pKgK;
-        int k_prefetch_idx = sel_prefetch_k ? PagedKV ? cached_nblock : nblock + DispatchPolicy::Stages
+        int k_prefetch_idx = sel_prefetch_k ? CollectiveMainloop::kv_cache_tile(mainloop_params, batch_coord, seq_len_kv_cache,
+                                                                                nblock + DispatchPolicy::Stages)
                                             : nblock + DispatchPolicy::Stages - nblock_cache;
         CUTLASS_PRAGMA_UNROLL
         for (int j = 0; j < size<4>(pKgK_); j++) {
@@ -438,12 +463,17 @@ public:
         Tensor tSr = make_tensor<ElementAccumulator>(Shape<Int<Vec>, Int<FragsM>, Int<FragsN>>{});
         clear(tSr);
         // 3) Perform GEMM S = Q*K
-        collective_mma.mmaQK(tSr, gQ,  gK(_, _, nblock_new - 1, _), tSr, ceil_div(head_size_qk, QK_BLK_K), mainloop_params, false);
+        collective_mma.mmaQK(tSr, gQ,  gK(_, _, nblock_new - 1, _), tSr, ceil_div(head_size_qk, QK_BLK_K), mainloop_params, false, k_scale);
         // we only need one block ahead, there is enough gap to prefetch it while doing softmax. because the gap between the two MMA is big,
         // prefetching it the same way as cutlass K matrix does not make sense
         for(int i = 0; i< size<1>(pVgV); i++) {
           prefetch(tiled_prefetch_v, pVgV(_, i, _ , nblock_new - 1));
         }
+        CollectiveSoftmaxEpilogue softmax(params.softmax);
+        softmax.template apply_score_mod<get<1>(MmaAtomShape())>(tSr, seq_coord + query_kv_offset,
+                                                                 seq_len_kv_cache + (nblock_new - 1) * QK_BLK_N + thread_idx % SubgroupSize,
+                                                                 num_heads_coord);
+
         // mask the elements of each tile where j > i
         const int item_id = thread_idx % SubgroupSize;
         int col_idx = item_id + (nblock_new - 1) * QK_BLK_N;
@@ -461,10 +491,13 @@ public:
           }
         }
 
-        CollectiveSoftmaxEpilogue softmax(params.softmax);
-        softmax((nblock_limit - 1) == 0, tSr, max_reg, sum_reg, out_reg);
+        if (LocalMask && seq_len_kv_cache + (nblock_new - 1) * QK_BLK_N < window_mask_end) {
+          apply_window_mask(tSr, seq_len_kv_cache + (nblock_new - 1) * QK_BLK_N);
+        }
+
+        softmax((nblock_limit - 1) == nblock_start, tSr, max_reg, sum_reg, out_reg);
 
-        collective_mma.template mmaPV<VSlicer>(out_reg, tSr,  gV(_, _ , nblock_new - 1), out_reg, mainloop_params, false);
+        collective_mma.template mmaPV<VSlicer>(out_reg, tSr,  gV(_, _ , nblock_new - 1), out_reg, mainloop_params, false, v_scale);
       }
 
       auto epilogue_params = CollectiveEpilogue::template get_updated_copies<is_var_len>(params.epilogue, params.problem_shape, sequence_length_shape, batch_coord);
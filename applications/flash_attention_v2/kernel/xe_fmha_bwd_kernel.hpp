@@ -0,0 +1,488 @@
+/***************************************************************************************************
+ * Copyright (C) 2025 Intel Corporation, All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/gemm.h"
+#include "cutlass/kernel_hardware_info.hpp"
+
+#include "flash_attention_v2/collective/xe_fmha_bwd_mainloop.hpp"
+#include "cute/util/type_traits.hpp"
+#include "flash_attention_v2/collective/fmha_fusion.hpp"
+#include "flash_attention_v2/kernel/xe_fhma_fwd_kernel.hpp"
+
+namespace cutlass::fmha::kernel {
+
+using namespace cute;
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Device side arguments shared by the two backward kernels. Gradients use the layouts of the
+// corresponding forward tensors, and dO uses the layout of O. LSE is the log-sum-exp saved by
+// XeFMHAFwdKernel: [batch, num_heads_q, seq_len_qo], with seq_len_qo the maximum sequence length
+// for variable length problems.
+template <class ProblemShape,
+          class ElementQ, class StrideQ,
+          class ElementK, class StrideK,
+          class ElementV, class StrideV,
+          class ElementO, class StrideO,
+          class ElementDO, class ElementLSE>
+struct FMHABwdKernelArguments {
+  ProblemShape shape;
+  const ElementQ *Q;
+  StrideQ stride_Q;
+  const ElementK *K;
+  StrideK stride_K;
+  const ElementV *V;
+  StrideV stride_V;
+  const ElementO *O;
+  StrideO stride_O;
+  const ElementDO *dO;
+  const ElementLSE *LSE;
+  ElementQ *dQ;
+  ElementK *dK;
+  ElementV *dV;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Backward pass, part 1: one work-group per (Q block, query head, batch).
+// Computes D = rowsum(dO o O) into the workspace, then dQ.
+template <class ProblemShape_, class CollectiveMainloop_, class ElementO_ = float>
+class XeFMHABwdDQKernel {
+
+public:
+  //
+  // Type Aliases
+  //
+  using ProblemShape = ProblemShape_;
+  using VariableLength = cutlass::fmha::collective::VariableLength;
+  static constexpr bool is_var_len = cutlass::fmha::collective::is_variable_length_v<typename ProblemShape::SeqLenType>;
+  // Mainloop derived types
+  using CollectiveMainloop = CollectiveMainloop_;
+  using MainloopArguments = typename CollectiveMainloop::Arguments;
+  using MainloopParams = typename CollectiveMainloop::Params;
+
+  using TiledMMAQK = typename CollectiveMainloop::TiledMMAQK;
+  using TiledMMADQ = typename CollectiveMainloop::TiledMMADQ;
+  using TileShapeQK = typename CollectiveMainloop::TileShapeQK;
+  using TileShapeDQ = typename CollectiveMainloop::TileShapeDQ;
+  static constexpr int DTiles = CollectiveMainloop::DTiles;
+  using ElementQ = typename CollectiveMainloop::TensorQ::element_type;
+  using ElementK = typename CollectiveMainloop::TensorK::element_type;
+  using ElementV = typename CollectiveMainloop::TensorV::element_type;
+  using ElementDO = typename CollectiveMainloop::TensorDO::element_type;
+  using ElementO = ElementO_;
+  using ElementLSE = typename CollectiveMainloop::ElementS;
+
+  using StrideQ = decltype(stride(typename CollectiveMainloop::TensorQ{}));
+  using StrideK = decltype(stride(typename CollectiveMainloop::TensorK{}));
+  using StrideV = decltype(stride(typename CollectiveMainloop::TensorV{}));
+  using StrideO = decltype(stride(typename CollectiveMainloop::TensorDO{}));
+
+  using SGPerWG = typename CollectiveMainloop::SGPerWG;
+
+  using FragDQ = typename CollectiveMainloop::FragDQ;
+  using FragSRow = typename CollectiveMainloop::FragSRow;
+
+  // Kernel level shared memory storage
+  using SharedStorage = typename CollectiveMainloop::SharedStorage;
+
+  static constexpr int SharedStorageSize = is_empty_v<SharedStorage> ? size_t(0)
+                                                                     : sizeof(SharedStorage);
+
+  // Device side arguments
+  using KernelArguments = FMHABwdKernelArguments<ProblemShape,
+                                                 ElementQ, StrideQ, ElementK, StrideK, ElementV, StrideV,
+                                                 ElementO, StrideO, ElementDO, ElementLSE>;
+  struct KernelParams : KernelArguments {
+    ElementLSE *delta;        // D = rowsum(dO o O), laid out as LSE
+  };
+
+  struct Arguments {
+    KernelArguments kernel{};
+    MainloopArguments mainloop{};
+    KernelHardwareInfo hw_info{};
+  };
+
+  // Kernel entry point API
+  struct Params {
+    KernelParams kernel;
+    MainloopParams mainloop;
+  };
+
+  //
+  // Methods
+  //
+
+  // D is kept in the workspace for the dK/dV kernel, which must be given the same workspace.
+  static Params to_underlying_arguments(Arguments const &args, void *workspace) {
+    return {{args.kernel, reinterpret_cast<ElementLSE*>(workspace)},
+            CollectiveMainloop::to_underlying_arguments(args.mainloop, workspace)};
+  }
+
+  static bool can_implement(Arguments const &args) {
+    auto const& s = args.kernel.shape;
+    if (s.num_heads_q % s.num_heads_kv != 0 || args.kernel.LSE == nullptr) {
+      return false;
+    }
+    if (s.head_size_qk != get<1>(TileShapeDQ{}) * DTiles) {
+      return false;
+    }
+    return CollectiveMainloop::can_implement(args.mainloop);
+  }
+
+  static int get_workspace_size(Arguments const &args) {
+    auto const& s = args.kernel.shape;
+    return s.batch * s.num_heads_q * int(s.seq_len_qo) * sizeof(ElementLSE);
+  }
+
+  static cutlass::Status initialize_workspace(Arguments const &args, void *workspace = nullptr,
+                                              cudaStream_t stream = nullptr, CudaHostAdapter *cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  static dim3 get_grid_shape(Params const &params) {
+    auto const& s = params.kernel.shape;
+    return dim3(ceil_div(int(s.seq_len_qo), int(get<0>(TileShapeQK{}))), s.num_heads_q, s.batch);
+  }
+
+  static dim3 get_block_shape() { return dim3(SGPerWG::value * intel::sg_size, 1, 1); }
+
+  CUTLASS_DEVICE
+  Shape<int, int> get_sequence_length_shape(ProblemShape const& problem_shape, int const& batch) {
+    if constexpr (is_var_len) {
+      return cutlass::fmha::collective::apply_variable_length(Shape<VariableLength, VariableLength>{problem_shape.seq_len_qo, problem_shape.seq_len_kv}, batch);
+    } else {
+      return Shape<int, int>{problem_shape.seq_len_qo, problem_shape.seq_len_kv};
+    }
+  }
+
+  CUTLASS_DEVICE
+  void operator()(Params const &params, char *smem_buf)
+  {
+    SharedStorage& shared_storage = *reinterpret_cast<SharedStorage *>(smem_buf);
+
+    auto &p = params.kernel;
+    ProblemShape const& s = p.shape;
+    int head_group_q = s.num_heads_q / s.num_heads_kv;
+
+    int thr_id = int(ThreadIdxX());
+    int blk_q = BlockIdxX();
+    int head_q = BlockIdxY();
+    int idx_b = BlockIdxZ();
+    int head = head_q / head_group_q;
+
+    auto [seq_len_qo, seq_len_kv] = get_sequence_length_shape(s, idx_b);
+    if (blk_q * get<0>(TileShapeQK{}) >= seq_len_qo) return;
+
+    auto offset = cute::min(seq_len_qo, seq_len_kv);
+    auto discard_seq_coord = seq_len_qo - offset;
+    auto full_tile_offset = seq_len_kv - offset;
+
+    // Keys visible to the last row of this tile (bottom-right aligned causal mask).
+    int last_row = cute::min(seq_len_qo, (blk_q + 1) * get<0>(TileShapeQK{})) - 1;
+    int seq_len = CollectiveMainloop::CausalMask
+                ? cute::max(0, cute::min(seq_len_kv, last_row - discard_seq_coord + full_tile_offset + 1))
+                : seq_len_kv;
+    int k_blocks = cute::ceil_div(seq_len, get<1>(TileShapeQK{}));
+
+    int offset_q = 0, offset_k = 0, offset_v = 0, offset_o = 0;
+    if constexpr (is_var_len) {
+      auto qo_cumulative = s.seq_len_qo.cumulative_length;
+      auto kv_cumulative = s.seq_len_kv.cumulative_length;
+      offset_q = s.num_heads_q * s.head_size_qk * qo_cumulative[idx_b];
+      offset_k = s.num_heads_kv * s.head_size_qk * kv_cumulative[idx_b];
+      offset_v = s.num_heads_kv * s.head_size_vo * kv_cumulative[idx_b];
+      offset_o = s.num_heads_q * s.head_size_vo * qo_cumulative[idx_b];
+    }
+
+    auto batch_dim = is_var_len ? 1 : s.batch;
+    auto shape_Q = make_shape(seq_len_qo, s.head_size_qk, s.num_heads_q, batch_dim);
+    auto shape_K = make_shape(seq_len_kv, s.head_size_qk, s.num_heads_kv, batch_dim);
+    auto shape_V = make_shape(s.head_size_vo, seq_len_kv, s.num_heads_kv, batch_dim);
+    auto shape_O = make_shape(seq_len_qo, s.head_size_vo, s.num_heads_q, batch_dim);
+
+    auto stride_q = is_var_len ? cutlass::make_cute_packed_stride(StrideQ{}, shape_Q) : p.stride_Q;
+    auto stride_k = is_var_len ? cutlass::make_cute_packed_stride(StrideK{}, shape_K) : p.stride_K;
+    auto stride_v = is_var_len ? cutlass::make_cute_packed_stride(StrideV{}, shape_V) : p.stride_V;
+    auto stride_o = is_var_len ? cutlass::make_cute_packed_stride(StrideO{}, shape_O) : p.stride_O;
+
+    Tensor Q  = make_tensor(make_gmem_ptr(const_cast<ElementQ*>(p.Q + offset_q)),   make_layout(shape_Q, stride_q));
+    Tensor K  = make_tensor(make_gmem_ptr(const_cast<ElementK*>(p.K + offset_k)),   make_layout(shape_K, stride_k));
+    Tensor V  = make_tensor(make_gmem_ptr(const_cast<ElementV*>(p.V + offset_v)),   make_layout(shape_V, stride_v));
+    Tensor O  = make_tensor(make_gmem_ptr(const_cast<ElementO*>(p.O + offset_o)),   make_layout(shape_O, stride_o));
+    Tensor dO = make_tensor(make_gmem_ptr(const_cast<ElementDO*>(p.dO + offset_o)), make_layout(shape_O, stride_o));
+    Tensor dQ = make_tensor(make_gmem_ptr(p.dQ + offset_q),                         make_layout(shape_Q, stride_q));
+
+    size_t offset_lse = (size_t(idx_b) * s.num_heads_q + head_q) * int(s.seq_len_qo);
+    int l_coord = is_var_len ? 0 : idx_b;
+
+    CollectiveMainloop mainloop(params.mainloop, shared_storage);
+
+    FragSRow tLSE, tD;
+    mainloop.load_row_stats(O(_,_,head_q,l_coord), dO(_,_,head_q,l_coord),
+                            p.LSE + offset_lse, p.delta + offset_lse,
+                            tLSE, tD, blk_q, thr_id, seq_len_qo);
+
+    FragDQ tDQrDQ;
+    mainloop(Q(_,_,head_q,l_coord),
+             K(_,_,head,l_coord),
+             V(_,_,head,l_coord),
+             dO(_,_,head_q,l_coord),
+             tDQrDQ, tLSE, tD,
+             blk_q, 0, k_blocks,
+             thr_id, seq_len_kv,
+             full_tile_offset, discard_seq_coord);
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < tDQrDQ.size(); i++) {
+      tDQrDQ(i) *= params.mainloop.scale;
+    }
+
+    auto tile_dq = make_shape(get<0>(TileShapeDQ{}), get<1>(TileShapeDQ{}) * C<DTiles>{});
+    cutlass::fmha::collective::store_tile<TiledMMADQ>(dQ(_,_,head_q,l_coord), tDQrDQ, tile_dq,
+                                                      make_coord(blk_q, 0), thr_id);
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Backward pass, part 2: one work-group per (K block, KV head, batch), launched after
+// XeFMHABwdDQKernel with the same workspace. Accumulates dK/dV over all query heads sharing
+// the KV head, so grouped-query attention needs no atomics either.
+template <class ProblemShape_, class CollectiveMainloop_, class ElementO_ = float>
+class XeFMHABwdDKDVKernel {
+
+public:
+  //
+  // Type Aliases
+  //
+  using ProblemShape = ProblemShape_;
+  using VariableLength = cutlass::fmha::collective::VariableLength;
+  static constexpr bool is_var_len = cutlass::fmha::collective::is_variable_length_v<typename ProblemShape::SeqLenType>;
+  // Mainloop derived types
+  using CollectiveMainloop = CollectiveMainloop_;
+  using MainloopArguments = typename CollectiveMainloop::Arguments;
+  using MainloopParams = typename CollectiveMainloop::Params;
+
+  using TiledMMAKQ = typename CollectiveMainloop::TiledMMAKQ;
+  using TiledMMADKV = typename CollectiveMainloop::TiledMMADKV;
+  using TileShapeKQ = typename CollectiveMainloop::TileShapeKQ;
+  using TileShapeDKV = typename CollectiveMainloop::TileShapeDKV;
+  static constexpr int DTiles = CollectiveMainloop::DTiles;
+  static constexpr int VTiles = CollectiveMainloop::VTiles;
+  using ElementQ = typename CollectiveMainloop::TensorQ::element_type;
+  using ElementK = typename CollectiveMainloop::TensorK::element_type;
+  using ElementV = typename CollectiveMainloop::TensorV::element_type;
+  using ElementDO = typename CollectiveMainloop::TensorDO::element_type;
+  using ElementO = ElementO_;
+  using ElementLSE = typename CollectiveMainloop::ElementS;
+
+  using StrideQ = decltype(stride(typename CollectiveMainloop::TensorQ{}));
+  using StrideK = decltype(stride(typename CollectiveMainloop::TensorK{}));
+  using StrideV = decltype(stride(typename CollectiveMainloop::TensorV{}));
+  using StrideO = decltype(stride(typename CollectiveMainloop::TensorDO{}));
+
+  using SGPerWG = typename CollectiveMainloop::SGPerWG;
+
+  using FragDK = typename CollectiveMainloop::FragDK;
+  using FragDV = typename CollectiveMainloop::FragDV;
+
+  // Kernel level shared memory storage
+  using SharedStorage = typename CollectiveMainloop::SharedStorage;
+
+  static constexpr int SharedStorageSize = is_empty_v<SharedStorage> ? size_t(0)
+                                                                     : sizeof(SharedStorage);
+
+  // Device side arguments
+  using KernelArguments = FMHABwdKernelArguments<ProblemShape,
+                                                 ElementQ, StrideQ, ElementK, StrideK, ElementV, StrideV,
+                                                 ElementO, StrideO, ElementDO, ElementLSE>;
+  struct KernelParams : KernelArguments {
+    ElementLSE const *delta;  // D = rowsum(dO o O), written by XeFMHABwdDQKernel
+  };
+
+  struct Arguments {
+    KernelArguments kernel{};
+    MainloopArguments mainloop{};
+    KernelHardwareInfo hw_info{};
+  };
+
+  // Kernel entry point API
+  struct Params {
+    KernelParams kernel;
+    MainloopParams mainloop;
+  };
+
+  //
+  // Methods
+  //
+
+  static Params to_underlying_arguments(Arguments const &args, void *workspace) {
+    return {{args.kernel, reinterpret_cast<ElementLSE const*>(workspace)},
+            CollectiveMainloop::to_underlying_arguments(args.mainloop, workspace)};
+  }
+
+  static bool can_implement(Arguments const &args) {
+    auto const& s = args.kernel.shape;
+    if (s.num_heads_q % s.num_heads_kv != 0 || args.kernel.LSE == nullptr) {
+      return false;
+    }
+    if (s.head_size_qk != get<1>(TileShapeDKV{}) * DTiles || s.head_size_vo != get<1>(TileShapeDKV{}) * VTiles) {
+      return false;
+    }
+    return CollectiveMainloop::can_implement(args.mainloop);
+  }
+
+  static int get_workspace_size(Arguments const &args) {
+    auto const& s = args.kernel.shape;
+    return s.batch * s.num_heads_q * int(s.seq_len_qo) * sizeof(ElementLSE);
+  }
+
+  static cutlass::Status initialize_workspace(Arguments const &args, void *workspace = nullptr,
+                                              cudaStream_t stream = nullptr, CudaHostAdapter *cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  static dim3 get_grid_shape(Params const &params) {
+    auto const& s = params.kernel.shape;
+    return dim3(ceil_div(int(s.seq_len_kv), int(get<0>(TileShapeKQ{}))), s.num_heads_kv, s.batch);
+  }
+
+  static dim3 get_block_shape() { return dim3(SGPerWG::value * intel::sg_size, 1, 1); }
+
+  CUTLASS_DEVICE
+  Shape<int, int> get_sequence_length_shape(ProblemShape const& problem_shape, int const& batch) {
+    if constexpr (is_var_len) {
+      return cutlass::fmha::collective::apply_variable_length(Shape<VariableLength, VariableLength>{problem_shape.seq_len_qo, problem_shape.seq_len_kv}, batch);
+    } else {
+      return Shape<int, int>{problem_shape.seq_len_qo, problem_shape.seq_len_kv};
+    }
+  }
+
+  CUTLASS_DEVICE
+  void operator()(Params const &params, char *smem_buf)
+  {
+    SharedStorage& shared_storage = *reinterpret_cast<SharedStorage *>(smem_buf);
+
+    auto &p = params.kernel;
+    ProblemShape const& s = p.shape;
+    int head_group_q = s.num_heads_q / s.num_heads_kv;
+
+    int thr_id = int(ThreadIdxX());
+    int blk_k = BlockIdxX();
+    int head = BlockIdxY();
+    int idx_b = BlockIdxZ();
+
+    auto [seq_len_qo, seq_len_kv] = get_sequence_length_shape(s, idx_b);
+    if (blk_k * get<0>(TileShapeKQ{}) >= seq_len_kv) return;
+
+    auto offset = cute::min(seq_len_qo, seq_len_kv);
+    auto discard_seq_coord = seq_len_qo - offset;
+    auto full_tile_offset = seq_len_kv - offset;
+
+    // First row that sees a key of this tile (bottom-right aligned causal mask).
+    int first_row = CollectiveMainloop::CausalMask
+                  ? cute::max(0, blk_k * get<0>(TileShapeKQ{}) - full_tile_offset + discard_seq_coord)
+                  : 0;
+    int blk_q0 = first_row / get<1>(TileShapeKQ{});
+    int blk_q1 = cute::ceil_div(seq_len_qo, get<1>(TileShapeKQ{}));
+
+    int offset_q = 0, offset_k = 0, offset_v = 0, offset_o = 0;
+    if constexpr (is_var_len) {
+      auto qo_cumulative = s.seq_len_qo.cumulative_length;
+      auto kv_cumulative = s.seq_len_kv.cumulative_length;
+      offset_q = s.num_heads_q * s.head_size_qk * qo_cumulative[idx_b];
+      offset_k = s.num_heads_kv * s.head_size_qk * kv_cumulative[idx_b];
+      offset_v = s.num_heads_kv * s.head_size_vo * kv_cumulative[idx_b];
+      offset_o = s.num_heads_q * s.head_size_vo * qo_cumulative[idx_b];
+    }
+
+    auto batch_dim = is_var_len ? 1 : s.batch;
+    auto shape_Q = make_shape(seq_len_qo, s.head_size_qk, s.num_heads_q, batch_dim);
+    auto shape_K = make_shape(seq_len_kv, s.head_size_qk, s.num_heads_kv, batch_dim);
+    auto shape_V = make_shape(s.head_size_vo, seq_len_kv, s.num_heads_kv, batch_dim);
+    auto shape_O = make_shape(seq_len_qo, s.head_size_vo, s.num_heads_q, batch_dim);
+
+    auto stride_q = is_var_len ? cutlass::make_cute_packed_stride(StrideQ{}, shape_Q) : p.stride_Q;
+    auto stride_k = is_var_len ? cutlass::make_cute_packed_stride(StrideK{}, shape_K) : p.stride_K;
+    auto stride_v = is_var_len ? cutlass::make_cute_packed_stride(StrideV{}, shape_V) : p.stride_V;
+    auto stride_o = is_var_len ? cutlass::make_cute_packed_stride(StrideO{}, shape_O) : p.stride_O;
+
+    Tensor Q  = make_tensor(make_gmem_ptr(const_cast<ElementQ*>(p.Q + offset_q)),   make_layout(shape_Q, stride_q));
+    Tensor K  = make_tensor(make_gmem_ptr(const_cast<ElementK*>(p.K + offset_k)),   make_layout(shape_K, stride_k));
+    Tensor V  = make_tensor(make_gmem_ptr(const_cast<ElementV*>(p.V + offset_v)),   make_layout(shape_V, stride_v));
+    Tensor dO = make_tensor(make_gmem_ptr(const_cast<ElementDO*>(p.dO + offset_o)), make_layout(shape_O, stride_o));
+    Tensor dK = make_tensor(make_gmem_ptr(p.dK + offset_k),                         make_layout(shape_K, stride_k));
+    Tensor dV = make_tensor(make_gmem_ptr(p.dV + offset_v),                         make_layout(shape_V, stride_v));
+
+    int l_coord = is_var_len ? 0 : idx_b;
+
+    CollectiveMainloop mainloop(params.mainloop, shared_storage);
+
+    FragDK tDKrDK;
+    FragDV tDVrDV;
+    clear(tDKrDK);
+    clear(tDVrDV);
+
+    for (int h = 0; h < head_group_q; h++) {
+      int head_q = head * head_group_q + h;
+      size_t offset_lse = (size_t(idx_b) * s.num_heads_q + head_q) * int(s.seq_len_qo);
+      mainloop(Q(_,_,head_q,l_coord),
+               K(_,_,head,l_coord),
+               V(_,_,head,l_coord),
+               dO(_,_,head_q,l_coord),
+               p.LSE + offset_lse, p.delta + offset_lse,
+               tDKrDK, tDVrDV,
+               blk_k, blk_q0, blk_q1,
+               thr_id, seq_len_qo,
+               full_tile_offset, discard_seq_coord);
+    }
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < tDKrDK.size(); i++) {
+      tDKrDK(i) *= params.mainloop.scale;
+    }
+
+    auto tile_dk = make_shape(get<0>(TileShapeDKV{}), get<1>(TileShapeDKV{}) * C<DTiles>{});
+    auto tile_dv = make_shape(get<0>(TileShapeDKV{}), get<1>(TileShapeDKV{}) * C<VTiles>{});
+    cutlass::fmha::collective::store_tile<TiledMMADKV>(dK(_,_,head,l_coord), tDKrDK, tile_dk,
+                                                       make_coord(blk_k, 0), thr_id);
+    cutlass::fmha::collective::store_tile<TiledMMADKV>(collective::transpose_2d(dV(_,_,head,l_coord)), tDVrDV, tile_dv,
+                                                       make_coord(blk_k, 0), thr_id);
+  }
+};
+
+}  // namespace cutlass::fmha::kernel
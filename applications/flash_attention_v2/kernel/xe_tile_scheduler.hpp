@@ -92,6 +92,62 @@ struct XeFHMAIndividualTileScheduler {
   }
 };
 
+// Decode with GQA packing: one work-group per KV head, whose Q tile stacks the seq_len_qo tokens of all
+// num_heads_q / num_heads_kv query heads sharing it, so K/V are streamed once per group of query heads.
+// Returns (Q,V,h_kv,b).
+struct XeFHMAPackedGQATileScheduler {
+
+  struct Params {
+    dim3 grid;
+    FastDivmod divmod_num_heads;
+  };
+
+  bool valid_ = true;
+  Params params;
+
+  CUTLASS_DEVICE
+  XeFHMAPackedGQATileScheduler(Params const& params) : params(params) {}
+
+  template <class ProblemShape, class TileShape>
+  static Params to_underlying_arguments(
+      ProblemShape const& shape, KernelHardwareInfo hw_info,
+      TileShape const& tile_shape)
+  {
+    using namespace cute;
+
+    int packed_rows = shape.seq_len_qo * (shape.num_heads_q / shape.num_heads_kv);
+    dim3 grid(size(ceil_div(shape.head_size_vo, get<1>(tile_shape))),     // V
+              size(ceil_div(packed_rows,        get<0>(tile_shape))),     // Q, packed over the query heads
+              size(shape.batch * shape.num_heads_kv));                    // (h_kv,b) -- split later
+    return Params{grid, {shape.num_heads_kv}};
+  }
+
+  template <int Num_SGs>
+  static dim3 get_grid_shape(Params const& params) {
+    return params.grid;
+  }
+
+  CUTLASS_DEVICE
+  bool is_valid() {
+    return valid_;
+  }
+
+  CUTLASS_DEVICE
+  auto get_block_coord() {
+    using namespace cute;
+    int idx_b = BlockIdxZ();
+    int head;
+    params.divmod_num_heads(idx_b, head, idx_b);
+    return make_coord(BlockIdxY(), BlockIdxX(), head, idx_b);
+  }
+
+  CUTLASS_DEVICE
+  XeFHMAPackedGQATileScheduler& operator++() {
+    valid_ = false;
+    return *this;
+  }
+};
+
 struct XeFHMAIndividualPersistentTileScheduler {
 
   struct Params {
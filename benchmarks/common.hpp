@@ -34,6 +34,11 @@
 #include <iostream>
 #include <sstream>
 #include <fstream>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -51,6 +56,22 @@ namespace cutlass {
     #endif
   }
 
+  // Evicts the last-level cache by overwriting a scratch buffer that is larger than it.
+  // Returns once the writes have completed.
+  static inline void flush_llc(void* scratch, std::size_t bytes, int value) {
+    #if defined(CUTLASS_ENABLE_SYCL)
+      compat::memset(scratch, value, bytes);
+    #else
+      auto result = cudaMemset(scratch, value, bytes);
+      if (result == cudaSuccess) {
+        result = cudaDeviceSynchronize();
+      }
+      if (result != cudaSuccess) {
+        throw std::runtime_error(cudaGetErrorString(result));
+      }
+    #endif
+  }
+
 
 namespace benchmark {
 
@@ -58,6 +79,8 @@ namespace benchmark {
   class BenchmarkRegistry {
     using BM_Lambda = std::function<void(::benchmark::State& state, Options const&, cutlass::KernelHardwareInfo const &)>;
     std::map<const std::string, BM_Lambda> benchmarks;
+    // Benchmarks with the same non-empty signature solve the same problem and can replace each other
+    std::map<const std::string, std::string> signatures;
 
     static BenchmarkRegistry& get_instance() {
       static BenchmarkRegistry runner;
@@ -78,15 +101,207 @@ namespace benchmark {
       return it->second;
     }
 
-    static void Register(std::string const& key, BM_Lambda const func) {
+    static bool contains(std::string const& name) {
+      auto& benchs = get_instance().benchmarks;
+      return benchs.find(name) != benchs.end();
+    }
+
+    // Returns the names of all registered benchmarks with the same signature as `name`, including `name` itself
+    static std::vector<std::string> get_compatible_benchmarks(std::string const& name) {
+      auto& sigs = get_instance().signatures;
+      auto it = sigs.find(name);
+      if (it == sigs.end()) {
+        throw std::runtime_error("Benchmark not found");
+      }
+      if (it->second.empty()) {
+        return {name};
+      }
+      std::vector<std::string> compatible;
+      for (auto const& [key, signature] : sigs) {
+        if (signature == it->second) {
+          compatible.push_back(key);
+        }
+      }
+      return compatible;
+    }
+
+    static void Register(std::string const& key, BM_Lambda const func, std::string const& signature = "") {
       auto& benchs = get_instance().benchmarks;
       if (benchs.find(key) == benchs.end()) {
         benchs.insert(std::make_pair(key, func));
+        get_instance().signatures.insert(std::make_pair(key, signature));
       } else {
         std::cerr << "Benchmark " << key << " duplicated." << std::endl;
       }
     }
   };
+
+  // Options controlling which runtime samples enter the statistics and when a benchmark stops
+  // launching kernels early
+  struct StatisticsOptions {
+    // Number of leading iterations whose runtime is discarded
+    int warmup = 0;
+    // Stop launching once the coefficient of variation of the last `stable_window` samples is
+    // below this value, or after `stable_max_samples` samples. Zero disables early stopping.
+    double stable_cv = 0.0;
+    int stable_window = 20;
+    int stable_max_samples = 1000;
+
+    void parse(cutlass::CommandLine const& cmd) {
+      cmd.get_cmd_line_argument("warmup", warmup, 0);
+      cmd.get_cmd_line_argument("stable_cv", stable_cv, 0.0);
+      cmd.get_cmd_line_argument("stable_window", stable_window, 20);
+      cmd.get_cmd_line_argument("stable_max_samples", stable_max_samples, 1000);
+      warmup = std::max(warmup, 0);
+      stable_window = std::max(stable_window, 2);
+      stable_max_samples = std::max(stable_max_samples, stable_window);
+    }
+
+    bool early_stop() const {
+      return stable_cv > 0;
+    }
+
+    // With early stopping, Google Benchmark runs a single iteration in which the runner keeps
+    // sampling until RuntimeStatistics::keep_sampling() returns false
+    void apply(::benchmark::internal::Benchmark* benchmark) const {
+      if (early_stop()) {
+        benchmark->Iterations(1);
+      }
+    }
+  };
+
+  // Collects per-iteration runtimes of a benchmark and reports robust statistics as counters.
+  //
+  // Runners sample inside every benchmark iteration until keep_sampling() returns false and report
+  // the mean of the launches they measured as the iteration time:
+  //
+  //   for (auto _ : state) {
+  //     statistics.begin_iteration();
+  //     do {
+  //       ... statistics.add(ms_elapsed);
+  //     } while (statistics.keep_sampling());
+  //     state.SetIterationTime(statistics.iteration_seconds());
+  //   }
+  //
+  // Without early stopping every iteration takes exactly one sample.
+  class RuntimeStatistics {
+  public:
+    explicit RuntimeStatistics(StatisticsOptions const& options) : options(options) {}
+
+    void begin_iteration() {
+      iteration_ms = 0;
+      iteration_launches = 0;
+    }
+
+    void add(double ms_elapsed) {
+      iteration_ms += ms_elapsed;
+      ++iteration_launches;
+      if (discarded < options.warmup) {
+        ++discarded;
+        return;
+      }
+      samples.push_back(ms_elapsed);
+
+      int const window = options.stable_window;
+      if (options.stable_cv > 0 && !converged && samples.size() >= static_cast<std::size_t>(window)) {
+        std::vector<double> last(samples.end() - window, samples.end());
+        double const mean = average(last);
+        if (mean > 0 && standard_deviation(last, mean) / mean < options.stable_cv) {
+          converged = true;
+          converged_after = samples.size();
+        }
+      }
+    }
+
+    // False once the samples are stable or the sample cap is reached; always false without early
+    // stopping, so that every benchmark iteration takes a single sample
+    bool keep_sampling() const {
+      return options.early_stop() && !converged &&
+             samples.size() < static_cast<std::size_t>(options.stable_max_samples);
+    }
+
+    // Mean runtime of the launches measured since begin_iteration()
+    double iteration_seconds() const {
+      return iteration_launches > 0 ? iteration_ms / iteration_launches / 1000 : 0;
+    }
+
+    // False when every iteration so far was discarded as warmup
+    bool has_samples() const {
+      return !samples.empty();
+    }
+
+    std::size_t sample_count() const {
+      return samples.size();
+    }
+
+    void report(::benchmark::State& state, double gflop, double mega_bytes_transferred) const {
+      state.counters["samples"] = static_cast<double>(samples.size());
+      state.counters["converged"] = converged;
+      state.counters["converged_after"] = static_cast<double>(converged_after);
+      if (samples.empty()) {
+        return;
+      }
+
+      double const mean = average(samples);
+      double const stddev = standard_deviation(samples, mean);
+      double const best = *std::min_element(samples.begin(), samples.end());
+      double const worst = *std::max_element(samples.begin(), samples.end());
+      double const median = percentile(samples, 50.0);
+
+      state.counters["avg_runtime_ms"] = mean;
+      state.counters["best_runtime_ms"] = best;
+      state.counters["worst_runtime_ms"] = worst;
+      state.counters["median_runtime_ms"] = median;
+      state.counters["p90_runtime_ms"] = percentile(samples, 90.0);
+      state.counters["p99_runtime_ms"] = percentile(samples, 99.0);
+      state.counters["stddev_runtime_ms"] = stddev;
+      state.counters["cv_runtime"] = mean > 0 ? stddev / mean : 0;
+
+      state.counters["avg_tflops"] = gflop / mean;
+      state.counters["avg_throughput"] = mega_bytes_transferred / mean;
+      state.counters["median_tflops"] = gflop / median;
+      state.counters["best_tflop"] = gflop / best;
+      state.counters["best_bandwidth"] = mega_bytes_transferred / best;
+    }
+
+  private:
+    static double average(std::vector<double> const& values) {
+      double sum = 0;
+      for (double v : values) {
+        sum += v;
+      }
+      return sum / static_cast<double>(values.size());
+    }
+
+    // Sample standard deviation; zero for fewer than two values
+    static double standard_deviation(std::vector<double> const& values, double mean) {
+      if (values.size() < 2) {
+        return 0;
+      }
+      double sum = 0;
+      for (double v : values) {
+        sum += (v - mean) * (v - mean);
+      }
+      return std::sqrt(sum / static_cast<double>(values.size() - 1));
+    }
+
+    // Percentile with linear interpolation between the closest ranks
+    static double percentile(std::vector<double> values, double p) {
+      std::sort(values.begin(), values.end());
+      double const rank = p / 100.0 * static_cast<double>(values.size() - 1);
+      auto const lo = static_cast<std::size_t>(std::floor(rank));
+      auto const hi = static_cast<std::size_t>(std::ceil(rank));
+      return values[lo] + (rank - static_cast<double>(lo)) * (values[hi] - values[lo]);
+    }
+
+    StatisticsOptions options;
+    std::vector<double> samples;
+    int discarded = 0;
+    bool converged = false;
+    std::size_t converged_after = 0;
+    double iteration_ms = 0;
+    int iteration_launches = 0;
+  };
 } // namespace benchmark
 } // namespace cutlass
 
@@ -149,14 +364,14 @@ auto benchmark_main(int argc, const char **argv) -> int {
 
   std::stringstream benchmark_name;
   benchmark_name << benchmark_config << "/" << options.benchmark_name();
-  ::benchmark::RegisterBenchmark(benchmark_name.str(), runner, options, hw_info)->UseManualTime();
+  auto* benchmark = ::benchmark::RegisterBenchmark(benchmark_name.str(), runner, options, hw_info)->UseManualTime();
+  options.statistics.apply(benchmark);
   return 0;
 }
 
 
-template <typename BenchOptions>
-void register_benchmarks(std::string line) {
-  // Split the line into arguments
+// Splits a line of a benchmark configuration file into its arguments
+inline std::vector<std::string> tokenize_benchmark_line(std::string const& line) {
   std::istringstream iss(line);
   std::vector<std::string> args;
   std::string arg;
@@ -164,6 +379,13 @@ void register_benchmarks(std::string line) {
   while (iss >> arg) {
     args.push_back(arg);
   }
+  return args;
+}
+
+template <typename BenchOptions>
+void register_benchmarks(std::string line) {
+  // Split the line into arguments
+  std::vector<std::string> args = tokenize_benchmark_line(line);
 
   // Prepare argc and argv for secondary_main
   int line_argc = static_cast<int>(args.size());
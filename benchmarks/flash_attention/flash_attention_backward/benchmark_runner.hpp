@@ -0,0 +1,644 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+#pragma once
+
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/GPU_Clock.hpp"
+#include "cutlass/util/sycl_event_manager.hpp"
+
+#include <cute/tensor.hpp>
+#include <random>
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/reference/device/gemm_complex.h"
+#include "cutlass/util/reference/device/tensor_compare.h"
+#include "../examples/common/sycl_common.hpp"
+#include "../../common.hpp"
+
+#include <sycl/ext/intel/experimental/grf_size_properties.hpp>
+
+using namespace cute;
+
+namespace cutlass::benchmark {
+
+// Command line options parsing
+struct FMHABackwardOptions {
+
+  bool error;
+
+  int batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, head_size_qk, head_size_vo, iterations;
+  float softmax_scale;
+  std::string bm_name;
+  StatisticsOptions statistics;
+
+  FMHABackwardOptions()
+      : error(false), batch(16), num_heads_q(16), num_heads_kv(16), seq_len_qo(512), head_size_qk(128),
+        seq_len_kv(512), head_size_vo(128), iterations(100), softmax_scale(1.f), bm_name("Flash Attention Backward") {}
+
+  // Parses the command line
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    cmd.get_cmd_line_argument("batch", batch, 16);
+    cmd.get_cmd_line_argument("num_heads_q", num_heads_q, 16);
+    cmd.get_cmd_line_argument("num_heads_kv", num_heads_kv, num_heads_q);
+    cmd.get_cmd_line_argument("seq_len_qo", seq_len_qo, 512);
+    cmd.get_cmd_line_argument("seq_len_kv", seq_len_kv, seq_len_qo);
+    cmd.get_cmd_line_argument("head_size_vo", head_size_vo, 128);
+    cmd.get_cmd_line_argument("head_size_qk", head_size_qk, head_size_vo);
+    cmd.get_cmd_line_argument("iterations", iterations, 100);
+    cmd.get_cmd_line_argument("bm_name", bm_name, std::string("Flash Attention Backward"));
+    statistics.parse(cmd);
+
+    softmax_scale = 1 / std::sqrt(static_cast<float>(head_size_qk));
+  }
+
+  std::string benchmark_name() const {
+    std::stringstream full_name;
+    full_name << bm_name << "/";
+    std::string const test_name_suffix = std::to_string(batch) + "x" +
+                                   std::to_string(num_heads_q) + "x" +
+                                   std::to_string(num_heads_kv) + "x" +
+                                   std::to_string(seq_len_qo) + "x" +
+                                   std::to_string(head_size_qk) + "x" +
+                                   std::to_string(seq_len_kv) + "x" +
+                                   std::to_string(head_size_vo);
+    full_name << test_name_suffix;
+
+    return full_name.str();
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Runs the forward kernel once to produce O and the log-sum-exp, checks the gradients of the
+// backward kernels against a reference built from device GEMMs and host-side softmax, then times
+// the backward pass (dQ kernel followed by the dK/dV kernel).
+template <class FMHABackwardConfiguration> struct BenchmarkRunnerFMHABackward {
+
+  using FwdKernel = typename FMHABackwardConfiguration::FwdKernel;
+  using DQKernel = typename FMHABackwardConfiguration::DQKernel;
+  using DKDVKernel = typename FMHABackwardConfiguration::DKDVKernel;
+
+  using LayoutQ = cutlass::layout::RowMajor;
+  using LayoutK = cutlass::layout::ColumnMajor;
+  using LayoutV = cutlass::layout::RowMajor;
+  using LayoutO = cutlass::layout::RowMajor;
+
+  using StrideQ = typename FMHABackwardConfiguration::StrideQ;
+  using StrideK = typename FMHABackwardConfiguration::StrideK;
+  using StrideV = typename FMHABackwardConfiguration::StrideV;
+  using StrideO = typename FMHABackwardConfiguration::StrideO;
+
+  using ElementQ = typename FMHABackwardConfiguration::ElementQ;
+  using ElementK = typename FMHABackwardConfiguration::ElementK;
+  using ElementV = typename FMHABackwardConfiguration::ElementV;
+  using ElementO = typename FMHABackwardConfiguration::ElementO;
+  using ElementLSE = typename DQKernel::ElementLSE;
+  using ElementAcc = float;
+
+  using ProblemShapeType = typename FMHABackwardConfiguration::ProblemShapeType;
+  static constexpr bool Causal = FMHABackwardConfiguration::Causal;
+  static constexpr bool isVarLen = FMHABackwardConfiguration::VarLen;
+
+  //
+  // Data members
+  //
+
+  /// Initialization
+  StrideQ stride_Q;
+  StrideK stride_K;
+  StrideV stride_V;
+  StrideO stride_O;
+  uint64_t seed = 0;
+
+  cutlass::DeviceAllocation<ElementQ> block_Q;
+  cutlass::DeviceAllocation<ElementK> block_K;
+  cutlass::DeviceAllocation<ElementV> block_V;
+  cutlass::DeviceAllocation<ElementO> block_O;
+  cutlass::DeviceAllocation<ElementQ> block_dO;
+  cutlass::DeviceAllocation<ElementLSE> block_LSE;
+  cutlass::DeviceAllocation<ElementQ> block_dQ;
+  cutlass::DeviceAllocation<ElementK> block_dK;
+  cutlass::DeviceAllocation<ElementV> block_dV;
+  cutlass::DeviceAllocation<ElementQ> block_ref_dQ;
+  cutlass::DeviceAllocation<ElementK> block_ref_dK;
+  cutlass::DeviceAllocation<ElementV> block_ref_dV;
+
+  std::vector<int> cumulative_seqlen_q;
+  std::vector<int> cumulative_seqlen_kv;
+  cutlass::DeviceAllocation<int> device_cumulative_seqlen_q;
+  cutlass::DeviceAllocation<int> device_cumulative_seqlen_kv;
+
+  //
+  // Methods
+  //
+
+  template <class Element>
+  static std::vector<Element> to_host(Element const* ptr, std::size_t size) {
+    std::vector<Element> host(size);
+    compat::memcpy<Element>(host.data(), ptr, size);
+    return host;
+  }
+
+  // Writes a float reference result into a device buffer of the kernel's output type.
+  template <class Element>
+  static void store_reference(Element* ptr, cutlass::DeviceAllocation<ElementAcc> const& acc) {
+    std::vector<ElementAcc> host_acc = to_host(acc.get(), acc.size());
+    std::vector<Element> host(host_acc.size());
+    for (std::size_t i = 0; i < host.size(); i++) {
+      host[i] = static_cast<Element>(host_acc[i]);
+    }
+    compat::memcpy<Element>(ptr, host.data(), host.size());
+  }
+
+  // D = alpha * A * B + beta * D, with D row-major (m,n)
+  template <class ElementA, class LayoutA, class ElementB, class LayoutB>
+  static void reference_gemm(int m, int n, int k, ElementAcc alpha,
+                             cutlass::TensorRef<ElementA, LayoutA> ref_A,
+                             cutlass::TensorRef<ElementB, LayoutB> ref_B,
+                             ElementAcc beta, ElementAcc* D) {
+    cutlass::TensorRef ref_D(D, LayoutO::packed({m, n}));
+    cutlass::reference::device::GemmComplex({m, n, k}, alpha, ref_A, cutlass::ComplexTransform::kNone,
+                                            ref_B, cutlass::ComplexTransform::kNone,
+                                            beta, ref_D, ref_D, ElementAcc(0));
+    compat::wait();
+  }
+
+  bool verify(ProblemShapeType shape, float softmax_scale) {
+
+    if constexpr (isVarLen) {
+      int max_seq_len_q = shape.seq_len_qo;
+      int max_seq_len_kv = shape.seq_len_kv;
+      shape.seq_len_qo = cutlass::fmha::collective::VariableLength{max_seq_len_q, cumulative_seqlen_q.data()};
+      shape.seq_len_kv = cutlass::fmha::collective::VariableLength{max_seq_len_kv, cumulative_seqlen_kv.data()};
+    }
+
+    int batch = shape.batch;
+    int num_heads_q = shape.num_heads_q;
+    int num_heads_kv = shape.num_heads_kv;
+    int head_size_qk = shape.head_size_qk;
+    int head_size_vo = shape.head_size_vo;
+    int max_seq_len_qo = shape.seq_len_qo;
+    int seq_len_qo, seq_len_kv;
+
+    int offset_q = 0;
+    int offset_k = 0;
+    int offset_v = 0;
+    int offset_o = 0;
+
+    // loop over the batch and KV head dimensions to compute the gradients
+    // to avoid the risk of running out of device memory
+    int q_group_size = num_heads_q / num_heads_kv;
+    for (int b = 0; b < batch; b++) {
+      if constexpr (isVarLen) {
+        auto logical_seq_shape = cutlass::fmha::collective::apply_variable_length(make_shape(shape.seq_len_qo, shape.seq_len_kv), b);
+        seq_len_qo = get<0>(logical_seq_shape);
+        seq_len_kv = get<1>(logical_seq_shape);
+      } else {
+        seq_len_qo = shape.seq_len_qo;
+        seq_len_kv = shape.seq_len_kv;
+      }
+
+      auto offset = cute::min(seq_len_qo, seq_len_kv);
+      auto discard_seq_coord = seq_len_qo - offset;
+      auto full_tile_offset = seq_len_kv - offset;
+
+      for (int h_kv = 0; h_kv < num_heads_kv; h_kv++) {
+        cutlass::TensorRef ref_K(block_K.get() + offset_k, LayoutK::packed({head_size_qk, seq_len_kv}));
+        cutlass::TensorRef ref_Kn(block_K.get() + offset_k, LayoutQ::packed({seq_len_kv, head_size_qk}));
+        cutlass::TensorRef ref_V(block_V.get() + offset_v, LayoutV::packed({seq_len_kv, head_size_vo}));
+        cutlass::TensorRef ref_Vt(block_V.get() + offset_v, LayoutK::packed({head_size_vo, seq_len_kv}));
+
+        // dK and dV are summed over all query heads sharing this KV head
+        cutlass::DeviceAllocation<ElementAcc> block_acc_dK(seq_len_kv * head_size_qk);
+        cutlass::DeviceAllocation<ElementAcc> block_acc_dV(seq_len_kv * head_size_vo);
+        compat::memset(block_acc_dK.get(), 0, block_acc_dK.size() * sizeof(ElementAcc));
+        compat::memset(block_acc_dV.get(), 0, block_acc_dV.size() * sizeof(ElementAcc));
+
+        for (int g = 0; g < q_group_size; g++) {
+          int h = h_kv * q_group_size + g;
+          cutlass::TensorRef ref_Q(block_Q.get() + offset_q, LayoutQ::packed({seq_len_qo, head_size_qk}));
+          cutlass::TensorRef ref_dO(block_dO.get() + offset_o, LayoutO::packed({seq_len_qo, head_size_vo}));
+
+          // S = Q * K^T, dP = dO * V^T
+          cutlass::DeviceAllocation<ElementAcc> block_S(seq_len_qo * seq_len_kv);
+          cutlass::DeviceAllocation<ElementAcc> block_dP(seq_len_qo * seq_len_kv);
+          reference_gemm(seq_len_qo, seq_len_kv, head_size_qk, 1.f, ref_Q, ref_K, 0.f, block_S.get());
+          reference_gemm(seq_len_qo, seq_len_kv, head_size_vo, 1.f, ref_dO, ref_Vt, 0.f, block_dP.get());
+          std::vector<ElementAcc> host_P = to_host(block_S.get(), block_S.size());
+          std::vector<ElementAcc> host_dS = to_host(block_dP.get(), block_dP.size());
+
+          // P = softmax(scale * S); rows left without any key by the causal mask are zero
+          for (int row = 0; row < seq_len_qo; row++) {
+            ElementAcc* p = host_P.data() + row * seq_len_kv;
+            ElementAcc max_val = -INFINITY;
+            for (int col = 0; col < seq_len_kv; col++) {
+              if (Causal && (col - full_tile_offset) > (row - discard_seq_coord)) {
+                p[col] = -INFINITY;
+              } else {
+                p[col] *= softmax_scale;
+              }
+              max_val = std::max(max_val, p[col]);
+            }
+            ElementAcc sum = 0;
+            for (int col = 0; col < seq_len_kv; col++) {
+              p[col] = (max_val == -INFINITY) ? 0.f : std::exp(p[col] - max_val);
+              sum += p[col];
+            }
+            for (int col = 0; col < seq_len_kv; col++) {
+              p[col] = (sum > 0) ? p[col] / sum : 0.f;
+            }
+          }
+
+          // O = P * V, D = rowsum(dO o O)
+          cutlass::DeviceAllocation<ElementAcc> block_P(host_P.size());
+          compat::memcpy<ElementAcc>(block_P.get(), host_P.data(), host_P.size());
+          cutlass::TensorRef ref_P(block_P.get(), LayoutQ::packed({seq_len_qo, seq_len_kv}));
+          cutlass::TensorRef ref_Pt(block_P.get(), LayoutK::packed({seq_len_kv, seq_len_qo}));
+
+          cutlass::DeviceAllocation<ElementAcc> block_ref_O(seq_len_qo * head_size_vo);
+          reference_gemm(seq_len_qo, head_size_vo, seq_len_kv, 1.f, ref_P, ref_V, 0.f, block_ref_O.get());
+          std::vector<ElementAcc> host_O = to_host(block_ref_O.get(), block_ref_O.size());
+          std::vector<ElementQ> host_dO = to_host(block_dO.get() + offset_o, host_O.size());
+
+          // dS = P o (dP - D)
+          for (int row = 0; row < seq_len_qo; row++) {
+            ElementAcc D = 0;
+            for (int v = 0; v < head_size_vo; v++) {
+              D += static_cast<ElementAcc>(host_dO[row * head_size_vo + v]) * host_O[row * head_size_vo + v];
+            }
+            for (int col = 0; col < seq_len_kv; col++) {
+              int idx = row * seq_len_kv + col;
+              host_dS[idx] = host_P[idx] * (host_dS[idx] - D);
+            }
+          }
+
+          cutlass::DeviceAllocation<ElementAcc> block_dS(host_dS.size());
+          compat::memcpy<ElementAcc>(block_dS.get(), host_dS.data(), host_dS.size());
+          cutlass::TensorRef ref_dS(block_dS.get(), LayoutQ::packed({seq_len_qo, seq_len_kv}));
+          cutlass::TensorRef ref_dSt(block_dS.get(), LayoutK::packed({seq_len_kv, seq_len_qo}));
+
+          // dQ = scale * dS * K, dK += scale * dS^T * Q, dV += P^T * dO
+          cutlass::DeviceAllocation<ElementAcc> block_acc_dQ(seq_len_qo * head_size_qk);
+          reference_gemm(seq_len_qo, head_size_qk, seq_len_kv, softmax_scale, ref_dS, ref_Kn, 0.f, block_acc_dQ.get());
+          reference_gemm(seq_len_kv, head_size_qk, seq_len_qo, softmax_scale, ref_dSt, ref_Q, 1.f, block_acc_dK.get());
+          reference_gemm(seq_len_kv, head_size_vo, seq_len_qo, 1.f, ref_Pt, ref_dO, 1.f, block_acc_dV.get());
+          store_reference(block_ref_dQ.get() + offset_q, block_acc_dQ);
+
+          offset_q += seq_len_qo * head_size_qk;
+          offset_o += seq_len_qo * head_size_vo;
+        }
+
+        store_reference(block_ref_dK.get() + offset_k, block_acc_dK);
+        store_reference(block_ref_dV.get() + offset_v, block_acc_dV);
+
+        offset_k += seq_len_kv * head_size_qk;
+        offset_v += seq_len_kv * head_size_vo;
+      }
+    }
+
+    compat::wait();
+
+    // Check if gradients from CUTLASS kernels and reference kernels are equal or not
+    bool passed = cutlass::reference::device::BlockCompareRelativelyEqual(block_ref_dQ.get(), block_dQ.get(),
+                                                                          block_dQ.size(), ElementQ{0.05}, ElementQ{0.05});
+    passed &= cutlass::reference::device::BlockCompareRelativelyEqual(block_ref_dK.get(), block_dK.get(),
+                                                                      block_dK.size(), ElementK{0.05}, ElementK{0.05});
+    passed &= cutlass::reference::device::BlockCompareRelativelyEqual(block_ref_dV.get(), block_dV.get(),
+                                                                      block_dV.size(), ElementV{0.05}, ElementV{0.05});
+    return passed;
+  }
+
+  template<class ProblemShape>
+  auto initialize_varlen(const ProblemShape& problem_size) {
+    int num_batches = get<0>(problem_size);
+
+    // generate Q as --b times
+    //    gaussian (--Q, --Q / 2) sampled positive
+    //    track cumulative 
+    std::mt19937 rng(0x202305151552ull);
+    std::normal_distribution<double> dist_q(get<3>(problem_size), get<3>(problem_size) / 2);
+    std::normal_distribution<double> dist_kv(get<4>(problem_size), get<4>(problem_size) / 2);
+
+    // Use Cacheline Size to calculate alignment
+    constexpr int cacheline_bytes = 64;
+    constexpr int AlignmentQ = cacheline_bytes / sizeof(ElementQ);    // Alignment of Q matrix in units of elements
+    constexpr int AlignmentKV = cacheline_bytes / sizeof(ElementK);   // Alignment of Kand V matrix in units of elements
+
+    auto generate_positive_int = [](auto& dist, auto& gen) {
+      int result = 0;
+      do {
+        result = static_cast<int>(dist(gen));
+      } while (result <= 0);
+      return result;
+    };
+
+    cumulative_seqlen_q = {0};
+    cumulative_seqlen_kv = {0};
+
+    int total_seqlen_q = 0;
+    int total_seqlen_kv = 0;
+    int max_seqlen_q = 0;
+    int max_seqlen_kv = 0;
+
+    for (int i = 0; i < num_batches; i++) {
+      int seqlen_q = cutlass::round_up(generate_positive_int(dist_q, rng), AlignmentQ);
+      int seqlen_kv = cutlass::round_up(generate_positive_int(dist_kv, rng), AlignmentKV);
+
+      total_seqlen_q += seqlen_q;
+      total_seqlen_kv += seqlen_kv;
+
+      max_seqlen_q = std::max(max_seqlen_q, seqlen_q);
+      max_seqlen_kv = std::max(max_seqlen_kv, seqlen_kv);
+
+      cumulative_seqlen_q.push_back(cumulative_seqlen_q.back() + seqlen_q);
+      cumulative_seqlen_kv.push_back(cumulative_seqlen_kv.back() + seqlen_kv);
+    }
+
+    ProblemShape problem_size_for_init = problem_size;
+    get<0>(problem_size_for_init) = 1;
+    get<3>(problem_size_for_init) = total_seqlen_q;
+    get<4>(problem_size_for_init) = total_seqlen_kv;
+
+    ProblemShapeType problem_size_for_launch;
+    problem_size_for_launch.batch = get<0>(problem_size);
+    problem_size_for_launch.num_heads_q = get<1>(problem_size);
+    problem_size_for_launch.num_heads_kv = get<2>(problem_size);
+    problem_size_for_launch.seq_len_qo = cutlass::fmha::collective::VariableLength{max_seqlen_q};
+    problem_size_for_launch.seq_len_kv = cutlass::fmha::collective::VariableLength{max_seqlen_kv};
+    problem_size_for_launch.head_size_qk = get<5>(problem_size);
+    problem_size_for_launch.head_size_vo = get<6>(problem_size);
+
+    return cute::make_tuple(problem_size_for_init, problem_size_for_launch);
+  }
+
+  /// Initialize operands to be used in the kernels and reference
+  ProblemShapeType initialize(const FMHABackwardOptions &options) {
+    auto problem_shape_in =
+        cute::make_tuple(options.batch, options.num_heads_q, options.num_heads_kv, options.seq_len_qo, options.seq_len_kv, options.head_size_qk, options.head_size_vo);
+
+    ProblemShapeType shape;
+    decltype(problem_shape_in) problem_size;
+
+    if constexpr (isVarLen) {
+      auto [problem_shape_init, problem_shape_launch] = initialize_varlen(problem_shape_in);
+      problem_size = problem_shape_init;
+      shape = problem_shape_launch;
+    } else {
+      problem_size = problem_shape_in;
+      shape.batch        = options.batch;
+      shape.num_heads_q  = options.num_heads_q;
+      shape.num_heads_kv = options.num_heads_kv;
+      shape.seq_len_qo   = options.seq_len_qo;
+      shape.seq_len_kv   = options.seq_len_kv;
+      shape.head_size_qk = options.head_size_qk;
+      shape.head_size_vo = options.head_size_vo;
+    }
+
+    auto [batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, head_size_qk, head_size_vo] = problem_size;
+
+    stride_Q = cutlass::make_cute_packed_stride(StrideQ{}, cute::make_shape(seq_len_qo, head_size_qk, num_heads_q,  batch));
+    stride_K = cutlass::make_cute_packed_stride(StrideK{}, cute::make_shape(seq_len_kv, head_size_qk, num_heads_kv, batch));
+    stride_V = cutlass::make_cute_packed_stride(StrideV{}, cute::make_shape(head_size_vo, seq_len_kv, num_heads_kv, batch));
+    stride_O = cutlass::make_cute_packed_stride(StrideO{}, cute::make_shape(seq_len_qo, head_size_vo, num_heads_q,  batch));
+
+    std::size_t mem_size_q = static_cast<std::size_t>(batch) * num_heads_q * seq_len_qo * head_size_qk;
+    std::size_t mem_size_k = static_cast<std::size_t>(batch) * num_heads_kv * seq_len_kv * head_size_qk;
+    std::size_t mem_size_v = static_cast<std::size_t>(batch) * num_heads_kv * seq_len_kv * head_size_vo;
+    std::size_t mem_size_o = static_cast<std::size_t>(batch) * num_heads_q * seq_len_qo * head_size_vo;
+    // The log-sum-exp is padded to the maximum sequence length for variable length problems
+    std::size_t mem_size_lse = static_cast<std::size_t>(shape.batch) * shape.num_heads_q * int(shape.seq_len_qo);
+
+    block_Q.reset(mem_size_q);
+    block_K.reset(mem_size_k);
+    block_V.reset(mem_size_v);
+    block_O.reset(mem_size_o);
+    block_dO.reset(mem_size_o);
+    block_LSE.reset(mem_size_lse);
+    block_dQ.reset(mem_size_q);
+    block_dK.reset(mem_size_k);
+    block_dV.reset(mem_size_v);
+    block_ref_dQ.reset(mem_size_q);
+    block_ref_dK.reset(mem_size_k);
+    block_ref_dV.reset(mem_size_v);
+
+    initialize_block(block_Q, seed + 2023);
+    initialize_block(block_K, seed + 2022);
+    initialize_block(block_V, seed + 2021);
+    initialize_block(block_dO, seed + 2020);
+
+    if (!cumulative_seqlen_q.empty()) {
+      device_cumulative_seqlen_q.reset(cumulative_seqlen_q.size());
+      device_cumulative_seqlen_q.copy_from_host(
+        cumulative_seqlen_q.data(), cumulative_seqlen_q.size());
+    }
+    if (!cumulative_seqlen_kv.empty()) {
+      device_cumulative_seqlen_kv.reset(cumulative_seqlen_kv.size());
+      device_cumulative_seqlen_kv.copy_from_host(
+        cumulative_seqlen_kv.data(), cumulative_seqlen_kv.size());
+    }
+
+    if constexpr (isVarLen) {
+      shape.seq_len_qo.cumulative_length = device_cumulative_seqlen_q.get();
+      shape.seq_len_kv.cumulative_length = device_cumulative_seqlen_kv.get();
+    }
+
+    return shape;
+  }
+
+  template <class Kernel>
+  static void run(typename Kernel::Params params) {
+    namespace syclex = sycl::ext::oneapi::experimental;
+    namespace intelex = sycl::ext::intel::experimental;
+
+    dim3 const block = Kernel::get_block_shape();
+    dim3 const grid = Kernel::get_grid_shape(params);
+
+    // configure smem size and carveout
+    int smem_size = Kernel::SharedStorageSize;
+
+    const auto sycl_block = compat::dim3(block.x, block.y, block.z);
+    const auto sycl_grid = compat::dim3(grid.x, grid.y, grid.z);
+
+    compat::experimental::launch_properties launch_props {
+      syclex::work_group_scratch_size(smem_size),
+    };
+    compat::experimental::kernel_properties kernel_props{
+      syclex::sub_group_size<cute::intel::sg_size>,
+      intelex::grf_size<256>
+    };
+    compat::experimental::launch_policy policy{sycl_grid, sycl_block, launch_props, kernel_props};
+    auto event = compat::experimental::launch<cutlass::device_kernel<Kernel>, Kernel>(policy, params);
+
+    EventManager::getInstance().addEvent(event);
+  }
+
+  void run(::benchmark::State& state, const FMHABackwardOptions &options, const cutlass::KernelHardwareInfo &hw_info) {
+
+    ProblemShapeType shape = initialize(options);
+
+    // Forward pass, saving the log-sum-exp
+    typename FwdKernel::Arguments fwd_arguments{
+      {
+        shape,
+        block_Q.get(), stride_Q,
+        block_K.get(), stride_K,
+        block_V.get(), stride_V,
+        block_O.get(), stride_O,
+        block_LSE.get()
+      },
+      {options.softmax_scale},
+      {},
+      hw_info
+    };
+
+    if (!FwdKernel::can_implement(fwd_arguments)) {
+      state.SkipWithError("Forward kernel cannot implement the problem.");
+      return;
+    }
+
+    cutlass::device_memory::allocation<uint8_t> fwd_workspace(FwdKernel::get_workspace_size(fwd_arguments));
+    CUTLASS_CHECK(FwdKernel::initialize_workspace(fwd_arguments, fwd_workspace.get()));
+    run<FwdKernel>(FwdKernel::to_underlying_arguments(fwd_arguments, fwd_workspace.get()));
+    compat::wait();
+
+    // Backward pass
+    typename DQKernel::KernelArguments bwd_kernel_arguments{
+      shape,
+      block_Q.get(), stride_Q,
+      block_K.get(), stride_K,
+      block_V.get(), stride_V,
+      block_O.get(), stride_O,
+      block_dO.get(), block_LSE.get(),
+      block_dQ.get(), block_dK.get(), block_dV.get()
+    };
+    typename DQKernel::Arguments dq_arguments{bwd_kernel_arguments, {options.softmax_scale}, hw_info};
+    typename DKDVKernel::Arguments dkdv_arguments{bwd_kernel_arguments, {options.softmax_scale}, hw_info};
+
+    if (!DQKernel::can_implement(dq_arguments) || !DKDVKernel::can_implement(dkdv_arguments)) {
+      state.SkipWithError("Backward kernels cannot implement the problem.");
+      return;
+    }
+
+    // The dQ kernel leaves D = rowsum(dO o O) in the workspace for the dK/dV kernel
+    size_t workspace_size = DQKernel::get_workspace_size(dq_arguments);
+    cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
+    CUTLASS_CHECK(DQKernel::initialize_workspace(dq_arguments, workspace.get()));
+
+    auto dq_params = DQKernel::to_underlying_arguments(dq_arguments, workspace.get());
+    auto dkdv_params = DKDVKernel::to_underlying_arguments(dkdv_arguments, workspace.get());
+
+    run<DQKernel>(dq_params);
+    run<DKDVKernel>(dkdv_params);
+
+    compat::wait();
+
+    // Verify that the result is correct
+    bool passed = verify(shape, options.softmax_scale);
+    if(not passed) {
+      state.SkipWithError("Disposition Failed.");
+    }
+
+    state.counters["batch"] = options.batch;
+    state.counters["num_heads_q"] = options.num_heads_q;
+    state.counters["num_heads_kv"] = options.num_heads_kv;
+    state.counters["seq_len_qo"] = options.seq_len_qo;
+    state.counters["seq_len_kv"] = options.seq_len_kv;
+    state.counters["head_size_kv"] = options.head_size_qk;
+    state.counters["head_size_vo"] = options.head_size_vo;
+    state.counters["scale"] = options.softmax_scale;
+    state.counters["causal"] = Causal;
+    state.counters["varlen"] = isVarLen;
+
+    std::stringstream extra_label;
+    extra_label << "layoutQ=RowMajor ";
+    extra_label << "layoutK=ColumnMajor ";
+    extra_label << "layoutV=RowMajor ";
+
+    state.SetLabel(extra_label.str());
+    // when seq_len_qo is not equal to seq_len_kv we use bottom up approach for the masking. 
+    // Following changes will adjust the effective_seq_len_kv when masking applied for such cases. 
+    auto offset = cute::min(options.seq_len_qo, options.seq_len_kv);
+    auto discard_seq_coord = options.seq_len_qo - offset;
+    auto full_tile_offset = options.seq_len_kv - offset;
+    auto effective_seq_len_kv = Causal ? full_tile_offset + ((offset + 1) / 2.0): options.seq_len_kv;
+    auto effective_seq_len_qo = Causal ? options.seq_len_qo - discard_seq_coord  : options.seq_len_qo;
+
+    // Five GEMMs: S = Q*K^T, dQ = dS*K and dK = dS^T*Q over head_size_qk, dP = dO*V^T and dV = P^T*dO
+    // over head_size_vo. S and dP being recomputed by the dK/dV kernel is not counted.
+    double flops_qk = 2.0 * options.batch * options.num_heads_q * effective_seq_len_qo * effective_seq_len_kv * options.head_size_qk;
+    double flops_vo = 2.0 * options.batch * options.num_heads_q * effective_seq_len_qo * effective_seq_len_kv * options.head_size_vo;
+    double gflops = (3 * flops_qk + 2 * flops_vo) * 1e-9;
+
+    double mb_inputs = options.batch * (
+        sizeof(ElementQ) * options.num_heads_q * effective_seq_len_qo * options.head_size_qk +          // Q
+        sizeof(ElementK) * options.num_heads_kv * effective_seq_len_kv * options.head_size_qk +         // K
+        sizeof(ElementV) * options.num_heads_kv * effective_seq_len_kv * options.head_size_vo +         // V
+        (sizeof(ElementO) + sizeof(ElementQ)) * options.num_heads_q * effective_seq_len_qo * options.head_size_vo +  // O, dO
+        2 * sizeof(ElementLSE) * options.num_heads_q * effective_seq_len_qo);                          // LSE, D
+    double mb_outputs = options.batch * (
+        sizeof(ElementQ) * options.num_heads_q * effective_seq_len_qo * options.head_size_qk +
+        sizeof(ElementK) * options.num_heads_kv * effective_seq_len_kv * options.head_size_qk +
+        sizeof(ElementV) * options.num_heads_kv * effective_seq_len_kv * options.head_size_vo);
+    double mega_bytes_transferred = (mb_inputs + mb_outputs) * (1e-6);
+
+    RuntimeStatistics statistics(options.statistics);
+    for(auto _ : state) {
+      statistics.begin_iteration();
+      do {
+        GPU_Clock timer;
+        timer.start();
+        run<DQKernel>(dq_params);
+        run<DKDVKernel>(dkdv_params);
+        auto ms_elapsed = timer.milliseconds();
+        statistics.add(ms_elapsed);
+      } while (statistics.keep_sampling());
+      state.SetIterationTime(statistics.iteration_seconds());
+    }
+    statistics.report(state, gflops, mega_bytes_transferred);
+  }
+};
+
+}
+
+#define CUTLASS_FMHA_BACKWARD_BENCHMARK(F) cutlass::benchmark::BenchmarkRegistry<cutlass::benchmark::FMHABackwardOptions>::Register(#F, &F##_func)
+
+#define CUTLASS_CREATE_FMHA_BACKWARD_BENCHMARK(F)                           \
+  static void F##_func(                                                     \
+      ::benchmark::State& state,                                            \
+      cutlass::benchmark::FMHABackwardOptions const& options,               \
+      cutlass::KernelHardwareInfo const& hw_info) {                         \
+    auto bench = cutlass::benchmark::BenchmarkRunnerFMHABackward<F>();      \
+    bench.run(state, options, hw_info);                                     \
+  }
@@ -0,0 +1,116 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "benchmark_runner.hpp"
+#include "fmha_backward_configuration.hpp"
+
+// The forward tiles must give each sub-group whole rows (SG layout (N,1,1)) so the epilogue can
+// save the log-sum-exp. Backward tiles: (q,k,d) for the dQ kernel, (k,q,d) for the dK/dV kernel.
+struct ShapeBwd_h64 {
+  static constexpr int PipelineStages = 2;
+  using ShapeQK = Shape<_128, _64, _32>;
+  using ShapePV = Shape<_128, _32, _64>;
+  using ShapeOutput = Shape<_128, _64>;
+  using SubgroupLayoutFwd = Layout<Shape<_8, _1, _1>, Stride<_1, _1, _1>>;
+
+  using ShapeBwdQK = Shape<_64, _64, _32>;
+  using ShapeBwdDQ = Shape<_64, _32, _64>;
+  using ShapeBwdKQ = Shape<_64, _64, _32>;
+  using ShapeBwdDKV = Shape<_64, _32, _64>;
+  using SubgroupLayoutBwd = Layout<Shape<_8, _1, _1>, Stride<_1, _1, _1>>;
+  static constexpr int DTiles = 2;
+  static constexpr int VTiles = 2;
+};
+
+struct ShapeBwd_h128 {
+  static constexpr int PipelineStages = 2;
+  using ShapeQK = Shape<_128, _64, _32>;
+  using ShapePV = Shape<_128, _32, _64>;
+  using ShapeOutput = Shape<_128, _128>;
+  using SubgroupLayoutFwd = Layout<Shape<_16, _1, _1>, Stride<_1, _1, _1>>;
+
+  using ShapeBwdQK = Shape<_64, _64, _32>;
+  using ShapeBwdDQ = Shape<_64, _32, _64>;
+  using ShapeBwdKQ = Shape<_64, _32, _32>;
+  using ShapeBwdDKV = Shape<_64, _32, _32>;
+  using SubgroupLayoutBwd = Layout<Shape<_8, _1, _1>, Stride<_1, _1, _1>>;
+  static constexpr int DTiles = 4;
+  static constexpr int VTiles = 4;
+};
+
+template<class QKVType, bool Causal, bool VarLen, class TileShapeConfig>
+struct FMHABackwardConfigGen {
+  using type = cutlass::flash_attention::FMHABackwardConfig<QKVType, Causal, VarLen, TileShapeConfig>;
+};
+
+using BmgFMHABackwardBF16BF16FP32_h64_Causal_FixedLen = FMHABackwardConfigGen<cutlass::bfloat16_t, true, false, ShapeBwd_h64>::type;
+using BmgFMHABackwardBF16BF16FP32_h64_NonCausal_FixedLen = FMHABackwardConfigGen<cutlass::bfloat16_t, false, false, ShapeBwd_h64>::type;
+using BmgFMHABackwardBF16BF16FP32_h64_Causal_VarLen = FMHABackwardConfigGen<cutlass::bfloat16_t, true, true, ShapeBwd_h64>::type;
+using BmgFMHABackwardBF16BF16FP32_h64_NonCausal_VarLen = FMHABackwardConfigGen<cutlass::bfloat16_t, false, true, ShapeBwd_h64>::type;
+using BmgFMHABackwardBF16BF16FP32_h128_Causal_FixedLen = FMHABackwardConfigGen<cutlass::bfloat16_t, true, false, ShapeBwd_h128>::type;
+using BmgFMHABackwardBF16BF16FP32_h128_NonCausal_FixedLen = FMHABackwardConfigGen<cutlass::bfloat16_t, false, false, ShapeBwd_h128>::type;
+using BmgFMHABackwardBF16BF16FP32_h128_Causal_VarLen = FMHABackwardConfigGen<cutlass::bfloat16_t, true, true, ShapeBwd_h128>::type;
+using BmgFMHABackwardBF16BF16FP32_h128_NonCausal_VarLen = FMHABackwardConfigGen<cutlass::bfloat16_t, false, true, ShapeBwd_h128>::type;
+
+// Same kernels as above, registered under separate names so GQA runs report under their own label
+using BmgFMHABackwardBF16BF16FP32_h128_Causal_FixedLen_GQA = BmgFMHABackwardBF16BF16FP32_h128_Causal_FixedLen;
+using BmgFMHABackwardBF16BF16FP32_h128_NonCausal_FixedLen_GQA = BmgFMHABackwardBF16BF16FP32_h128_NonCausal_FixedLen;
+using BmgFMHABackwardBF16BF16FP32_h128_Causal_VarLen_GQA = BmgFMHABackwardBF16BF16FP32_h128_Causal_VarLen;
+using BmgFMHABackwardBF16BF16FP32_h128_NonCausal_VarLen_GQA = BmgFMHABackwardBF16BF16FP32_h128_NonCausal_VarLen;
+
+CUTLASS_CREATE_FMHA_BACKWARD_BENCHMARK(BmgFMHABackwardBF16BF16FP32_h64_Causal_FixedLen);
+CUTLASS_CREATE_FMHA_BACKWARD_BENCHMARK(BmgFMHABackwardBF16BF16FP32_h64_NonCausal_FixedLen);
+CUTLASS_CREATE_FMHA_BACKWARD_BENCHMARK(BmgFMHABackwardBF16BF16FP32_h64_Causal_VarLen);
+CUTLASS_CREATE_FMHA_BACKWARD_BENCHMARK(BmgFMHABackwardBF16BF16FP32_h64_NonCausal_VarLen);
+CUTLASS_CREATE_FMHA_BACKWARD_BENCHMARK(BmgFMHABackwardBF16BF16FP32_h128_Causal_FixedLen);
+CUTLASS_CREATE_FMHA_BACKWARD_BENCHMARK(BmgFMHABackwardBF16BF16FP32_h128_NonCausal_FixedLen);
+CUTLASS_CREATE_FMHA_BACKWARD_BENCHMARK(BmgFMHABackwardBF16BF16FP32_h128_Causal_VarLen);
+CUTLASS_CREATE_FMHA_BACKWARD_BENCHMARK(BmgFMHABackwardBF16BF16FP32_h128_NonCausal_VarLen);
+CUTLASS_CREATE_FMHA_BACKWARD_BENCHMARK(BmgFMHABackwardBF16BF16FP32_h128_Causal_FixedLen_GQA);
+CUTLASS_CREATE_FMHA_BACKWARD_BENCHMARK(BmgFMHABackwardBF16BF16FP32_h128_NonCausal_FixedLen_GQA);
+CUTLASS_CREATE_FMHA_BACKWARD_BENCHMARK(BmgFMHABackwardBF16BF16FP32_h128_Causal_VarLen_GQA);
+CUTLASS_CREATE_FMHA_BACKWARD_BENCHMARK(BmgFMHABackwardBF16BF16FP32_h128_NonCausal_VarLen_GQA);
+
+static void register_flash_attention_backward_benchmarks() {
+  CUTLASS_FMHA_BACKWARD_BENCHMARK(BmgFMHABackwardBF16BF16FP32_h64_Causal_FixedLen);
+  CUTLASS_FMHA_BACKWARD_BENCHMARK(BmgFMHABackwardBF16BF16FP32_h64_NonCausal_FixedLen);
+  CUTLASS_FMHA_BACKWARD_BENCHMARK(BmgFMHABackwardBF16BF16FP32_h64_Causal_VarLen);
+  CUTLASS_FMHA_BACKWARD_BENCHMARK(BmgFMHABackwardBF16BF16FP32_h64_NonCausal_VarLen);
+  CUTLASS_FMHA_BACKWARD_BENCHMARK(BmgFMHABackwardBF16BF16FP32_h128_Causal_FixedLen);
+  CUTLASS_FMHA_BACKWARD_BENCHMARK(BmgFMHABackwardBF16BF16FP32_h128_NonCausal_FixedLen);
+  CUTLASS_FMHA_BACKWARD_BENCHMARK(BmgFMHABackwardBF16BF16FP32_h128_Causal_VarLen);
+  CUTLASS_FMHA_BACKWARD_BENCHMARK(BmgFMHABackwardBF16BF16FP32_h128_NonCausal_VarLen);
+  CUTLASS_FMHA_BACKWARD_BENCHMARK(BmgFMHABackwardBF16BF16FP32_h128_Causal_FixedLen_GQA);
+  CUTLASS_FMHA_BACKWARD_BENCHMARK(BmgFMHABackwardBF16BF16FP32_h128_NonCausal_FixedLen_GQA);
+  CUTLASS_FMHA_BACKWARD_BENCHMARK(BmgFMHABackwardBF16BF16FP32_h128_Causal_VarLen_GQA);
+  CUTLASS_FMHA_BACKWARD_BENCHMARK(BmgFMHABackwardBF16BF16FP32_h128_NonCausal_VarLen_GQA);
+}
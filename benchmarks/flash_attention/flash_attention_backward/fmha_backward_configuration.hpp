@@ -0,0 +1,121 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+#pragma once
+
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "flash_attention_v2/collective/xe_fmha_fwd_mainloop.hpp"
+#include "flash_attention_v2/collective/xe_fmha_fwd_epilogue.hpp"
+#include "flash_attention_v2/collective/xe_fmha_bwd_mainloop.hpp"
+#include "flash_attention_v2/kernel/xe_fhma_fwd_kernel.hpp"
+#include "flash_attention_v2/kernel/xe_fmha_bwd_kernel.hpp"
+#include "flash_attention_v2/kernel/xe_tile_scheduler.hpp"
+
+namespace cutlass {
+namespace flash_attention {
+
+// Builds the forward kernel (which saves the log-sum-exp) and the two backward kernels
+//   for one problem configuration. O is kept in float so that D = rowsum(dO o O) is exact.
+template <typename ElementInputType, bool HasCausal, bool IsVarLen, typename TileShapeConfig>
+struct FMHABackwardConfig {
+
+  using ElementQ = ElementInputType;
+  using ElementK = ElementInputType;
+  using ElementV = ElementInputType;
+  using ElementO = float;
+  static constexpr bool Causal = HasCausal;
+  static constexpr bool VarLen = IsVarLen;
+
+  using StrideQ = cute::Stride<int, cute::_1, int, int>;
+  using StrideK = cute::Stride<int, cute::_1, int, int>;
+  using StrideV = cute::Stride<cute::_1, int, int, int>;
+  using StrideO = cute::Stride<int, cute::_1, int, int>;
+
+  using ProblemShapeType = cutlass::fmha::kernel::FMHAProblemShape<VarLen>;
+  using MMAOperation = cute::XE_DPAS_TT<8, float, ElementInputType>;
+
+  template <class Element, class Stride>
+  using DummyTensor = decltype(cute::make_tensor(cute::make_gmem_ptr(static_cast<Element*>(nullptr)),
+                                                 cute::make_layout(cute::repeat<cute::rank_v<Stride>>(1), Stride{})));
+  using TensorQ = DummyTensor<ElementQ, StrideQ>;
+  using TensorK = DummyTensor<ElementK, StrideK>;
+  using TensorV = DummyTensor<ElementV, StrideV>;
+  using TensorO = DummyTensor<ElementO, StrideO>;
+
+  template <class TileShape, class SubgroupLayout>
+  using TiledMMA = typename cute::TiledMMAHelper<cute::MMA_Atom<MMAOperation>, cute::Layout<TileShape>,
+                                                 SubgroupLayout>::TiledMMA;
+
+  //
+  // Forward
+  //
+  using SubgroupLayoutFwd = typename TileShapeConfig::SubgroupLayoutFwd;
+  using SubgroupLayoutPV = decltype(cutlass::fmha::collective::get_sg_layout_pv(SubgroupLayoutFwd{}));
+  using TiledMMAQK = TiledMMA<typename TileShapeConfig::ShapeQK, SubgroupLayoutFwd>;
+  using TiledMMAPV = TiledMMA<typename TileShapeConfig::ShapePV, SubgroupLayoutPV>;
+  static constexpr int VTilesFwd = cute::get<1>(typename TileShapeConfig::ShapeOutput{})
+                                 / cute::get<1>(typename TileShapeConfig::ShapePV{});
+
+  using FwdMainloop = cutlass::fmha::collective::FMHAFwdMainloop<
+      cutlass::fmha::XeDefault<TileShapeConfig::PipelineStages>, Causal,
+      TiledMMAQK, TiledMMAPV, VTilesFwd,
+      TensorQ, TensorK, TensorV>;
+  using FwdEpilogue = cutlass::fmha::collective::FMHAFwdEpilogue<
+      FwdMainloop, typename TileShapeConfig::ShapeOutput, TensorO>;
+  using FwdKernel = cutlass::fmha::kernel::XeFMHAFwdKernel<
+      ProblemShapeType, FwdMainloop, FwdEpilogue, cutlass::fmha::kernel::XeFHMAIndividualTileScheduler>;
+
+  //
+  // Backward
+  //
+  using SubgroupLayoutBwd = typename TileShapeConfig::SubgroupLayoutBwd;
+  using SubgroupLayoutBwd2 = decltype(cutlass::fmha::collective::get_sg_layout_pv(SubgroupLayoutBwd{}));
+
+  using TiledMMABwdQK = TiledMMA<typename TileShapeConfig::ShapeBwdQK, SubgroupLayoutBwd>;
+  using TiledMMABwdDQ = TiledMMA<typename TileShapeConfig::ShapeBwdDQ, SubgroupLayoutBwd2>;
+  using TiledMMABwdKQ = TiledMMA<typename TileShapeConfig::ShapeBwdKQ, SubgroupLayoutBwd>;
+  using TiledMMABwdDKV = TiledMMA<typename TileShapeConfig::ShapeBwdDKV, SubgroupLayoutBwd2>;
+
+  using DQMainloop = cutlass::fmha::collective::FMHABwdDQMainloop<
+      cutlass::fmha::XeDefault<TileShapeConfig::PipelineStages>, Causal,
+      TiledMMABwdQK, TiledMMABwdDQ, TileShapeConfig::DTiles,
+      TensorQ, TensorK, TensorV, TensorQ>;
+  using DKDVMainloop = cutlass::fmha::collective::FMHABwdDKDVMainloop<
+      cutlass::fmha::XeDefault<TileShapeConfig::PipelineStages>, Causal,
+      TiledMMABwdKQ, TiledMMABwdDKV, TileShapeConfig::DTiles, TileShapeConfig::VTiles,
+      TensorQ, TensorK, TensorV, TensorQ>;
+
+  using DQKernel = cutlass::fmha::kernel::XeFMHABwdDQKernel<ProblemShapeType, DQMainloop, ElementO>;
+  using DKDVKernel = cutlass::fmha::kernel::XeFMHABwdDKDVKernel<ProblemShapeType, DKDVMainloop, ElementO>;
+};
+
+} // namespace flash_attention
+} // namespace cutlass
@@ -38,6 +38,7 @@
 #include "cutlass/gemm/device/gemm_universal_adapter.h"
 #include "cutlass/util/packed_stride.hpp"
 #include "flash_attention_v2/kernel/xe_flash_attn_decode.hpp"
+#include "flash_attention_v2/kernel/xe_flash_attn_decode_split_kv.hpp"
 #include "flash_attention_v2/collective/xe_flash_attn_decode_epilogue.hpp"
 #include "flash_attention_v2/collective/xe_flash_attn_decode_softmax_epilogue.hpp"
 #include "cutlass/util/GPU_Clock.hpp"
@@ -66,6 +67,7 @@ struct FMHADecodeOptions {
       head_size_vo, iterations, page_size;
   float softmax_scale;
   std::string bm_name;
+  StatisticsOptions statistics;
 
   FMHADecodeOptions()
       : error(false), batch(32), num_heads_q(16), num_heads_kv(16), seq_len_qo(1), head_size_qk(128),
@@ -86,6 +88,7 @@ struct FMHADecodeOptions {
     cmd.get_cmd_line_argument("head_size_qk", head_size_qk, head_size_vo);
     cmd.get_cmd_line_argument("iterations", iterations, 100);
     cmd.get_cmd_line_argument("bm_name", bm_name, std::string("Flash Attention v2"));
+    statistics.parse(cmd);
 
     softmax_scale = 1 / std::sqrt(static_cast<float>(head_size_qk));
 
@@ -132,6 +135,9 @@ template <class FMHADecodeConfiguration> struct BenchmarkRunnerFMHADecode {
   using ElementK = typename FMHADecodeKernel::ElementK;
   using ElementV = typename FMHADecodeKernel::ElementV;
   using ElementAcc = typename FMHADecodeKernel::ElementAccumulator;
+  // FP8 K/V are dequantized with per-KV-head scales and P stays in the Q type, as in the kernel.
+  static constexpr bool isFP8KV = cute::is_any_of_v<ElementK, cutlass::float_e4m3_t, cutlass::float_e5m2_t>;
+  using ElementP = cute::conditional_t<isFP8KV, ElementQ, ElementV>;
 
   using CollectiveEpilogue = typename FMHADecodeKernel::CollectiveEpilogue;
   using ElementOutput = typename CollectiveEpilogue::ElementOutput;
@@ -166,6 +172,10 @@ template <class FMHADecodeConfiguration> struct BenchmarkRunnerFMHADecode {
   std::vector<cutlass::DeviceAllocation<ElementV>> block_V_cache;
   cutlass::DeviceAllocation<ElementOutput> block_O;
   cutlass::DeviceAllocation<ElementOutput> block_ref_O;
+  std::vector<float> host_K_scale;
+  std::vector<float> host_V_scale;
+  cutlass::DeviceAllocation<float> block_K_scale;
+  cutlass::DeviceAllocation<float> block_V_scale;
 
   std::vector<int> cumulative_seqlen_q;
   std::vector<int> cumulative_seqlen_kv;
@@ -287,6 +297,12 @@ template <class FMHADecodeConfiguration> struct BenchmarkRunnerFMHADecode {
         compat::memcpy<ElementAccumulator>(host_S.data(), block_S.get(), host_S.size());
         compat::wait();
 
+        if constexpr (isFP8KV) {
+          for (auto& s : host_S) {
+            s *= host_K_scale[h / q_group_size];
+          }
+        }
+
         // delete this memory as it is no longer needed
         block_S.reset();
 
@@ -345,14 +361,14 @@ template <class FMHADecodeConfiguration> struct BenchmarkRunnerFMHADecode {
           }
         }
 
-        std::vector<ElementV> host_P(host_S.size());
+        std::vector<ElementP> host_P(host_S.size());
         for (int p = 0; p < host_P.size(); p++)
-          host_P[p] = static_cast<ElementV>(host_S[p]);
+          host_P[p] = static_cast<ElementP>(host_S[p]);
 
-        cutlass::DeviceAllocation<ElementV> block_P;
+        cutlass::DeviceAllocation<ElementP> block_P;
         block_P.reset(host_P.size());
 
-        compat::memcpy<ElementV>(block_P.get(), host_P.data(), host_P.size());
+        compat::memcpy<ElementP>(block_P.get(), host_P.data(), host_P.size());
         compat::wait();
 
         cutlass::TensorRef ref_P(block_P.get(), LayoutQ::packed({seq_len_qo, seq_len_kv_total}));
@@ -379,6 +395,12 @@ template <class FMHADecodeConfiguration> struct BenchmarkRunnerFMHADecode {
         compat::memcpy<ElementAccumulator>(vec_acc.data(), block_acc.get(), vec_acc.size());
         compat::wait();
 
+        if constexpr (isFP8KV) {
+          for (auto& acc : vec_acc) {
+            acc *= host_V_scale[h / q_group_size];
+          }
+        }
+
         // delete this memory as it is no longer needed
         block_acc.reset();
         std::vector<ElementOutput> vec_out(vec_acc.size());
@@ -577,6 +599,19 @@ template <class FMHADecodeConfiguration> struct BenchmarkRunnerFMHADecode {
       initialize_block(block_V_cache[i], seed + i + 103);
     }
 
+    if constexpr (isFP8KV) {
+      host_K_scale.resize(num_heads_kv);
+      host_V_scale.resize(num_heads_kv);
+      for (int h = 0; h < num_heads_kv; h++) {
+        host_K_scale[h] = 0.5f + 0.25f * (h % 4);
+        host_V_scale[h] = 1.5f - 0.25f * (h % 4);
+      }
+      block_K_scale.reset(num_heads_kv);
+      block_V_scale.reset(num_heads_kv);
+      block_K_scale.copy_from_host(host_K_scale.data(), num_heads_kv);
+      block_V_scale.copy_from_host(host_V_scale.data(), num_heads_kv);
+    }
+
     block_O.reset(mem_size_o);
     block_ref_O.reset(mem_size_o);
 
@@ -607,36 +642,46 @@ template <class FMHADecodeConfiguration> struct BenchmarkRunnerFMHADecode {
     return problem_shape;
   }
 
-  static void run(typename FMHADecodeKernel::Params params) {
-    dim3 const block = FMHADecodeKernel::get_block_shape();
-    dim3 const grid = FMHADecodeKernel::get_grid_shape(params);
+  template <class Kernel>
+  static void launch(typename Kernel::Params params) {
+    dim3 const block = Kernel::get_block_shape();
+    dim3 const grid = Kernel::get_grid_shape(params);
 
     // configure smem size and carveout
-    int smem_size = FMHADecodeKernel::SharedStorageSize;
+    int smem_size = Kernel::SharedStorageSize;
 
     const auto sycl_block = compat::dim3(block.x, block.y, block.z);
     const auto sycl_grid = compat::dim3(grid.x, grid.y, grid.z);
 
 #if !defined(SYCL_EXT_ONEAPI_WORK_GROUP_SCRATCH_MEMORY)
     using namespace compat::experimental;
-    auto event = launch<cutlass::device_kernel<FMHADecodeKernel>, FMHADecodeKernel>(
+    auto event = compat::experimental::launch<cutlass::device_kernel<Kernel>, Kernel>(
         launch_policy{sycl_grid, sycl_block, local_mem_size{static_cast<std::size_t>(smem_size)},
-                      kernel_properties{sycl_exp::sub_group_size<FMHADecodeKernel::DispatchPolicy::SubgroupSize>}},
+                      kernel_properties{sycl_exp::sub_group_size<Kernel::DispatchPolicy::SubgroupSize>}},
         params);
 #else
     compat::experimental::launch_properties launch_props{
       sycl::ext::oneapi::experimental::work_group_scratch_size(smem_size)
     };
     compat::experimental::kernel_properties kernel_props{
-      sycl::ext::oneapi::experimental::sub_group_size<FMHADecodeKernel::DispatchPolicy::SubgroupSize>
+      sycl::ext::oneapi::experimental::sub_group_size<Kernel::DispatchPolicy::SubgroupSize>
     };
     compat::experimental::launch_policy policy{sycl_grid, sycl_block, launch_props, kernel_props};
-    auto event = compat::experimental::launch<cutlass::device_kernel<FMHADecodeKernel>, FMHADecodeKernel>(policy, params);
+    auto event = compat::experimental::launch<cutlass::device_kernel<Kernel>, Kernel>(policy, params);
 #endif
 
     EventManager::getInstance().addEvent(event);
   }
 
+  static void run(typename FMHADecodeKernel::Params params) {
+    launch<FMHADecodeKernel>(params);
+    if constexpr (FMHADecodeConfiguration::SplitKV) {
+      // Merge the per-partition results written to the workspace
+      using CombineKernel = typename FMHADecodeKernel::CombineKernel;
+      launch<CombineKernel>(FMHADecodeKernel::to_combine_params(params));
+    }
+  }
+
   void run(::benchmark::State& state, const FMHADecodeOptions &options, const cutlass::KernelHardwareInfo &hw_info) {
 
     ProblemShapeType problem_size = initialize(options);
@@ -651,7 +696,8 @@ template <class FMHADecodeConfiguration> struct BenchmarkRunnerFMHADecode {
         block_V_cache[0].get(), stride_V_cache,
         PagedKV ? paged_kv_cache.page_table.get() : nullptr,
         PagedKV ? paged_kv_cache.page_size : 0,
-        PagedKV ? paged_kv_cache.num_pages_per_seq.get() : nullptr},
+        PagedKV ? paged_kv_cache.num_pages_per_seq.get() : nullptr,
+        0, block_K_scale.get(), block_V_scale.get()},
         {options.softmax_scale},
         {block_O.get(), stride_O},
         hw_info};
@@ -719,73 +765,55 @@ template <class FMHADecodeConfiguration> struct BenchmarkRunnerFMHADecode {
                      sizeof(ElementOutput) * options.batch * options.num_heads_q * effective_seq_len_qo * options.head_size_vo;
     double mega_bytes_transferred = (gbps_qk + gbps_pv) * (1e-6);
 
-    initialize_counters(state);
+    RuntimeStatistics statistics(options.statistics);
     int32_t counter = 1;
     for(auto _ : state) {
-      state.PauseTiming();
-      int input_num = std::max(int(0), counter % count);
-
-      typename FMHADecodeKernel::Arguments arguments{
-        cutlass::gemm::GemmUniversalMode::kGemm,
-        problem_size,
-        {block_Q[input_num].get(), stride_Q,
-        block_K[input_num].get(), stride_K,
-        block_V[input_num].get(), stride_V,
-        block_K_cache[input_num].get(), stride_K_cache,
-        block_V_cache[input_num].get(), stride_V_cache,
-        PagedKV ? paged_kv_cache.page_table.get() : nullptr,
-        PagedKV ? paged_kv_cache.page_size : 0,
-        PagedKV ? paged_kv_cache.num_pages_per_seq.get() : nullptr},
-        {options.softmax_scale},
-        {block_O.get(), stride_O},
-        hw_info};
-
-      size_t workspace_size = FMHADecodeKernel::get_workspace_size(arguments);
-      cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
-
-      FMHADecodeKernel::can_implement(arguments);
-
-      // Initialize the workspace
-      auto status = FMHADecodeKernel::initialize_workspace(arguments, workspace.get());
-      if (status != cutlass::Status::kSuccess) {
-        return;
-      }
+      statistics.begin_iteration();
+      do {
+        state.PauseTiming();
+        int input_num = std::max(int(0), counter % count);
+
+        typename FMHADecodeKernel::Arguments arguments{
+          cutlass::gemm::GemmUniversalMode::kGemm,
+          problem_size,
+          {block_Q[input_num].get(), stride_Q,
+          block_K[input_num].get(), stride_K,
+          block_V[input_num].get(), stride_V,
+          block_K_cache[input_num].get(), stride_K_cache,
+          block_V_cache[input_num].get(), stride_V_cache,
+          PagedKV ? paged_kv_cache.page_table.get() : nullptr,
+          PagedKV ? paged_kv_cache.page_size : 0,
+          PagedKV ? paged_kv_cache.num_pages_per_seq.get() : nullptr,
+          0, block_K_scale.get(), block_V_scale.get()},
+          {options.softmax_scale},
+          {block_O.get(), stride_O},
+          hw_info};
+
+        size_t workspace_size = FMHADecodeKernel::get_workspace_size(arguments);
+        cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
+
+        FMHADecodeKernel::can_implement(arguments);
+
+        // Initialize the workspace
+        auto status = FMHADecodeKernel::initialize_workspace(arguments, workspace.get());
+        if (status != cutlass::Status::kSuccess) {
+          return;
+        }
 
-      typename FMHADecodeKernel::Params params = FMHADecodeKernel::to_underlying_arguments(arguments, workspace.get());
+        typename FMHADecodeKernel::Params params = FMHADecodeKernel::to_underlying_arguments(arguments, workspace.get());
 
-      state.ResumeTiming();
+        state.ResumeTiming();
 
-      GPU_Clock timer;
-      timer.start();
-      run(params);
-      auto ms_elapsed = timer.milliseconds();
-      update_counters(state, ms_elapsed);
-      state.SetIterationTime(ms_elapsed / 1000);
-      counter++;
+        GPU_Clock timer;
+        timer.start();
+        run(params);
+        auto ms_elapsed = timer.milliseconds();
+        statistics.add(ms_elapsed);
+        counter++;
+      } while (statistics.keep_sampling());
+      state.SetIterationTime(statistics.iteration_seconds());
     }
-    finalize_counters(state, gflops, mega_bytes_transferred);
-  }
-
-private:
-  static void initialize_counters(::benchmark::State& state) {
-    state.counters["avg_runtime_ms"] = 0;
-    state.counters["best_runtime_ms"] = std::numeric_limits<double>::max();
-  }
-
-  static void update_counters(::benchmark::State& state, double ms_elapsed) {
-    state.PauseTiming();
-    state.counters["total_runtime_ms"] += ms_elapsed;
-    state.counters["best_runtime_ms"] = std::min<double>(state.counters["best_runtime_ms"], ms_elapsed);
-    state.ResumeTiming();
-  }
-
-  static void finalize_counters(::benchmark::State& state,  double gflop, double mega_bytes_transferred) {
-    state.counters["avg_runtime_ms"] =
-      state.counters["total_runtime_ms"] / static_cast<double>(state.iterations());
-    state.counters["avg_tflops"] = gflop / state.counters["avg_runtime_ms"];
-    state.counters["avg_throughput"] = mega_bytes_transferred / state.counters["avg_runtime_ms"];
-    state.counters["best_tflop"] = gflop / state.counters["best_runtime_ms"];
-    state.counters["best_bandwidth"] = mega_bytes_transferred / state.counters["best_runtime_ms"];
+    statistics.report(state, gflops, mega_bytes_transferred);
   }
 };
 
@@ -39,6 +39,7 @@
 #include <benchmarks_h128_1024_nonpaged.cpp>
 #include <benchmarks_h192_512_nonpaged.cpp>
 #include <benchmarks_h192_1024_nonpaged.cpp>
+#include <benchmarks_h128_512_splitkv.cpp>
 
 static void register_flash_attention_decode_benchmarks() {
   register_flash_attention_decode_benchmarks_nonpaged_h64_512();
@@ -49,4 +50,5 @@ static void register_flash_attention_decode_benchmarks() {
   register_flash_attention_decode_benchmarks_nonpaged_h96_1024();
   register_flash_attention_decode_benchmarks_nonpaged_h128_1024();
   register_flash_attention_decode_benchmarks_nonpaged_h192_1024();
+  register_flash_attention_decode_benchmarks_splitkv_h128_512();
 }
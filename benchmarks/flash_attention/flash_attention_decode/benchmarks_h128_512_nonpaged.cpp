@@ -47,6 +47,10 @@ using PvcFMHADecodeFP16FP16FP32_RCR_NonPaged_KVTile512_h128_Causal_VarLen = FMHA
 using PvcFMHADecodeFP16FP16FP32_RCR_NonPaged_KVTile512_h128_NonCausal_FixedLen = FMHADecodeConfigGen<cutlass::half_t, float, float, false, false, Shape_h128<512, 8>, false>::type;
 using PvcFMHADecodeFP16FP16FP32_RCR_NonPaged_KVTile512_h128_NonCausal_VarLen = FMHADecodeConfigGen<cutlass::half_t, float, float, false, true, Shape_h128<512, 8>, false>::type;
 
+using PvcFMHADecodeBF16E4M3FP32_RCR_NonPaged_KVTile512_h128_Causal_FixedLen = FMHADecodeConfigGen<cutlass::bfloat16_t, float, float, true, false, Shape_h128<512, 8>, false, false, cutlass::float_e4m3_t>::type;
+using PvcFMHADecodeBF16E4M3FP32_RCR_NonPaged_KVTile512_h128_NonCausal_FixedLen = FMHADecodeConfigGen<cutlass::bfloat16_t, float, float, false, false, Shape_h128<512, 8>, false, false, cutlass::float_e4m3_t>::type;
+using PvcFMHADecodeFP16E5M2FP32_RCR_NonPaged_KVTile512_h128_Causal_FixedLen = FMHADecodeConfigGen<cutlass::half_t, float, float, true, false, Shape_h128<512, 8>, false, false, cutlass::float_e5m2_t>::type;
+
 CUTLASS_CREATE_FMHA_DECODE_BENCHMARK(PvcFMHADecodeBF16BF16FP32_RCR_NonPaged_KVTile512_h128_Causal_FixedLen);
 CUTLASS_CREATE_FMHA_DECODE_BENCHMARK(PvcFMHADecodeBF16BF16FP32_RCR_NonPaged_KVTile512_h128_NonCausal_FixedLen);
 CUTLASS_CREATE_FMHA_DECODE_BENCHMARK(PvcFMHADecodeFP16FP16FP32_RCR_NonPaged_KVTile512_h128_Causal_FixedLen);
@@ -57,6 +61,10 @@ CUTLASS_CREATE_FMHA_DECODE_BENCHMARK(PvcFMHADecodeBF16BF16FP32_RCR_NonPaged_KVTi
 CUTLASS_CREATE_FMHA_DECODE_BENCHMARK(PvcFMHADecodeFP16FP16FP32_RCR_NonPaged_KVTile512_h128_Causal_VarLen);
 CUTLASS_CREATE_FMHA_DECODE_BENCHMARK(PvcFMHADecodeFP16FP16FP32_RCR_NonPaged_KVTile512_h128_NonCausal_VarLen);
 
+CUTLASS_CREATE_FMHA_DECODE_BENCHMARK(PvcFMHADecodeBF16E4M3FP32_RCR_NonPaged_KVTile512_h128_Causal_FixedLen);
+CUTLASS_CREATE_FMHA_DECODE_BENCHMARK(PvcFMHADecodeBF16E4M3FP32_RCR_NonPaged_KVTile512_h128_NonCausal_FixedLen);
+CUTLASS_CREATE_FMHA_DECODE_BENCHMARK(PvcFMHADecodeFP16E5M2FP32_RCR_NonPaged_KVTile512_h128_Causal_FixedLen);
+
 
 static void register_flash_attention_decode_benchmarks_nonpaged_h128_512() {
   CUTLASS_FMHA_DECODE_BENCHMARK(PvcFMHADecodeBF16BF16FP32_RCR_NonPaged_KVTile512_h128_Causal_FixedLen);
@@ -68,4 +76,8 @@ static void register_flash_attention_decode_benchmarks_nonpaged_h128_512() {
   CUTLASS_FMHA_DECODE_BENCHMARK(PvcFMHADecodeBF16BF16FP32_RCR_NonPaged_KVTile512_h128_NonCausal_VarLen);
   CUTLASS_FMHA_DECODE_BENCHMARK(PvcFMHADecodeFP16FP16FP32_RCR_NonPaged_KVTile512_h128_Causal_VarLen);
   CUTLASS_FMHA_DECODE_BENCHMARK(PvcFMHADecodeFP16FP16FP32_RCR_NonPaged_KVTile512_h128_NonCausal_VarLen);
+
+  CUTLASS_FMHA_DECODE_BENCHMARK(PvcFMHADecodeBF16E4M3FP32_RCR_NonPaged_KVTile512_h128_Causal_FixedLen);
+  CUTLASS_FMHA_DECODE_BENCHMARK(PvcFMHADecodeBF16E4M3FP32_RCR_NonPaged_KVTile512_h128_NonCausal_FixedLen);
+  CUTLASS_FMHA_DECODE_BENCHMARK(PvcFMHADecodeFP16E5M2FP32_RCR_NonPaged_KVTile512_h128_Causal_FixedLen);
 }
@@ -47,6 +47,10 @@ using PvcFMHADecodeFP16FP16FP32_RCR_NonPaged_KVTile512_h64_Causal_VarLen = FMHAD
 using PvcFMHADecodeFP16FP16FP32_RCR_NonPaged_KVTile512_h64_NonCausal_FixedLen = FMHADecodeConfigGen<cutlass::half_t, float, float, false, false, Shape_h64<512, 8>, false>::type;
 using PvcFMHADecodeFP16FP16FP32_RCR_NonPaged_KVTile512_h64_NonCausal_VarLen = FMHADecodeConfigGen<cutlass::half_t, float, float, false, true, Shape_h64<512, 8>, false>::type;
 
+using PvcFMHADecodeBF16E4M3FP32_RCR_NonPaged_KVTile512_h64_Causal_FixedLen = FMHADecodeConfigGen<cutlass::bfloat16_t, float, float, true, false, Shape_h64<512, 8>, false, false, cutlass::float_e4m3_t>::type;
+using PvcFMHADecodeBF16E4M3FP32_RCR_NonPaged_KVTile512_h64_NonCausal_FixedLen = FMHADecodeConfigGen<cutlass::bfloat16_t, float, float, false, false, Shape_h64<512, 8>, false, false, cutlass::float_e4m3_t>::type;
+using PvcFMHADecodeFP16E5M2FP32_RCR_NonPaged_KVTile512_h64_Causal_FixedLen = FMHADecodeConfigGen<cutlass::half_t, float, float, true, false, Shape_h64<512, 8>, false, false, cutlass::float_e5m2_t>::type;
+
 
 CUTLASS_CREATE_FMHA_DECODE_BENCHMARK(PvcFMHADecodeBF16BF16FP32_RCR_NonPaged_KVTile512_h64_Causal_FixedLen);
 CUTLASS_CREATE_FMHA_DECODE_BENCHMARK(PvcFMHADecodeBF16BF16FP32_RCR_NonPaged_KVTile512_h64_NonCausal_FixedLen);
@@ -58,6 +62,10 @@ CUTLASS_CREATE_FMHA_DECODE_BENCHMARK(PvcFMHADecodeBF16BF16FP32_RCR_NonPaged_KVTi
 CUTLASS_CREATE_FMHA_DECODE_BENCHMARK(PvcFMHADecodeFP16FP16FP32_RCR_NonPaged_KVTile512_h64_Causal_VarLen);
 CUTLASS_CREATE_FMHA_DECODE_BENCHMARK(PvcFMHADecodeFP16FP16FP32_RCR_NonPaged_KVTile512_h64_NonCausal_VarLen);
 
+CUTLASS_CREATE_FMHA_DECODE_BENCHMARK(PvcFMHADecodeBF16E4M3FP32_RCR_NonPaged_KVTile512_h64_Causal_FixedLen);
+CUTLASS_CREATE_FMHA_DECODE_BENCHMARK(PvcFMHADecodeBF16E4M3FP32_RCR_NonPaged_KVTile512_h64_NonCausal_FixedLen);
+CUTLASS_CREATE_FMHA_DECODE_BENCHMARK(PvcFMHADecodeFP16E5M2FP32_RCR_NonPaged_KVTile512_h64_Causal_FixedLen);
+
 
 static void register_flash_attention_decode_benchmarks_nonpaged_h64_512() {
   CUTLASS_FMHA_DECODE_BENCHMARK(PvcFMHADecodeBF16BF16FP32_RCR_NonPaged_KVTile512_h64_Causal_FixedLen);
@@ -69,4 +77,8 @@ static void register_flash_attention_decode_benchmarks_nonpaged_h64_512() {
   CUTLASS_FMHA_DECODE_BENCHMARK(PvcFMHADecodeBF16BF16FP32_RCR_NonPaged_KVTile512_h64_NonCausal_VarLen);
   CUTLASS_FMHA_DECODE_BENCHMARK(PvcFMHADecodeFP16FP16FP32_RCR_NonPaged_KVTile512_h64_Causal_VarLen);
   CUTLASS_FMHA_DECODE_BENCHMARK(PvcFMHADecodeFP16FP16FP32_RCR_NonPaged_KVTile512_h64_NonCausal_VarLen);
+
+  CUTLASS_FMHA_DECODE_BENCHMARK(PvcFMHADecodeBF16E4M3FP32_RCR_NonPaged_KVTile512_h64_Causal_FixedLen);
+  CUTLASS_FMHA_DECODE_BENCHMARK(PvcFMHADecodeBF16E4M3FP32_RCR_NonPaged_KVTile512_h64_NonCausal_FixedLen);
+  CUTLASS_FMHA_DECODE_BENCHMARK(PvcFMHADecodeFP16E5M2FP32_RCR_NonPaged_KVTile512_h64_Causal_FixedLen);
 }
@@ -49,13 +49,13 @@ template <typename DispatchPolicy> struct MMAOP <DispatchPolicy, half_t, float>
 template <typename ElementInputType_, typename ElementAccumulatorType_, typename ElementOutputType_,
           typename GmemTiledCopyQ_, typename GmemTiledCopyK_, typename GmemTiledCopyV_, typename GmemTiledCopyO_, 
           typename TileShapeQK_, typename TileShapePV_, typename TileShapeOutput_, typename SubgroupLayout_,
-          bool Causal_, bool VarLen_, bool PagedKV_>
+          bool Causal_, bool VarLen_, bool PagedKV_, bool SplitKV_ = false, typename ElementInputKVType_ = ElementInputType_>
 struct FMHADecodeConfig {
 
   using ElementO = ElementOutputType_;     // <- data type of output
   using ElementInputQ = ElementInputType_;     // <- data type of elements in input matrix Q
-  using ElementInputK = ElementInputType_;    // <- data type of elements in input matrix K
-  using ElementInputV = ElementInputType_;    // <- data type of elements in input matrix V
+  using ElementInputK = ElementInputKVType_;    // <- data type of elements in input matrix K
+  using ElementInputV = ElementInputKVType_;    // <- data type of elements in input matrix V
   using ElementAccumulator = ElementAccumulatorType_; // <- data type of accumulator
 
   using LayoutQ = cutlass::layout::RowMajor;
@@ -71,6 +71,7 @@ struct FMHADecodeConfig {
   static constexpr bool Causal = Causal_;
   static constexpr bool VarLen = VarLen_;
   static constexpr bool PagedKV = PagedKV_;
+  static constexpr bool SplitKV = SplitKV_;
   
   static constexpr int PipelineStages = 2;
   using GEMMDispatchPolicy = cutlass::gemm::MainloopIntelXeXMX16<PipelineStages>;
@@ -82,9 +83,13 @@ struct FMHADecodeConfig {
   using GmemTiledCopyK = GmemTiledCopyK_;
   using GmemTiledCopyV = GmemTiledCopyV_;
   using GmemTiledCopyO = GmemTiledCopyO_;
-  using CollectiveEpilogue = cutlass::flash_attention::collective::FlashDecodeEpilogue<
-      EpilogueDispatchPolicy, MMAOperation, TileShapeOutput, SubgroupLayout, ElementAccumulator, ElementO, cutlass::gemm::TagToStrideC_t<LayoutO>, ElementO,
-      GmemTiledCopyO>;
+  using CollectiveEpilogue = std::conditional_t<SplitKV,
+      cutlass::flash_attention::collective::FlashDecodeSplitKVEpilogue<
+          EpilogueDispatchPolicy, MMAOperation, TileShapeOutput, SubgroupLayout, ElementAccumulator, ElementO, cutlass::gemm::TagToStrideC_t<LayoutO>, ElementO,
+          GmemTiledCopyO>,
+      cutlass::flash_attention::collective::FlashDecodeEpilogue<
+          EpilogueDispatchPolicy, MMAOperation, TileShapeOutput, SubgroupLayout, ElementAccumulator, ElementO, cutlass::gemm::TagToStrideC_t<LayoutO>, ElementO,
+          GmemTiledCopyO>>;
 
   using CollectiveSoftmaxEpilogue = cutlass::flash_attention::collective::FlashDecodeSoftmaxEpilogue<Causal, EpilogueDispatchPolicy, ElementAccumulator>;
 
@@ -102,8 +107,11 @@ struct FMHADecodeConfig {
       GmemTiledCopyV, // V,
       Causal, PagedKV>;
 
-  using FMHADecodeKernel = cutlass::flash_attention::kernel::FMHADecode<ProblemShapeType, CollectiveMainloop,
-                                                                    CollectiveSoftmaxEpilogue, CollectiveEpilogue>;
+  using FMHADecodeKernel = std::conditional_t<SplitKV,
+      cutlass::flash_attention::kernel::FMHADecodeSplitKV<ProblemShapeType, CollectiveMainloop,
+                                                          CollectiveSoftmaxEpilogue, CollectiveEpilogue>,
+      cutlass::flash_attention::kernel::FMHADecode<ProblemShapeType, CollectiveMainloop,
+                                                   CollectiveSoftmaxEpilogue, CollectiveEpilogue>>;
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -139,52 +147,65 @@ struct Shape_h192 {
   using SubgroupLayout = Layout<Shape<Int<NumSGs>, _1, _1>>;
 };
 
-template<class QKVType, class AccumulatorType, class OutputType, bool Causal, bool VarLen, class TileShapeConfig, bool PagedKV>
+// K/V loads for 16-bit inputs and for an FP8 KV cache, which is widened to the Q type in registers.
+template <int KVBits>
+struct FMHADecodeKVCopy {
+  using GmemTiledCopyK = cute::XE_2D_U16x16x16_LD_T;
+  using GmemTiledCopyV = cute::XE_2D_U16x32x32_LD_V;
+};
+
+template <>
+struct FMHADecodeKVCopy<8> {
+  using GmemTiledCopyK = cute::XE_2D_U8x16x16_LD_T;
+  using GmemTiledCopyV = cute::XE_2D_U8x32x32_LD_V;
+};
+
+template<class QKVType, class AccumulatorType, class OutputType, bool Causal, bool VarLen, class TileShapeConfig, bool PagedKV, bool SplitKV = false, class KVType = QKVType>
 struct FMHADecodeConfigGen;
 
-template<class QKVType, bool Causal, bool VarLen, class TileShapeConfig, bool PagedKV>
-struct FMHADecodeConfigGen<QKVType, float, float, Causal, VarLen, TileShapeConfig, PagedKV> {
+template<class QKVType, bool Causal, bool VarLen, class TileShapeConfig, bool PagedKV, bool SplitKV, class KVType>
+struct FMHADecodeConfigGen<QKVType, float, float, Causal, VarLen, TileShapeConfig, PagedKV, SplitKV, KVType> {
 
 using GmemTiledCopyQ = cute::XE_2D_U16x1x16_LD_N;
-using GmemTiledCopyK = cute::XE_2D_U16x16x16_LD_T;
-using GmemTiledCopyV = cute::XE_2D_U16x32x32_LD_V;
+using GmemTiledCopyK = typename FMHADecodeKVCopy<cute::sizeof_bits_v<KVType>>::GmemTiledCopyK;
+using GmemTiledCopyV = typename FMHADecodeKVCopy<cute::sizeof_bits_v<KVType>>::GmemTiledCopyV;
 using GmemTiledCopyO = cute::XE_2D_U32x1x16_ST_N;
 
 using type = cutlass::flash_attention::FMHADecodeConfig<
       QKVType, float, float, GmemTiledCopyQ, GmemTiledCopyK, GmemTiledCopyV,
       GmemTiledCopyO, typename TileShapeConfig::ShapeQK, typename TileShapeConfig::ShapePV,
       typename TileShapeConfig::ShapeOutput, typename TileShapeConfig::SubgroupLayout,
-      Causal, VarLen, PagedKV>;
+      Causal, VarLen, PagedKV, SplitKV, KVType>;
 };
 
-template<class QKVType, bool Causal, bool VarLen, class TileShapeConfig, bool PagedKV>
-struct FMHADecodeConfigGen<QKVType, float, cutlass::bfloat16_t, Causal, VarLen, TileShapeConfig, PagedKV> {
+template<class QKVType, bool Causal, bool VarLen, class TileShapeConfig, bool PagedKV, bool SplitKV, class KVType>
+struct FMHADecodeConfigGen<QKVType, float, cutlass::bfloat16_t, Causal, VarLen, TileShapeConfig, PagedKV, SplitKV, KVType> {
 
 using GmemTiledCopyQ = cute::XE_2D_U16x1x16_LD_N;
-using GmemTiledCopyK = cute::XE_2D_U16x16x16_LD_T;
-using GmemTiledCopyV = cute::XE_2D_U16x32x32_LD_V;
+using GmemTiledCopyK = typename FMHADecodeKVCopy<cute::sizeof_bits_v<KVType>>::GmemTiledCopyK;
+using GmemTiledCopyV = typename FMHADecodeKVCopy<cute::sizeof_bits_v<KVType>>::GmemTiledCopyV;
 using GmemTiledCopyO = cute::XE_2D_U16x1x16_ST_N;
 
 using type = cutlass::flash_attention::FMHADecodeConfig<
       QKVType, float, cutlass::bfloat16_t, GmemTiledCopyQ, GmemTiledCopyK, GmemTiledCopyV,
       GmemTiledCopyO, typename TileShapeConfig::ShapeQK, typename TileShapeConfig::ShapePV,
       typename TileShapeConfig::ShapeOutput, typename TileShapeConfig::SubgroupLayout,
-      Causal, VarLen, PagedKV>;
+      Causal, VarLen, PagedKV, SplitKV, KVType>;
 };
 
-template<class QKVType, bool Causal, bool VarLen, class TileShapeConfig, bool PagedKV>
-struct FMHADecodeConfigGen<QKVType, float, cutlass::half_t, Causal, VarLen, TileShapeConfig, PagedKV> {
+template<class QKVType, bool Causal, bool VarLen, class TileShapeConfig, bool PagedKV, bool SplitKV, class KVType>
+struct FMHADecodeConfigGen<QKVType, float, cutlass::half_t, Causal, VarLen, TileShapeConfig, PagedKV, SplitKV, KVType> {
 
 using GmemTiledCopyQ = cute::XE_2D_U16x1x16_LD_N;
-using GmemTiledCopyK = cute::XE_2D_U16x16x16_LD_T;
-using GmemTiledCopyV = cute::XE_2D_U16x32x32_LD_V;
+using GmemTiledCopyK = typename FMHADecodeKVCopy<cute::sizeof_bits_v<KVType>>::GmemTiledCopyK;
+using GmemTiledCopyV = typename FMHADecodeKVCopy<cute::sizeof_bits_v<KVType>>::GmemTiledCopyV;
 using GmemTiledCopyO = cute::XE_2D_U16x1x16_ST_N;
 
 using type = cutlass::flash_attention::FMHADecodeConfig<
       QKVType, float, cutlass::half_t, GmemTiledCopyQ, GmemTiledCopyK, GmemTiledCopyV,
       GmemTiledCopyO, typename TileShapeConfig::ShapeQK, typename TileShapeConfig::ShapePV,
       typename TileShapeConfig::ShapeOutput, typename TileShapeConfig::SubgroupLayout,
-      Causal, VarLen, PagedKV>;
+      Causal, VarLen, PagedKV, SplitKV, KVType>;
 };
 
 } // namespace flash_attention
@@ -64,6 +64,7 @@ struct FMHAOptions {
   int batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, head_size_qk, head_size_vo, iterations;
   float softmax_scale;
   std::string bm_name;
+  StatisticsOptions statistics;
 
   FMHAOptions()
       : error(false), batch(32), num_heads_q(16), num_heads_kv(16), seq_len_qo(512), head_size_qk(128),
@@ -82,6 +83,7 @@ struct FMHAOptions {
     cmd.get_cmd_line_argument("head_size_qk", head_size_qk, head_size_vo);
     cmd.get_cmd_line_argument("iterations", iterations, 100);
     cmd.get_cmd_line_argument("bm_name", bm_name, std::string("Flash Attention v2"));
+    statistics.parse(cmd);
 
     softmax_scale = 1 / std::sqrt(static_cast<float>(head_size_qk));
   }
@@ -571,66 +573,47 @@ template <class FMHAPrefillConfiguration> struct BenchmarkRunnerFMHA {
                      sizeof(ElementOutput) * options.batch * options.num_heads_q * effective_seq_len_qo * options.head_size_vo;
     double mega_bytes_transferred = (gbps_qk + gbps_pv) * (1e-6);
 
-    initialize_counters(state);
+    RuntimeStatistics statistics(options.statistics);
     int32_t counter = 1;
     for(auto _ : state) {
-      state.PauseTiming();
-      int input_num = std::max(int(0), counter % count);
-
-      typename GemmKernel::Arguments arguments{
-          cutlass::gemm::GemmUniversalMode::kGemm,
-          problem_size,
-          {block_Q[input_num].get(), stride_Q, block_K[input_num].get(), stride_K, block_V[input_num].get(), stride_V},
-          {options.softmax_scale},
-          {block_O.get(), stride_O},
-          hw_info};
-
-      size_t workspace_size = GemmKernel::get_workspace_size(arguments);
-      cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
-
-      GemmKernel::can_implement(arguments);
-
-      // Initialize the workspace
-      auto status = GemmKernel::initialize_workspace(arguments, workspace.get());
-      if (status != cutlass::Status::kSuccess) {
-        return;
-      }
+      statistics.begin_iteration();
+      do {
+        state.PauseTiming();
+        int input_num = std::max(int(0), counter % count);
+
+        typename GemmKernel::Arguments arguments{
+            cutlass::gemm::GemmUniversalMode::kGemm,
+            problem_size,
+            {block_Q[input_num].get(), stride_Q, block_K[input_num].get(), stride_K, block_V[input_num].get(), stride_V},
+            {options.softmax_scale},
+            {block_O.get(), stride_O},
+            hw_info};
+
+        size_t workspace_size = GemmKernel::get_workspace_size(arguments);
+        cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
+
+        GemmKernel::can_implement(arguments);
+
+        // Initialize the workspace
+        auto status = GemmKernel::initialize_workspace(arguments, workspace.get());
+        if (status != cutlass::Status::kSuccess) {
+          return;
+        }
 
-      typename GemmKernel::Params params = GemmKernel::to_underlying_arguments(arguments, workspace.get());
+        typename GemmKernel::Params params = GemmKernel::to_underlying_arguments(arguments, workspace.get());
 
-      state.ResumeTiming();
+        state.ResumeTiming();
 
-      GPU_Clock timer;
-      timer.start();
-      run(params);
-      auto ms_elapsed = timer.milliseconds();
-      update_counters(state, ms_elapsed);
-      state.SetIterationTime(ms_elapsed / 1000);
-      counter++;
+        GPU_Clock timer;
+        timer.start();
+        run(params);
+        auto ms_elapsed = timer.milliseconds();
+        statistics.add(ms_elapsed);
+        counter++;
+      } while (statistics.keep_sampling());
+      state.SetIterationTime(statistics.iteration_seconds());
     }
-    finalize_counters(state, gflops, mega_bytes_transferred);
-  }
-
-private:
-  static void initialize_counters(::benchmark::State& state) {
-    state.counters["avg_runtime_ms"] = 0;
-    state.counters["best_runtime_ms"] = std::numeric_limits<double>::max();
-  }
-
-  static void update_counters(::benchmark::State& state, double ms_elapsed) {
-    state.PauseTiming();
-    state.counters["total_runtime_ms"] += ms_elapsed;
-    state.counters["best_runtime_ms"] = std::min<double>(state.counters["best_runtime_ms"], ms_elapsed);
-    state.ResumeTiming();
-  }
-
-  static void finalize_counters(::benchmark::State& state,  double gflop, double mega_bytes_transferred) {
-    state.counters["avg_runtime_ms"] =
-      state.counters["total_runtime_ms"] / static_cast<double>(state.iterations());
-    state.counters["avg_tflops"] = gflop / state.counters["avg_runtime_ms"];
-    state.counters["avg_throughput"] = mega_bytes_transferred / state.counters["avg_runtime_ms"];
-    state.counters["best_tflop"] = gflop / state.counters["best_runtime_ms"];
-    state.counters["best_bandwidth"] = mega_bytes_transferred / state.counters["best_runtime_ms"];
+    statistics.report(state, gflops, mega_bytes_transferred);
   }
 };
 
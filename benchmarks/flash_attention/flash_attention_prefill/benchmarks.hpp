@@ -67,7 +67,7 @@ struct Shape_h192 {
   using SubgroupLayout = Layout<Shape<_32, _1, _1>, Stride<_1, _1, _1>>; 
 };
 
-template<class QKVType, bool Causal, bool VarLen, class TileShapeConfig>
+template<class QKVType, bool Causal, bool VarLen, class TileShapeConfig, class TileScheduler = void>
 struct FMHAPrefillConfigGen {
  // Todo(codeplay) this type should be passed as parameter as well since come shape may get better performace
  // with different copy
@@ -86,7 +86,7 @@ struct FMHAPrefillConfigGen {
       typename TileShapeConfig::ShapePV,
       typename TileShapeConfig::ShapeOutPut,
       typename TileShapeConfig::SubgroupLayout,
-      Causal, VarLen, TileShapeConfig::PipelineStages>;
+      Causal, VarLen, TileShapeConfig::PipelineStages, TileScheduler>;
 };
 
 using PvcFMHAPrefillBF16BF16FP32_RCR_h64_Causal_FixedLen = FMHAPrefillConfigGen<cutlass::bfloat16_t,  true, false, Shape_h64>::type;
@@ -125,6 +125,15 @@ using PvcFMHAPrefillFP16FP16FP32_RCR_h96_NonCausal_VarLen = FMHAPrefillConfigGen
 using PvcFMHAPrefillFP16FP16FP32_RCR_h128_NonCausal_VarLen = FMHAPrefillConfigGen<cutlass::half_t, false, true, Shape_h128>::type;
 using PvcFMHAPrefillFP16FP16FP32_RCR_h192_NonCausal_VarLen = FMHAPrefillConfigGen<cutlass::half_t, false, true, Shape_h192>::type;
 
+// Variable-length batches with the persistent longest-first scheduler, to compare against the _VarLen tails above.
+using PvcFMHAPrefillBF16BF16FP32_RCR_h64_Causal_VarLen_LPT = FMHAPrefillConfigGen<cutlass::bfloat16_t, true, true, Shape_h64,
+                                                                                cutlass::flash_attention::PersistentLPTScheduler>::type;
+using PvcFMHAPrefillBF16BF16FP32_RCR_h64_NonCausal_VarLen_LPT = FMHAPrefillConfigGen<cutlass::bfloat16_t, false, true, Shape_h64,
+                                                                                   cutlass::flash_attention::PersistentLPTScheduler>::type;
+using PvcFMHAPrefillBF16BF16FP32_RCR_h128_Causal_VarLen_LPT = FMHAPrefillConfigGen<cutlass::bfloat16_t, true, true, Shape_h128,
+                                                                                 cutlass::flash_attention::PersistentLPTScheduler>::type;
+using PvcFMHAPrefillBF16BF16FP32_RCR_h128_NonCausal_VarLen_LPT = FMHAPrefillConfigGen<cutlass::bfloat16_t, false, true, Shape_h128,
+                                                                                    cutlass::flash_attention::PersistentLPTScheduler>::type;
 
 CUTLASS_CREATE_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillBF16BF16FP32_RCR_h64_Causal_FixedLen);
 CUTLASS_CREATE_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillBF16BF16FP32_RCR_h64_NonCausal_FixedLen);
@@ -160,6 +169,11 @@ CUTLASS_CREATE_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillFP16FP16FP32_RCR_h128_NonCau
 CUTLASS_CREATE_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillFP16FP16FP32_RCR_h192_Causal_VarLen);
 CUTLASS_CREATE_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillFP16FP16FP32_RCR_h192_NonCausal_VarLen);
 
+CUTLASS_CREATE_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillBF16BF16FP32_RCR_h64_Causal_VarLen_LPT);
+CUTLASS_CREATE_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillBF16BF16FP32_RCR_h64_NonCausal_VarLen_LPT);
+CUTLASS_CREATE_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillBF16BF16FP32_RCR_h128_Causal_VarLen_LPT);
+CUTLASS_CREATE_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillBF16BF16FP32_RCR_h128_NonCausal_VarLen_LPT);
+
 static void register_flash_attention_prefill_benchmarks() {
   CUTLASS_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillBF16BF16FP32_RCR_h64_Causal_FixedLen);
   CUTLASS_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillBF16BF16FP32_RCR_h64_NonCausal_FixedLen);
@@ -194,4 +208,9 @@ static void register_flash_attention_prefill_benchmarks() {
   CUTLASS_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillFP16FP16FP32_RCR_h128_NonCausal_VarLen);
   CUTLASS_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillFP16FP16FP32_RCR_h192_Causal_VarLen);
   CUTLASS_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillFP16FP16FP32_RCR_h192_NonCausal_VarLen);
+
+  CUTLASS_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillBF16BF16FP32_RCR_h64_Causal_VarLen_LPT);
+  CUTLASS_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillBF16BF16FP32_RCR_h64_NonCausal_VarLen_LPT);
+  CUTLASS_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillBF16BF16FP32_RCR_h128_Causal_VarLen_LPT);
+  CUTLASS_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillBF16BF16FP32_RCR_h128_NonCausal_VarLen_LPT);
 }
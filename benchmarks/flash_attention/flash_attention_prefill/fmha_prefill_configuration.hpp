@@ -48,7 +48,7 @@ namespace flash_attention{
 template<typename ElementInputType, typename ElementAccumulatorType, typename ElementOutputType,  
           typename GmemTiledCopyQ, typename GmemTiledCopyK, typename GmemTiledCopyV, typename GmemTiledCopyO,
           typename TileShapeQK, typename TileShapePV, typename TileShapeOutput, typename SubgroupLayout, 
-          bool HasCausal, bool IsVarLen, int PipelineStages>
+          bool HasCausal, bool IsVarLen, int PipelineStages, typename TileScheduler = void>
 struct FMHAPrefillConfig {
 
   using ElementOutput = ElementOutputType;        // <- data type of output
@@ -91,7 +91,7 @@ struct FMHAPrefillConfig {
                                                               Causal>;
 
   using GemmKernel = cutlass::flash_attention::kernel::FMHAPrefill<ProblemShapeType, CollectiveMainloop,
-                                                                    CollectiveSoftmaxEpilogue, CollectiveEpilogue>;
+                                                                    CollectiveSoftmaxEpilogue, CollectiveEpilogue, TileScheduler>;
 };
 
 } // namespace flash_attention
@@ -65,6 +65,7 @@ struct FMHAOptions {
   int batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, seq_len_kv_cache, head_size_qk, head_size_vo, iterations;
   float softmax_scale;
   std::string bm_name;
+  StatisticsOptions statistics;
 
   FMHAOptions()
       : error(false), batch(32), num_heads_q(16), num_heads_kv(16), seq_len_qo(512), seq_len_kv(512), seq_len_kv_cache(512),
@@ -84,6 +85,7 @@ struct FMHAOptions {
     cmd.get_cmd_line_argument("head_size_qk", head_size_qk, head_size_vo);
     cmd.get_cmd_line_argument("iterations", iterations, 100);
     cmd.get_cmd_line_argument("bm_name", bm_name, std::string("Flash Attention v2"));
+    statistics.parse(cmd);
 
     softmax_scale = 1 / std::sqrt(static_cast<float>(head_size_qk));
   }
@@ -125,6 +127,9 @@ template <class FMHAPrefillConfiguration> struct BenchmarkRunnerFMHA {
   using ElementK = typename GemmKernel::ElementK;
   using ElementV = typename GemmKernel::ElementV;
   using ElementAcc = typename GemmKernel::ElementAccumulator;
+  // FP8 K/V are dequantized with per-KV-head scales and P stays in the Q type, as in the kernel.
+  static constexpr bool isFP8KV = cute::is_any_of_v<ElementK, cutlass::float_e4m3_t, cutlass::float_e5m2_t>;
+  using ElementP = cute::conditional_t<isFP8KV, ElementQ, ElementV>;
 
   using CollectiveEpilogue = typename GemmKernel::CollectiveEpilogue;
   using ElementOutput = typename CollectiveEpilogue::ElementOutput;
@@ -158,6 +163,10 @@ template <class FMHAPrefillConfiguration> struct BenchmarkRunnerFMHA {
   std::vector<cutlass::DeviceAllocation<ElementV>> block_V_cache;
   cutlass::DeviceAllocation<ElementOutput> block_O;
   cutlass::DeviceAllocation<ElementOutput> block_ref_O;
+  std::vector<float> host_K_scale;
+  std::vector<float> host_V_scale;
+  cutlass::DeviceAllocation<float> block_K_scale;
+  cutlass::DeviceAllocation<float> block_V_scale;
 
   std::vector<int> cumulative_seqlen_q;
   std::vector<int> cumulative_seqlen_kv;
@@ -272,6 +281,12 @@ template <class FMHAPrefillConfiguration> struct BenchmarkRunnerFMHA {
         compat::memcpy<ElementAccumulator>(host_S.data(), block_S.get(), host_S.size());
         compat::wait();
 
+        if constexpr (isFP8KV) {
+          for (auto& s : host_S) {
+            s *= host_K_scale[h / q_group_size];
+          }
+        }
+
         // delete this memory as it is no longer needed
         block_S.reset();
         auto offset = cute::min(seq_len_qo, seq_len_kv);
@@ -330,14 +345,14 @@ template <class FMHAPrefillConfiguration> struct BenchmarkRunnerFMHA {
           }
         }
 
-        std::vector<ElementV> host_P(host_S.size());
+        std::vector<ElementP> host_P(host_S.size());
         for (int p = 0; p < host_P.size(); p++)
-          host_P[p] = static_cast<ElementV>(host_S[p]);
+          host_P[p] = static_cast<ElementP>(host_S[p]);
 
-        cutlass::DeviceAllocation<ElementV> block_P;
+        cutlass::DeviceAllocation<ElementP> block_P;
         block_P.reset(host_P.size());
 
-        compat::memcpy<ElementV>(block_P.get(), host_P.data(), host_P.size());
+        compat::memcpy<ElementP>(block_P.get(), host_P.data(), host_P.size());
         compat::wait();
 
         cutlass::TensorRef ref_P(block_P.get(), LayoutQ::packed({seq_len_qo, seq_len_kv_total}));
@@ -364,6 +379,12 @@ template <class FMHAPrefillConfiguration> struct BenchmarkRunnerFMHA {
         compat::memcpy<ElementAccumulator>(vec_acc.data(), block_acc.get(), vec_acc.size());
         compat::wait();
 
+        if constexpr (isFP8KV) {
+          for (auto& acc : vec_acc) {
+            acc *= host_V_scale[h / q_group_size];
+          }
+        }
+
         // delete this memory as it is no longer needed
         block_acc.reset();
         std::vector<ElementOutput> vec_out(vec_acc.size());
@@ -532,6 +553,19 @@ template <class FMHAPrefillConfiguration> struct BenchmarkRunnerFMHA {
       initialize_block(block_V_cache[i], seed + i + 2025);
     }
 
+    if constexpr (isFP8KV) {
+      host_K_scale.resize(num_heads_kv);
+      host_V_scale.resize(num_heads_kv);
+      for (int h = 0; h < num_heads_kv; h++) {
+        host_K_scale[h] = 0.5f + 0.25f * (h % 4);
+        host_V_scale[h] = 1.5f - 0.25f * (h % 4);
+      }
+      block_K_scale.reset(num_heads_kv);
+      block_V_scale.reset(num_heads_kv);
+      block_K_scale.copy_from_host(host_K_scale.data(), num_heads_kv);
+      block_V_scale.copy_from_host(host_V_scale.data(), num_heads_kv);
+    }
+
     block_O.reset(mem_size_o);
     block_ref_O.reset(mem_size_o);
 
@@ -609,7 +643,11 @@ template <class FMHAPrefillConfiguration> struct BenchmarkRunnerFMHA {
           //page size
           0,
           // num pages per seq lengh
-          0
+          0,
+          // window size
+          0,
+          // FP8 K/V dequantization scales
+          block_K_scale.get(), block_V_scale.get()
         },
         {options.softmax_scale},
         {block_O.get(), stride_O},
@@ -679,79 +717,64 @@ template <class FMHAPrefillConfiguration> struct BenchmarkRunnerFMHA {
                      sizeof(ElementOutput) * options.batch * options.num_heads_q * effective_seq_len_qo * options.head_size_vo;
     double mega_bytes_transferred = (gbps_qk + gbps_pv) * (1e-6);
 
-    initialize_counters(state);
+    RuntimeStatistics statistics(options.statistics);
     int32_t counter = 1;
     for(auto _ : state) {
-      state.PauseTiming();
-      int input_num = std::max(int(0), counter % count);
-
-      typename GemmKernel::Arguments arguments{
-          cutlass::gemm::GemmUniversalMode::kGemm,
-          problem_size,
-          {
-            block_Q[input_num].get(), stride_Q,
-            block_K[input_num].get(), stride_K,
-            block_V[input_num].get(), stride_V,
-            block_K_cache[input_num].get(), stride_K_cache,
-            block_V_cache[input_num].get(), stride_V_cache,
-            //TODO:: the following 3 parameters need to be parametrised when the benchmark for paged KV has been added.
-            // page table
-            nullptr,
-            //page size
-            0,
-            // num pages per seq lengh
-            0
-          },
-          {options.softmax_scale},
-          {block_O.get(), stride_O},
-          hw_info};
-
-      size_t workspace_size = GemmKernel::get_workspace_size(arguments);
-      cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
-
-      GemmKernel::can_implement(arguments);
-
-      // Initialize the workspace
-      auto status = GemmKernel::initialize_workspace(arguments, workspace.get());
-      if (status != cutlass::Status::kSuccess) {
-        return;
-      }
+      statistics.begin_iteration();
+      do {
+        state.PauseTiming();
+        int input_num = std::max(int(0), counter % count);
+
+        typename GemmKernel::Arguments arguments{
+            cutlass::gemm::GemmUniversalMode::kGemm,
+            problem_size,
+            {
+              block_Q[input_num].get(), stride_Q,
+              block_K[input_num].get(), stride_K,
+              block_V[input_num].get(), stride_V,
+              block_K_cache[input_num].get(), stride_K_cache,
+              block_V_cache[input_num].get(), stride_V_cache,
+              //TODO:: the following 3 parameters need to be parametrised when the benchmark for paged KV has been added.
+              // page table
+              nullptr,
+              //page size
+              0,
+              // num pages per seq lengh
+              0,
+              // window size
+              0,
+              // FP8 K/V dequantization scales
+              block_K_scale.get(), block_V_scale.get()
+            },
+            {options.softmax_scale},
+            {block_O.get(), stride_O},
+            hw_info};
+
+        size_t workspace_size = GemmKernel::get_workspace_size(arguments);
+        cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
+
+        GemmKernel::can_implement(arguments);
+
+        // Initialize the workspace
+        auto status = GemmKernel::initialize_workspace(arguments, workspace.get());
+        if (status != cutlass::Status::kSuccess) {
+          return;
+        }
 
-      typename GemmKernel::Params params = GemmKernel::to_underlying_arguments(arguments, workspace.get());
+        typename GemmKernel::Params params = GemmKernel::to_underlying_arguments(arguments, workspace.get());
 
-      state.ResumeTiming();
+        state.ResumeTiming();
 
-      GPU_Clock timer;
-      timer.start();
-      run(params);
-      auto ms_elapsed = timer.milliseconds();
-      update_counters(state, ms_elapsed);
-      state.SetIterationTime(ms_elapsed / 1000);
-      counter++;
+        GPU_Clock timer;
+        timer.start();
+        run(params);
+        auto ms_elapsed = timer.milliseconds();
+        statistics.add(ms_elapsed);
+        counter++;
+      } while (statistics.keep_sampling());
+      state.SetIterationTime(statistics.iteration_seconds());
     }
-    finalize_counters(state, gflops, mega_bytes_transferred);
-  }
-
-private:
-  static void initialize_counters(::benchmark::State& state) {
-    state.counters["avg_runtime_ms"] = 0;
-    state.counters["best_runtime_ms"] = std::numeric_limits<double>::max();
-  }
-
-  static void update_counters(::benchmark::State& state, double ms_elapsed) {
-    state.PauseTiming();
-    state.counters["total_runtime_ms"] += ms_elapsed;
-    state.counters["best_runtime_ms"] = std::min<double>(state.counters["best_runtime_ms"], ms_elapsed);
-    state.ResumeTiming();
-  }
-
-  static void finalize_counters(::benchmark::State& state,  double gflop, double mega_bytes_transferred) {
-    state.counters["avg_runtime_ms"] =
-      state.counters["total_runtime_ms"] / static_cast<double>(state.iterations());
-    state.counters["avg_tflops"] = gflop / state.counters["avg_runtime_ms"];
-    state.counters["avg_throughput"] = mega_bytes_transferred / state.counters["avg_runtime_ms"];
-    state.counters["best_tflop"] = gflop / state.counters["best_runtime_ms"];
-    state.counters["best_bandwidth"] = mega_bytes_transferred / state.counters["best_runtime_ms"];
+    statistics.report(state, gflops, mega_bytes_transferred);
   }
 };
 
@@ -66,13 +66,26 @@ struct Shape_h192 {
   using SubgroupLayout = Layout<Shape<_32, _1, _1>, Stride<_1, _1, _1>>; 
 };
 
-template<class QKVType, bool Causal, bool VarLen, class TileShapeConfig>
+// K/V loads for 16-bit inputs and for an FP8 KV cache, which is widened to the Q type in registers.
+template <int KVBits>
+struct FMHAPrefillKVCopy {
+  using GmemTiledCopyK = XE_2D_U16x16x16_LD_T; // _T designates a transposed block load operation
+  using GmemTiledCopyV = XE_2D_U16x16x32_LD_V;
+};
+
+template <>
+struct FMHAPrefillKVCopy<8> {
+  using GmemTiledCopyK = XE_2D_U8x16x16_LD_T;
+  using GmemTiledCopyV = XE_2D_U8x32x32_LD_V;
+};
+
+template<class QKVType, bool Causal, bool VarLen, class TileShapeConfig, class KVType = QKVType>
 struct FMHAPrefillConfigGen {
  // Todo(codeplay) this type should be passed as parameter as well since come shape may get better performace
  // with different copy
   using GmemTiledCopyQ = XE_2D_U16x8x32_LD_N;
-  using GmemTiledCopyK = XE_2D_U16x16x16_LD_T; // _T designates a transposed block load operation
-  using GmemTiledCopyV = XE_2D_U16x16x32_LD_V;
+  using GmemTiledCopyK = typename FMHAPrefillKVCopy<cute::sizeof_bits_v<KVType>>::GmemTiledCopyK;
+  using GmemTiledCopyV = typename FMHAPrefillKVCopy<cute::sizeof_bits_v<KVType>>::GmemTiledCopyV;
   using GmemTiledCopyO = XE_2D_U32x8x16_ST_N;
   using type = cutlass::flash_attention::FMHAPrefillConfig<
      // todo(codeplay) : accumulator type and output type should be pass as template parameter
@@ -87,7 +100,7 @@ struct FMHAPrefillConfigGen {
       typename TileShapeConfig::SubgroupLayout,
       //TODO: the pagedKV has been set to false, the benchmark for the PagedKV needs to be added here and the parameter need to be set similar 
       // to causal
-      Causal, VarLen, false, TileShapeConfig::PipelineStages>;
+      Causal, VarLen, false, TileShapeConfig::PipelineStages, KVType>;
 };
 
 using PvcFMHAPrefillCachedKVBF16BF16FP32_RCR_h64_Causal_FixedLen = FMHAPrefillConfigGen<cutlass::bfloat16_t,  true, false, Shape_h64>::type;
@@ -126,6 +139,12 @@ using PvcFMHAPrefillCachedKVFP16FP16FP32_RCR_h96_NonCausal_VarLen = FMHAPrefillC
 using PvcFMHAPrefillCachedKVFP16FP16FP32_RCR_h128_NonCausal_VarLen = FMHAPrefillConfigGen<cutlass::half_t, false, true, Shape_h128>::type;
 using PvcFMHAPrefillCachedKVFP16FP16FP32_RCR_h192_NonCausal_VarLen = FMHAPrefillConfigGen<cutlass::half_t, false, true, Shape_h192>::type;
 
+using PvcFMHAPrefillCachedKVBF16E4M3FP32_RCR_h64_Causal_FixedLen = FMHAPrefillConfigGen<cutlass::bfloat16_t, true, false, Shape_h64, cutlass::float_e4m3_t>::type;
+using PvcFMHAPrefillCachedKVBF16E4M3FP32_RCR_h128_Causal_FixedLen = FMHAPrefillConfigGen<cutlass::bfloat16_t, true, false, Shape_h128, cutlass::float_e4m3_t>::type;
+using PvcFMHAPrefillCachedKVBF16E4M3FP32_RCR_h64_NonCausal_FixedLen = FMHAPrefillConfigGen<cutlass::bfloat16_t, false, false, Shape_h64, cutlass::float_e4m3_t>::type;
+using PvcFMHAPrefillCachedKVBF16E4M3FP32_RCR_h128_NonCausal_FixedLen = FMHAPrefillConfigGen<cutlass::bfloat16_t, false, false, Shape_h128, cutlass::float_e4m3_t>::type;
+using PvcFMHAPrefillCachedKVFP16E5M2FP32_RCR_h128_Causal_FixedLen = FMHAPrefillConfigGen<cutlass::half_t, true, false, Shape_h128, cutlass::float_e5m2_t>::type;
+
 
 CUTLASS_CREATE_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillCachedKVBF16BF16FP32_RCR_h64_Causal_FixedLen);
 CUTLASS_CREATE_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillCachedKVBF16BF16FP32_RCR_h64_NonCausal_FixedLen);
@@ -161,6 +180,12 @@ CUTLASS_CREATE_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillCachedKVFP16FP16FP32_RCR_h12
 CUTLASS_CREATE_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillCachedKVFP16FP16FP32_RCR_h192_Causal_VarLen);
 CUTLASS_CREATE_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillCachedKVFP16FP16FP32_RCR_h192_NonCausal_VarLen);
 
+CUTLASS_CREATE_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillCachedKVBF16E4M3FP32_RCR_h64_Causal_FixedLen);
+CUTLASS_CREATE_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillCachedKVBF16E4M3FP32_RCR_h64_NonCausal_FixedLen);
+CUTLASS_CREATE_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillCachedKVBF16E4M3FP32_RCR_h128_Causal_FixedLen);
+CUTLASS_CREATE_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillCachedKVBF16E4M3FP32_RCR_h128_NonCausal_FixedLen);
+CUTLASS_CREATE_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillCachedKVFP16E5M2FP32_RCR_h128_Causal_FixedLen);
+
 static void register_flash_attention_prefill_benchmarks() {
   CUTLASS_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillCachedKVBF16BF16FP32_RCR_h64_Causal_FixedLen);
   CUTLASS_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillCachedKVBF16BF16FP32_RCR_h64_NonCausal_FixedLen);
@@ -195,4 +220,10 @@ static void register_flash_attention_prefill_benchmarks() {
   CUTLASS_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillCachedKVFP16FP16FP32_RCR_h128_NonCausal_VarLen);
   CUTLASS_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillCachedKVFP16FP16FP32_RCR_h192_Causal_VarLen);
   CUTLASS_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillCachedKVFP16FP16FP32_RCR_h192_NonCausal_VarLen);
+
+  CUTLASS_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillCachedKVBF16E4M3FP32_RCR_h64_Causal_FixedLen);
+  CUTLASS_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillCachedKVBF16E4M3FP32_RCR_h64_NonCausal_FixedLen);
+  CUTLASS_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillCachedKVBF16E4M3FP32_RCR_h128_Causal_FixedLen);
+  CUTLASS_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillCachedKVBF16E4M3FP32_RCR_h128_NonCausal_FixedLen);
+  CUTLASS_FMHA_PREFILL_BENCHMARK(PvcFMHAPrefillCachedKVFP16E5M2FP32_RCR_h128_Causal_FixedLen);
 }
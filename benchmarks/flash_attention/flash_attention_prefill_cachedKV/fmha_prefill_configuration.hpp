@@ -49,13 +49,13 @@ template <typename DispatchPolicy> struct MMAOP <DispatchPolicy, half_t, float>
 template<typename ElementInputType, typename ElementAccumulatorType, typename ElementOutputType,
           typename GmemTiledCopyQ, typename GmemTiledCopyK, typename GmemTiledCopyV, typename GmemTiledCopyO,
           typename TileShapeQK, typename TileShapePV, typename TileShapeOutput, typename SubgroupLayout,
-          bool HasCausal, bool IsVarLen, bool IsPagedKV, int PipelineStages>
+          bool HasCausal, bool IsVarLen, bool IsPagedKV, int PipelineStages, typename ElementInputKVType = ElementInputType>
 struct FMHAPrefillConfig {
 
   using ElementOutput = ElementOutputType;        // <- data type of output
   using ElementInputQ = ElementInputType;    // <- data type of elements in input matrix Q
-  using ElementInputK = ElementInputType;    // <- data type of elements in input matrix K
-  using ElementInputV = ElementInputType;    // <- data type of elements in input matrix V
+  using ElementInputK = ElementInputKVType;    // <- data type of elements in input matrix K
+  using ElementInputV = ElementInputKVType;    // <- data type of elements in input matrix V
   using ElementAccumulator = ElementAccumulatorType;   // <- data type of accumulator for mma operation
   using LayoutQ = cutlass::layout::RowMajor;
   using LayoutK = cutlass::layout::ColumnMajor;
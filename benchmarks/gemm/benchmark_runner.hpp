@@ -56,6 +56,9 @@
 
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+#include <typeinfo>
+
 using namespace cute;
 
 namespace cutlass::benchmark {
@@ -119,12 +122,15 @@ struct GEMMOptions {
   int m, n, k, l;
   float alpha, beta;
   std::string bm_name;
+  bool cold_cache;
+  StatisticsOptions statistics;
 
   GEMMOptions():
           error(false),
           m(5120), n(4096), k(4096), l(1),
           alpha(1.f), beta(0.f),
-          bm_name("GEMM")
+          bm_name("GEMM"),
+          cold_cache(false)
   { }
 
   // Parses the command line
@@ -138,6 +144,8 @@ struct GEMMOptions {
     cmd.get_cmd_line_argument("alpha", alpha, 1.f);
     cmd.get_cmd_line_argument("beta", beta, 0.f);
     cmd.get_cmd_line_argument("bm_name", bm_name, std::string("GEMM"));
+    cold_cache = cmd.check_cmd_line_flag("cold_cache");
+    statistics.parse(cmd);
   }
 
   std::string benchmark_name() const {
@@ -148,6 +156,9 @@ struct GEMMOptions {
                                    std::to_string(k) + "x" +
                                    std::to_string(l);
     full_name << test_name_suffix;
+    if (cold_cache) {
+      full_name << "/cold";
+    }
 
     return full_name.str();
   }
@@ -252,8 +263,19 @@ struct BenchmarkRunnerGemm {
   DeviceAllocation<ElementMma> block_A_verify;
   DeviceAllocation<ElementMma> block_B_verify;
 
+  // Scratch buffer written between iterations to evict the LLC in cold-cache mode
+  DeviceAllocation<uint8_t> block_flush;
+
   BenchmarkRunnerGemm() : seed(0) {};
 
+  // Identifies the problem this configuration solves. Configurations with the same signature
+  // differ only in tiling and scheduling, so they are candidates for one another when autotuning.
+  static std::string signature() {
+    return typeid(cute::type_list<ElementA, ElementB, ElementC, ElementOutput, ElementAccumulator,
+                              LayoutA, LayoutB, LayoutC, LayoutD,
+                              FusionOp, ElementScale, ElementZero>).name();
+  }
+
   //
   // Methods
   //
@@ -677,6 +699,14 @@ struct BenchmarkRunnerGemm {
       state.SkipWithError(e.what());
     }
 
+    if (options.cold_cache) {
+      try {
+        block_flush.reset(2 * cutlass::get_llc_size());
+      } catch (std::exception const &e) {
+        state.SkipWithError(e.what());
+      }
+    }
+
     if (gemm_op.can_implement(arguments) != cutlass::Status::kSuccess)
       state.SkipWithError("GEMM unable to implement given args.");
 
@@ -738,68 +768,310 @@ struct BenchmarkRunnerGemm {
         (options.beta != 0 ? 2 : 1) * options.m * options.n * sizeof_c
       ) * 1e-6 * options.l;
 
-    initialize_counters(state);
+    RuntimeStatistics statistics(options.statistics);
     int32_t counter = 1;
     for(auto _ : state) {
-      state.PauseTiming();
-      int input_num = std::max(int(0), counter % count);
-      typename Gemm::GemmKernel::Arguments arguments{
-        gemm::GemmUniversalMode::kGemm,
-        problem_size,
-        {block_A[input_num].get(), stride_A, block_B[input_num].get(), stride_B},
-        {{ElementAccumulator(options.alpha), ElementAccumulator(options.beta)}, block_C[input_num].get(), stride_C, block_D.get(), stride_D},
-        hw_info
-      };
-      if constexpr (is_mixed_dtype<DispatchPolicy>) {
-        arguments.mainloop = {block_A[input_num].get(), stride_A, block_B[input_num].get(), stride_B, block_scale.get(),
-                stride_S, block_zero.get(), stride_Z, 128};
-      }
-      if constexpr(epi_is_deeltactmul){
-        arguments.epilogue.thread.aux_ptr = block_Aux[input_num].get();
-        arguments.epilogue.thread.dAux = cutlass::make_cute_packed_stride(StrideD{}, cute::make_shape(options.m, options.n, options.l));
+      statistics.begin_iteration();
+      do {
+        state.PauseTiming();
+        int input_num = std::max(int(0), counter % count);
+        // Start from the configuration defaults so tile scheduler arguments are preserved
+        typename Gemm::GemmKernel::Arguments arguments = GemmConfiguration::defaultArguments();
+        arguments.mode = gemm::GemmUniversalMode::kGemm;
+        arguments.problem_shape = problem_size;
+        arguments.mainloop = {block_A[input_num].get(), stride_A, block_B[input_num].get(), stride_B};
+        arguments.epilogue = {{ElementAccumulator(options.alpha), ElementAccumulator(options.beta)}, block_C[input_num].get(), stride_C, block_D.get(), stride_D};
+        arguments.hw_info = hw_info;
+        if constexpr (is_mixed_dtype<DispatchPolicy>) {
+          arguments.mainloop = {block_A[input_num].get(), stride_A, block_B[input_num].get(), stride_B, block_scale.get(),
+                  stride_S, block_zero.get(), stride_Z, 128};
+        }
+        if constexpr(epi_is_deeltactmul){
+          arguments.epilogue.thread.aux_ptr = block_Aux[input_num].get();
+          arguments.epilogue.thread.dAux = cutlass::make_cute_packed_stride(StrideD{}, cute::make_shape(options.m, options.n, options.l));
+        }
+        gemm_op.initialize(arguments, workspace.get());
+        if (options.cold_cache) {
+          cutlass::flush_llc(block_flush.get(), block_flush.size(), counter & 0xff);
+        }
+        state.ResumeTiming();
+
+        GPU_Clock timer;
+        timer.start();
+        gemm_op.run();
+        auto ms_elapsed = timer.milliseconds();
+        statistics.add(ms_elapsed);
+        counter++;
+      } while (statistics.keep_sampling());
+      state.SetIterationTime(statistics.iteration_seconds());
+    }
+    statistics.report(state, gflop, mega_bytes_transferred);
+
+    if (options.cold_cache) {
+      // The timed loop above flushed the LLC before every launch. Repeat the launches on the same
+      // buffers without flushing so that cold and hot throughput are reported side by side. The cold
+      // counters are only set when at least one iteration outlived the warmup.
+      if (statistics.has_samples()) {
+        state.counters["cold_avg_runtime_ms"] = state.counters["avg_runtime_ms"];
+        state.counters["cold_avg_tflops"] = state.counters["avg_tflops"];
+        state.counters["cold_avg_throughput"] = state.counters["avg_throughput"];
       }
-      gemm_op.initialize(arguments, workspace.get());
-      state.ResumeTiming();
 
-      GPU_Clock timer;
-      timer.start();
+      // Like the timed loop, re-initialize before every launch so that split-K and stream-K
+      // workspaces (barriers, partials) are reset, and time each launch on its own.
+      gemm_op.initialize(arguments, workspace.get());
       gemm_op.run();
-      auto ms_elapsed = timer.milliseconds();
-      update_counters(state, ms_elapsed);
-      state.SetIterationTime(ms_elapsed / 1000);
-      counter++;
+#if defined(CUTLASS_ENABLE_SYCL)
+      compat::wait();
+#else
+      cudaDeviceSynchronize();
+#endif
+      int const hot_iterations = std::clamp(static_cast<int>(statistics.sample_count()), 1, 100);
+      double hot_ms = 0;
+      for (int i = 0; i < hot_iterations; ++i) {
+        gemm_op.initialize(arguments, workspace.get());
+        GPU_Clock timer;
+        timer.start();
+        gemm_op.run();
+        hot_ms += timer.milliseconds();
+      }
+      hot_ms /= hot_iterations;
+
+      state.counters["hot_avg_runtime_ms"] = hot_ms;
+      state.counters["hot_avg_tflops"] = gflop / hot_ms;
+      state.counters["hot_avg_throughput"] = mega_bytes_transferred / hot_ms;
     }
-    finalize_counters(state, gflop, mega_bytes_transferred);
   }
+};
 
-private:
-  static void initialize_counters(::benchmark::State& state) {
-    state.counters["avg_runtime_ms"] = 0;
-    state.counters["best_runtime_ms"] = std::numeric_limits<double>::max();
-    state.counters["worst_runtime_ms"] = std::numeric_limits<double>::lowest();
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Command line options of the GEMM benchmark executable
+struct GEMMBenchmarkOptions : BenckmarkOptions {
+
+  bool autotune = false;
+  std::string autotune_output = "best_gemm_configs.json";
+  std::string best_config_file;
+
+  void parse(int argc, char const **args) {
+    BenckmarkOptions::parse(argc, args);
+    if (help) {
+      return;
+    }
+
+    cutlass::CommandLine cmd(argc, args);
+    autotune = cmd.check_cmd_line_flag("autotune");
+    cmd.get_cmd_line_argument("autotune_output", autotune_output, std::string("best_gemm_configs.json"));
+    cmd.get_cmd_line_argument("best_config_file", best_config_file);
+
+    if (autotune && !best_config_file.empty()) {
+      std::cerr << "--autotune and --best_config_file are mutually exclusive." << std::endl;
+      error = true;
+    }
   }
 
-  static void update_counters(::benchmark::State& state, double ms_elapsed) {
-    state.PauseTiming();
-    state.counters["total_runtime_ms"] += ms_elapsed;
-    state.counters["best_runtime_ms"] = std::min<double>(state.counters["best_runtime_ms"], ms_elapsed);
-    state.counters["worst_runtime_ms"] = std::max<double>(state.counters["worst_runtime_ms"], ms_elapsed);
-    state.ResumeTiming();
+  std::ostream & print_usage(std::ostream &out) const {
+
+    out << "GEMM Benchmark\n\n"
+        << "Options:\n\n"
+        << "  --config_file=/path/to/config_file.in\n"
+        << "  --autotune                           Runs every registered configuration compatible with the one\n"
+        << "                                       named on each line and records the fastest by median runtime\n"
+        << "  --autotune_output=<file.json>        Best-config table written by --autotune (default: best_gemm_configs.json)\n"
+        << "  --best_config_file=<file.json>       Replaces the configuration of each line with the best one from a table\n"
+        << "                                       written by --autotune\n\n";
+
+    return out;
   }
+};
+
+// Autotuning support for the GEMM benchmarks.
+//
+// Each line of the configuration file names a registered configuration and a problem. The autotuner
+// registers one benchmark per compatible configuration (same element types, layouts and fusion), and
+// a reporter collects the median runtime of each. The best configuration per problem is written as a
+// JSON array with one object per line, which `read_best_config_table` reads back without a JSON library.
+class GemmAutotuner {
+public:
+  using Registry = BenchmarkRegistry<GEMMOptions>;
+
+  struct Candidate {
+    std::string config;
+    double median_runtime_ms;
+  };
+
+  struct Problem {
+    std::string config;
+    GEMMOptions options;
+    std::vector<Candidate> candidates;
+  };
+
+  // Forwards results to the console and records the median runtime of every successful run
+  class Reporter : public ::benchmark::ConsoleReporter {
+  public:
+    explicit Reporter(GemmAutotuner& autotuner) : autotuner(autotuner) {}
+
+    void ReportRuns(std::vector<Run> const& reports) override {
+      for (auto const& run : reports) {
+        autotuner.record(run);
+      }
+      ::benchmark::ConsoleReporter::ReportRuns(reports);
+    }
+
+  private:
+    GemmAutotuner& autotuner;
+  };
 
-  static void finalize_counters(::benchmark::State& state,  double gflop, double mega_bytes_transferred) {
-    state.counters["avg_runtime_ms"] =
-      (state.counters["total_runtime_ms"] -state.counters["best_runtime_ms"] - state.counters["worst_runtime_ms"] ) / static_cast<double>(state.iterations() - 2);
-    state.counters["avg_tflops"] = gflop / state.counters["avg_runtime_ms"];
-    state.counters["avg_throughput"] = mega_bytes_transferred / state.counters["avg_runtime_ms"];
-    state.counters["best_tflop"] = gflop / state.counters["best_runtime_ms"];
-    state.counters["best_bandwidth"] = mega_bytes_transferred / state.counters["best_runtime_ms"];
+  // Key identifying a problem of an input line in the best-config table
+  static std::string problem_key(std::string const& config, GEMMOptions const& options) {
+    return config + "/" + options.benchmark_name();
   }
+
+  void register_line(std::string const& line, KernelHardwareInfo const& hw_info) {
+    auto args = tokenize_benchmark_line(line);
+    if (args.empty()) {
+      return;
+    }
+    std::vector<const char*> argv;
+    for (auto const& arg : args) {
+      argv.push_back(arg.c_str());
+    }
+
+    Problem problem;
+    problem.config = args[0];
+    problem.options.parse(static_cast<int>(argv.size()), argv.data());
+
+    for (auto const& candidate : Registry::get_compatible_benchmarks(problem.config)) {
+      std::string const name = candidate + "/" + problem.options.benchmark_name();
+      auto it = benchmarks.find(name);
+      if (it != benchmarks.end()) {
+        // Another line already registered this run; share its result
+        it->second.first.push_back(problems.size());
+        continue;
+      }
+      benchmarks.insert(std::make_pair(name, std::make_pair(std::vector<size_t>{problems.size()}, candidate)));
+      auto* benchmark = ::benchmark::RegisterBenchmark(name, Registry::get_benchmark(candidate), problem.options, hw_info)->UseManualTime();
+      problem.options.statistics.apply(benchmark);
+    }
+    problems.push_back(problem);
+  }
+
+  bool write(std::string const& path) const {
+    std::ofstream out(path);
+    if (!out.is_open()) {
+      std::cerr << "Failed to open autotune output file: " << path << std::endl;
+      return false;
+    }
+
+    out << "[\n";
+    for (size_t i = 0; i < problems.size(); ++i) {
+      auto const& problem = problems[i];
+      auto best = std::min_element(problem.candidates.begin(), problem.candidates.end(),
+          [](Candidate const& a, Candidate const& b) { return a.median_runtime_ms < b.median_runtime_ms; });
+
+      out << "  {\"key\": \"" << problem_key(problem.config, problem.options) << "\""
+          << ", \"config\": \"" << problem.config << "\""
+          << ", \"bm_name\": \"" << problem.options.bm_name << "\""
+          << ", \"m\": " << problem.options.m
+          << ", \"n\": " << problem.options.n
+          << ", \"k\": " << problem.options.k
+          << ", \"l\": " << problem.options.l
+          << ", \"alpha\": " << problem.options.alpha
+          << ", \"beta\": " << problem.options.beta;
+      if (best != problem.candidates.end()) {
+        out << ", \"best_config\": \"" << best->config << "\""
+            << ", \"median_runtime_ms\": " << best->median_runtime_ms;
+      }
+      out << ", \"candidates\": {";
+      for (size_t c = 0; c < problem.candidates.size(); ++c) {
+        out << (c ? ", " : "") << "\"" << problem.candidates[c].config << "\": " << problem.candidates[c].median_runtime_ms;
+      }
+      out << "}}" << (i + 1 < problems.size() ? "," : "") << "\n";
+    }
+    out << "]\n";
+    return true;
+  }
+
+  // Reads a table written by `write` and returns the best configuration for each problem key
+  static std::map<std::string, std::string> read_best_config_table(std::string const& path) {
+    std::ifstream in(path);
+    if (!in.is_open()) {
+      throw std::runtime_error("Failed to open best-config table: " + path);
+    }
+
+    std::map<std::string, std::string> table;
+    std::string line;
+    while (std::getline(in, line)) {
+      auto key = string_field(line, "key");
+      auto best = string_field(line, "best_config");
+      if (!key.empty() && !best.empty()) {
+        table[key] = best;
+      }
+    }
+    return table;
+  }
+
+  // Replaces the configuration named on a line of the configuration file with the tuned one, if any
+  static std::string apply_best_config(std::string const& line, std::map<std::string, std::string> const& table) {
+    auto args = tokenize_benchmark_line(line);
+    if (args.empty()) {
+      return line;
+    }
+    std::vector<const char*> argv;
+    for (auto const& arg : args) {
+      argv.push_back(arg.c_str());
+    }
+
+    GEMMOptions options;
+    options.parse(static_cast<int>(argv.size()), argv.data());
+
+    auto it = table.find(problem_key(args[0], options));
+    if (it == table.end() || !Registry::contains(it->second)) {
+      return line;
+    }
+    std::string tuned = it->second;
+    for (size_t i = 1; i < args.size(); ++i) {
+      tuned += " " + args[i];
+    }
+    return tuned;
+  }
+
+private:
+  void record(::benchmark::BenchmarkReporter::Run const& run) {
+    if (run.skipped || run.run_type != ::benchmark::BenchmarkReporter::Run::RT_Iteration) {
+      return;
+    }
+    auto it = benchmarks.find(run.run_name.function_name);
+    auto median = run.counters.find("median_runtime_ms");
+    if (it == benchmarks.end() || median == run.counters.end()) {
+      return;
+    }
+    auto const& [problem_indices, config] = it->second;
+    for (auto problem_idx : problem_indices) {
+      problems[problem_idx].candidates.push_back({config, median->second.value});
+    }
+  }
+
+  static std::string string_field(std::string const& line, std::string const& field) {
+    std::string const prefix = "\"" + field + "\": \"";
+    auto begin = line.find(prefix);
+    if (begin == std::string::npos) {
+      return {};
+    }
+    begin += prefix.size();
+    auto end = line.find('"', begin);
+    return end == std::string::npos ? std::string{} : line.substr(begin, end - begin);
+  }
+
+  std::vector<Problem> problems;
+  // Registered benchmark name -> (indices of the problems it belongs to, candidate configuration)
+  std::map<std::string, std::pair<std::vector<size_t>, std::string>> benchmarks;
 };
 
 }
 
-#define CUTLASS_BENCHMARK(F) cutlass::benchmark::BenchmarkRegistry<cutlass::benchmark::GEMMOptions>::Register(#F, &F##_func)
+#define CUTLASS_BENCHMARK(F) cutlass::benchmark::BenchmarkRegistry<cutlass::benchmark::GEMMOptions>::Register( \
+    #F, &F##_func, cutlass::benchmark::BenchmarkRunnerGemm<F>::signature())
 
 #define CUTLASS_CREATE_GEMM_BENCHMARK(F)                          \
   static void F##_func(                                           \
@@ -112,8 +112,38 @@ using PvcGemmBF16BF16FP32_RCR_9 = Gemm_Bench_BF16FP32_RCR<Shape<_8, _64, _32>, T
 using Tile_9 = TiledMMAHelper<MMAAtom, Layout<Shape<_16, _64, _32>>, Layout<Shape<_2, _4, _1>, Stride<_4, _1, _0>>>::TiledMMA;
 using PvcGemmBF16BF16FP32_RCR_16 = Gemm_Bench_BF16FP32_RCR<Shape<_16, _64, _32>, Tile_9, XE_2D_U16x8x32_LD_N, XE_2D_U16x16x16_LD_T>;
 
+using RasterOrderOptions = cutlass::gemm::kernel::detail::RasterOrderOptions;
+template <int MaxSwizzleSize, RasterOrderOptions RasterOrder>
+using PvcGemmBF16BF16FP32_RCR_6_SwizzleConfig = cutlass::gemm::device::SwizzledGemmConfiguration<
+    cutlass::gemm::device::GemmConfiguration<
+      cutlass::arch::IntelXe,
+      cutlass::bfloat16_t, cutlass::layout::RowMajor,
+      cutlass::bfloat16_t, cutlass::layout::ColumnMajor,
+      float, cutlass::layout::RowMajor,
+      float,
+      Shape<_256, _256, _32>, Scheduler::GemmSwizzle, Tile_1,
+      XE_2D_U16x8x32_LD_N, XE_2D_U16x16x16_LD_T>,
+    MaxSwizzleSize, RasterOrder>;
+
+using PvcGemmBF16BF16FP32_RCR_6_Swizzle1 = PvcGemmBF16BF16FP32_RCR_6_SwizzleConfig<1, RasterOrderOptions::AlongN>;
+using PvcGemmBF16BF16FP32_RCR_6_Swizzle2_AlongN = PvcGemmBF16BF16FP32_RCR_6_SwizzleConfig<2, RasterOrderOptions::AlongN>;
+using PvcGemmBF16BF16FP32_RCR_6_Swizzle4_AlongN = PvcGemmBF16BF16FP32_RCR_6_SwizzleConfig<4, RasterOrderOptions::AlongN>;
+using PvcGemmBF16BF16FP32_RCR_6_Swizzle8_AlongN = PvcGemmBF16BF16FP32_RCR_6_SwizzleConfig<8, RasterOrderOptions::AlongN>;
+using PvcGemmBF16BF16FP32_RCR_6_Swizzle2_AlongM = PvcGemmBF16BF16FP32_RCR_6_SwizzleConfig<2, RasterOrderOptions::AlongM>;
+using PvcGemmBF16BF16FP32_RCR_6_Swizzle4_AlongM = PvcGemmBF16BF16FP32_RCR_6_SwizzleConfig<4, RasterOrderOptions::AlongM>;
+using PvcGemmBF16BF16FP32_RCR_6_Swizzle8_AlongM = PvcGemmBF16BF16FP32_RCR_6_SwizzleConfig<8, RasterOrderOptions::AlongM>;
+using PvcGemmBF16BF16FP32_RCR_6_Swizzle8_Heuristic = PvcGemmBF16BF16FP32_RCR_6_SwizzleConfig<8, RasterOrderOptions::Heuristic>;
+
 CUTLASS_CREATE_GEMM_BENCHMARK(PvcGemmBF16BF16FP32_RCR_5);
 CUTLASS_CREATE_GEMM_BENCHMARK(PvcGemmBF16BF16FP32_RCR_6);
+CUTLASS_CREATE_GEMM_BENCHMARK(PvcGemmBF16BF16FP32_RCR_6_Swizzle1);
+CUTLASS_CREATE_GEMM_BENCHMARK(PvcGemmBF16BF16FP32_RCR_6_Swizzle2_AlongN);
+CUTLASS_CREATE_GEMM_BENCHMARK(PvcGemmBF16BF16FP32_RCR_6_Swizzle4_AlongN);
+CUTLASS_CREATE_GEMM_BENCHMARK(PvcGemmBF16BF16FP32_RCR_6_Swizzle8_AlongN);
+CUTLASS_CREATE_GEMM_BENCHMARK(PvcGemmBF16BF16FP32_RCR_6_Swizzle2_AlongM);
+CUTLASS_CREATE_GEMM_BENCHMARK(PvcGemmBF16BF16FP32_RCR_6_Swizzle4_AlongM);
+CUTLASS_CREATE_GEMM_BENCHMARK(PvcGemmBF16BF16FP32_RCR_6_Swizzle8_AlongM);
+CUTLASS_CREATE_GEMM_BENCHMARK(PvcGemmBF16BF16FP32_RCR_6_Swizzle8_Heuristic);
 CUTLASS_CREATE_GEMM_BENCHMARK(PvcGemmBF16BF16FP32_RCR_7);
 CUTLASS_CREATE_GEMM_BENCHMARK(PvcGemmBF16BF16FP32_RCR_9);
 CUTLASS_CREATE_GEMM_BENCHMARK(PvcGemmBF16BF16FP32_RCR_16);
@@ -497,6 +527,14 @@ static void register_gemm_benchmarks() {
 
   CUTLASS_BENCHMARK(PvcGemmBF16BF16FP32_RCR_5);
   CUTLASS_BENCHMARK(PvcGemmBF16BF16FP32_RCR_6);
+  CUTLASS_BENCHMARK(PvcGemmBF16BF16FP32_RCR_6_Swizzle1);
+  CUTLASS_BENCHMARK(PvcGemmBF16BF16FP32_RCR_6_Swizzle2_AlongN);
+  CUTLASS_BENCHMARK(PvcGemmBF16BF16FP32_RCR_6_Swizzle4_AlongN);
+  CUTLASS_BENCHMARK(PvcGemmBF16BF16FP32_RCR_6_Swizzle8_AlongN);
+  CUTLASS_BENCHMARK(PvcGemmBF16BF16FP32_RCR_6_Swizzle2_AlongM);
+  CUTLASS_BENCHMARK(PvcGemmBF16BF16FP32_RCR_6_Swizzle4_AlongM);
+  CUTLASS_BENCHMARK(PvcGemmBF16BF16FP32_RCR_6_Swizzle8_AlongM);
+  CUTLASS_BENCHMARK(PvcGemmBF16BF16FP32_RCR_6_Swizzle8_Heuristic);
   CUTLASS_BENCHMARK(PvcGemmBF16BF16FP32_RCR_7);
   CUTLASS_BENCHMARK(PvcGemmBF16BF16FP32_RCR_9);
   CUTLASS_BENCHMARK(PvcGemmBF16BF16FP32_RCR_16);
@@ -51,7 +51,7 @@ using namespace cute;
 
 namespace cutlass::gemm::device {
 
-enum class Scheduler { Gemm, GemmSplitK, GemmStreamK };
+enum class Scheduler { Gemm, GemmSplitK, GemmStreamK, GemmSwizzle };
 
 template<
   class ArchTag,
@@ -96,7 +96,8 @@ struct GemmConfiguration<
       TileShape, TileScheduler, TiledMma,
       GmemTiledCopyA, GmemTiledCopyB, EpilogueOp>
 {
-  using KernelScheduleType = std::conditional_t<TileScheduler == Scheduler::Gemm,
+  static constexpr bool is_non_persistent = TileScheduler == Scheduler::Gemm || TileScheduler == Scheduler::GemmSwizzle;
+  using KernelScheduleType = std::conditional_t<is_non_persistent,
     cutlass::gemm::KernelXe, cutlass::gemm::KernelXeCooperative>;
   using DispatchPolicy = MainloopIntelXeXMX16<3, KernelScheduleType>;
 
@@ -149,7 +150,9 @@ struct GemmConfiguration<
     Shape<int, int, int, int>,
     CollectiveMainloop,
     CollectiveEpilogue,
-    std::conditional_t<TileScheduler == Scheduler::Gemm, void, cutlass::gemm::StreamKScheduler>
+    std::conditional_t<TileScheduler == Scheduler::Gemm, void,
+      std::conditional_t<TileScheduler == Scheduler::GemmSwizzle, cutlass::gemm::SwizzleScheduler,
+                         cutlass::gemm::StreamKScheduler>>
   >;
 
   using Gemm = GemmUniversalAdapter<GemmKernel>;
@@ -157,7 +160,7 @@ struct GemmConfiguration<
   constexpr static typename GemmKernel::Arguments defaultArguments() {
     using StreamKMode =
       cutlass::gemm::kernel::detail::PersistentTileSchedulerXeStreamKParams::DecompositionMode;
-    if constexpr (TileScheduler == Scheduler::Gemm) {
+    if constexpr (is_non_persistent) {
       return {};
     } else if constexpr (TileScheduler == Scheduler::GemmStreamK) {
       typename GemmKernel::Arguments arguments{};
@@ -248,4 +251,19 @@ struct MixedPrecisionGemmConfiguration<
   }
 };
 
+// Overrides the tile scheduler arguments of a GemmConfiguration using Scheduler::GemmSwizzle
+template <class GemmConfig, int MaxSwizzleSize,
+  kernel::detail::RasterOrderOptions RasterOrder = kernel::detail::RasterOrderOptions::Heuristic>
+struct SwizzledGemmConfiguration : GemmConfig {
+  using GemmKernel = typename GemmConfig::GemmKernel;
+  static_assert(cute::is_same_v<typename GemmKernel::TileSchedulerTag, SwizzleScheduler>,
+    "SwizzledGemmConfiguration requires a configuration using Scheduler::GemmSwizzle.");
+
+  constexpr static typename GemmKernel::Arguments defaultArguments() {
+    typename GemmKernel::Arguments arguments = GemmConfig::defaultArguments();
+    arguments.scheduler = {MaxSwizzleSize, RasterOrder};
+    return arguments;
+  }
+};
+
 } // namespace cutlass::gemm::device
@@ -42,7 +42,7 @@
 
 int main(int argc, const char** argv) {
 
-  BenckmarkOptions options;
+  cutlass::benchmark::GEMMBenchmarkOptions options;
 
   options.parse(argc, argv);
 
@@ -70,10 +70,24 @@ int main(int argc, const char** argv) {
 
   register_gemm_benchmarks();
 
+  cutlass::benchmark::GemmAutotuner autotuner;
+  std::map<std::string, std::string> best_configs;
+  if (!options.best_config_file.empty()) {
+    best_configs = cutlass::benchmark::GemmAutotuner::read_best_config_table(options.best_config_file);
+  }
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
   std::string line;
   while (std::getline(file, line)) {
     if (!line.empty() && line.find("#") != 0) {
-      register_benchmarks<cutlass::benchmark::GEMMOptions>(line);
+      if (options.autotune) {
+        autotuner.register_line(line, hw_info);
+      } else {
+        register_benchmarks<cutlass::benchmark::GEMMOptions>(
+            cutlass::benchmark::GemmAutotuner::apply_best_config(line, best_configs));
+      }
     }
   }
   file.close();
@@ -82,6 +96,13 @@ int main(int argc, const char** argv) {
   ::benchmark::SetDefaultTimeUnit(::benchmark::kMillisecond);
   ::benchmark::Initialize(&argc_bm, nullptr);
 
+  if (options.autotune) {
+    cutlass::benchmark::GemmAutotuner::Reporter reporter(autotuner);
+    ::benchmark::RunSpecifiedBenchmarks(&reporter);
+    ::benchmark::Shutdown();
+    return autotuner.write(options.autotune_output) ? 0 : 1;
+  }
+
   ::benchmark::RunSpecifiedBenchmarks();
   ::benchmark::Shutdown();
 
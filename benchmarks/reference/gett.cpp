@@ -0,0 +1,141 @@
+/***************************************************************************************************
+* Copyright (c) 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+// Compares the serial host reference GETT with the multithreaded, cache-blocked one.
+//
+//   ./benchmarks/reference/cutlass_benchmarks_reference_gett --benchmark_filter=Parallel
+//
+// Problem sizes are M = N = K; the second argument of the parallel benchmark is the thread count
+// (0 selects std::thread::hardware_concurrency()).
+
+#include "cutlass/bfloat16.h"
+#include "cutlass/util/reference/host/gett.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+namespace {
+
+using ElementInput = cutlass::bfloat16_t;
+using ElementAccumulator = float;
+using ElementOutput = float;
+
+struct GettProblem {
+  std::vector<ElementInput> A;
+  std::vector<ElementInput> B;
+  std::vector<ElementOutput> D;
+  int64_t m, n, k;
+
+  explicit GettProblem(int64_t size) : A(size * size), B(size * size), D(size * size), m(size), n(size), k(size) {
+    std::mt19937 rng(2025);
+    std::uniform_int_distribution<int> dist(-4, 4);
+    for (auto& a : A) { a = ElementInput(float(dist(rng))); }
+    for (auto& b : B) { b = ElementInput(float(dist(rng))); }
+  }
+
+  // Row-major A (M, K), column-major B (N, K) and row-major D (M, N)
+  template <class GettFunc>
+  void run(GettFunc&& gett) {
+    using namespace cute;
+    auto tensor_A = make_tensor(A.data(), make_layout(make_shape(m, k, 1), make_stride(k, _1{}, m * k)));
+    auto tensor_B = make_tensor(B.data(), make_layout(make_shape(n, k, 1), make_stride(k, _1{}, n * k)));
+    auto tensor_D = make_tensor(D.data(), make_layout(make_shape(m, n, 1), make_stride(n, _1{}, m * n)));
+    using unused_t = decltype(tensor_D);
+
+    cutlass::reference::host::GettMainloopParams<ElementAccumulator, decltype(tensor_A), decltype(tensor_B)>
+        mainloop_params{tensor_A, tensor_B};
+
+    cutlass::reference::host::GettEpilogueParams<
+        ElementAccumulator,
+        ElementAccumulator,
+        ElementAccumulator,
+        ElementAccumulator,
+        unused_t,
+        decltype(tensor_D),
+        unused_t, // bias
+        unused_t, // aux
+        unused_t, // valpha
+        unused_t  // vbeta
+    > epilogue_params;
+
+    epilogue_params.D = tensor_D;
+    epilogue_params.alpha = 1.f;
+    epilogue_params.beta = 0.f;
+
+    gett(mainloop_params, epilogue_params);
+  }
+};
+
+void set_counters(benchmark::State& state, GettProblem const& problem) {
+  double flop = 2.0 * problem.m * problem.n * problem.k;
+  state.counters["TFlops"] = benchmark::Counter(
+      flop / 1e12, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void BM_GettSerial(benchmark::State& state) {
+  GettProblem problem(state.range(0));
+  for (auto _ : state) {
+    problem.run([](auto const& mainloop, auto const& epilogue) {
+      cutlass::reference::host::Gett(mainloop, epilogue);
+    });
+    benchmark::DoNotOptimize(problem.D.data());
+  }
+  set_counters(state, problem);
+}
+
+void BM_GettParallel(benchmark::State& state) {
+  GettProblem problem(state.range(0));
+  int num_threads = static_cast<int>(state.range(1));
+  for (auto _ : state) {
+    problem.run([num_threads](auto const& mainloop, auto const& epilogue) {
+      cutlass::reference::host::GettParallel(mainloop, epilogue, num_threads);
+    });
+    benchmark::DoNotOptimize(problem.D.data());
+  }
+  state.counters["threads"] = num_threads;
+  set_counters(state, problem);
+}
+
+} // namespace
+
+BENCHMARK(BM_GettSerial)
+    ->ArgNames({"mnk"})
+    ->Arg(256)->Arg(512)->Arg(1024)
+    ->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK(BM_GettParallel)
+    ->ArgNames({"mnk", "threads"})
+    ->ArgsProduct({{256, 512, 1024}, {1, 0}})
+    ->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -460,17 +460,23 @@ void initialize(const Options &options) {
         {ptr_A.get(), stride_A.get(), ptr_B.get(), stride_B.get()},
         {fusion_args, ptr_C.get(), stride_C.get(), ptr_D.get(), stride_D.get()},
         hw_info,
-        {1, RasterOrderOptions::AlongN}
+        {1, RasterOrderOptions::AlongN, /* use_group_tile_offsets = */ true}
       };
     }
     else {
+      // Nothing is read back on the host: the grid is sized from an upper bound on the number of tiles
+      // (here every group is at most m x n) and work-groups without a tile exit early.
+      using TileShape = typename Gemm::GemmKernel::TileShape;
+      uint64_t max_total_tiles = uint64_t(options.groups) *
+                                 cute::ceil_div(options.m, cute::get<0>(TileShape{})) *
+                                 cute::ceil_div(options.n, cute::get<1>(TileShape{}));
       arguments = typename Gemm::Arguments {
         cutlass::gemm::GemmUniversalMode::kGrouped,
         {options.groups, problem_sizes.get(), nullptr},
         {ptr_A.get(), stride_A.get(), ptr_B.get(), stride_B.get()},
         {fusion_args, ptr_C.get(), stride_C.get(), ptr_D.get(), stride_D.get()},
         hw_info,
-        {1, RasterOrderOptions::AlongN}
+        {1, RasterOrderOptions::AlongN, /* use_group_tile_offsets = */ false, max_total_tiles}
       };
     }
 
@@ -623,5 +629,9 @@ int main(int argc, const char** argv)
 
   CUTLASS_CHECK(runner.run(options, hw_info));
 
+  std::cout << "\nGrouped GEMM with problem shapes available on the device only" << std::endl;
+  ExampleRunner<Gemm> device_shapes_runner;
+  CUTLASS_CHECK(device_shapes_runner.run(options, hw_info, /* host_problem_shapes_available = */ false));
+
   return 0;
 }
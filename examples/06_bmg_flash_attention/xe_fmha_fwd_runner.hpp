@@ -93,13 +93,21 @@ struct Options {
     cmd.get_cmd_line_argument("num_heads_q", num_heads_q, 8);
     cmd.get_cmd_line_argument("num_heads_kv", num_heads_kv, 1);
     cmd.get_cmd_line_argument("seq_len_kv", seq_len_kv, 4096);
+#elif defined(PACK_GQA)
+    cmd.get_cmd_line_argument("batch", batch, 32);
+    cmd.get_cmd_line_argument("num_heads_q", num_heads_q, 32);
+    cmd.get_cmd_line_argument("num_heads_kv", num_heads_kv, 8);
+    cmd.get_cmd_line_argument("seq_len_kv", seq_len_kv, 512);
 #else
     cmd.get_cmd_line_argument("batch", batch, 32);
     cmd.get_cmd_line_argument("num_heads_q", num_heads_q, 16);
     cmd.get_cmd_line_argument("num_heads_kv", num_heads_kv, num_heads_q);
     cmd.get_cmd_line_argument("seq_len_kv", seq_len_kv, 512);
 #endif
-#ifdef DECODE
+#if defined(DECODE) && defined(PACK_GQA)
+    // speculative decoding: verify 4 draft tokens per step
+    cmd.get_cmd_line_argument("seq_len_qo", seq_len_qo, 4);
+#elif defined(DECODE)
     cmd.get_cmd_line_argument("seq_len_qo", seq_len_qo, 1);
 #else
     cmd.get_cmd_line_argument("seq_len_qo", seq_len_qo, seq_len_kv);
@@ -166,7 +174,9 @@ using LayoutK = cutlass::layout::ColumnMajor;
 using LayoutV = cutlass::layout::RowMajor;
 using LayoutO = cutlass::layout::RowMajor;
 
-template <class FMHAKernel, bool isVarLen = false> struct ExampleRunner {
+// UnsplitFMHAKernel (optional) is run on the same inputs and its output is compared with FMHAKernel's,
+// to check that splitting the KV sequence across work-groups does not change the result.
+template <class FMHAKernel, bool isVarLen = false, class UnsplitFMHAKernel = void> struct ExampleRunner {
 
   using StrideQ = typename FMHAKernel::StrideQ;
   using StrideK = typename FMHAKernel::StrideK;
@@ -512,16 +522,17 @@ template <class FMHAKernel, bool isVarLen = false> struct ExampleRunner {
 
   // Note that the GemmUniversalAdapter currently doesn't support flash attention, which is why this
   // secondary `run` function is required to launch the kernel.
-  static void run(typename FMHAKernel::Params params)
+  template <class Kernel = FMHAKernel>
+  static void run(typename Kernel::Params params)
   {
     namespace syclex = sycl::ext::oneapi::experimental;
     namespace intelex = sycl::ext::intel::experimental;
 
-    dim3 const block = FMHAKernel::get_block_shape();
-    dim3 const grid = FMHAKernel::get_grid_shape(params);
+    dim3 const block = Kernel::get_block_shape();
+    dim3 const grid = Kernel::get_grid_shape(params);
 
     // configure smem size and carveout
-    int smem_size = FMHAKernel::SharedStorageSize;
+    int smem_size = Kernel::SharedStorageSize;
 
     const auto sycl_block = compat::dim3(block.x, block.y, block.z);
     const auto sycl_grid = compat::dim3(grid.x, grid.y, grid.z);
@@ -535,11 +546,40 @@ template <class FMHAKernel, bool isVarLen = false> struct ExampleRunner {
       intelex::grf_size<256>
     };
     compat::experimental::launch_policy policy{sycl_grid, sycl_block, launch_props, kernel_props};
-    auto event = compat::experimental::launch<cutlass::device_kernel<FMHAKernel>, FMHAKernel>(policy, params);
+    auto event = compat::experimental::launch<cutlass::device_kernel<Kernel>, Kernel>(policy, params);
 
     EventManager::getInstance().addEvent(event);
   }
 
+  bool verify_against_unsplit(const Options &options, ProblemShapeType shape, const cutlass::KernelHardwareInfo &hw_info) {
+    typename UnsplitFMHAKernel::Arguments arguments{
+      {
+        shape,
+        block_Q.get(), stride_Q,
+        block_K.get(), stride_K,
+        block_V.get(), stride_V,
+        block_ref_O.get(), stride_O
+      },
+      {options.softmax_scale},
+      {},
+      hw_info
+    };
+
+    size_t workspace_size = UnsplitFMHAKernel::get_workspace_size(arguments);
+    cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
+    if (!UnsplitFMHAKernel::can_implement(arguments) ||
+        UnsplitFMHAKernel::initialize_workspace(arguments, workspace.get()) != cutlass::Status::kSuccess) {
+      return false;
+    }
+
+    run<UnsplitFMHAKernel>(UnsplitFMHAKernel::to_underlying_arguments(arguments, workspace.get()));
+    compat::wait();
+
+    // Only the order of the softmax reduction differs between the two kernels
+    return cutlass::reference::device::BlockCompareRelativelyEqual(block_ref_O.get(), block_O.get(),
+                                                                   block_O.size(), ElementO{0.01}, ElementO{0.01});
+  }
+
   cutlass::Status run(const Options &options, const cutlass::KernelHardwareInfo &hw_info) {
 
     ProblemShapeType shape = initialize(options);
@@ -587,6 +627,15 @@ template <class FMHAKernel, bool isVarLen = false> struct ExampleRunner {
       return cutlass::Status::kErrorInternal;
     }
 
+    if constexpr (!is_void_v<UnsplitFMHAKernel>) {
+      passed = verify_against_unsplit(options, shape, hw_info);
+      std::cout << "Disposition (vs. unsplit kernel): " << (passed ? "Passed" : "Failed") << std::endl;
+
+      if (!passed) {
+        return cutlass::Status::kErrorInternal;
+      }
+    }
+
     if (options.iterations > 0) {
       GPU_Clock timer;
       timer.start();
@@ -712,18 +761,29 @@ struct FMHAConfig {
         ProblemShapeType, CollectiveMainloop, CollectiveEpilogue, Scheduler>
         >;
 
-    ExampleRunner<FMHAKernel, isVarLen> runner;
+    using UnsplitFMHAKernel = conditional_t<is_same_v<Scheduler, cutlass::fmha::kernel::XeFHMAIndividualPersistentTileScheduler>,
+      cutlass::fmha::kernel::XeFMHAFwdKernel<
+        ProblemShapeType, CollectiveMainloop, CollectiveEpilogue, cutlass::fmha::kernel::XeFHMAIndividualTileScheduler>,
+        void
+        >;
+
+    ExampleRunner<FMHAKernel, isVarLen, UnsplitFMHAKernel> runner;
 
     CUTLASS_CHECK(runner.run(options, hw_info));
     return 0;
   }
 
   static int run(const Options &options) {
+#ifdef PACK_GQA
+    using IndividualScheduler = cutlass::fmha::kernel::XeFHMAPackedGQATileScheduler;
+#else
+    using IndividualScheduler = cutlass::fmha::kernel::XeFHMAIndividualTileScheduler;
+#endif
     if (options.varlen) {
-      return run<true, cutlass::fmha::kernel::XeFHMAIndividualTileScheduler>(options);
+      return run<true, IndividualScheduler>(options);
     } else {
       return persistent ? run<false, cutlass::fmha::kernel::XeFHMAIndividualPersistentTileScheduler>(options) :
-              run<false, cutlass::fmha::kernel::XeFHMAIndividualTileScheduler>(options);
+              run<false, IndividualScheduler>(options);
     }
   }
 };
@@ -0,0 +1,624 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 Codeplay Software Ltd. All rights reserved.
+ * Copyright (C) 2025 Intel Corporation, All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief CUTLASS Intel BMG Dual Gemm with an interleaved gate/up weight and a fused SwiGLU epilogue
+
+    This example computes the gated MLP projection of a LLaMA-style model, D = silu(A * B_gate) * (A * B_up),
+    in a single kernel. Instead of two separate B tensors, the gate and up weights are stored in one
+    (K, 2N) tensor whose columns alternate between BLK_N-wide blocks of B_gate and B_up, where BLK_N is
+    the N extent of the workgroup tile. Each workgroup reads the matching pair of blocks, keeps both
+    accumulators in registers, and only writes the product D; the intermediate GEMM results are never
+    stored.
+
+    The weights may be bf16, or int8/int4 with a per-output-channel scale for each of B_gate and B_up.
+    Narrow weights are widened to bf16 in registers and the scales are applied to the accumulators in
+    the epilogue. int4 weights are stored K-major, as for the other int4 examples.
+
+    Verification runs two reference GEMMs against the de-interleaved, dequantized weights. For
+    comparison, the example also times two separate bf16 GEMMs producing the gate and up projections,
+    which is the unfused baseline (excluding the activation pass).
+
+    To build & run this example (from your build dir):
+
+      $ ninja 07_bmg_dual_gemm_swiglu
+      $ ./examples/sycl/07_bmg_dual_gemm/07_bmg_dual_gemm_swiglu
+
+    Call with `--help` for information about available options
+*/
+
+#include "cutlass/epilogue/collective/default_epilogue.hpp"
+#include "cutlass/epilogue/collective/xe_epilogue.hpp"
+#include "cutlass/epilogue/fusion/xe_callbacks.hpp"
+#include "cutlass/gemm/device/gemm_universal.h"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/collective/collective_mma.hpp"
+#include "dual_gemm/kernel/xe_dual_gemm.hpp"
+#include "dual_gemm/collective/xe_dual_gemm_epilogue_elementwise_activation.hpp"
+#include "cutlass/util/GPU_Clock.hpp"
+
+#include <cute/tensor.hpp>
+#include <cmath>
+#include <random>
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/reference/device/gemm_complex.h"
+#include "cutlass/util/reference/device/tensor_compare.h"
+#include "sycl_common.hpp"
+#include "helper.h"
+#include "tensor_silu.h"
+#include "dual_gemm/thread/xe_binary_elem_wise_op.hpp"
+
+using namespace cute;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Command line options parsing
+struct Options {
+
+  bool help;
+  bool error;
+
+  int m, n, k, l, iterations;
+
+  Options():
+    help(false),
+    error(false),
+    m(4096), n(4096), k(4096), l(1), iterations(20)
+  { }
+
+  // Parses the command line
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    cmd.get_cmd_line_argument("m", m, 4096);
+    cmd.get_cmd_line_argument("n", n, 4096);
+    cmd.get_cmd_line_argument("k", k, 4096);
+    cmd.get_cmd_line_argument("l", l, 1);
+    cmd.get_cmd_line_argument("iterations", iterations, 100);
+  }
+
+  /// Prints the usage statement.
+  std::ostream & print_usage(std::ostream &out) const {
+
+    out << "BMG Dual GEMM SwiGLU Example\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement\n\n"
+      << "  --m=<int>                   Sets the M extent (tokens) of the GEMM\n"
+      << "  --n=<int>                   Sets the N extent (intermediate size) of each of the gate and up projections\n"
+      << "  --k=<int>                   Sets the K extent (hidden size) of the GEMM\n"
+      << "  --l=<int>                   Sets the L extent (batch count) of the GEMM\n"
+      << "  --iterations=<int>          Iterations\n\n";
+
+    return out;
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+using LayoutA = cutlass::layout::RowMajor;
+using LayoutRefB = cutlass::layout::RowMajor;
+using LayoutD = cutlass::layout::RowMajor;
+
+template <
+  class GemmKernel,
+  class LayoutB,
+  class SeparateGemm
+>
+struct ExampleRunner {
+
+  using StrideA = typename GemmKernel::StrideA;
+  using StrideB = typename GemmKernel::StrideB;
+  using StrideD = typename GemmKernel::StrideD;
+
+  using ElementA = typename GemmKernel::ElementA;
+  using ElementB = typename GemmKernel::ElementB;
+  using ElementOutput = typename GemmKernel::ElementD;
+  using ElementAccumulator = typename GemmKernel::ElementAccumulator;
+  using ElementScale = ElementOutput;
+
+  using ProblemShapeType = typename GemmKernel::ProblemShape;
+
+  static constexpr int BLK_N = get<1>(typename GemmKernel::TileShape{});
+  static constexpr bool IsQuantized = not cute::is_same_v<ElementA, ElementB>;
+
+  //
+  // Data members
+  //
+
+  /// Initialization
+  StrideA stride_A;
+  StrideB stride_B;
+  StrideD stride_D;
+  uint64_t seed = 0;
+
+  cutlass::DeviceAllocation<ElementA> block_A;
+  cutlass::DeviceAllocation<ElementB> block_B;
+  cutlass::DeviceAllocation<ElementScale> block_scale0;
+  cutlass::DeviceAllocation<ElementScale> block_scale1;
+  cutlass::DeviceAllocation<ElementOutput> block_D;
+  // De-interleaved and dequantized weights for the reference and the unfused baseline
+  cutlass::DeviceAllocation<ElementA> block_ref_B0;
+  cutlass::DeviceAllocation<ElementA> block_ref_B1;
+  cutlass::DeviceAllocation<ElementOutput> block_ref_D0;
+  cutlass::DeviceAllocation<ElementOutput> block_ref_D1;
+  cutlass::DeviceAllocation<ElementOutput> block_ref_D;
+
+  //
+  // Methods
+  //
+
+  bool verify(const ProblemShapeType& problem_size) {
+    auto [M, N, K, L] = problem_size;
+
+    cutlass::TensorRef ref_A(block_A.get(), LayoutA::packed({M, K}));
+    cutlass::TensorRef ref_B0(block_ref_B0.get(), LayoutRefB::packed({K, N}));
+    cutlass::TensorRef ref_B1(block_ref_B1.get(), LayoutRefB::packed({K, N}));
+    cutlass::TensorRef ref_D0(block_ref_D0.get(), LayoutD::packed({M, N}));
+    cutlass::TensorRef ref_D1(block_ref_D1.get(), LayoutD::packed({M, N}));
+
+    cutlass::reference::device::GemmComplex(
+          {M, N, K},
+          ElementAccumulator(1),
+          ref_A,
+          cutlass::ComplexTransform::kNone,
+          ref_B0,
+          cutlass::ComplexTransform::kNone,
+          ElementAccumulator(0),
+          ref_D0,
+          ref_D0,
+          ElementAccumulator(0),
+          L,     // batch_count
+          M * K, // batch_stride_A
+          K * N, // batch_stride_B
+          M * N, // batch_stride_C
+          M * N  // batch_stride_D
+        );
+
+    cutlass::reference::device::GemmComplex(
+          {M, N, K},
+          ElementAccumulator(1),
+          ref_A,
+          cutlass::ComplexTransform::kNone,
+          ref_B1,
+          cutlass::ComplexTransform::kNone,
+          ElementAccumulator(0),
+          ref_D1,
+          ref_D1,
+          ElementAccumulator(0),
+          L,     // batch_count
+          M * K, // batch_stride_A
+          K * N, // batch_stride_B
+          M * N, // batch_stride_C
+          M * N  // batch_stride_D
+        );
+
+    compat::wait();
+
+    for(int batch = 0, offset = 0; batch < L; batch++, offset += M * N) {
+      auto D0_view = cutlass::TensorView(block_ref_D0.get() + offset, LayoutD::packed({M, N}), cutlass::make_Coord(M, N));
+      auto D1_view = cutlass::TensorView(block_ref_D1.get() + offset, LayoutD::packed({M, N}), cutlass::make_Coord(M, N));
+      auto D_view = cutlass::TensorView(block_ref_D.get() + offset, LayoutD::packed({M, N}), cutlass::make_Coord(M, N));
+      cutlass::reference::device::TensorSiLu(D_view, D0_view, D1_view);
+    }
+
+    compat::wait();
+
+    return cutlass::reference::device::BlockCompareRelativelyEqual(
+      block_ref_D.get(), block_D.get(), block_D.size(), 0.5f, 0.5f);
+  }
+
+  // Offset of element (n, k) of the gate (which == 0) or up (which == 1) weight within the interleaved B
+  static size_t interleaved_offset(int n, int k, int which, int N, int K) {
+    size_t col = static_cast<size_t>(n / BLK_N) * 2 * BLK_N + which * BLK_N + n % BLK_N;
+    if constexpr (cute::is_same_v<LayoutB, cutlass::layout::ColumnMajor>) {
+      return col * K + k;
+    } else {
+      return static_cast<size_t>(k) * 2 * N + col;
+    }
+  }
+
+  static void store_weight(std::vector<uint8_t>& host_B, size_t idx, float value) {
+    if constexpr (sizeof_bits_v<ElementB> == 4) {
+      uint8_t nibble = static_cast<uint8_t>(static_cast<int>(value)) & 0xf;
+      uint8_t& byte = host_B[idx / 2];
+      byte = (idx % 2) ? ((byte & 0x0f) | (nibble << 4)) : ((byte & 0xf0) | nibble);
+    } else {
+      reinterpret_cast<ElementB*>(host_B.data())[idx] = static_cast<ElementB>(value);
+    }
+  }
+
+  /// Initialize operands to be used in the GEMM and reference GEMM
+  void initialize(const ProblemShapeType& problem_size) {
+    auto problem_shape_MNKL = cute::append<4>(problem_size, 1);
+    auto [M, N, K, L] = problem_shape_MNKL;
+
+    stride_A = cutlass::make_cute_packed_stride(StrideA{}, cute::make_shape(M, K, L));
+    stride_B = cutlass::make_cute_packed_stride(StrideB{}, cute::make_shape(2 * N, K, L));
+    stride_D = cutlass::make_cute_packed_stride(StrideD{}, cute::make_shape(M, N, L));
+
+    block_A.reset(static_cast<std::size_t>(M) * K * L);
+    block_B.reset(static_cast<std::size_t>(2) * N * K * L);
+    block_D.reset(static_cast<std::size_t>(M) * N * L);
+    block_ref_B0.reset(static_cast<std::size_t>(K) * N * L);
+    block_ref_B1.reset(static_cast<std::size_t>(K) * N * L);
+    block_ref_D0.reset(static_cast<std::size_t>(M) * N * L);
+    block_ref_D1.reset(static_cast<std::size_t>(M) * N * L);
+    block_ref_D.reset(static_cast<std::size_t>(M) * N * L);
+
+    initialize_block(block_A, seed + 2023);
+
+    // Weights are generated on the host so that the interleaved, packed copy and the de-interleaved
+    // reference hold the same values. Quantized weights are small integers and their scales are
+    // powers of two, so the dequantized reference is exact in bf16.
+    std::mt19937 rng(seed + 2022);
+    std::uniform_int_distribution<int> int_dist(-4, 4);
+    std::uniform_int_distribution<int> exp_dist(4, 7);
+    std::uniform_real_distribution<float> float_dist(-1.f, 1.f);
+
+    std::vector<uint8_t> host_B(block_B.bytes());
+    std::vector<ElementA> host_ref_B[2] = {std::vector<ElementA>(block_ref_B0.size()), std::vector<ElementA>(block_ref_B1.size())};
+    std::vector<ElementScale> host_scale[2] = {std::vector<ElementScale>(N * L), std::vector<ElementScale>(N * L)};
+
+    for (int which = 0; which < 2; ++which) {
+      for (int i = 0; i < N * L; ++i) {
+        host_scale[which][i] = IsQuantized ? ElementScale(std::ldexp(1.f, -exp_dist(rng))) : ElementScale(1);
+      }
+    }
+
+    for (int batch = 0; batch < L; ++batch) {
+      for (int which = 0; which < 2; ++which) {
+        for (int k = 0; k < K; ++k) {
+          for (int n = 0; n < N; ++n) {
+            float value = IsQuantized ? static_cast<float>(int_dist(rng)) : static_cast<float>(ElementA(float_dist(rng)));
+            store_weight(host_B, static_cast<size_t>(batch) * 2 * N * K + interleaved_offset(n, k, which, N, K), value);
+            host_ref_B[which][(static_cast<size_t>(batch) * K + k) * N + n] = ElementA(value * host_scale[which][batch * N + n]);
+          }
+        }
+      }
+    }
+
+    compat::memcpy(reinterpret_cast<uint8_t*>(block_B.get()), host_B.data(), host_B.size());
+    block_ref_B0.copy_from_host(host_ref_B[0].data());
+    block_ref_B1.copy_from_host(host_ref_B[1].data());
+
+    if constexpr (IsQuantized) {
+      block_scale0.reset(static_cast<std::size_t>(N) * L);
+      block_scale1.reset(static_cast<std::size_t>(N) * L);
+      block_scale0.copy_from_host(host_scale[0].data());
+      block_scale1.copy_from_host(host_scale[1].data());
+    }
+    compat::wait();
+  }
+
+  // Note that the GemmUniversalAdapter currently doesn't support dual gemm, which is why this
+  // secondary `run` function is required to launch the kernel.
+  static cutlass::Status run(typename GemmKernel::Params params) {
+    dim3 const block = GemmKernel::get_block_shape();
+    dim3 const grid = GemmKernel::get_grid_shape(params);
+
+    // configure smem size and carveout
+    int smem_size = GemmKernel::SharedStorageSize;
+
+    const auto sycl_block = compat::dim3(block.x, block.y, block.z);
+    const auto sycl_grid = compat::dim3(grid.x, grid.y, grid.z);
+
+#if !defined(SYCL_EXT_ONEAPI_WORK_GROUP_SCRATCH_MEMORY)
+    using namespace compat::experimental;
+    auto event = launch<cutlass::device_kernel<GemmKernel>>(
+        launch_policy{sycl_grid, sycl_block, local_mem_size{static_cast<std::size_t>(smem_size)},
+                      kernel_properties{sycl_exp::sub_group_size<GemmKernel::DispatchPolicy::SubgroupSize>}},
+        params);
+#else
+    compat::experimental::launch_properties launch_props{
+      sycl::ext::oneapi::experimental::work_group_scratch_size(smem_size)
+    };
+    compat::experimental::kernel_properties kernel_props{
+      sycl::ext::oneapi::experimental::sub_group_size<GemmKernel::DispatchPolicy::SubgroupSize>
+    };
+    compat::experimental::launch_policy policy{sycl_grid, sycl_block, launch_props, kernel_props};
+    auto event = compat::experimental::launch<cutlass::device_kernel<GemmKernel>, GemmKernel>(policy, params);
+#endif
+
+    EventManager::getInstance().addEvent(event);
+    return cutlass::Status::kSuccess;
+  }
+
+  /// Time two separate GEMMs computing the gate and up projections from the de-interleaved weights
+  float time_separate_gemms(const Options& options, const cutlass::KernelHardwareInfo& hw_info) {
+    using SeparateKernel = typename SeparateGemm::GemmKernel;
+    ProblemShapeType problem_size = ProblemShapeType{options.m, options.n, options.k, options.l};
+
+    auto stride_ref_B = cutlass::make_cute_packed_stride(typename SeparateKernel::StrideB{}, cute::make_shape(options.n, options.k, options.l));
+    auto stride_C = cutlass::make_cute_packed_stride(typename SeparateKernel::StrideC{}, cute::make_shape(options.m, options.n, options.l));
+
+    typename SeparateKernel::Arguments arguments0{
+      cutlass::gemm::GemmUniversalMode::kGemm,
+      problem_size,
+      {block_A.get(), stride_A, block_ref_B0.get(), stride_ref_B},
+      {{ElementAccumulator(1), ElementAccumulator(0)}, block_ref_D0.get(), stride_C, block_ref_D0.get(), stride_D},
+      hw_info
+    };
+    typename SeparateKernel::Arguments arguments1{
+      cutlass::gemm::GemmUniversalMode::kGemm,
+      problem_size,
+      {block_A.get(), stride_A, block_ref_B1.get(), stride_ref_B},
+      {{ElementAccumulator(1), ElementAccumulator(0)}, block_ref_D1.get(), stride_C, block_ref_D1.get(), stride_D},
+      hw_info
+    };
+
+    SeparateGemm gemm_op0;
+    SeparateGemm gemm_op1;
+
+    if (gemm_op0.can_implement(arguments0) != cutlass::Status::kSuccess) {
+      std::cout << "Separate GEMM baseline cannot run this problem size" << std::endl;
+      return 0.f;
+    }
+
+    size_t workspace_size = SeparateGemm::get_workspace_size(arguments0);
+    cutlass::device_memory::allocation<uint8_t> workspace0(workspace_size);
+    cutlass::device_memory::allocation<uint8_t> workspace1(workspace_size);
+
+    CUTLASS_CHECK(gemm_op0.initialize(arguments0, workspace0.get()));
+    CUTLASS_CHECK(gemm_op1.initialize(arguments1, workspace1.get()));
+
+    // Warmup
+    CUTLASS_CHECK(gemm_op0.run());
+    CUTLASS_CHECK(gemm_op1.run());
+    compat::wait();
+
+    GPU_Clock timer;
+    timer.start();
+    for (int i = 0; i < options.iterations; ++i) {
+      gemm_op0.run();
+      gemm_op1.run();
+    }
+    compat::wait();
+
+    return timer.seconds() / options.iterations;
+  }
+
+  cutlass::Status run(const Options& options, const cutlass::KernelHardwareInfo& hw_info) {
+    ProblemShapeType problem_size = ProblemShapeType{options.m, options.n, options.k, options.l};
+
+    initialize(problem_size);
+
+    // The per-GEMM epilogues are void: only silu(gate) * up is written
+    typename GemmKernel::Arguments arguments{
+      cutlass::gemm::GemmUniversalMode::kGemm,
+      problem_size,
+      {block_A.get(), stride_A, block_B.get(), stride_B, nullptr, stride_B},
+      {},
+      {},
+      {block_D.get(), stride_D, block_scale0.get(), block_scale1.get()},
+      hw_info
+    };
+
+    size_t workspace_size = GemmKernel::get_workspace_size(arguments);
+    cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
+
+    if (!GemmKernel::can_implement(arguments)){
+      std::cout << "Invalid Problem Size: " << options.m << 'x' << options.n << 'x' << options.k << 'x' << options.l << std::endl;
+      std::exit(1);
+    }
+
+    CUTLASS_CHECK(GemmKernel::initialize_workspace(arguments, workspace.get()));
+
+    typename GemmKernel::Params params = GemmKernel::to_underlying_arguments(arguments, workspace.get());
+
+    // Run the GEMM
+    CUTLASS_CHECK(run(params));
+
+    compat::wait();
+
+    // Verify that the result is correct
+    bool passed = verify(problem_size);
+    std::cout << "Disposition: " << (passed ? "Passed" : "Failed") << std::endl;
+
+    if(!passed) return cutlass::Status::kErrorInternal;
+
+    if (options.iterations > 0) {
+      GPU_Clock timer;
+      timer.start();
+      for (int i = 0; i < options.iterations; ++i) {
+        run(params);
+      }
+      compat::wait();
+
+      float cute_time = timer.seconds() / options.iterations;
+      float separate_time = time_separate_gemms(options, hw_info);
+      double tflops = 2 * (2.0 * options.m * options.n * options.k * options.l) * 1e-12;
+      std::cout << "Problem Size: " << options.m << 'x' << options.n << 'x' << options.k << 'x' << options.l << std::endl;
+      printf("Cutlass Dual GEMM SwiGLU Performance:        [%4.3f]TFlop/s  (%6.4f)ms\n", tflops / cute_time, cute_time*1000);
+      if (separate_time > 0.f) {
+        printf("Cutlass 2x bf16 GEMM (unfused) Performance:  [%4.3f]TFlop/s  (%6.4f)ms\n", tflops / separate_time, separate_time*1000);
+      }
+    }
+
+    return cutlass::Status::kSuccess;
+  }
+
+};
+
+template <class ElementInputB, class LayoutB, class GmemTiledCopyB>
+int run_dual_gemm_swiglu(Options const& options, cutlass::KernelHardwareInfo const& hw_info)
+{
+  // The code section below describes datatype for input, output matrices and computation between
+  // elements in input matrices.
+  using ElementAccumulator = float;     // <- data type of accumulator
+  using ElementComputeEpilogue = float; // <- data type of epilogue operations
+  using ElementInputA = bfloat16_t;     // <- data type of elements in input matrix A
+  using ElementOutput = float;          // <- data type of elements in output matrix D
+
+  using GmemTiledCopyA = XE_2D_U16x16x32_LD_N;
+
+  // Workgroup-level tile. The gate and up weights are interleaved in blocks of its N extent.
+  using TileShape = Shape<_128, _128, _64>;
+
+  using TiledMma = typename TiledMMAHelper<MMA_Atom<XE_8x16x16_F32BF16BF16F32_TT>,
+                                          Layout<TileShape>,
+                                          Layout<Shape<_8, _4, _1>, Stride<_4, _1, _0>>>::TiledMMA;
+
+  constexpr int PipelineStages = 2;
+  using GEMMDispatchPolicy = cutlass::gemm::MainloopIntelXeXMX16<PipelineStages>;
+  using EpilogueDispatchPolicy = cutlass::epilogue::IntelXeXMX16;
+
+  // silu(gate) * up
+  using EpilogueOutputOp = cutlass::epilogue::thread::FusedElementWiseOpDualGemm <ElementOutput,
+          cutlass::epilogue::thread::SiLu,
+          cutlass::epilogue::thread::Identity,
+          cutlass::multiplies, ElementAccumulator, ElementAccumulator>;
+
+  using CollectiveEpilogueActivation = cutlass::epilogue::collective::DualGemmElemActEpilogue<
+          EpilogueDispatchPolicy,
+          TileShape,
+          void,
+          cutlass::gemm::TagToStrideC_t<LayoutD>,
+          ElementOutput,
+          cutlass::gemm::TagToStrideC_t<LayoutD>,
+          void,
+          XE_2D_U32x8x16_ST_N,
+          EpilogueOutputOp>;
+
+  // Mainloop reading a single interleaved B
+  using CollectiveMainloop = cutlass::gemm::collective::DualGemmMma<
+          GEMMDispatchPolicy,
+          TileShape,
+          ElementInputA,
+          cutlass::gemm::TagToStrideA_t<LayoutA>,
+          ElementInputB,
+          cutlass::gemm::TagToStrideB_t<LayoutB>,
+          TiledMma,
+          GmemTiledCopyA, // A
+          GmemTiledCopyB, // B
+          true            // InterleavedB
+  >;
+
+  using GemmKernel = cutlass::gemm::kernel::DualGemm<
+  Shape<int, int, int, int>,
+  CollectiveMainloop,
+  void,
+  void,
+  CollectiveEpilogueActivation
+  >;
+
+  // Unfused baseline: a regular bf16 GEMM run once for each of the gate and up projections
+  using EpilogueOp = cutlass::epilogue::fusion::LinearCombination<ElementOutput, ElementComputeEpilogue,
+          ElementAccumulator, ElementAccumulator, cutlass::FloatRoundStyle::round_to_nearest>;
+
+  using FusionCallBacks = cutlass::epilogue::fusion::FusionCallbacks<EpilogueDispatchPolicy, EpilogueOp, TileShape,
+          decltype(tile_shape(TiledMma()))>;
+
+  using SeparateEpilogue = cutlass::epilogue::collective::CollectiveEpilogue<
+          EpilogueDispatchPolicy,
+          TileShape,
+          ElementAccumulator,
+          cutlass::gemm::TagToStrideC_t<LayoutD>,
+          ElementOutput,
+          cutlass::gemm::TagToStrideC_t<LayoutD>,
+          FusionCallBacks,
+          XE_2D_U32x8x16_LD_N,
+          void, void,
+          XE_2D_U32x8x16_ST_N,
+          void, void>;
+
+  using SeparateMainloop = cutlass::gemm::collective::CollectiveMma<
+          GEMMDispatchPolicy,
+          TileShape,
+          ElementInputA,
+          cutlass::gemm::TagToStrideA_t<LayoutA>,
+          ElementInputA,
+          cutlass::gemm::TagToStrideB_t<LayoutRefB>,
+          TiledMma,
+          GmemTiledCopyA, void, void, cute::identity,              // A
+          XE_2D_U16x32x32_LD_V, void, void, cute::identity         // B
+  >;
+
+  using SeparateGemm = cutlass::gemm::device::GemmUniversalAdapter<cutlass::gemm::kernel::GemmUniversal<
+          Shape<int, int, int, int>,
+          SeparateMainloop,
+          SeparateEpilogue>>;
+
+  ExampleRunner<GemmKernel, LayoutB, SeparateGemm> runner;
+
+  CUTLASS_CHECK(runner.run(options, hw_info));
+
+  return 0;
+}
+
+int main(int argc, const char** argv)
+{
+  //
+  // Parse options
+  //
+
+  Options options;
+
+  options.parse(argc, argv);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  if (options.error) {
+    std::cerr << "Aborting execution." << std::endl;
+    return -1;
+  }
+
+  //
+  // Run examples
+  //
+
+  // The KernelHardwareInfo struct holds the number of EUs on the GPU with a given device ID. This
+  // information is used by the underlying kernel.
+  cutlass::KernelHardwareInfo hw_info;
+
+  // Change device_id to another value if you are running on a machine with multiple GPUs and wish
+  // to use a GPU other than that with device ID 0.
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  std::cout << "Running Dual Gemm SwiGLU with interleaved bf16 weights\n";
+  run_dual_gemm_swiglu<bfloat16_t, cutlass::layout::RowMajor, XE_2D_U16x32x32_LD_V>(options, hw_info);
+  std::cout << "\nRunning Dual Gemm SwiGLU with interleaved int8 weights and per-channel scales\n";
+  run_dual_gemm_swiglu<int8_t, cutlass::layout::RowMajor, XE_2D_U8x32x32_LD_V>(options, hw_info);
+  std::cout << "\nRunning Dual Gemm SwiGLU with interleaved int4 weights and per-channel scales\n";
+  run_dual_gemm_swiglu<cutlass::int4b_t, cutlass::layout::ColumnMajor, XE_2D_U4x32x16_LD_T>(options, hw_info);
+  std::cout << "\n\n";
+  return 0;
+}
@@ -74,6 +74,7 @@ struct Options {
   bool error;
 
   bool a_narrower;
+  bool device_shapes;
   int mode;
   int m, n, k, l, iterations, groups;
   int g;
@@ -81,7 +82,7 @@ struct Options {
   std::vector<typename ProblemShape::UnderlyingProblemShape> problem_sizes_host;
 
   Options(): help(false), error(false), m(5120), n(4096), k(4096), l(1), iterations(20),
-    g(128), groups(2), mode(2), a_narrower(false), alpha(FLT_MAX), beta(FLT_MAX) {
+    g(128), groups(2), mode(2), a_narrower(false), device_shapes(false), alpha(FLT_MAX), beta(FLT_MAX) {
 
     problem_sizes_host.reserve(groups);
     for(int i = 0; i < groups; i++) {
@@ -111,6 +112,9 @@ struct Options {
     if (cmd.check_cmd_line_flag("a_narrower")) {
       a_narrower = true;
     }
+    if (cmd.check_cmd_line_flag("device_shapes")) {
+      device_shapes = true;
+    }
     assert(groups > 0);
     problem_sizes_host.clear();
     problem_sizes_host.reserve(groups);
@@ -133,6 +137,7 @@ struct Options {
       << "  --groups=<int>              Sets the number of individual GEMM problems for Grouped GEMM\n"
       << "  --mode=<int>                The mode to run the gemm. 0 is Convert Only, 1 is Convert and Scale, 2 is Convert and Scale with Zero Point\n"
       << "  --a_narrower                If specified, make A the narrower type (B is narrower by default).\n"
+      << "  --device_shapes             If specified, only pass the problem shapes to the kernel on the device.\n"
       << "  --alpha=<s32>               Epilogue scalar alpha\n"
       << "  --beta=<s32>                Epilogue scalar beta\n\n"
       << "  --iterations=<int>          Iterations\n\n";
@@ -362,7 +367,18 @@ struct ExampleRunner {
     }
     using RasterOrderOptions = typename cutlass::gemm::kernel::detail::PersistentTileSchedulerXeGroup<ProblemShape>::RasterOrderOptions;
 
-    // Per-GEMM problem shape info may only exist on the device.
+    // Per-GEMM problem shape info may only exist on the device. In that case the grid is sized from an
+    // upper bound on the number of tiles (here every group is at most m x n).
+    if (options.device_shapes) {
+      using TileShape = typename Gemm::GemmKernel::TileShape;
+      uint64_t max_total_tiles = uint64_t(options.groups) *
+                                 cute::ceil_div(options.m, cute::get<0>(TileShape{})) *
+                                 cute::ceil_div(options.n, cute::get<1>(TileShape{}));
+      return cute::make_tuple(cutlass::gemm::GemmUniversalMode::kGrouped,
+                              typename Gemm::GemmKernel::ProblemShape{options.groups, problem_sizes.get(), nullptr},
+                              fusion_args, hw_info,
+                              typename Gemm::GemmKernel::TileSchedulerArguments{1, RasterOrderOptions::AlongN, false, max_total_tiles});
+    }
     return cute::make_tuple(cutlass::gemm::GemmUniversalMode::kGrouped,
                             typename Gemm::GemmKernel::ProblemShape{options.groups, problem_sizes.get(), options.problem_sizes_host.data()},
                             fusion_args, hw_info,
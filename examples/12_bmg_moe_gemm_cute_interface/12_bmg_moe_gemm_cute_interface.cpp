@@ -37,6 +37,8 @@
 #include "cutlass/util/GPU_Clock.hpp"
 
 #include <cute/tensor.hpp>
+#include <algorithm>
+#include <array>
 #include <random>
 
 #include <cute/util/compat.hpp>
@@ -45,6 +47,8 @@
 
 #include <cute/tensor.hpp>
 
+#include "cutlass/device_kernel.h"
+#include "cutlass/gemm/kernel/xe_moe_gemm.hpp"
 #include "cutlass/kernel_hardware_info.h"
 #include "cutlass/platform/platform.h"
 #include "cutlass/tensor_ref.h"
@@ -57,7 +61,6 @@
 #include "cutlass/util/sycl_event_manager.hpp"
 
 #include "moe_grouped_gemm.hpp"
-#include "moe_tile_scheduler.hpp"
 
 #pragma clang diagnostic ignored "-Wpass-failed"
 #pragma clang diagnostic ignored "-Wdeprecated-declarations"
@@ -239,15 +242,15 @@ void MoEGEMMLauncher(const ElementA *activations, const ElementB *weights,
   using TileShape = Shape<_256, _128, _32>;
   using ClusterShape = Shape<_1, _1, _1>;
   auto scheduler_params =
-      PersistentTileSchedulerXeMoE<ProblemShape>::to_underlying_arguments(
+      TileScheduler::to_underlying_arguments(
           dummy_group_problem_shape, TileShape{}, ClusterShape{}, hw_info,
-          PersistentTileSchedulerXeMoE<ProblemShape>::Arguments{
+          TileScheduler::Arguments{
               1, RasterOrderOptions::AlongN});
   auto group_distribution =
-      PersistentTileSchedulerXeMoE<ProblemShape>::get_grid_shape(
+      TileScheduler::get_grid_shape(
           scheduler_params, dummy_group_problem_shape, TileShape{},
           ClusterShape{}, hw_info,
-          PersistentTileSchedulerXeMoE<ProblemShape>::Arguments{
+          TileScheduler::Arguments{
               1, RasterOrderOptions::AlongN});
   auto mma = choose_tiled_mma(activations, weights);
   auto MaxThreadsPerWorkgroup = size(mma);
@@ -346,10 +349,321 @@ void launcher(int *M_per_expert, int N, int K, const int &num_experts) {
                             M_per_expert, num_experts);
 }
 
+// Host reference: D[t] = sum over the experts e routed to t of w(t,e) * A[t] * B[e]
+bool verify_fused_topk(std::vector<bfloat16_t> const &A_host,
+                       std::vector<bfloat16_t> const &B_host,
+                       cutlass::DeviceAllocation<float> &D_device,
+                       std::vector<int32_t> const &num_rows_per_expert_host,
+                       std::vector<int32_t> const &gather_idx_host,
+                       std::vector<float> const &topk_weights_host,
+                       int num_tokens, int N, int K, int num_experts) {
+  std::vector<float> D_ref(size_t(num_tokens) * N, 0.f);
+  int row = 0;
+  for (int e = 0; e < num_experts; ++e) {
+    for (int r = 0; r < num_rows_per_expert_host[e]; ++r, ++row) {
+      int t = gather_idx_host[row];
+      float w = topk_weights_host[row];
+      for (int n = 0; n < N; ++n) {
+        float acc = 0.f;
+        for (int k = 0; k < K; ++k) {
+          acc += float(A_host[size_t(t) * K + k]) *
+                 float(B_host[(size_t(e) * K + k) * N + n]);
+        }
+        D_ref[size_t(t) * N + n] += w * acc;
+      }
+    }
+  }
+
+  std::vector<float> D_host(D_ref.size());
+  D_device.copy_to_host(D_host.data());
+  bool passed = true;
+  for (size_t i = 0; i < D_ref.size(); ++i) {
+    if (std::abs(D_host[i] - D_ref[i]) > 1e-2f * (1.f + std::abs(D_ref[i]))) {
+      passed = false;
+      break;
+    }
+  }
+  return passed;
+}
+
+// type tags to define unique sycl kernel names for the unfused MoE layer
+class MoEPermuteName;
+class MoEUnfusedGemmName;
+class MoEUnpermuteName;
+
+// Unfused baseline of the fused top-k MoE layer: permute the activations into expert order, run
+// the grouped GEMM of MoEGEMMLauncher on them, then reduce the weighted top-k outputs back into
+// token order. Returns the average runtime in ms of each of the three passes.
+std::array<double, 3>
+time_unfused_topk(const bfloat16_t *activations, const bfloat16_t *weights,
+                  float *outputs, const int32_t *num_rows_per_expert_device,
+                  const int32_t *gather_idx, const float *topk_weights,
+                  std::vector<int32_t> const &gather_idx_host, int num_tokens,
+                  int top_k, int N, int K, int num_experts, int iterations) {
+  int const num_rows = gather_idx_host.size();
+
+  // Expert-sorted rows of every token, so the reduction needs no atomics
+  std::vector<int32_t> token_rows_host(size_t(num_tokens) * top_k);
+  std::vector<int> rows_of_token(num_tokens, 0);
+  for (int r = 0; r < num_rows; ++r) {
+    int t = gather_idx_host[r];
+    token_rows_host[size_t(t) * top_k + rows_of_token[t]++] = r;
+  }
+  cutlass::DeviceAllocation<int32_t> token_rows_device(token_rows_host.size());
+  token_rows_device.copy_from_host(token_rows_host.data());
+  cutlass::DeviceAllocation<bfloat16_t> sorted_activations_device(
+      size_t(num_rows) * K);
+  cutlass::DeviceAllocation<bfloat16_t> sorted_outputs_device(
+      size_t(num_rows) * N);
+
+  int32_t const *token_rows = token_rows_device.get();
+  bfloat16_t *sorted_activations = sorted_activations_device.get();
+  bfloat16_t *sorted_outputs = sorted_outputs_device.get();
+  void const *scales = nullptr;
+
+  cutlass::KernelHardwareInfo hw_info{
+      0, cutlass::KernelHardwareInfo::query_device_multiprocessor_count(0)};
+  auto dummy_problem_shape = cute::Shape<int, int, int>{1, K, N};
+  auto dummy_group_problem_shape =
+      cutlass::gemm::GroupProblemShape<Shape<int, int, int>>{
+          1, &dummy_problem_shape, nullptr};
+  using TileShape = Shape<_256, _128, _32>;
+  using ClusterShape = Shape<_1, _1, _1>;
+  auto scheduler_params = TileScheduler::to_underlying_arguments(
+      dummy_group_problem_shape, TileShape{}, ClusterShape{}, hw_info,
+      TileScheduler::Arguments{1, RasterOrderOptions::AlongN});
+  auto group_distribution = TileScheduler::get_grid_shape(
+      scheduler_params, dummy_group_problem_shape, TileShape{},
+      ClusterShape{}, hw_info,
+      TileScheduler::Arguments{1, RasterOrderOptions::AlongN});
+  auto mma = choose_tiled_mma(activations, weights);
+  sycl::range<3> local = {1, 1, size_t(size(mma))};
+  sycl::range<3> groups = {group_distribution.z, group_distribution.y,
+                           group_distribution.x};
+  sycl::range<3> global = {local[0] * groups[0], local[1] * groups[1],
+                           local[2] * groups[2]};
+
+  namespace syclex = sycl::ext::oneapi::experimental;
+  namespace intelex = sycl::ext::intel::experimental;
+
+  syclex::properties kernel_props{syclex::sub_group_size<16>,
+                                  intelex::grf_size<256>};
+  sycl::queue Q = compat::get_default_queue();
+
+  std::array<double, 3> runtime_ms{};
+  GPU_Clock timer;
+  for (int i = 0; i < iterations; ++i) {
+    timer.start();
+    Q.parallel_for<MoEPermuteName>(
+        sycl::range<1>(size_t(num_rows) * K), [=](sycl::id<1> idx) {
+          size_t r = idx[0] / K;
+          size_t k = idx[0] % K;
+          sorted_activations[idx[0]] =
+              activations[size_t(gather_idx[r]) * K + k];
+        });
+    Q.wait_and_throw();
+    runtime_ms[0] += timer.milliseconds();
+
+    timer.start();
+    Q.parallel_for<MoEUnfusedGemmName>(
+        sycl::nd_range<3>(global, local), kernel_props, [=](auto) {
+          MoE::MoEGEMM<XE_LOAD_2D<16, 32, 32, 16>,
+                       XE_LOAD_2D_VNNI<16, 32, 16, 16>,
+                       XE_STORE_2D<16, 8, 32>, 'R', 'R', 'R'>(
+              sorted_activations, weights, scales, sorted_outputs, mma,
+              num_rows_per_expert_device, num_experts, N, K,
+              scheduler_params);
+        });
+    Q.wait_and_throw();
+    runtime_ms[1] += timer.milliseconds();
+
+    timer.start();
+    Q.parallel_for<MoEUnpermuteName>(
+        sycl::range<1>(size_t(num_tokens) * N), [=](sycl::id<1> idx) {
+          size_t t = idx[0] / N;
+          size_t n = idx[0] % N;
+          float acc = 0.f;
+          for (int j = 0; j < top_k; ++j) {
+            int32_t r = token_rows[t * top_k + j];
+            acc += topk_weights[r] * float(sorted_outputs[size_t(r) * N + n]);
+          }
+          outputs[idx[0]] = acc;
+        });
+    Q.wait_and_throw();
+    runtime_ms[2] += timer.milliseconds();
+  }
+  for (auto &ms : runtime_ms) {
+    ms /= iterations;
+  }
+  return runtime_ms;
+}
+
+// MoE layer with the token permutation fused into the GEMM: the activations stay in token order,
+// each expert gathers its routed tokens and the top-k expert outputs are weighted and accumulated
+// straight into the token-ordered output. With iterations > 0 the fused kernel is also timed
+// against the unfused permute + grouped GEMM + unpermute path.
+bool fused_topk_launcher(int num_tokens, int top_k, int N, int K,
+                         int num_experts, bool verify = true,
+                         int iterations = 0) {
+  using MMA = decltype(choose_tiled_mma(static_cast<bfloat16_t *>(nullptr),
+                                        static_cast<bfloat16_t *>(nullptr)));
+  using MoEKernel =
+      cutlass::gemm::kernel::XeMoEGemmGatherScatter<MMA, bfloat16_t,
+                                                    bfloat16_t, float>;
+
+  // Random top-k routing, then sort the (token, expert) pairs by expert
+  std::mt19937 gen(2025);
+  std::uniform_int_distribution<int> expert_dist(0, num_experts - 1);
+  std::uniform_real_distribution<float> weight_dist(0.f, 1.f);
+  std::vector<std::vector<std::pair<int, float>>> routed(num_experts);
+  for (int t = 0; t < num_tokens; ++t) {
+    std::vector<int> experts;
+    while (int(experts.size()) < top_k) {
+      int e = expert_dist(gen);
+      if (std::find(experts.begin(), experts.end(), e) == experts.end()) {
+        experts.push_back(e);
+      }
+    }
+    for (int e : experts) {
+      routed[e].push_back({t, weight_dist(gen)});
+    }
+  }
+  std::vector<int32_t> num_rows_per_expert_host(num_experts);
+  std::vector<int32_t> gather_idx_host;
+  std::vector<float> topk_weights_host;
+  for (int e = 0; e < num_experts; ++e) {
+    num_rows_per_expert_host[e] = routed[e].size();
+    for (auto [t, w] : routed[e]) {
+      gather_idx_host.push_back(t);
+      topk_weights_host.push_back(w);
+    }
+  }
+
+  cutlass::DeviceAllocation<bfloat16_t> A_device(size_t(num_tokens) * K);
+  cutlass::DeviceAllocation<bfloat16_t> B_device(size_t(num_experts) * K * N);
+  // The host reference needs host copies of the operands; timing-only runs fill them on the device
+  std::vector<bfloat16_t> A_host;
+  std::vector<bfloat16_t> B_host;
+  if (verify) {
+    A_host.resize(A_device.size());
+    B_host.resize(B_device.size());
+    std::uniform_real_distribution<float> data_dist(-1.f, 1.f);
+    for (auto &a : A_host) {
+      a = bfloat16_t(data_dist(gen));
+    }
+    for (auto &b : B_host) {
+      b = bfloat16_t(data_dist(gen));
+    }
+    A_device.copy_from_host(A_host.data());
+    B_device.copy_from_host(B_host.data());
+  } else {
+    initialize_block(A_device, 2025);
+    initialize_block(B_device, 2026);
+  }
+  cutlass::DeviceAllocation<float> D_device(size_t(num_tokens) * N);
+  cutlass::DeviceAllocation<int32_t> num_rows_per_expert_device(num_experts);
+  cutlass::DeviceAllocation<int32_t> gather_idx_device(gather_idx_host.size());
+  cutlass::DeviceAllocation<float> topk_weights_device(
+      topk_weights_host.size());
+  num_rows_per_expert_device.copy_from_host(num_rows_per_expert_host.data());
+  gather_idx_device.copy_from_host(gather_idx_host.data());
+  topk_weights_device.copy_from_host(topk_weights_host.data());
+  compat::memset(D_device.get(), 0, D_device.size() * sizeof(float));
+
+  cutlass::KernelHardwareInfo hw_info{
+      0, cutlass::KernelHardwareInfo::query_device_multiprocessor_count(0)};
+  typename MoEKernel::Arguments arguments{A_device.get(),
+                                          B_device.get(),
+                                          D_device.get(),
+                                          num_rows_per_expert_device.get(),
+                                          gather_idx_device.get(),
+                                          topk_weights_device.get(),
+                                          num_experts,
+                                          N,
+                                          K,
+                                          hw_info};
+  if (!MoEKernel::can_implement(arguments)) {
+    std::cout << "Invalid problem size for the fused top-k MoE GEMM"
+              << std::endl;
+    return false;
+  }
+  auto params = MoEKernel::to_underlying_arguments(arguments, nullptr);
+
+  dim3 const block = MoEKernel::get_block_shape();
+  dim3 const grid = MoEKernel::get_grid_shape(params);
+  compat::dim3 sycl_grid(grid.x, grid.y, grid.z);
+  compat::dim3 sycl_block(block.x, block.y, block.z);
+
+  namespace syclex = sycl::ext::oneapi::experimental;
+  namespace intelex = sycl::ext::intel::experimental;
+
+  compat::experimental::launch_properties launch_props{
+      syclex::work_group_scratch_size(MoEKernel::SharedStorageSize),
+  };
+  compat::experimental::kernel_properties kernel_props{
+      syclex::sub_group_size<MoEKernel::SubgroupSize>, intelex::grf_size<256>};
+  compat::experimental::launch_policy policy{sycl_grid, sycl_block,
+                                             launch_props, kernel_props};
+  auto event =
+      compat::experimental::launch<cutlass::device_kernel<MoEKernel>,
+                                   MoEKernel>(policy, params);
+  EventManager::getInstance().addEvent(event);
+  compat::wait();
+
+  std::cout << "\n\n Fused top-" << top_k << " MoE GEMM (" << num_tokens
+            << " tokens, " << num_experts << " experts, N=" << N
+            << ", K=" << K << ")" << std::endl;
+
+  bool passed = true;
+  if (verify) {
+    passed = verify_fused_topk(A_host, B_host, D_device, num_rows_per_expert_host,
+                               gather_idx_host, topk_weights_host, num_tokens,
+                               N, K, num_experts);
+    std::cout << "  Verification : " << (passed ? "Passed" : "Failed")
+              << std::endl;
+  }
+
+  if (iterations > 0) {
+    // The fused kernel accumulates into D, so zeroing it is part of its cost
+    GPU_Clock timer;
+    double fused_ms = 0;
+    for (int i = 0; i < iterations; ++i) {
+      timer.start();
+      compat::memset(D_device.get(), 0, D_device.size() * sizeof(float));
+      event = compat::experimental::launch<cutlass::device_kernel<MoEKernel>,
+                                           MoEKernel>(policy, params);
+      EventManager::getInstance().addEvent(event);
+      compat::wait();
+      fused_ms += timer.milliseconds();
+    }
+    fused_ms /= iterations;
+
+    cutlass::DeviceAllocation<float> D_unfused_device(D_device.size());
+    auto [permute_ms, gemm_ms, unpermute_ms] = time_unfused_topk(
+        A_device.get(), B_device.get(), D_unfused_device.get(),
+        num_rows_per_expert_device.get(), gather_idx_device.get(),
+        topk_weights_device.get(), gather_idx_host, num_tokens, top_k, N, K,
+        num_experts, iterations);
+    std::cout << "  Fused gather/scatter       : " << fused_ms << " ms"
+              << std::endl;
+    std::cout << "  Permute + GEMM + unpermute : "
+              << permute_ms + gemm_ms + unpermute_ms << " ms (" << permute_ms
+              << " + " << gemm_ms << " + " << unpermute_ms << ")"
+              << std::endl;
+  }
+  return passed;
+}
+
 int main(int argc, const char **argv) {
   constexpr int num_experts = 32;
   constexpr int num_layers = 24;
 
+  if (!fused_topk_launcher(256, 2, 512, 256, num_experts)) {
+    return -1;
+  }
+  fused_topk_launcher(4096, 2, 2880, 2880, num_experts, false, 10);
+  fused_topk_launcher(4096, 4, 5760, 2880, num_experts, false, 10);
+
   int total_rows_for_each_expert[num_layers][num_experts] = {
       {148, 231, 404, 180, 127, 244, 224, 244, 110, 617, 289,
        845, 191, 424, 30,  97,  57,  324, 62,  77,  75,  144,
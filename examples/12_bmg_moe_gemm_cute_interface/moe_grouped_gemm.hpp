@@ -36,10 +36,10 @@
 #include "cutlass/gemm/gemm.h"
 #include "cutlass/gemm/group_array_problem_shape.hpp"
 #include "cutlass/gemm/kernel/tile_scheduler.hpp"
+#include "cutlass/gemm/kernel/xe_tile_scheduler_moe.hpp"
 #include "cutlass/kernel_hardware_info.hpp"
 #include "cutlass/platform/platform.h"
 #include "moe_gemms.hpp"
-#include "moe_tile_scheduler.hpp"
 #include <cute/util/compat.hpp>
 
 #pragma clang diagnostic ignored "-Wpass-failed"
@@ -50,7 +50,8 @@ using namespace cute;
 
 using ProblemShapeMNKL = Shape<int, int, int, int>;
 using ProblemShape = cutlass::gemm::GroupProblemShape<Shape<int, int, int>>;
-using TileScheduler = typename MoE::PersistentTileSchedulerXeMoE<ProblemShape>;
+using TileScheduler =
+    cutlass::gemm::kernel::detail::PersistentTileSchedulerXeMoE<ProblemShape>;
 using RasterOrderOptions = typename TileScheduler::RasterOrderOptions;
 
 template <typename T, char LayoutKind>
@@ -73,10 +74,9 @@ MoEGEMM(const ElementA *Activations, const ElementB *Weights,
         const ElementS *Scales, ElementD *Outputs, TiledMMA const &mma,
         const int32_t *M_per_group, const int32_t num_experts, const int32_t N,
         const int32_t K,
-        PersistentTileSchedulerSm90GroupParams<ProblemShape> scheduler_params) {
+        typename TileScheduler::Params scheduler_params) {
 
-  TileScheduler scheduler{scheduler_params, const_cast<int32_t *>(M_per_group),
-                          N, K, num_experts};
+  TileScheduler scheduler{scheduler_params, M_per_group, N, K, num_experts};
 
   auto work_tile_info = scheduler.initial_work_tile_info(Shape<_1, _1, _1>{});
   constexpr char actual_layout_of_B = LayoutKindB ^ ('R' ^ 'C');
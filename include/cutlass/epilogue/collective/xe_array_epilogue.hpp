@@ -201,29 +201,34 @@ public:
     bool implementable = true;
     bool fusion_implementable = true;
 
-    for (int i = 0; i < problem_shape.groups(); ++i) {
-      auto problem_shape_MNKL = append<4>(problem_shape.get_host_problem_shape(i), 1);
-      auto [M,N,K,L] = problem_shape_MNKL;
+    if (problem_shape.is_host_problem_shape_available()) {
+      for (int i = 0; i < problem_shape.groups(); ++i) {
+        auto problem_shape_MNKL = append<4>(problem_shape.get_host_problem_shape(i), 1);
+        auto [M,N,K,L] = problem_shape_MNKL;
 
-      if constexpr (is_destination_supported) {
-        constexpr int min_aligned_elements_D = copy_alignment_bits / sizeof_bits<ElementD>::value;
-        implementable &= cutlass::detail::check_alignment<min_aligned_elements_D>(cute::make_shape(M,N,L), InternalStrideD{});
-        if (L > 1) {
-          constexpr int min_batch_aligned_elements_D = batch_alignment_bits / sizeof_bits<ElementD>::value;
-          implementable &= get<2>(InternalStrideD{}) % min_batch_aligned_elements_D == 0;
+        if constexpr (is_destination_supported) {
+          constexpr int min_aligned_elements_D = copy_alignment_bits / sizeof_bits<ElementD>::value;
+          implementable &= cutlass::detail::check_alignment<min_aligned_elements_D>(cute::make_shape(M,N,L), InternalStrideD{});
+          if (L > 1) {
+            constexpr int min_batch_aligned_elements_D = batch_alignment_bits / sizeof_bits<ElementD>::value;
+            implementable &= get<2>(InternalStrideD{}) % min_batch_aligned_elements_D == 0;
+          }
         }
-      }
 
-      if constexpr (is_source_supported) {
-        constexpr int min_aligned_elements_C = copy_alignment_bits / sizeof_bits<ElementC>::value;
-        implementable &= cutlass::detail::check_alignment<min_aligned_elements_C>(cute::make_shape(M,N,L), InternalStrideC{});
-        if (L > 1) {
-          constexpr int min_batch_aligned_elements_C = batch_alignment_bits / sizeof_bits<ElementC>::value;
-          implementable &= get<2>(InternalStrideC{}) % min_batch_aligned_elements_C == 0;
+        if constexpr (is_source_supported) {
+          constexpr int min_aligned_elements_C = copy_alignment_bits / sizeof_bits<ElementC>::value;
+          implementable &= cutlass::detail::check_alignment<min_aligned_elements_C>(cute::make_shape(M,N,L), InternalStrideC{});
+          if (L > 1) {
+            constexpr int min_batch_aligned_elements_C = batch_alignment_bits / sizeof_bits<ElementC>::value;
+            implementable &= get<2>(InternalStrideC{}) % min_batch_aligned_elements_C == 0;
+          }
         }
-      }
 
-      fusion_implementable = fusion_implementable && FusionCallbacks::can_implement(problem_shape_MNKL, args.thread);
+        fusion_implementable = fusion_implementable && FusionCallbacks::can_implement(problem_shape_MNKL, args.thread);
+      }
+    }
+    else {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Ignoring check to can implement because host problem shape is not available.\n");
     }
 
     if (!implementable) {
@@ -403,6 +403,29 @@ struct ScaledLinCombPerColBiasEltAct
   static constexpr bool IsScaleFactorSupported = true;
 };
 
+// Z = scale_a * scale_b * alpha * acc + scale_c * beta * C
+// amax_d = max(abs(elements in activation(Z)))
+// if D is fp8
+//   D = scale_d * activation(Z)
+// else
+//   D = activation(Z)
+template<
+  template <class> class ActivationFn_,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementAmax_ = ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct ScaledLinCombEltActAmax
+    : LinCombEltAct<ActivationFn_, ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  static constexpr bool IsScaleFactorSupported = true;
+
+  using ElementAmax = ElementAmax_;
+  static constexpr bool IsAbsMaxSupported = true;
+};
+
 // Z = scale_a * scale_b * alpha * acc + scale_c * beta * C + per-row bias
 // if D is fp8 
 //   amax_d = max(abs(elements in activation(Z)))
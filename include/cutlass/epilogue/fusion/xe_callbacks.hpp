@@ -763,6 +763,129 @@ struct FusionCallbacks<
   using Impl::Impl;
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Z = scale_a * scale_b * alpha * acc + scale_c * beta * C
+// amax_d = max(abs(elements in activation(Z)))
+// if D is fp8
+//   D = scale_d * activation(Z)
+// else
+//   D = activation(Z)
+template<
+  template <class> class ActivationFn,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementAmax = ElementCompute,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using XeScaledLinCombEltActAmax =
+  Sm90EVT<Sm90Compute<detail::ScaleOutOp<ElementOutput>::template Op, ElementOutput, ElementCompute, RoundStyle>, // activation(Z) * scale_d
+    Sm90EVT<XeScalarReduction<detail::amax, maximum_with_nan_propagation, atomic_maximum, ElementAmax, ElementCompute, RoundStyle>, // amax_d
+      Sm90EVT<Sm90Compute<ActivationFn, ElementCompute, ElementCompute, RoundStyle>, // activation(Z)
+        Sm90EVT<Sm90Compute<homogeneous_multiply_add, ElementCompute, ElementCompute, RoundStyle>, // (scale_c * beta) * C + (scale_a * scale_b * alpha) * acc
+          Sm90ScalarBroadcast<ElementScalar, Stride<_0,_0,int64_t>, 2>, // scale_c * beta
+          Sm90SrcFetch<ElementSource>, // C
+          Sm90EVT<Sm90Compute<multiplies, ElementCompute, ElementCompute, RoundStyle>, // (scale_a * scale_b * alpha) * acc
+            Sm90ScalarBroadcast<ElementScalar, Stride<_0,_0,int64_t>, 3>, // scale_a * scale_b * alpha
+            Sm90AccFetch // acc
+          >
+        >
+      >
+    >,
+    Sm90ScalarBroadcast<ElementScalar> // scale_d
+  >;
+
+template <
+  template <class> class ActivationFn_,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementAmax_,
+  class ElementSource_,
+  class ElementScalar_,
+  FloatRoundStyle RoundStyle_,
+  class CtaTileShapeMNK_,
+  class EpilogueTile_
+>
+struct FusionCallbacks<
+    epilogue::IntelXeGeneric,
+    fusion::ScaledLinCombEltActAmax<ActivationFn_, ElementOutput_, ElementCompute_, ElementAmax_, ElementSource_, ElementScalar_, RoundStyle_>,
+    CtaTileShapeMNK_,
+    EpilogueTile_
+> : XeScaledLinCombEltActAmax<ActivationFn_, typename cutlass::detail::get_unpacked_element_type<ElementOutput_>::type, ElementCompute_, ElementAmax_, ElementSource_, ElementScalar_, RoundStyle_> {
+
+  using Impl = XeScaledLinCombEltActAmax<ActivationFn_, typename cutlass::detail::get_unpacked_element_type<ElementOutput_>::type, ElementCompute_, ElementAmax_, ElementSource_, ElementScalar_, RoundStyle_>;
+  using ElementOutput = ElementOutput_;
+  using ElementCompute = ElementCompute_;
+  using ElementAmax = ElementAmax_;
+  using ElementSource = ElementSource_;
+  using ElementScalar = ElementScalar_;
+  using Operation = fusion::ScaledLinCombEltActAmax<ActivationFn_, ElementOutput_, ElementCompute_, ElementAmax_, ElementSource_, ElementScalar_, RoundStyle_>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    ElementScalar scale_a = ElementScalar(1);
+    ElementScalar scale_b = ElementScalar(1);
+    ElementScalar scale_c = ElementScalar(1);
+    ElementScalar scale_d = ElementScalar(1);
+    ElementScalar const* scale_a_ptr = nullptr;
+    ElementScalar const* scale_b_ptr = nullptr;
+    ElementScalar const* scale_c_ptr = nullptr;
+    ElementScalar const* scale_d_ptr = nullptr;
+
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
+    StrideAlpha dAlpha = {_0{}, _0{}, 0};
+    StrideBeta  dBeta  = {_0{}, _0{}, 0};
+
+    using ActivationArguments = typename Sm90Compute<ActivationFn_, ElementCompute_, ElementCompute_, RoundStyle_>::Arguments;
+    ActivationArguments activation = ActivationArguments();
+
+    // Reset to zero by initialize_workspace, nullptr skips the reduction
+    ElementAmax* amax_D_ptr = nullptr;
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // binary op : activation(Z) * scale_d or activation(Z)
+          {    // unary op : reduce(activation(Z))
+            {    // unary op : activation(Z)
+              {    // ternary op : (scale_c * beta) * C + (scale_a * scale_b * alpha) * acc
+                {{beta, scale_c},
+                 {beta_ptr, scale_c_ptr},
+                 {dBeta, {_0{}, _0{}, 0}}
+                },   // leaf args : (scale_c * beta)
+                {},  // leaf args : C
+                {    // binary op : (scale_a * scale_b * alpha) * acc
+                  {{alpha, scale_a, scale_b},
+                   {alpha_ptr, scale_a_ptr, scale_b_ptr},
+                   {dAlpha, {_0{}, _0{}, 0}, {_0{}, _0{}, 0}}
+                  },   // leaf args : (scale_a * scale_b * alpha)
+                  {},  // leaf args : acc
+                  {}   // binary args : multiplies
+                },   // end binary op
+                {}   // ternary args : multiply_add
+              },   // end ternary op
+              activation // unary args : activation
+            },   // end unary op
+            {amax_D_ptr} // unary args : reduce
+          },   // end unary op
+          {{scale_d},
+           {scale_d_ptr}
+          },   // leaf args : scale_d
+          {}   // binary args : multiplies or first
+        };   // end binary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////
 // D = alpha * acc + beta * C, where beta and alpha can be vectors for each batch
 template <
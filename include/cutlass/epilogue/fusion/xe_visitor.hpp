@@ -48,6 +48,33 @@
 
 namespace cutlass::epilogue::fusion {
 
+namespace detail {
+
+// Partition an (M,N) tensor the same way the IntelXeGeneric epilogue tiles its accumulators, so that
+// element i of the epi_v-th fragment visited in epilogue tile (epi_m,epi_n) is
+// tCgX(epi_v * FragmentSize + i, epi_m, epi_n).
+template <class Engine, class LayoutMN, class TileShapeMNK, class TileCoordMNKL, class TiledMma, class EpilogueTile>
+CUTLASS_DEVICE auto
+xe_partition_for_epilogue(
+    Tensor<Engine, LayoutMN> mX,                                                       // (M,N)
+    TileShapeMNK tile_shape_mnk,
+    TileCoordMNKL tile_coord_mnkl,
+    TiledMma const& tiled_mma,
+    EpilogueTile epi_tile,
+    int thread_idx) {
+  using MMATile = decltype(take<0,2>(typename TiledMma::AtomShape_MNK{}));
+
+  Tensor gX = local_tile(mX, take<0,2>(tile_shape_mnk), take<0,2>(tile_coord_mnkl)); // (m_in_wg_tile,n_in_wg_tile)
+  Tensor tCgX = tiled_mma.get_slice(thread_idx).partition_C(gX);                    // (mma_v,mma_m,mma_n)
+
+  auto mma_per_epi = shape_div(epi_tile, MMATile{});
+  auto tCgX_epi_layout = group<0,3>(prepend(flat_divide(remove<0>(tCgX.layout()), mma_per_epi),
+                                            get<0>(tCgX.layout())));
+  return make_tensor(tCgX.data(), tCgX_epi_layout);                                 // ((mma_v,mma_m,mma_n),epi_m,epi_n)
+}
+
+} // namespace detail
+
 template <
   class Element,
   class StrideMNL,
@@ -434,4 +461,863 @@ struct XeRowBroadcast {
     return ConsumerStoreCallbacks(tCgRow, tCrRow, args.tCcD, args.residue_tCcD, params);
   }
 };
+
+// Column vector broadcast
+template<
+  int Stages,
+  class CtaTileShapeMNK,
+  class ElementInput_,
+  class ElementCompute = cute::remove_pointer_t<ElementInput_>,
+  class StrideMNL_ = Stride<_1,_0,_0>,
+  int Alignment = 128 / sizeof_bits_v<cute::remove_pointer_t<ElementInput_>>,
+  bool EnableNullptr = true // Fallback scalar broadcast for nullptr params
+>
+struct XeColBroadcast {
+  using StrideMNL = StrideMNL_;
+  // Get base element input type.
+  using ElementInput = cute::remove_pointer_t<ElementInput_>;
+  // Check if input is an array of pointers.
+  static constexpr bool IsArrayOfPointers = is_same_v<ElementInput*, ElementInput_>;
+  using PtrColType = cute::conditional_t<IsArrayOfPointers, ElementInput const* const*, ElementInput const*>;
+
+  static_assert(Stages == 0, "Column broadcast doesn't support smem pipelining");
+
+  static constexpr bool IsDynamicBroadcast = is_same_v<remove_cvref_t<decltype(get<0>(StrideMNL{}))>, bool>; // column vector or scalar broadcast
+  static_assert(is_static_v<decltype(take<0,2>(StrideMNL{}))> || IsDynamicBroadcast, "XeColBroadcast requires static MN stride for non-dynamic broadcast case."); // batch stride can be dynamic or static
+  static_assert(take<0,2>(StrideMNL{}) == Stride<_1,_0>{} || IsDynamicBroadcast, "XeColBroadcast requires MN stride=(1,0) for non-dynamic broadcast case.");
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    PtrColType ptr_col = nullptr;
+    ElementInput null_default = ElementInput(0);
+    StrideMNL dCol = {};
+  };
+
+  struct Params {
+    PtrColType ptr_col = nullptr;
+    ElementCompute null_default = ElementCompute(0);
+    StrideMNL dCol = {};
+  };
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return {args.ptr_col, ElementCompute(args.null_default), args.dCol};
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+  CUTLASS_HOST_DEVICE
+  XeColBroadcast() { }
+
+  CUTLASS_HOST_DEVICE
+  XeColBroadcast(Params const& params, SharedStorage const& shared_storage)
+      : params(params), is_zero_(false) {
+    auto const& [stride_M, stride_N, stride_L] = params.dCol;
+    // Nullptr default
+    if (EnableNullptr && params.ptr_col == nullptr) {
+      is_zero_ = params.null_default == ElementCompute(0);
+    }
+    // Dynamic non-batched scalar broadcast
+    else if (IsDynamicBroadcast && stride_M == bool(0) && stride_L == repeat_like(stride_L, 0)) {
+       if constexpr (!IsArrayOfPointers) {
+         is_zero_ = params.ptr_col[0] == ElementInput(0);
+       }
+    }
+  }
+
+  Params params;
+  bool is_zero_ = false;
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_zero() const {
+    return is_zero_;
+  }
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class GTensor, class RTensor, class CTensor, class ProblemShapeMN>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(GTensor tCgCol_, RTensor tCrCol_, CTensor tCcCol_, ProblemShapeMN problem_shape_mn_, Params const& params_)
+      : tCgCol(tCgCol_),
+        tCrCol(tCrCol_),
+        tCcCol(tCcCol_),
+        problem_shape_mn(problem_shape_mn_),
+        params(params_) {
+      if (EnableNullptr && params.ptr_col == nullptr) {
+        fill(tCrCol, params.null_default);
+      }
+    }
+
+    GTensor tCgCol;                                                                    // ((MMA_V,MMA_M,MMA_N),EPI_M,EPI_N)
+    RTensor tCrCol;                                                                    // ((MMA_V,MMA_M,MMA_N),EPI_M,EPI_N)
+    CTensor tCcCol;                                                                    // ((MMA_V,MMA_M,MMA_N),EPI_M,EPI_N)
+    ProblemShapeMN problem_shape_mn;
+    Params const& params;
+
+    CUTLASS_DEVICE void
+    begin() {
+      if (EnableNullptr && params.ptr_col == nullptr) {
+        return;
+      }
+
+      // Filter so we don't issue redundant loads over stride-0 modes
+      // (only works if 0-strides are in same location, which is by construction)
+      Tensor tCgCol_flt = filter_zeros(tCgCol);
+      Tensor tCrCol_flt = filter_zeros(tCrCol);
+      Tensor tCcCol_flt = filter_zeros(tCcCol, tCgCol.stride());
+
+      NumericConverter<ElementCompute, ElementInput> convert_input{};
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(tCrCol_flt); ++i) {
+        if (get<0>(tCcCol_flt(i)) < get<0>(problem_shape_mn)) {
+          tCrCol_flt(i) = convert_input(tCgCol_flt(i));
+        }
+      }
+    }
+
+    template <typename ElementAccumulator, int FragmentSize>
+    CUTLASS_DEVICE Array<ElementCompute, FragmentSize>
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n) {
+      Array<ElementCompute, FragmentSize> frg_col;
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        frg_col[i] = tCrCol(epi_v * FragmentSize + i, epi_m, epi_n);
+      }
+
+      return frg_col;
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+
+    auto layout_M = [&] () CUTLASS_LAMBDA_FUNC_INLINE {
+      if constexpr (IsDynamicBroadcast) {
+        auto stride_M = repeat_like(M, int(0));
+        if (get<0>(params.dCol) == bool(1)) {
+          stride_M = transform_leaf(compact_major<LayoutLeft>(M),
+            [] (auto const& stride) { return static_cast<int>(stride); }
+          );
+        }
+        return make_layout(M, stride_M);
+      }
+      else {
+        return make_layout(M);
+      }
+    }();
+
+    auto layout_N = make_layout(N, repeat_like(N, _0{}));
+    auto layout_L = make_layout(L, get<2>(params.dCol));
+    ElementInput const* ptr_col;
+    if constexpr(IsArrayOfPointers) {
+      ptr_col = params.ptr_col[l];
+    } else {
+      ptr_col = params.ptr_col;
+    }
+
+    Tensor mCol = make_tensor(make_gmem_ptr(ptr_col), make_layout(layout_M,layout_N,layout_L));
+    Tensor tCgCol = detail::xe_partition_for_epilogue(                                 // ((MMA_V,MMA_M,MMA_N),EPI_M,EPI_N)
+      mCol(_,_,l), args.tile_shape_mnk, args.tile_coord_mnkl, args.tiled_mma, args.epi_tile, args.thread_idx);
+    Tensor tCcCol = detail::xe_partition_for_epilogue(                                 // ((MMA_V,MMA_M,MMA_N),EPI_M,EPI_N)
+      make_identity_tensor(make_shape(M,N)), args.tile_shape_mnk, args.tile_coord_mnkl, args.tiled_mma, args.epi_tile, args.thread_idx);
+
+    Tensor mCol_static = make_tensor(make_gmem_ptr(ptr_col), make_layout(make_layout(M),layout_N,layout_L));
+    Tensor tCgCol_static = detail::xe_partition_for_epilogue(
+      mCol_static(_,_,l), args.tile_shape_mnk, args.tile_coord_mnkl, args.tiled_mma, args.epi_tile, args.thread_idx);
+    Tensor tCrCol = make_tensor_like<ElementCompute>(tCgCol_static);                   // ((MMA_V,MMA_M,MMA_N),EPI_M,EPI_N)
+
+    return ConsumerStoreCallbacks(tCgCol, tCrCol, tCcCol, make_shape(M,N), params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Elementwise Store Operations
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Stores the visited fragment to a second (M,N,L) output and forwards it unchanged, e.g. to keep
+// the pre-activation tensor for the backward pass.
+template <
+  class Element,
+  class StrideMNL,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest,
+  bool EnableNullptr = true // Noop on nullptr params
+>
+struct XeAuxStore {
+  using ElementAux = Element;
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    Element* ptr_aux = nullptr;
+    StrideMNL dAux = {};
+  };
+
+  struct Params {
+    Element* ptr_aux = nullptr;
+    StrideMNL dAux = {};
+    bool is_nullptr = false;
+  };
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    bool is_nullptr = false;
+    if constexpr (EnableNullptr) {
+      is_nullptr = args.ptr_aux == nullptr;
+    }
+
+    return {args.ptr_aux, args.dAux, is_nullptr};
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+  CUTLASS_HOST_DEVICE
+  XeAuxStore() { }
+
+  CUTLASS_HOST_DEVICE
+  XeAuxStore(Params const& params, SharedStorage const&) : params_ptr(&params) { }
+
+  Params const* params_ptr;
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template <class GTensor, class CTensor, class ProblemShapeMN>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(GTensor tCgAux, CTensor tCcAux, ProblemShapeMN problem_shape_mn, Params const* params_ptr)
+      : tCgAux(tCgAux), tCcAux(tCcAux), problem_shape_mn(problem_shape_mn), params_ptr(params_ptr) { }
+
+    GTensor tCgAux;                                                                    // ((MMA_V,MMA_M,MMA_N),EPI_M,EPI_N)
+    CTensor tCcAux;                                                                    // ((MMA_V,MMA_M,MMA_N),EPI_M,EPI_N)
+    ProblemShapeMN problem_shape_mn;
+    Params const* params_ptr;
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      if (EnableNullptr && params_ptr->is_nullptr) {
+        return frg_input;
+      }
+
+      using ConvertInput = NumericArrayConverter<Element, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+      Array<Element, FragmentSize> frg_aux = convert_input(frg_input);
+
+      // Work-items of a subgroup hold consecutive columns, so row-major stores coalesce across the subgroup
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        int idx = epi_v * FragmentSize + i;
+        if (elem_less(tCcAux(idx, epi_m, epi_n), problem_shape_mn)) {
+          tCgAux(idx, epi_m, epi_n) = frg_aux[i];
+        }
+      }
+
+      return frg_input;
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+
+    Tensor mAux = make_tensor(make_gmem_ptr(params_ptr->ptr_aux), make_layout(make_shape(M,N,L), params_ptr->dAux)); // (M,N,L)
+    Tensor tCgAux = detail::xe_partition_for_epilogue(                                 // ((MMA_V,MMA_M,MMA_N),EPI_M,EPI_N)
+      mAux(_,_,l), args.tile_shape_mnk, args.tile_coord_mnkl, args.tiled_mma, args.epi_tile, args.thread_idx);
+    Tensor tCcAux = detail::xe_partition_for_epilogue(                                 // ((MMA_V,MMA_M,MMA_N),EPI_M,EPI_N)
+      make_identity_tensor(make_shape(M,N)), args.tile_shape_mnk, args.tile_coord_mnkl, args.tiled_mma, args.epi_tile, args.thread_idx);
+
+    return ConsumerStoreCallbacks(tCgAux, tCcAux, make_shape(M,N), params_ptr);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Reduction Store Operations
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// Shared implementation of the Xe row and column vector reductions. StrideMNL has a 0-stride in the
+// reduced mode, so the register fragment built from the partitioned output vector already folds every
+// element a work-item owns along that mode into one slot. Partials are accumulated there across all
+// epilogue tiles and flushed once per tile with GmemReduceFn, which must be atomic.
+template <
+  int ReduceMode, // 0: reduce along M (row vector), 1: reduce along N (column vector)
+  template <class> class RegReduceFn,
+  template <class> class GmemReduceFn,
+  class ElementOutput,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle,
+  class StrideMNL,
+  bool EnableNullptr,
+  bool VisitCheckOOB
+>
+struct XeVectorReduction {
+  static constexpr bool IsAtomic = is_atomic<GmemReduceFn<ElementOutput>>::value;
+  static_assert(IsAtomic, "non-atomic vector reduction not supported yet");
+  static_assert(is_static_v<decltype(take<0,2>(StrideMNL{}))>); // batch stride can be dynamic or static
+  static_assert(get<ReduceMode>(StrideMNL{}) == _0{});
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    void* ptr = nullptr; // ElementOutput*
+    ElementCompute reduction_identity = ElementCompute(0);
+    StrideMNL dVec = {};
+  };
+
+  struct Params {
+    ElementOutput* ptr = nullptr;
+    ElementCompute reduction_identity = ElementCompute(0);
+    StrideMNL dVec = {};
+  };
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return {reinterpret_cast<ElementOutput*>(args.ptr), args.reduction_identity, args.dVec};
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  // Atomic reduction accumulates into the output, so it has to start from the reduction identity
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    if (args.ptr == nullptr) {
+      return Status::kSuccess;
+    }
+    auto problem_shape_mnkl = append<4>(problem_shape, 1);
+    auto [M, N, K, L] = problem_shape_mnkl;
+    Layout mVec_layout = make_layout(make_shape(size<>(M),size<>(N),size<>(L)), args.dVec);
+    return fill_workspace(args.ptr, ElementOutput(args.reduction_identity), cosize(mVec_layout), stream, cuda_adapter);
+  }
+
+  template<class GTensor, class RTensor, class CTensor, class ProblemShapeMN>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(GTensor tCgVec, RTensor tCrVec, CTensor tCcVec, ProblemShapeMN problem_shape_mn, Params const& params)
+      : tCgVec(tCgVec), tCrVec(tCrVec), tCcVec(tCcVec), problem_shape_mn(problem_shape_mn), params(params) { }
+
+    GTensor tCgVec;                                                                    // ((MMA_V,MMA_M,MMA_N),EPI_M,EPI_N)
+    RTensor tCrVec;                                                                    // ((MMA_V,MMA_M,MMA_N),EPI_M,EPI_N)
+    CTensor tCcVec;                                                                    // ((MMA_V,MMA_M,MMA_N),EPI_M,EPI_N)
+    ProblemShapeMN problem_shape_mn;
+    Params const& params;
+
+    CUTLASS_DEVICE void
+    begin() {
+      fill(tCrVec, params.reduction_identity);
+    }
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      if (EnableNullptr && params.ptr == nullptr) {
+        return frg_input;
+      }
+
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+      Array<ElementCompute, FragmentSize> frg_I = convert_input(frg_input);
+
+      RegReduceFn<ElementCompute> reduce_input{};
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        int idx = epi_v * FragmentSize + i;
+        if (!VisitCheckOOB || elem_less(tCcVec(idx, epi_m, epi_n), problem_shape_mn)) {
+          tCrVec(idx, epi_m, epi_n) = reduce_input(tCrVec(idx, epi_m, epi_n), frg_I[i]);
+        }
+      }
+
+      return frg_input;
+    }
+
+    CUTLASS_DEVICE void
+    end() {
+      if (EnableNullptr && params.ptr == nullptr) {
+        return;
+      }
+
+      // One atomic per distinct output element owned by this work-item
+      Tensor tCgVec_flt = filter_zeros(tCgVec);
+      Tensor tCrVec_flt = filter_zeros(tCrVec);
+      Tensor tCcVec_flt = filter_zeros(tCcVec, tCgVec.stride());
+
+      // NOTE: atomic reduction is performed in the output type
+      using ConvertOutput = NumericConverter<ElementOutput, ElementCompute, RoundStyle>;
+      using ReduceOutput = GmemReduceFn<ElementOutput>;
+      ConvertOutput convert_output{};
+      ReduceOutput reduce_output{};
+
+      constexpr int KeepMode = 1 - ReduceMode;
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(tCrVec_flt); ++i) {
+        if (get<KeepMode>(tCcVec_flt(i)) < get<KeepMode>(problem_shape_mn)) {
+          reduce_output(&tCgVec_flt(i), convert_output(tCrVec_flt(i)));
+        }
+      }
+    }
+  };
+
+  template <class CstArgs>
+  CUTLASS_DEVICE static auto
+  get_consumer_store_callbacks(CstArgs const& args, Params const& params) {
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+
+    Tensor mVec = make_tensor(make_gmem_ptr(params.ptr), make_layout(make_shape(M,N,L), params.dVec)); // (M,N,L)
+    Tensor tCgVec = xe_partition_for_epilogue(                                         // ((MMA_V,MMA_M,MMA_N),EPI_M,EPI_N)
+      mVec(_,_,l), args.tile_shape_mnk, args.tile_coord_mnkl, args.tiled_mma, args.epi_tile, args.thread_idx);
+    Tensor tCcVec = xe_partition_for_epilogue(                                         // ((MMA_V,MMA_M,MMA_N),EPI_M,EPI_N)
+      make_identity_tensor(make_shape(M,N)), args.tile_shape_mnk, args.tile_coord_mnkl, args.tiled_mma, args.epi_tile, args.thread_idx);
+    Tensor tCrVec = make_tensor_like<ElementCompute>(tCgVec);                          // ((MMA_V,MMA_M,MMA_N),EPI_M,EPI_N)
+
+    return ConsumerStoreCallbacks(tCgVec, tCrVec, tCcVec, make_shape(M,N), params);
+  }
+};
+
+} // namespace detail
+
+// Row vector reduction: reduces the visited tensor along M into an (N,L) vector, e.g. per-channel sums
+template <
+  template <class> class RegReduceFn,
+  template <class> class GmemReduceFn,
+  int Stages,
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle,
+  class StrideMNL = Stride<_0,_1,_0>,
+  bool EnableNullptr = true, // Noop on nullptr params
+  // False means skip OOB predication if OOB inputs are known to be the reduction identity
+  bool VisitCheckOOB = true
+>
+struct XeRowReduction {
+private:
+  static_assert(Stages == 0, "Smem usage not supported yet");
+  static_assert(take<0,2>(StrideMNL{}) == Stride<_0,_1>{});
+  using Impl = detail::XeVectorReduction<0, RegReduceFn, GmemReduceFn, ElementOutput, ElementCompute,
+                                         RoundStyle, StrideMNL, EnableNullptr, VisitCheckOOB>;
+
+public:
+  using SharedStorage = typename Impl::SharedStorage;
+
+  struct Arguments {
+    void* ptr_row = nullptr; // ElementOutput*
+    ElementCompute reduction_identity = ElementCompute(0);
+    StrideMNL dRow = {};
+  };
+
+  using Params = typename Impl::Params;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return Impl::to_underlying_arguments(problem_shape, {args.ptr_row, args.reduction_identity, args.dRow}, workspace);
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return Impl::get_workspace_size(problem_shape, {args.ptr_row, args.reduction_identity, args.dRow});
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Impl::initialize_workspace(problem_shape, {args.ptr_row, args.reduction_identity, args.dRow},
+                                      workspace, stream, cuda_adapter);
+  }
+
+  CUTLASS_HOST_DEVICE
+  XeRowReduction() { }
+
+  CUTLASS_HOST_DEVICE
+  XeRowReduction(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    return Impl::get_consumer_store_callbacks(args, params);
+  }
+};
+
+// Col vector reduction: reduces the visited tensor along N into an (M,L) vector, e.g. per-row statistics
+template <
+  template <class> class RegReduceFn,
+  template <class> class GmemReduceFn,
+  int Stages,
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle,
+  class StrideMNL = Stride<_1,_0,_0>,
+  bool EnableNullptr = true, // Noop on nullptr params
+  // False means skip OOB predication if OOB inputs are known to be the reduction identity
+  bool VisitCheckOOB = true
+>
+struct XeColReduction {
+private:
+  static_assert(Stages == 0, "Smem usage not supported yet");
+  static_assert(take<0,2>(StrideMNL{}) == Stride<_1,_0>{});
+  using Impl = detail::XeVectorReduction<1, RegReduceFn, GmemReduceFn, ElementOutput, ElementCompute,
+                                         RoundStyle, StrideMNL, EnableNullptr, VisitCheckOOB>;
+
+public:
+  using SharedStorage = typename Impl::SharedStorage;
+
+  struct Arguments {
+    void* ptr_col = nullptr; // ElementOutput*
+    ElementCompute reduction_identity = ElementCompute(0);
+    StrideMNL dCol = {};
+  };
+
+  using Params = typename Impl::Params;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return Impl::to_underlying_arguments(problem_shape, {args.ptr_col, args.reduction_identity, args.dCol}, workspace);
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return Impl::get_workspace_size(problem_shape, {args.ptr_col, args.reduction_identity, args.dCol});
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Impl::initialize_workspace(problem_shape, {args.ptr_col, args.reduction_identity, args.dCol},
+                                      workspace, stream, cuda_adapter);
+  }
+
+  CUTLASS_HOST_DEVICE
+  XeColReduction() { }
+
+  CUTLASS_HOST_DEVICE
+  XeColReduction(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    return Impl::get_consumer_store_callbacks(args, params);
+  }
+};
+
+// Scalar reduction: reduces the whole visited tensor into one value per batch, e.g. amax for fp8
+// scaling. Each work-item folds its elements with RegReduceFn, the subgroup combines the partials with
+// ShuffleReduceFn and a single work-item per subgroup flushes the result with the atomic GmemReduceFn,
+// so the number of global atomics is independent of the tile size.
+template <
+  template <class> class RegReduceFn,
+  template <class> class ShuffleReduceFn,
+  template <class> class GmemReduceFn,
+  class ElementOutput,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle,
+  class StrideMNL = Stride<_0,_0,_0>,
+  bool EnableNullptr = true // Noop on nullptr params
+>
+struct XeScalarReduction {
+private:
+  static_assert(is_static_v<decltype(take<0,2>(StrideMNL{}))>); // batch stride can be dynamic or static
+  static_assert(take<0,2>(StrideMNL{}) == Stride<_0,_0>{});
+  static constexpr bool IsAtomic = is_atomic<GmemReduceFn<ElementOutput>>::value;
+  static_assert(IsAtomic, "non-atomic scalar reduction not supported yet");
+
+public:
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementOutput* ptr_scalar = nullptr;
+    ElementCompute reduction_identity = ElementCompute(0);
+    StrideMNL dScalar = {};
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  // Atomic reduction accumulates into the output, so it has to start from the reduction identity
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    if (args.ptr_scalar == nullptr) {
+      return Status::kSuccess;
+    }
+    auto problem_shape_mnkl = append<4>(problem_shape, 1);
+    auto [M, N, K, L] = problem_shape_mnkl;
+    Layout mScalar_layout = make_layout(make_shape(size<>(M),size<>(N),size<>(L)), args.dScalar);
+    return fill_workspace(args.ptr_scalar, ElementOutput(args.reduction_identity), cosize(mScalar_layout), stream, cuda_adapter);
+  }
+
+  CUTLASS_HOST_DEVICE
+  XeScalarReduction() { }
+
+  CUTLASS_HOST_DEVICE
+  XeScalarReduction(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params const params;
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class CTensor, class ProblemShapeMN>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(int l_coord, CTensor tCcScalar, ProblemShapeMN problem_shape_mn, Params const& params)
+      : scalar(params.reduction_identity),
+        l_coord(l_coord),
+        tCcScalar(tCcScalar),
+        problem_shape_mn(problem_shape_mn),
+        params(params) { }
+
+    ElementCompute scalar;
+    int l_coord;
+    CTensor tCcScalar;                                                                 // ((MMA_V,MMA_M,MMA_N),EPI_M,EPI_N)
+    ProblemShapeMN problem_shape_mn;
+    Params const& params;
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      if (EnableNullptr && params.ptr_scalar == nullptr) {
+        return frg_input;
+      }
+
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+      Array<ElementCompute, FragmentSize> frg_I = convert_input(frg_input);
+
+      RegReduceFn<ElementCompute> reduce_input{};
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        if (elem_less(tCcScalar(epi_v * FragmentSize + i, epi_m, epi_n), problem_shape_mn)) {
+          scalar = reduce_input(scalar, frg_I[i]);
+        }
+      }
+
+      return frg_input;
+    }
+
+    CUTLASS_DEVICE void
+    end() {
+      if (EnableNullptr && params.ptr_scalar == nullptr) {
+        return;
+      }
+
+      // Butterfly over the subgroup, every work-item ends up with the subgroup result
+      auto sg = compat::get_nd_item<1>().get_sub_group();
+      ShuffleReduceFn<ElementCompute> reduce_shuffle{};
+      for (uint32_t mask = sg.get_local_linear_range() / 2; mask > 0; mask /= 2) {
+        scalar = reduce_shuffle(scalar, sycl::permute_group_by_xor(sg, scalar, mask));
+      }
+
+      if (sg.get_local_linear_id() == 0) {
+        // NOTE: atomic reduction is performed in the output type
+        NumericConverter<ElementOutput, ElementCompute, RoundStyle> convert_output{};
+        GmemReduceFn<ElementOutput> reduce_output{};
+
+        ElementOutput* ptr_scalar = params.ptr_scalar + l_coord * get<2>(params.dScalar);
+        reduce_output(ptr_scalar, convert_output(scalar));
+      }
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+
+    Tensor tCcScalar = detail::xe_partition_for_epilogue(                              // ((MMA_V,MMA_M,MMA_N),EPI_M,EPI_N)
+      make_identity_tensor(make_shape(M,N)), args.tile_shape_mnk, args.tile_coord_mnkl, args.tiled_mma, args.epi_tile, args.thread_idx);
+
+    return ConsumerStoreCallbacks(static_cast<int>(l), tCcScalar, make_shape(M,N), params);
+  }
+};
+
 } // namespace cutlass::epilogue::fusion
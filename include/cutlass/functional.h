@@ -950,7 +950,7 @@ template <typename T>
 struct atomic_maximum {
   CUTLASS_DEVICE
   T operator()(T *ptr, T value) const {
-#if defined(__CUDA_ARCH__)
+#if defined(__CUDA_ARCH__) || defined(__SYCL_DEVICE_ONLY__)
     return atomicMax(ptr, value);
 #else
     CUTLASS_UNUSED(ptr);
@@ -975,6 +975,11 @@ struct atomic_maximum<float> {
     return ! ::signbit(value) ?
       __int_as_float(atomicMax((int*)ptr, __float_as_int(value))) :
       __uint_as_float(atomicMin((unsigned int*)ptr, __float_as_uint(value)));
+#elif defined(__SYCL_DEVICE_ONLY__)
+    // Same integer ordering trick as above, which also keeps NaN propagation
+    return ! sycl::signbit(value) ?
+      sycl::bit_cast<float>(atomicMax(reinterpret_cast<int*>(ptr), sycl::bit_cast<int>(value))) :
+      sycl::bit_cast<float>(atomicMin(reinterpret_cast<unsigned int*>(ptr), sycl::bit_cast<unsigned int>(value)));
 #else
     CUTLASS_UNUSED(ptr);
     CUTLASS_UNUSED(value);
@@ -56,6 +56,8 @@ struct DynamicPersistentScheduler { };
 
 struct StaticPersistentScheduler { };
 
+struct SwizzleScheduler { }; // Only used for non-persistent Intel Xe GEMMs
+
 } // namespace cutlass::gemm
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -70,6 +72,7 @@ struct StaticPersistentScheduler { };
 #if defined (SYCL_INTEL_TARGET)
 #include "cutlass/gemm/kernel/xe_tile_scheduler_streamk.hpp"
 #include "cutlass/gemm/kernel/xe_tile_scheduler_group.hpp"
+#include "cutlass/gemm/kernel/xe_tile_scheduler_swizzle.hpp"
 #endif
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -223,6 +226,19 @@ struct TileSchedulerSelector<
   > {
   using Scheduler = PersistentTileSchedulerSm90;
 };
+
+template <
+  class TileShape,
+  class ClusterShape
+>
+struct TileSchedulerSelector<
+  SwizzleScheduler,
+  arch::IntelXe,
+  TileShape,
+  ClusterShape
+  > {
+  using Scheduler = SwizzledTileSchedulerXe;
+};
 #endif
 
 template <class TileShape, class ClusterShape, uint32_t SchedulerPipelineStageCount>
@@ -79,8 +79,10 @@ public:
   using ClusterShape = typename DispatchPolicy::ClusterShape;
   using MainloopParams = typename CollectiveMainloop::Params;
 
-  static_assert(cute::is_void_v<TileScheduler_> or cute::is_same_v<TileScheduler_, PersistentScheduler>,
-    "Intel Xe does not support specializing the tile scheduler.");
+  static_assert(cute::is_void_v<TileScheduler_> or cute::is_same_v<TileScheduler_, PersistentScheduler> or
+    cute::is_same_v<TileScheduler_, SwizzleScheduler>,
+    "Intel Xe non-persistent GEMM only supports the default or the swizzled tile scheduler.");
+  static constexpr bool IsSwizzledSchedule = cute::is_same_v<TileScheduler_, SwizzleScheduler>;
   using TileSchedulerTag = TileScheduler_;
   using TileScheduler = typename detail::TileSchedulerSelector<
     TileScheduler_, ArchTag, WorkgroupTileShape,
@@ -172,23 +174,27 @@ public:
 
   static int
   get_workspace_size(Arguments const& args) {
-    return 0;
+    return CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue);
   }
 
   static
   cutlass::Status
   initialize_workspace(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr, 
     CudaHostAdapter* cuda_adapter = nullptr) {
-    return Status::kSuccess;
+    return CollectiveEpilogue::initialize_workspace(args.problem_shape, args.epilogue, workspace, stream, cuda_adapter);
   }
 
   static dim3
   get_grid_shape(Params const& params) {
-    dim3 grid = TileScheduler::get_tiled_cta_shape_mnl(params.problem_shape, TileShape{}, ClusterShape{});
-    if(params.scheduler.raster_order_ == TileScheduler::RasterOrder::AlongN) {
-      return {grid.y, grid.x, grid.z};
+    if constexpr (IsSwizzledSchedule) {
+      return TileScheduler::get_grid_shape(params.scheduler);
     } else {
-      return {grid.x, grid.y, grid.z};
+      dim3 grid = TileScheduler::get_tiled_cta_shape_mnl(params.problem_shape, TileShape{}, ClusterShape{});
+      if(params.scheduler.raster_order_ == TileScheduler::RasterOrder::AlongN) {
+        return {grid.y, grid.x, grid.z};
+      } else {
+        return {grid.x, grid.y, grid.z};
+      }
     }
   }
 
@@ -222,7 +228,17 @@ public:
     int thread_idx = int(ThreadIdxX());
     auto blk_shape = TileShape{};
     int m_coord, n_coord, l_coord;
-    if (params.scheduler.raster_order_ == TileScheduler::RasterOrder::AlongN) {
+    if constexpr (IsSwizzledSchedule) {
+      TileScheduler scheduler{params.scheduler};
+      auto work_tile_info = scheduler.get_current_work();
+      // Work-groups in the swizzle padding have no output tile to compute
+      if (!work_tile_info.is_valid()) {
+        return;
+      }
+      m_coord = work_tile_info.M_idx;
+      n_coord = work_tile_info.N_idx;
+      l_coord = work_tile_info.L_idx;
+    } else if (params.scheduler.raster_order_ == TileScheduler::RasterOrder::AlongN) {
       m_coord = BlockIdxY();
       n_coord = BlockIdxX();
       l_coord = BlockIdxZ();
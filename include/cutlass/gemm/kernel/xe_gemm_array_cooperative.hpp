@@ -199,8 +199,8 @@ public:
   static size_t
   get_workspace_size(Arguments const& args) {
     size_t workspace_size = 0;
-    workspace_size += TileScheduler::template get_workspace_size<typename ProblemShape::UnderlyingProblemShape, ElementAccumulator>(
-      args.scheduler, typename ProblemShape::UnderlyingProblemShape{}, args.hw_info, -1);
+    workspace_size += TileScheduler::get_workspace_size(
+      args.scheduler, args.problem_shape, TileShape{}, ClusterShape{}, args.hw_info);
     return workspace_size;
   }
 
@@ -210,8 +210,8 @@ public:
     Status status = Status::kSuccess;
     uint8_t* workspace_ptr = reinterpret_cast<uint8_t*>(workspace);
 
-    status = TileScheduler::template initialize_workspace<typename ProblemShape::UnderlyingProblemShape, ElementAccumulator>(
-      args.scheduler, workspace_ptr, stream, typename ProblemShape::UnderlyingProblemShape{}, args.hw_info, -1);
+    status = TileScheduler::initialize_workspace(
+      args.scheduler, workspace_ptr, stream, args.problem_shape, TileShape{}, ClusterShape{}, args.hw_info, cuda_adapter);
 
     return status;
   }
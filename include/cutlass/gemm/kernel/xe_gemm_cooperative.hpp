@@ -276,20 +276,23 @@ public:
       TiledMma tiled_mma;
       Tensor accumulators = partition_fragment_C(tiled_mma, take<0,2>(workgroup_shape)); 
 
-      CollectiveMainloop collective_mma;
-
-      // Perform the collective scoped MMA
-      collective_mma(
-        accumulators,
-        gA,
-        gB,
-        accumulators,
-        k_tile_iter, work_k_tile_count,
-        tile_coord, // TODO(codeplay): Remove this once unneeded in xe_mma_mixed_input.hpp
-        K,
-        thread_idx,
-        params.mainloop
-      );
+      // Separate reduction units only reduce the partials of their peers in the fixup
+      if (TileScheduler::valid_warpgroup_in_work_tile(work_tile_info)) {
+        CollectiveMainloop collective_mma;
+
+        // Perform the collective scoped MMA
+        collective_mma(
+          accumulators,
+          gA,
+          gB,
+          accumulators,
+          k_tile_iter, work_k_tile_count,
+          tile_coord, // TODO(codeplay): Remove this once unneeded in xe_mma_mixed_input.hpp
+          K,
+          thread_idx,
+          params.mainloop
+        );
+      }
 
       // Perform reduction across splits, if needed
       TileScheduler::fixup(
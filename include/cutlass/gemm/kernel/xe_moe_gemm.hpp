@@ -0,0 +1,316 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 Intel Corporation. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/functional.h"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/gemm/gemm.h"
+#include "cutlass/gemm/group_array_problem_shape.hpp"
+#include "cutlass/gemm/kernel/xe_tile_scheduler_moe.hpp"
+
+#include "cute/tensor.hpp"
+
+namespace cutlass::gemm::kernel {
+
+///////////////////////////////////////////////////////////////////////////////
+
+// MoE grouped GEMM with the token permutation fused in.
+//
+// Rows are processed in expert-sorted order: expert e owns the num_rows_per_expert[e] rows that
+// follow those of experts 0..e-1, and sorted row r reads token gather_idx[r] of the token-ordered
+// activations A (num_tokens,K). B holds one row-major (K,N) weight matrix per expert. The result of
+// sorted row r is scaled by topk_weights[r] and atomically added to row gather_idx[r] of the
+// token-ordered output D (num_tokens,N), which therefore has to be initialized by the caller
+// (e.g. zero-filled, or holding the residual). Both the permutation of A into expert order and the
+// weighted top-k reduction of the GEMM output back to token order are thus done inside the kernel.
+//
+// The gathered rows of A are not contiguous, so A cannot use block 2D loads: every element of the
+// A fragment is a scalar global load, params.ptr_A[gather_idx[m] * K + k], with no prefetch. B is
+// loaded and prefetched with block 2D copies. The fused kernel therefore trades the permute and
+// unpermute passes for a slower A mainloop. Whether that pays off depends on the shape; the BMG
+// MoE example (examples/12_bmg_moe_gemm_cute_interface) times it against permute + grouped GEMM +
+// unpermute.
+template <
+  class TiledMma_,
+  class ElementA_,
+  class ElementB_,
+  class ElementD_,
+  class ElementWeight_ = float,
+  class GmemTiledCopyB_ = void
+>
+class XeMoEGemmGatherScatter {
+public:
+  //
+  // Type Aliases
+  //
+  using TiledMma = TiledMma_;
+  using ElementA = ElementA_;
+  using ElementB = ElementB_;
+  using ElementD = ElementD_;
+  using ElementWeight = ElementWeight_;
+  using GmemTiledCopyB = GmemTiledCopyB_;
+  using ElementAccumulator = typename TiledMma::ValTypeC;
+
+  using TileShape = decltype(TiledMma{}.tile_mnk());
+  using ClusterShape = cute::Shape<cute::_1, cute::_1, cute::_1>;
+  using ProblemShape = GroupProblemShape<cute::Shape<int,int,int>>;
+  using TileScheduler = detail::PersistentTileSchedulerXeMoE<ProblemShape>;
+  using TileSchedulerArguments = typename TileScheduler::Arguments;
+  using TileSchedulerParams = typename TileScheduler::Params;
+  using RasterOrderOptions = typename TileScheduler::RasterOrderOptions;
+
+  static_assert(cute::is_same_v<ElementD, float>,
+    "XeMoEGemmGatherScatter scatter-adds its output with atomics, which requires a float ElementD.");
+
+  static constexpr int SharedStorageSize = 0;
+  static constexpr int SubgroupSize = cute::intel::sg_size;
+  static constexpr uint32_t MaxThreadsPerBlock = cute::size(TiledMma{});
+
+  // Device side arguments
+  struct Arguments {
+    ElementA const* ptr_A = nullptr;                // (num_tokens,K), row-major, token order
+    ElementB const* ptr_B = nullptr;                // (num_experts,K,N), row-major
+    ElementD* ptr_D = nullptr;                      // (num_tokens,N), row-major, token order
+    int32_t const* num_rows_per_expert = nullptr;   // (num_experts)
+    int32_t const* gather_idx = nullptr;            // token index of each expert-sorted row
+    ElementWeight const* topk_weights = nullptr;    // routing weight of each expert-sorted row; nullptr = 1
+    int num_experts = 0;
+    int N = 0;
+    int K = 0;
+    KernelHardwareInfo hw_info{};
+    RasterOrderOptions raster_order = RasterOrderOptions::AlongN;
+  };
+
+  // Kernel entry point API
+  struct Params {
+    ElementA const* ptr_A = nullptr;
+    ElementB const* ptr_B = nullptr;
+    ElementD* ptr_D = nullptr;
+    int32_t const* num_rows_per_expert = nullptr;
+    int32_t const* gather_idx = nullptr;
+    ElementWeight const* topk_weights = nullptr;
+    int num_experts = 0;
+    int N = 0;
+    int K = 0;
+    KernelHardwareInfo hw_info{};
+    RasterOrderOptions raster_order = RasterOrderOptions::AlongN;
+    TileSchedulerParams scheduler{};
+  };
+
+  //
+  // Methods
+  //
+
+  // The number of rows of each expert is only known on the device, so the scheduler is set up
+  // from a single placeholder group and walks num_rows_per_expert itself.
+  static ProblemShape
+  placeholder_problem_shape() {
+    return ProblemShape{1, nullptr, nullptr};
+  }
+
+  static
+  Params
+  to_underlying_arguments(Arguments const& args, void* workspace) {
+    (void) workspace;
+    TileSchedulerParams scheduler = TileScheduler::to_underlying_arguments(
+      placeholder_problem_shape(), TileShape{}, ClusterShape{}, args.hw_info,
+      TileSchedulerArguments{1, args.raster_order});
+    return {
+      args.ptr_A,
+      args.ptr_B,
+      args.ptr_D,
+      args.num_rows_per_expert,
+      args.gather_idx,
+      args.topk_weights,
+      args.num_experts,
+      args.N,
+      args.K,
+      args.hw_info,
+      args.raster_order,
+      scheduler
+    };
+  }
+
+  static bool
+  can_implement(Arguments const& args) {
+    bool implementable = args.ptr_A != nullptr && args.ptr_B != nullptr && args.ptr_D != nullptr &&
+                         args.num_rows_per_expert != nullptr && args.gather_idx != nullptr;
+    implementable &= args.num_experts > 0 && args.N > 0 && args.K > 0;
+    // B is read with block 2D copies, whose row pitch must be 16B aligned
+    implementable &= (args.N * cutlass::sizeof_bits_v<ElementB>) % 128 == 0;
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem size or pointers don't meet the requirements for XeMoEGemmGatherScatter.\n");
+    }
+    return implementable;
+  }
+
+  static int
+  get_workspace_size(Arguments const& args) {
+    return 0;
+  }
+
+  static
+  cutlass::Status
+  initialize_workspace(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  static dim3
+  get_grid_shape(Params const& params) {
+    return TileScheduler::get_grid_shape(
+      params.scheduler, placeholder_problem_shape(), TileShape{}, ClusterShape{}, params.hw_info,
+      TileSchedulerArguments{1, params.raster_order});
+  }
+
+  static dim3
+  get_block_shape() {
+    return dim3(MaxThreadsPerBlock, 1, 1);
+  }
+
+  CUTLASS_DEVICE
+  void
+  operator()(Params const& params, char* smem_buf) {
+    using namespace cute;
+    (void) smem_buf;
+
+    CUTE_STATIC_ASSERT(is_static<TileShape>::value);
+
+    int const N = params.N;
+    int const K = params.K;
+    int thread_idx = int(ThreadIdxX());
+
+    TiledMma mma{};
+    auto wg_tile = mma.tile_mnk();
+    auto thr_mma = mma.get_slice(thread_idx);
+
+    TileScheduler scheduler{params.scheduler, params.num_rows_per_expert, N, K, params.num_experts};
+    auto work_tile_info = scheduler.initial_work_tile_info(ClusterShape{});
+
+    // First expert-sorted row of the current expert. Tiles are handed out in increasing expert order,
+    // so the offset only ever moves forward.
+    int32_t curr_expert = 0;
+    int32_t expert_row_offset = 0;
+
+    constexpr int barrier_scope = 2;
+    constexpr int prefetch_dist = 3;
+    int k_tile_count = ceil_div(K, get<2>(wg_tile));
+
+    while (work_tile_info.is_valid()) {
+      for (; curr_expert < work_tile_info.L_idx; ++curr_expert) {
+        expert_row_offset += params.num_rows_per_expert[curr_expert];
+      }
+      int32_t const M = params.num_rows_per_expert[curr_expert];
+      int32_t const* gather_idx = params.gather_idx + expert_row_offset;
+
+      // B of the current expert, viewed as (N,K)
+      Tensor mB = make_tensor(make_gmem_ptr(const_cast<ElementB*>(params.ptr_B) + int64_t(curr_expert) * K * N),
+                              make_layout(make_shape(N, K), make_stride(_1{}, N)));
+
+      Tensor cA = make_identity_tensor(make_shape(M, K));   // (M,K)
+      Tensor cB = make_identity_tensor(mB.shape());         // (N,K)
+      Tensor cD = make_identity_tensor(make_shape(M, N));   // (M,N)
+
+      auto wg_coord = make_coord(work_tile_info.M_idx, work_tile_info.N_idx, 0);
+      Tensor gA = local_tile(cA, select<0,2>(wg_tile), make_coord(work_tile_info.M_idx, _));
+      Tensor gB = local_tile(cB, select<1,2>(wg_tile), make_coord(work_tile_info.N_idx, _));
+      Tensor gD = local_tile(cD, wg_tile, wg_coord, Step<_1,_1,X>{});
+
+      auto tiled_copy_b = get_block_2d_copy_B<GmemTiledCopyB>(mma, mB);
+      auto thr_copy_b = tiled_copy_b.get_slice(thread_idx);
+
+      auto tCrA = thr_mma.partition_sg_fragment_A(gA(_,_,0));
+      auto tCrB = thr_mma.partition_sg_fragment_B(gB(_,_,0));
+      auto tCrD = thr_mma.partition_sg_fragment_C(gD);
+      auto tBrB = thr_copy_b.partition_sg_fragment_D(gB(_,_,0));
+
+      // Coordinates of the A and D fragment elements owned by this work-item
+      Tensor tCcA = thr_mma.partition_A(gA);                // (MMA,MMA_M,MMA_K,k)
+      Tensor tCcD = thr_mma.partition_C(gD);                // (MMA,MMA_M,MMA_N)
+      Tensor tBgB = thr_copy_b.partition_S(gB);
+
+      auto prefetch_b = make_block_2d_prefetch(tiled_copy_b);
+      auto thr_prefetch_B = prefetch_b.get_slice(thread_idx);
+      auto pBgB = thr_prefetch_B.partition_S(gB);
+
+      int prefetch_k = 0;
+      CUTE_UNROLL
+      for (; prefetch_k < prefetch_dist; prefetch_k++) {
+        prefetch(prefetch_b, pBgB(_,_,_,prefetch_k));
+      }
+
+      clear(tCrD);
+
+      for (int k_tile = 0; k_tile < k_tile_count; k_tile++, prefetch_k++) {
+        barrier_arrive(barrier_scope);
+
+        copy(tiled_copy_b, tBgB(_,_,_,k_tile), tBrB);
+
+        if (prefetch_k < k_tile_count) {
+          prefetch(prefetch_b, pBgB(_,_,_,prefetch_k));
+        }
+
+        // Gather the rows of A belonging to this expert straight from token order
+        Tensor tCcA_k = tCcA(_,_,_,k_tile);
+        CUTE_UNROLL
+        for (int i = 0; i < size(tCrA); ++i) {
+          auto [m, k] = tCcA_k(i);
+          tCrA(i) = (m < M && k < K) ? params.ptr_A[int64_t(gather_idx[m]) * K + k] : ElementA(0);
+        }
+
+        reorder(tBrB, tCrB);
+
+        cute::gemm(mma, tCrA, tCrB, tCrD);
+        barrier_wait(barrier_scope);
+      }
+
+      // Scale by the routing weight and reduce the top-k expert outputs back into token order
+      CUTE_UNROLL
+      for (int i = 0; i < size(tCrD); ++i) {
+        auto [m, n] = tCcD(i);
+        if (m < M && n < N) {
+          ElementAccumulator w = params.topk_weights == nullptr
+                               ? ElementAccumulator(1)
+                               : ElementAccumulator(params.topk_weights[expert_row_offset + m]);
+          atomic_add<ElementD>{}(params.ptr_D + int64_t(gather_idx[m]) * N + n, ElementD(w * tCrD(i)));
+        }
+      }
+
+      work_tile_info = scheduler.fetch_next_work(work_tile_info);
+    }
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::kernel
@@ -69,7 +69,15 @@ struct PersistentTileSchedulerXeStreamKParams {
     // Due to the nondeterminsitic ordering of accumulation, deterministic numeric behavior cannot
     // be guaranteed with this mode (e.g., floating-point rounding error will depend on the order
     // of accumulation)
-    Nondeterministic
+    Nondeterministic,
+
+    // Each participating work-group writes its partial accumulators to its own slot of the workspace
+    // without waiting on any other work-group. A dedicated reduction unit per split output tile waits
+    // for all peers to arrive, sums the partials in K order and computes the epilogue.
+    //
+    // Peers never serialize on one another, at the cost of a workspace that holds one partial tile per peer.
+    // Summation order is fixed, so numeric behavior is deterministic.
+    Separate
   };
 
   // Strategies for decomposing the problem
@@ -92,7 +100,8 @@ struct PersistentTileSchedulerXeStreamKParams {
   FastDivmodU64 divmod_blk_major_{};
 
   // Divide up the number of stream-K tiles amongst G groups of stream-K units.
-  // Currently defaults to 1 since we don't create groups for Xe.
+  // Each group covers an interleaved subset of the stream-K tiles, which bounds the
+  // number of units that can collaborate on a given output tile.
   FastDivmodU64 divmod_sk_groups_{};
 
   // Number of stream-K units in each group
@@ -133,15 +142,39 @@ struct PersistentTileSchedulerXeStreamKParams {
   // Strategy to use when reducing between collaborating work-groups
   ReductionMode reduction_mode_ = ReductionMode::Deterministic;
 
+  // Number of work units dedicated to reducing partials when using ReductionMode::Separate.
+  // One such unit is created per output tile that is split across work-groups.
+  uint32_t separate_reduction_units_ = 0;
+
   // Minimum number of k tiles that can be assigned to a stream-K unit
   static constexpr uint32_t min_iters_per_sk_unit_ = 8u;
 
   // Maximum number of groups of stream-K units
-  static constexpr uint32_t max_sk_groups_ = 1u;
+  static constexpr uint32_t max_sk_groups_ = 8u;
 
   // ktile start from even for each cta
   uint32_t ktile_start_alignment_count { 1u };
 
+  // Returns whether the kernel uses separate reduction units
+  CUTLASS_HOST_DEVICE
+  bool
+  requires_separate_reduction() const {
+    return separate_reduction_units_ > 0;
+  }
+
+  // Returns the maximum number of peers that can collaborate on a given output tile
+  // in a stream-K decomposition without groups.
+  CUTLASS_HOST_DEVICE
+  static uint32_t
+  max_peers_per_tile(uint64_t sk_units, uint64_t sk_tiles) {
+    // When we can divide up our SK units to SK tiles evenly, the number of peers
+    // per SK tile is exactly (sk_units_ / sk_tiles_). In cases where this division
+    // is not exact, some tiles will need to be covered by additional SK units. Because
+    // the extra work can occur at both the beginning and the end of the SK tile, at
+    // most 2 extra peers will be needed.
+    return static_cast<uint32_t>(sk_units / sk_tiles + 2);
+  }
+
   // Initializes members. This variant of the method should only be used when
   // problem_shape and tile_shape contain modes of only rank 1.
   void
@@ -197,27 +230,7 @@ struct PersistentTileSchedulerXeStreamKParams {
         (decomposition_mode == DecompositionMode::Heuristic && splits > 1)) {
       // Short circuit to basic split-K decomposition
 
-      // Don't split by more than the available number of SMs
-      if (splits > hw_info.sm_count) {
-        splits = hw_info.sm_count;
-      }
-
-      // Don't split by more than the K tile iterations
-      //
-      // splits is almost certainly nonnegative here (e.g., hw_info.sm_count,
-      // despite being an int, is a count), so it can safely be converted to unsigned
-      // in the comparison to avoid a signed-unsigned comparison warning-as-error.
-      if (static_cast<decltype(k_tiles_per_output_tile)>(splits) > k_tiles_per_output_tile) {
-        splits = k_tiles_per_output_tile;
-      }
-
-      // If splits == k_tiles_per_output_tiles, there will be one k_tile per cta
-      //   and this violate k_tile start from even requirements. Thus we need to
-      //   reduce the number of splits.
-      if (ktile_start_alignment_count > 1u &&
-           static_cast<decltype(k_tiles_per_output_tile)>(splits) == k_tiles_per_output_tile) { 
-        splits = k_tiles_per_output_tile / ktile_start_alignment_count;
-      }
+      splits = get_clamped_splits(splits, k_tiles_per_output_tile, hw_info.sm_count, ktile_start_alignment_count);
 
       set_params_basic(
         problem_blocks_m,
@@ -274,7 +287,13 @@ struct PersistentTileSchedulerXeStreamKParams {
       return;
     }
 
-    uint32_t groups = max_sk_groups_;
+    uint32_t groups = calculate_groups(
+      problem_blocks_n,
+      sk_tiles,
+      sk_units,
+      k_tiles_per_output_tile,
+      reduction_mode
+    );
 
     auto sk_units_per_group = sk_units / groups;
 
@@ -289,10 +308,9 @@ struct PersistentTileSchedulerXeStreamKParams {
     // Number of k tiles computed per stream-K unit
     uint64_t k_tiles_per_sk_unit = k_tiles_per_group / sk_units_per_group;
 
-    uint32_t reduction_units = 0;
+    // Separate reduction uses one reduction unit per stream-K tile
+    uint32_t reduction_units = reduction_mode == ReductionMode::Separate ? sk_tiles : 0;
 
-    // Use separate reduction when we have less than one wave of output tiles (dp_tiles == 0)
-    // and when each tile will be operated on by at least two stream-K units (sk_units > 2 * sk_tiles)
     if (decomposition_mode == DecompositionMode::Heuristic && sk_tiles < sk_units && sk_units % sk_tiles == 0) {
       // If the number of stream-K units is a multiple of the number of stream-K tiles, then
       // the problem can leverage a basic split-K decomposition for the stream-K tiles.
@@ -322,7 +340,7 @@ struct PersistentTileSchedulerXeStreamKParams {
 
     // Assign big_units_ assuming that group count == 1. This is unused by stream-K
     // when group count > 1.
-    big_units_ = static_cast<uint32_t>(k_tiles_per_group % k_tiles_per_sk_unit);
+    big_units_ = static_cast<uint32_t>(k_tiles_per_group % sk_units_per_group);
 
     big_groups_ = static_cast<uint32_t>(sk_big_groups);
     reduction_workspace_ = reduction_workspace;
@@ -331,9 +349,104 @@ struct PersistentTileSchedulerXeStreamKParams {
     divmod_k_tiles_per_sk_unit_ = FastDivmod(static_cast<uint32_t>(k_tiles_per_sk_unit));
     divmod_k_tiles_per_sk_big_unit_ = FastDivmod(static_cast<uint32_t>(k_tiles_per_sk_unit + 1));
     reduction_mode_ = reduction_mode;
+    separate_reduction_units_ = reduction_units;
   }
 
-  static CUTLASS_DEVICE
+  // Calculates the number of groups of stream-K units. Groups are interleaved along the
+  // rasterized (N) dimension of the output, so no more groups than output tiles along N
+  // are used. We start from the maximum number of groups and iterate down looking for a
+  // group count that evenly divides the stream-K units and tiles, and for which the
+  // resulting number of K tiles per stream-K unit remains above min_iters_per_sk_unit_.
+  static uint32_t
+  calculate_groups(
+    uint32_t problem_blocks_n,
+    uint32_t sk_tiles,
+    uint64_t sk_units,
+    uint32_t k_tiles_per_output_tile,
+    ReductionMode reduction_mode) {
+
+    uint32_t groups = platform::min(problem_blocks_n, max_sk_groups_);
+
+    // Grouping is disabled for separate reduction: the reduction units rely on every stream-K
+    // unit covering a contiguous range of the global K iteration space to locate their peers.
+    if (reduction_mode == ReductionMode::Separate) {
+      groups = 1;
+    }
+
+    uint32_t fallback_groups = 0;
+
+    auto sk_splits_too_small = [&](uint32_t g) {
+      // Check whether the number of K tiles computed per stream-K unit is less
+      // than min_iters_per_sk_unit_
+      auto total_sk_k_tiles = (sk_tiles / g) * k_tiles_per_output_tile;
+      auto k_tiles_per_sk_unit = total_sk_k_tiles / (sk_units / g);
+      return k_tiles_per_sk_unit < min_iters_per_sk_unit_;
+    };
+
+    auto is_ideal_grouping = [&](uint32_t g) {
+      // An ideal grouping will evenly divide stream-K units, evenly divide
+      // stream-K tiles, and not result in stream-K splits that are too small.
+      return (sk_units % g == 0) && (sk_tiles % g == 0) && !sk_splits_too_small(g);
+    };
+
+    auto is_valid_grouping = [&](uint32_t g) {
+      // A grouping is valid, but not ideal, if it evenly divides the stream-K units
+      // and does not result in stream-K splits that are too small. Such a setting
+      // can be used as a fallback option in the case that an ideal grouping is not achievable
+      return (sk_units % g == 0) && !sk_splits_too_small(g);
+    };
+
+    while (groups > 1 && !is_ideal_grouping(groups)) {
+      if (fallback_groups == 0 && is_valid_grouping(groups)) {
+        // Set fallback groups once in preference for a larger number of groups.
+        fallback_groups = groups;
+      }
+      --groups;
+    }
+
+    // If groups == 1, we did not find a group count that satisfies all criteria. If we have
+    // found a fallback group count, use this instead.
+    if (groups == 1 && fallback_groups > 0) {
+      groups = fallback_groups;
+    }
+    return groups;
+  }
+
+  // Returns the number of splits used by a basic split-K decomposition once the requested
+  // count has been clamped to the available work-groups and K tile iterations.
+  CUTLASS_HOST_DEVICE
+  static int
+  get_clamped_splits(
+    int splits,
+    uint32_t k_tiles_per_output_tile,
+    int sm_count,
+    uint32_t ktile_start_alignment_count = 1u) {
+
+    // Don't split by more than the available number of SMs
+    if (splits > sm_count) {
+      splits = sm_count;
+    }
+
+    // Don't split by more than the K tile iterations
+    //
+    // splits is almost certainly nonnegative here (e.g., hw_info.sm_count,
+    // despite being an int, is a count), so it can safely be converted to unsigned
+    // in the comparison to avoid a signed-unsigned comparison warning-as-error.
+    if (static_cast<decltype(k_tiles_per_output_tile)>(splits) > k_tiles_per_output_tile) {
+      splits = k_tiles_per_output_tile;
+    }
+
+    // If splits == k_tiles_per_output_tiles, there will be one k_tile per cta
+    //   and this violate k_tile start from even requirements. Thus we need to
+    //   reduce the number of splits.
+    if (ktile_start_alignment_count > 1u &&
+         static_cast<decltype(k_tiles_per_output_tile)>(splits) == k_tiles_per_output_tile) {
+      splits = k_tiles_per_output_tile / ktile_start_alignment_count;
+    }
+    return splits;
+  }
+
+  static CUTLASS_HOST_DEVICE
   cute::tuple<int32_t, int32_t>
   get_work_idx_m_and_n(
       uint64_t blk_per_grid_dim,
@@ -349,7 +462,7 @@ struct PersistentTileSchedulerXeStreamKParams {
 
   // Computes the linear index within a batch given M and N tile offsets within the batch.
   // This essentially inverts the mapping performed in get_work_idx_m_and_n
-  static CUTLASS_DEVICE
+  static CUTLASS_HOST_DEVICE
   uint64_t
   get_linear_idx_from_m_and_n(
     int32_t tile_m,
@@ -490,7 +603,8 @@ struct PersistentTileSchedulerXeStreamKParams {
     int splits,
     DecompositionMode decomposition_mode,
     uint32_t barrier_bits,
-    uint32_t accumulator_bits) {
+    uint32_t accumulator_bits,
+    ReductionMode reduction_mode = ReductionMode::Deterministic) {
 
     // Workspace is needed only for output tiles that will be split. Thus, we first determine the number
     // of output tiles that will be split, and then calculate the workspace needed to cover these.
@@ -503,8 +617,15 @@ struct PersistentTileSchedulerXeStreamKParams {
     else if (splits > 1 &&
              (decomposition_mode == DecompositionMode::SplitK || decomposition_mode == DecompositionMode::Heuristic)) {
       // Basic split-K variant requires workspace for all output tiles
+      uint64_t reduction_tiles = output_tiles;
+      if (reduction_mode == ReductionMode::Separate) {
+        // Each split writes its partials to its own slot
+        int sm_count = hw_info.sm_count > 0 ? hw_info.sm_count :
+                       KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+        reduction_tiles *= get_clamped_splits(splits, k_tiles_per_output_tile, sm_count);
+      }
       barrier_workspace_size = get_barrier_workspace_size(output_tiles, barrier_bits);
-      reduction_workspace_size = get_reduction_workspace_size(output_tiles, tile_shape, accumulator_bits);
+      reduction_workspace_size = get_reduction_workspace_size(reduction_tiles, tile_shape, accumulator_bits);
     }
     else {
       KernelHardwareInfo new_hw_info;
@@ -532,6 +653,16 @@ struct PersistentTileSchedulerXeStreamKParams {
       uint64_t dp_tiles = output_tiles - sk_tiles;
 
       uint64_t reduction_tiles = sk_tiles;
+      if (reduction_mode == ReductionMode::Separate && sk_units > 0) {
+        // Each peer of a stream-K tile writes its partials to its own slot. The heuristic
+        // falls back to split-K with sk_units / sk_tiles splits when this divides evenly.
+        if (decomposition_mode == DecompositionMode::Heuristic && sk_tiles < sk_units && sk_units % sk_tiles == 0) {
+          reduction_tiles *= sk_units / sk_tiles;
+        }
+        else {
+          reduction_tiles *= max_peers_per_tile(sk_units, sk_tiles);
+        }
+      }
 
       barrier_workspace_size = get_barrier_workspace_size(sk_tiles, barrier_bits);
       reduction_workspace_size = get_reduction_workspace_size(reduction_tiles, tile_shape, accumulator_bits);
@@ -548,7 +679,8 @@ struct PersistentTileSchedulerXeStreamKParams {
     int splits,
     DecompositionMode decomposition_mode,
     uint32_t barrier_bits,
-    uint32_t element_accumulator_bits) {
+    uint32_t element_accumulator_bits,
+    ReductionMode reduction_mode = ReductionMode::Deterministic) {
 
     dim3 problem_blocks = get_tiled_wg_shape_mnl(problem_shape, tile_shape);
     uint32_t k_tiles_per_output_tile = (problem_shape.k() + tile_shape.k() - 1) / tile_shape.k();
@@ -561,7 +693,8 @@ struct PersistentTileSchedulerXeStreamKParams {
       splits,
       decomposition_mode,
       barrier_bits,
-      element_accumulator_bits
+      element_accumulator_bits,
+      reduction_mode
     );
   }
 
@@ -577,7 +710,8 @@ struct PersistentTileSchedulerXeStreamKParams {
     int splits,
     DecompositionMode decomposition_mode,
     uint32_t barrier_bits,
-    uint32_t element_accumulator_bits) {
+    uint32_t element_accumulator_bits,
+    ReductionMode reduction_mode = ReductionMode::Deterministic) {
 
     size_t barrier_workspace_size = 0;
     size_t reduction_workspace_size = 0;
@@ -592,7 +726,8 @@ struct PersistentTileSchedulerXeStreamKParams {
       splits,
       decomposition_mode,
       barrier_bits,
-      element_accumulator_bits
+      element_accumulator_bits,
+      reduction_mode
     );
 
     return barrier_workspace_size + reduction_workspace_size;
@@ -609,7 +744,8 @@ struct PersistentTileSchedulerXeStreamKParams {
     int splits,
     DecompositionMode decomposition_mode,
     uint32_t barrier_bits,
-    uint32_t element_accumulator_bits) {
+    uint32_t element_accumulator_bits,
+    ReductionMode reduction_mode = ReductionMode::Deterministic) {
 
     dim3 problem_blocks = get_tiled_wg_shape_mnl(problem_shape, tile_shape);
     uint32_t k_tiles_per_output_tile = (problem_shape.k() + tile_shape.k() - 1) / tile_shape.k();
@@ -623,7 +759,8 @@ struct PersistentTileSchedulerXeStreamKParams {
       splits,
       decomposition_mode,
       barrier_bits,
-      element_accumulator_bits
+      element_accumulator_bits,
+      reduction_mode
     );
   }
 
@@ -640,7 +777,8 @@ struct PersistentTileSchedulerXeStreamKParams {
     int splits,
     DecompositionMode decomposition_mode,
     uint32_t barrier_bits,
-    uint32_t element_accumulator_bits) {
+    uint32_t element_accumulator_bits,
+    ReductionMode reduction_mode = ReductionMode::Deterministic) {
 
       uint64_t barrier_workspace_size = 0;
       uint64_t reduction_workspace_size = 0;
@@ -655,7 +793,8 @@ struct PersistentTileSchedulerXeStreamKParams {
         splits,
         decomposition_mode,
         barrier_bits,
-        element_accumulator_bits
+        element_accumulator_bits,
+      reduction_mode
       );
 
       if (barrier_workspace_size > 0) {
@@ -693,10 +832,15 @@ struct PersistentTileSchedulerXeStreamKParams {
     reduction_mode_ = reduction_mode;
     divmod_k_tiles_per_sk_unit_ = FastDivmod(k_tiles_per_output_tile / splits);
 
+    divmod_k_tiles_per_sk_big_unit_ = FastDivmod(k_tiles_per_output_tile / splits + 1);
+
     // No stream-K work is performed for "basic" data-parallel and split-K decompositions
     sk_tiles_ = 0;
     sk_units_ = 0;
     divmod_sk_units_per_group_ = FastDivmodU64(blocks_m * blocks_n * blocks_l);
+
+    // Every output tile of a split-K decomposition is reduced by its own reduction unit
+    separate_reduction_units_ = (splits > 1 && reduction_mode == ReductionMode::Separate) ? units_per_problem_ : 0;
   }
 };
 
@@ -33,17 +33,42 @@
 #include "cutlass/fast_math.h"
 #include "cutlass/gemm_coord.hpp"
 #include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/workspace.h"
 #include "cutlass/gemm/kernel/tile_scheduler_params.h"
 #include "cute/layout.hpp"
 #include "cute/tensor.hpp"
 
+#include <vector>
+
 namespace cutlass::gemm::kernel::detail {
 
 ///////////////////////////////////////////////////////////////////////////////
 
+// Parameters for the persistent Xe group scheduler. Adds an optional table of cumulative
+// tile offsets per group, which lives in the kernel workspace.
+template <class GroupProblemShape>
+struct PersistentTileSchedulerXeGroupParams : PersistentTileSchedulerSm90GroupParams<GroupProblemShape> {
+  // group_tile_offsets_[g] is the first linear tile index of group g and group_tile_offsets_[groups]
+  // is the total number of tiles. When null, the scheduler walks the groups one at a time.
+  uint64_t const* group_tile_offsets_ = nullptr;
+  // Caller-provided upper bound on the total number of tiles when the problem shapes only live on the
+  // device, 0 if unknown. Work-groups whose linear tile index reaches it exit without walking the groups.
+  uint64_t max_total_tiles_ = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
 // Persistent Thread Block (TB) scheduler
 template <class GroupProblemShape>
 class PersistentTileSchedulerXeGroup {
+public:
+  // Tracking current group, its starting linear idx and total tiles
+  struct GroupInfo {
+    int group_idx = 0;
+    uint64_t start_linear_idx = 0;
+    uint64_t total_tiles = 0;
+  };
+
   //
   // Data members
   //
@@ -51,13 +76,7 @@ class PersistentTileSchedulerXeGroup {
 private:
   uint64_t current_work_linear_idx_ = 0;
   uint64_t total_grid_size_ = 0;
-
-  // Tracking current group, its starting linear idx and total tiles
-  struct GroupInfo {
-    int group_idx = 0;
-    uint64_t start_linear_idx = 0;
-    uint64_t total_tiles = 0;
-  } current_group_info_;
+  GroupInfo current_group_info_;
 
 public:
   struct WorkTileInfo {
@@ -92,7 +111,7 @@ public:
   };
 
   using ProblemShape = typename GroupProblemShape::UnderlyingProblemShape;
-  using Params = PersistentTileSchedulerSm90GroupParams<GroupProblemShape>;
+  using Params = PersistentTileSchedulerXeGroupParams<GroupProblemShape>;
   using RasterOrder = typename Params::RasterOrder;
   using RasterOrderOptions = typename Params::RasterOrderOptions;
 
@@ -100,6 +119,15 @@ public:
     int max_swizzle_size = 1;
     // Not applying Heuristics for Grouped problems, since largest dimension can change per group
     RasterOrderOptions raster_order = RasterOrderOptions::AlongM;
+    // Precompute the cumulative tile offsets of all groups into the workspace so that work-groups
+    // locate their group with a binary search instead of walking every preceding group.
+    // Requires host problem shapes; ignored otherwise.
+    bool use_group_tile_offsets = false;
+    // Upper bound on the total number of tiles of all groups, for problem shapes that only live on the
+    // device (e.g. per-expert token counts written by a MoE router). The grid is sized from it instead of
+    // the EU count and work-groups past it exit immediately, so no host round trip is needed to launch.
+    // Ignored when host problem shapes are provided; 0 means unknown.
+    uint64_t max_total_tiles = 0;
   };
 
   // Sink scheduler params as a member
@@ -130,7 +158,8 @@ public:
       problem_shapes.groups(),
       problem_shapes,
       hw_info,
-      tile_shape, cluster_shape);
+      tile_shape, cluster_shape,
+      arguments.max_total_tiles);
 
     Params params;
     params.initialize(
@@ -143,6 +172,15 @@ public:
       arguments.raster_order
     );
 
+    // The table is only available once the workspace has been initialized
+    if (arguments.use_group_tile_offsets && problem_shapes.is_host_problem_shape_available()) {
+      params.group_tile_offsets_ = reinterpret_cast<uint64_t const*>(workspace);
+    }
+
+    if (!problem_shapes.is_host_problem_shape_available()) {
+      params.max_total_tiles_ = arguments.max_total_tiles;
+    }
+
     return params;
   }
 
@@ -163,7 +201,8 @@ public:
       problem_shapes.groups(),
       problem_shapes,
       hw_info,
-      tile_shape, cluster_shape);
+      tile_shape, cluster_shape,
+      cute::max(arguments.max_total_tiles, params.max_total_tiles_));
 
     return Params::get_grid_shape(
       problem_blocks,
@@ -180,13 +219,14 @@ public:
   template<class BlockShape, class ClusterShape>
   CUTLASS_HOST_DEVICE static
   dim3
-  get_tiled_cta_shape_mnl(int groups, GroupProblemShape problem_shapes, KernelHardwareInfo hw_info, BlockShape cta_shape, ClusterShape cluster_shape) {
+  get_tiled_cta_shape_mnl(int groups, GroupProblemShape problem_shapes, KernelHardwareInfo hw_info, BlockShape cta_shape, ClusterShape cluster_shape,
+                          uint64_t max_total_tiles = 0) {
     uint32_t total_ctas = 0;
     uint32_t cta_in_N_dim = 1; // We linearize the blocks across all the problems here
 
-    // If host problem shapes are not provided.
+    // If host problem shapes are not provided, size the grid from the caller's bound if there is one.
     if (!problem_shapes.is_host_problem_shape_available()) {
-      total_ctas = hw_info.sm_count;
+      total_ctas = max_total_tiles > 0 ? static_cast<uint32_t>(max_total_tiles) : hw_info.sm_count;
     }
     // If host problem shapes are provided, make a better decision about possibility to launch smaller grid.
     else {
@@ -225,18 +265,13 @@ public:
 
     total_grid_size_ = uint64_t(GridDimX()) * uint64_t(GridDimY()) * uint64_t(GridDimZ());
 
-    uint64_t ctas_along_m, ctas_along_n;
-    if (is_tuple<decltype(cute::shape<0>(params_.problem_shapes_.get_problem_shape(0)))>::value ||
-        is_tuple<decltype(cute::shape<1>(params_.problem_shapes_.get_problem_shape(0)))>::value) {
-      ctas_along_m = cute::size(cute::ceil_div(cute::shape<0>(params_.problem_shapes_.get_problem_shape(0)), scheduler_params.cta_shape_.m()));
-      ctas_along_n = cute::size(cute::ceil_div(cute::shape<1>(params_.problem_shapes_.get_problem_shape(0)), scheduler_params.cta_shape_.n()));
-    }
-    else {
-      ctas_along_m = scheduler_params.divmod_cta_shape_m_.divide(cute::shape<0>(params_.problem_shapes_.get_problem_shape(0)) +  scheduler_params.divmod_cta_shape_m_.divisor - 1);
-      ctas_along_n = scheduler_params.divmod_cta_shape_n_.divide(cute::shape<1>(params_.problem_shapes_.get_problem_shape(0)) +  scheduler_params.divmod_cta_shape_n_.divisor - 1);
-    }
-    auto problem_blocks_m = round_up(ctas_along_m, (1 << params_.log_swizzle_size_) * params_.cluster_shape_.m());
-    auto problem_blocks_n = round_up(ctas_along_n, (1 << params_.log_swizzle_size_) * params_.cluster_shape_.n());
+    auto [problem_blocks_m, problem_blocks_n] = get_problem_blocks_m_and_n(
+      params_.problem_shapes_.get_problem_shape(0),
+      scheduler_params.cta_shape_,
+      scheduler_params.cluster_shape_,
+      scheduler_params.divmod_cta_shape_m_,
+      scheduler_params.divmod_cta_shape_n_,
+      scheduler_params.log_swizzle_size_);
     current_group_info_.total_tiles = problem_blocks_m * problem_blocks_n;
 #else
     CUTLASS_ASSERT(false && "This line should never be reached");
@@ -255,6 +290,9 @@ public:
     if (scheduler_params.pre_processed_problem_shapes && linear_idx >= scheduler_params.blocks_across_problem_) {
       return WorkTileInfo::invalid_work_tile();
     }
+    if (scheduler_params.max_total_tiles_ != 0 && linear_idx >= scheduler_params.max_total_tiles_) {
+      return WorkTileInfo::invalid_work_tile();
+    }
 
     return get_work_idx_m_and_n(linear_idx,
                                 current_group_info_,
@@ -266,7 +304,8 @@ public:
                                 scheduler_params.divmod_cta_shape_m_,
                                 scheduler_params.divmod_cta_shape_n_,
                                 scheduler_params.log_swizzle_size_, 
-                                scheduler_params.raster_order_);
+                                scheduler_params.raster_order_,
+                                scheduler_params.group_tile_offsets_);
   }
 
   CUTLASS_DEVICE
@@ -275,60 +314,160 @@ public:
     current_work_linear_idx_ += total_grid_size_ * uint64_t(advance_count);
   }
 
-  // get work_idx_m, work_idx_n from linear_idx while applying swizzle
-  static CUTLASS_DEVICE
-  WorkTileInfo
-  get_work_idx_m_and_n(
-      uint64_t linear_idx,
-      struct GroupInfo& group_info,
-      GroupProblemShape &problem_shapes,
+  // Computes the number of tiles along M and N of a single group, rounded up to the swizzle and cluster size
+  static CUTLASS_HOST_DEVICE
+  cute::tuple<uint64_t, uint64_t>
+  get_problem_blocks_m_and_n(
+      ProblemShape const& problem_shape,
       GemmCoord cta_shape,
       GemmCoord cluster_shape,
-      FastDivmodU64Pow2 const& divmod_cluster_shape_major,
-      FastDivmodU64Pow2 const& divmod_cluster_shape_minor,
       FastDivmodU64 const& divmod_cta_shape_m,
       FastDivmodU64 const& divmod_cta_shape_n,
-      int32_t log_swizzle_size, 
-      RasterOrder raster_order) {
+      int32_t log_swizzle_size) {
 
-    bool valid_tile = true;
     uint64_t ctas_along_m, ctas_along_n;
-    int total_problem_groups = problem_shapes.groups();
-
-    if (is_tuple<decltype(cute::shape<0>(problem_shapes.get_problem_shape(group_info.group_idx)))>::value ||
-        is_tuple<decltype(cute::shape<1>(problem_shapes.get_problem_shape(group_info.group_idx)))>::value) {
-      ctas_along_m = cute::size(cute::ceil_div(cute::shape<0>(problem_shapes.get_problem_shape(group_info.group_idx)), cta_shape.m()));
-      ctas_along_n = cute::size(cute::ceil_div(cute::shape<1>(problem_shapes.get_problem_shape(group_info.group_idx)), cta_shape.n()));
+    if (is_tuple<decltype(cute::shape<0>(problem_shape))>::value ||
+        is_tuple<decltype(cute::shape<1>(problem_shape))>::value) {
+      ctas_along_m = cute::size(cute::ceil_div(cute::shape<0>(problem_shape), cta_shape.m()));
+      ctas_along_n = cute::size(cute::ceil_div(cute::shape<1>(problem_shape), cta_shape.n()));
     }
     else {
-      ctas_along_m = divmod_cta_shape_m.divide(cute::shape<0>(problem_shapes.get_problem_shape(group_info.group_idx)) +  divmod_cta_shape_m.divisor - 1);
-      ctas_along_n = divmod_cta_shape_n.divide(cute::shape<1>(problem_shapes.get_problem_shape(group_info.group_idx)) +  divmod_cta_shape_n.divisor - 1);
+      ctas_along_m = divmod_cta_shape_m.divide(cute::shape<0>(problem_shape) +  divmod_cta_shape_m.divisor - 1);
+      ctas_along_n = divmod_cta_shape_n.divide(cute::shape<1>(problem_shape) +  divmod_cta_shape_n.divisor - 1);
     }
     auto problem_blocks_m = round_up(ctas_along_m, (1 << log_swizzle_size) * cluster_shape.m());
     auto problem_blocks_n = round_up(ctas_along_n, (1 << log_swizzle_size) * cluster_shape.n());
+    return {problem_blocks_m, problem_blocks_n};
+  }
+
+  // Moves group_info forward to the group containing linear_idx by visiting the groups one at a time.
+  // Returns false if linear_idx lies past the last group.
+  static CUTLASS_HOST_DEVICE
+  bool
+  advance_group_linear(
+      uint64_t linear_idx,
+      GroupInfo& group_info,
+      GroupProblemShape const& problem_shapes,
+      GemmCoord cta_shape,
+      GemmCoord cluster_shape,
+      FastDivmodU64 const& divmod_cta_shape_m,
+      FastDivmodU64 const& divmod_cta_shape_n,
+      int32_t log_swizzle_size) {
+
+    int total_problem_groups = problem_shapes.groups();
+
+    auto [problem_blocks_m, problem_blocks_n] = get_problem_blocks_m_and_n(
+      problem_shapes.get_problem_shape(group_info.group_idx), cta_shape, cluster_shape,
+      divmod_cta_shape_m, divmod_cta_shape_n, log_swizzle_size);
     group_info.total_tiles = problem_blocks_m * problem_blocks_n;
 
     while (group_info.start_linear_idx + group_info.total_tiles <= linear_idx) {
       group_info.group_idx++;
 
       if (group_info.group_idx >= total_problem_groups)
-        return WorkTileInfo::invalid_work_tile();
+        return false;
 
       group_info.start_linear_idx += group_info.total_tiles;
-      if (is_tuple<decltype(cute::shape<0>(problem_shapes.get_problem_shape(group_info.group_idx)))>::value ||
-          is_tuple<decltype(cute::shape<1>(problem_shapes.get_problem_shape(group_info.group_idx)))>::value) {
-        ctas_along_m = cute::size(cute::ceil_div(cute::shape<0>(problem_shapes.get_problem_shape(group_info.group_idx)), cta_shape.m()));
-        ctas_along_n = cute::size(cute::ceil_div(cute::shape<1>(problem_shapes.get_problem_shape(group_info.group_idx)), cta_shape.n()));
+      auto [next_blocks_m, next_blocks_n] = get_problem_blocks_m_and_n(
+        problem_shapes.get_problem_shape(group_info.group_idx), cta_shape, cluster_shape,
+        divmod_cta_shape_m, divmod_cta_shape_n, log_swizzle_size);
+      group_info.total_tiles = next_blocks_m * next_blocks_n;
+    }
+    return true;
+  }
+
+  // Moves group_info to the group containing linear_idx using the cumulative tile offsets table.
+  // Returns false if linear_idx lies past the last group.
+  static CUTLASS_HOST_DEVICE
+  bool
+  advance_group_from_offsets(
+      uint64_t linear_idx,
+      GroupInfo& group_info,
+      uint64_t const* group_tile_offsets,
+      int total_problem_groups) {
+
+    // Consecutive tiles of a work-group usually fall into the same group
+    if (group_info.start_linear_idx <= linear_idx &&
+        linear_idx < group_info.start_linear_idx + group_info.total_tiles) {
+      return true;
+    }
+
+    if (linear_idx >= group_tile_offsets[total_problem_groups]) {
+      return false;
+    }
+
+    // Find the last group starting at or before linear_idx. Work-groups only move forward through
+    // the linear tile space, so the search can start from the current group.
+    int lo = linear_idx >= group_info.start_linear_idx ? group_info.group_idx : 0;
+    int hi = total_problem_groups - 1;
+    while (lo < hi) {
+      int mid = lo + (hi - lo + 1) / 2;
+      if (group_tile_offsets[mid] <= linear_idx) {
+        lo = mid;
       }
       else {
-        ctas_along_m = divmod_cta_shape_m.divide(cute::shape<0>(problem_shapes.get_problem_shape(group_info.group_idx)) +  divmod_cta_shape_m.divisor - 1);
-        ctas_along_n = divmod_cta_shape_n.divide(cute::shape<1>(problem_shapes.get_problem_shape(group_info.group_idx)) +  divmod_cta_shape_n.divisor - 1);
+        hi = mid - 1;
       }
-      problem_blocks_m = round_up(ctas_along_m, (1 << log_swizzle_size) * cluster_shape.m());
-      problem_blocks_n = round_up(ctas_along_n, (1 << log_swizzle_size) * cluster_shape.n());
-      group_info.total_tiles = problem_blocks_m * problem_blocks_n;
     }
 
+    group_info.group_idx = lo;
+    group_info.start_linear_idx = group_tile_offsets[lo];
+    group_info.total_tiles = group_tile_offsets[lo + 1] - group_tile_offsets[lo];
+    return true;
+  }
+
+  // Fills group_tile_offsets (groups + 1 entries) with the cumulative tile counts of the host problem shapes
+  static void
+  get_group_tile_offsets(
+      GroupProblemShape const& problem_shapes,
+      GemmCoord cta_shape,
+      GemmCoord cluster_shape,
+      int32_t log_swizzle_size,
+      uint64_t* group_tile_offsets) {
+
+    FastDivmodU64 divmod_cta_shape_m(cta_shape.m());
+    FastDivmodU64 divmod_cta_shape_n(cta_shape.n());
+
+    group_tile_offsets[0] = 0;
+    for (int group = 0; group < problem_shapes.groups(); ++group) {
+      auto [problem_blocks_m, problem_blocks_n] = get_problem_blocks_m_and_n(
+        problem_shapes.get_host_problem_shape(group), cta_shape, cluster_shape,
+        divmod_cta_shape_m, divmod_cta_shape_n, log_swizzle_size);
+      group_tile_offsets[group + 1] = group_tile_offsets[group] + problem_blocks_m * problem_blocks_n;
+    }
+  }
+
+  // get work_idx_m, work_idx_n from linear_idx while applying swizzle
+  static CUTLASS_DEVICE
+  WorkTileInfo
+  get_work_idx_m_and_n(
+      uint64_t linear_idx,
+      struct GroupInfo& group_info,
+      GroupProblemShape &problem_shapes,
+      GemmCoord cta_shape,
+      GemmCoord cluster_shape,
+      FastDivmodU64Pow2 const& divmod_cluster_shape_major,
+      FastDivmodU64Pow2 const& divmod_cluster_shape_minor,
+      FastDivmodU64 const& divmod_cta_shape_m,
+      FastDivmodU64 const& divmod_cta_shape_n,
+      int32_t log_swizzle_size, 
+      RasterOrder raster_order,
+      uint64_t const* group_tile_offsets = nullptr) {
+
+    bool valid_tile = true;
+
+    bool found_group = group_tile_offsets != nullptr ?
+      advance_group_from_offsets(linear_idx, group_info, group_tile_offsets, problem_shapes.groups()) :
+      advance_group_linear(linear_idx, group_info, problem_shapes, cta_shape, cluster_shape,
+                           divmod_cta_shape_m, divmod_cta_shape_n, log_swizzle_size);
+    if (!found_group) {
+      return WorkTileInfo::invalid_work_tile();
+    }
+
+    auto [problem_blocks_m, problem_blocks_n] = get_problem_blocks_m_and_n(
+      problem_shapes.get_problem_shape(group_info.group_idx), cta_shape, cluster_shape,
+      divmod_cta_shape_m, divmod_cta_shape_n, log_swizzle_size);
+
     uint64_t cluster_id, cluster_major_offset = 0, cluster_minor_offset = 0;
     uint64_t blk_per_grid_dim = divmod_cluster_shape_minor.divide(linear_idx - group_info.start_linear_idx);
     divmod_cluster_shape_major(cluster_id, cluster_major_offset, blk_per_grid_dim);
@@ -402,17 +541,41 @@ public:
     return false;
   }
 
-  // The basic tile scheduler does not require any additional workspace
-  template <class ProblemShape, class ElementAccumulator>
+  // Workspace is only needed for the optional group tile offsets table
+  template <class TileShape, class ClusterShape>
   static size_t
-  get_workspace_size(Arguments const&, ProblemShape, KernelHardwareInfo const&, uint32_t, const uint32_t = 1, uint32_t = 1) {
-    return 0;
+  get_workspace_size(Arguments const& args, GroupProblemShape problem_shapes, TileShape, ClusterShape, KernelHardwareInfo const&) {
+    if (!args.use_group_tile_offsets || !problem_shapes.is_host_problem_shape_available()) {
+      return 0;
+    }
+    return round_nearest(sizeof(uint64_t) * (problem_shapes.groups() + 1), MinWorkspaceAlignment);
   }
 
-  template <class ProblemShape, class ElementAccumulator>
+  template <class TileShape, class ClusterShape>
   static cutlass::Status
-  initialize_workspace(Arguments const&, void*, cudaStream_t, ProblemShape, KernelHardwareInfo const&,
-    uint32_t, const uint32_t = 1, uint32_t = 1, CudaHostAdapter* cuda_adapter = nullptr) {
+  initialize_workspace(Arguments const& args, void* workspace, cudaStream_t stream, GroupProblemShape problem_shapes,
+    TileShape tile_shape, ClusterShape cluster_shape, KernelHardwareInfo const& hw_info,
+    [[maybe_unused]] CudaHostAdapter* cuda_adapter = nullptr) {
+
+    if (get_workspace_size(args, problem_shapes, tile_shape, cluster_shape, hw_info) == 0) {
+      return Status::kSuccess;
+    }
+
+    if (workspace == nullptr) {
+      CUTLASS_TRACE_HOST("  error: device workspace must not be null");
+      return Status::kErrorWorkspaceNull;
+    }
+
+    // Tile counts must be rounded with the same swizzle size as the kernel will use
+    Params params = to_underlying_arguments(problem_shapes, tile_shape, cluster_shape, hw_info, args);
+
+    std::vector<uint64_t> group_tile_offsets(problem_shapes.groups() + 1);
+    get_group_tile_offsets(problem_shapes, params.cta_shape_, params.cluster_shape_, params.log_swizzle_size_,
+                           group_tile_offsets.data());
+
+    auto q = stream ? *stream : compat::get_default_queue();
+    compat::memcpy(workspace, group_tile_offsets.data(), sizeof(uint64_t) * group_tile_offsets.size(), q);
+
     return Status::kSuccess;
   }
 
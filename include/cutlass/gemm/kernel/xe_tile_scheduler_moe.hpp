@@ -31,21 +31,21 @@
  **************************************************************************************************/
 #pragma once
 
-#include "cute/layout.hpp"
-#include "cute/tensor.hpp"
 #include "cutlass/fast_math.h"
-#include "cutlass/gemm/kernel/tile_scheduler_params.h"
 #include "cutlass/gemm_coord.hpp"
 #include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler_params.h"
+#include "cutlass/gemm/kernel/xe_tile_scheduler_group.hpp"
+#include "cute/layout.hpp"
+#include "cute/tensor.hpp"
+
+namespace cutlass::gemm::kernel::detail {
 
-namespace MoE {
-using namespace cutlass::gemm::kernel::detail;
-using namespace cutlass;
-using namespace cutlass::gemm;
-using namespace cute;
 ///////////////////////////////////////////////////////////////////////////////
-// Adapted from xe_tile_scheduler_group.hpp
-// Persistent Thread Block (TB) scheduler for MoE GEMM
+
+// Persistent Thread Block (TB) scheduler for MoE GEMM.
+// All experts share N and K, and the number of rows of each expert is read on the device from
+// num_rows_per_expert, so the host never needs to know how the tokens were routed.
 template <class GroupProblemShape>
 class PersistentTileSchedulerXeMoE
     : public PersistentTileSchedulerXeGroup<GroupProblemShape> {
@@ -56,7 +56,7 @@ class PersistentTileSchedulerXeMoE
 private:
   uint64_t current_work_linear_idx_ = 0;
   uint64_t total_grid_size_ = 0;
-  int32_t *num_rows_per_expert_ = nullptr;
+  int32_t const* num_rows_per_expert_ = nullptr;
   int32_t K_ = 0;
   int32_t N_ = 0;
   int32_t num_experts_ = 0;
@@ -83,7 +83,7 @@ public:
   };
 
   using ProblemShape = typename GroupProblemShape::UnderlyingProblemShape;
-  using Params = PersistentTileSchedulerSm90GroupParams<GroupProblemShape>;
+  using Params = PersistentTileSchedulerXeGroupParams<GroupProblemShape>;
   using RasterOrder = typename Params::RasterOrder;
   using RasterOrderOptions = typename Params::RasterOrderOptions;
   using BaseClass = PersistentTileSchedulerXeGroup<GroupProblemShape>;
@@ -139,7 +139,7 @@ public:
   }
 
   CUTLASS_DEVICE explicit PersistentTileSchedulerXeMoE(
-      Params const &params_, int32_t *num_rows_per_expert, int32_t N, int32_t K,
+      Params const &params_, int32_t const* num_rows_per_expert, int32_t N, int32_t K,
       int32_t num_experts)
       : scheduler_params(params_) {
     num_rows_per_expert_ = num_rows_per_expert;
@@ -299,4 +299,4 @@ public:
   }
 };
 
-} // namespace MoE
+} // namespace cutlass::gemm::kernel::detail
@@ -79,11 +79,20 @@ public:
     // Number of k tiles remaining for the work unit as a whole
     uint32_t k_tile_remaining = 0;
 
+    // Whether this unit of work only reduces the partials written by its peers (ReductionMode::Separate)
+    bool is_separate_reduction = false;
+
     CUTLASS_HOST_DEVICE
     bool
     is_valid() const {
-      // A work tile that computes no K tiles is invalid
-      return k_tile_count > 0;
+      // A work tile that computes no K tiles is invalid unless it is a separate reduction work tile
+      return k_tile_count > 0 || is_separate_reduction;
+    }
+
+    CUTLASS_HOST_DEVICE
+    bool
+    is_reduction_unit() const {
+      return is_separate_reduction;
     }
 
     CUTLASS_HOST_DEVICE
@@ -200,7 +209,7 @@ public:
     return get_current_work_for_linear_idx(current_work_linear_idx_, scheduler_params);
   }
 
-  CUTLASS_DEVICE
+  CUTLASS_HOST_DEVICE
   static WorkTileInfo
   get_current_work_for_linear_idx(uint64_t linear_idx, Params const& params) {
     // The maximum number of work units is units_per_problem_ * splits_.
@@ -208,8 +217,8 @@ public:
     // units_per_problem_ is equal to the total number of output tiles. To account
     // for the fact that we have splits_ peers per output tile, we multiply this
     // value by splits_. For stream-K, this multiplication ends up being a no-op
-    // because splits_ is set to 1 for stream-K.
-    if(linear_idx >= (params.units_per_problem_ * params.divmod_splits_.divisor)) {
+    // because splits_ is set to 1 for stream-K. Separate reduction units follow all other units.
+    if(linear_idx >= (params.units_per_problem_ * params.divmod_splits_.divisor + params.separate_reduction_units_)) {
       // Invalid work. Return an empty result.
       return WorkTileInfo::invalid_work_tile();
     }
@@ -230,7 +239,7 @@ public:
       current_work_linear_idx_, work_tile_info, scheduler_params);
   }
 
-  CUTLASS_DEVICE
+  CUTLASS_HOST_DEVICE
   static bool
   continue_current_work_for_linear_idx(
     uint64_t linear_idx,
@@ -282,12 +291,124 @@ public:
     );
   }
 
+  // Returns whether the output tile at `tile_idx` is split across work-groups and reduced by a
+  // separate reduction unit.
+  CUTLASS_HOST_DEVICE
+  static bool
+  is_separately_reduced_tile(Params const& params, uint64_t tile_idx) {
+    // Stream-K tiles precede data-parallel tiles in the linearized tile space. Every tile
+    // is reduced in a split-K decomposition.
+    return params.requires_separate_reduction() &&
+           (params.divmod_splits_.divisor > 1 || tile_idx < params.sk_tiles_);
+  }
+
   // Returns whether fixup is needed for `work_tile_info`.
   CUTLASS_HOST_DEVICE
   static bool
   requires_fixup(Params const& params, WorkTileInfo const& work_tile_info) {
-    // Fixup is not needed for invalid or data-parallel tiles
-    return work_tile_info.is_valid() && work_tile_info.k_tile_count != params.divmod_tiles_per_output_tile_.divisor;
+    if (!work_tile_info.is_valid()) {
+      return false;
+    }
+
+    // With separate reduction every peer of a split tile, including one that happens to cover
+    // all of its K tiles, hands its partials to the reduction unit.
+    if (work_tile_info.is_reduction_unit() ||
+        is_separately_reduced_tile(params, output_tile_index(params, work_tile_info))) {
+      return true;
+    }
+
+    // Fixup is not needed for data-parallel tiles
+    return work_tile_info.k_tile_count != params.divmod_tiles_per_output_tile_.divisor;
+  }
+
+  // Returns whether the current work tile computes any K tiles. Separate reduction units only
+  // reduce partials from their peers and must skip the mainloop.
+  CUTLASS_HOST_DEVICE
+  static bool
+  valid_warpgroup_in_work_tile(WorkTileInfo const& work_tile_info) {
+    return !work_tile_info.is_reduction_unit();
+  }
+
+  // Returns whether the kernel uses separate reduction units
+  CUTLASS_HOST_DEVICE
+  static bool
+  requires_separate_reduction(Params const& params) {
+    return params.requires_separate_reduction();
+  }
+
+  // Returns the number of partial tiles held in the reduction workspace for each split output tile
+  CUTLASS_HOST_DEVICE
+  static uint32_t
+  reduction_peers_per_tile(Params const& params) {
+    if (!params.requires_separate_reduction()) {
+      return 1;
+    }
+    if (params.divmod_splits_.divisor > 1) {
+      return params.divmod_splits_.divisor;
+    }
+    return Params::max_peers_per_tile(params.sk_units_, params.sk_tiles_);
+  }
+
+  // Returns the peer indices (first, mine, last) of the work units that compute the output tile
+  // at `tile_idx`, where `mine` is the unit that computes the K tile at offset `k_tile_start` within
+  // that tile. The peer count of the tile is last - first + 1. Only defined for decompositions
+  // without groups, which is always the case for separate reduction.
+  CUTLASS_HOST_DEVICE
+  static cute::tuple<uint32_t, uint32_t, uint32_t>
+  tile_peer_range(Params const& params, uint32_t tile_idx, uint32_t k_tile_start) {
+    uint32_t k_tiles_per_output_tile = params.divmod_tiles_per_output_tile_.divisor;
+    uint32_t k_tiles_per_unit = params.divmod_k_tiles_per_sk_unit_.divisor;
+    uint32_t big_unit_k_tiles = params.big_units_ * (k_tiles_per_unit + 1);
+
+    // Returns the unit that, before any min_iters_per_sk_unit_ adjustment, computes `k_tile`.
+    // Big units precede normal units.
+    auto find_unit_unadjusted = [&](uint32_t k_tile) {
+      if (k_tile < big_unit_k_tiles) {
+        return static_cast<uint32_t>(params.divmod_k_tiles_per_sk_big_unit_.divide(k_tile));
+      }
+      return params.big_units_ + static_cast<uint32_t>(params.divmod_k_tiles_per_sk_unit_.divide(k_tile - big_unit_k_tiles));
+    };
+
+    if (params.divmod_splits_.divisor > 1) {
+      // Each split covers a contiguous K range of every output tile
+      return cute::make_tuple(0u, find_unit_unadjusted(k_tile_start), static_cast<uint32_t>(params.divmod_splits_.divisor - 1));
+    }
+
+    // Returns the starting k iteration of `unit` after applying the same min_iters_per_sk_unit_
+    // adjustment as assign_work
+    auto unit_iter_start = [&](uint32_t unit) {
+      uint32_t iter_start = unit * k_tiles_per_unit + cute::min(unit, params.big_units_);
+      int unused, start_tile_k_tile;
+      params.divmod_tiles_per_output_tile_(unused, start_tile_k_tile, iter_start);
+      if (static_cast<uint32_t>(start_tile_k_tile) < Params::min_iters_per_sk_unit_) {
+        return iter_start - start_tile_k_tile;
+      }
+      else if (static_cast<uint32_t>(start_tile_k_tile) > (k_tiles_per_output_tile - Params::min_iters_per_sk_unit_)) {
+        return iter_start + (k_tiles_per_output_tile - start_tile_k_tile);
+      }
+      return iter_start;
+    };
+
+    // Adjusted unit boundaries move by less than min_iters_per_sk_unit_ K tiles, which is no larger
+    // than a unit, so the unit covering `k_tile` is a direct neighbor of its unadjusted unit.
+    // Units emptied by the adjustment are skipped.
+    auto find_unit = [&](uint32_t k_tile) {
+      uint32_t unit = find_unit_unadjusted(k_tile);
+      while (unit > 0 && k_tile < unit_iter_start(unit)) {
+        --unit;
+      }
+      while (unit + 1 < params.sk_units_ && k_tile >= unit_iter_start(unit + 1)) {
+        ++unit;
+      }
+      return unit;
+    };
+
+    uint32_t tile_iter_start = tile_idx * k_tiles_per_output_tile;
+    return cute::make_tuple(
+      find_unit(tile_iter_start),
+      find_unit(tile_iter_start + k_tile_start),
+      find_unit(tile_iter_start + k_tiles_per_output_tile - 1)
+    );
   }
 
   // Performs the reduction across splits for a given output tile.
@@ -326,6 +447,12 @@ template <class FrgTensorC>
     }
     auto tile_idx = output_tile_index(params, work_tile_info);
 
+    if (params.requires_separate_reduction()) {
+      separate_reduction_fixup<FrgTensorC, BarrierManager>(
+        params, work_tile_info, accumulators, tile_idx, num_barriers, barrier_idx, num_accumulator_mtxs);
+      return;
+    }
+
     // Index of the lock on which to wait
     auto lock_idx = (tile_idx * num_barriers) + barrier_idx;
 
@@ -402,11 +529,79 @@ template <class FrgTensorC>
     }
   }
 
+  // Fixup for ReductionMode::Separate. Each peer stores its partials to its own slot of the tile's
+  // workspace and signals its arrival. The reduction unit of the tile waits for all peers and sums
+  // the partials in K order into its accumulators, on which it then computes the epilogue.
+  template <class FrgTensorC, class BarrierManager>
+  CUTLASS_DEVICE
+  static void
+  separate_reduction_fixup(
+    Params const& params,
+    WorkTileInfo const& work_tile_info,
+    FrgTensorC& accumulators,
+    uint64_t tile_idx,
+    uint32_t num_barriers,
+    uint32_t barrier_idx,
+    uint32_t num_accumulator_mtxs) {
+
+    using ElementAccumulator = typename FrgTensorC::value_type;
+    using AccumulatorArrayT = Array<typename FrgTensorC::value_type, size(FrgTensorC{})>;
+    using BlockStripedReduceT = BlockStripedReduce<ThreadsPerBlock, AccumulatorArrayT>;
+
+    auto lock_idx = (tile_idx * num_barriers) + barrier_idx;
+    int barrier_group_thread_idx = ThreadIdxX();
+
+    uint32_t reduction_tiles = params.divmod_splits_.divisor > 1 ? params.units_per_problem_ : params.sk_tiles_;
+    uint32_t peers_per_tile = reduction_peers_per_tile(params);
+
+    auto reduction_workspace_size = Params::get_reduction_workspace_size(
+      reduction_tiles * peers_per_tile, to_gemm_coord(TileShape{}), sizeof_bits<ElementAccumulator>::value, num_accumulator_mtxs);
+    BarrierType* lock_workspace = reinterpret_cast<BarrierType*>(
+      reinterpret_cast<uint8_t*>(params.reduction_workspace_) + reduction_workspace_size);
+
+    // Partials of the peers of a tile occupy consecutive slots
+    uint64_t peer_elements = cute::size<0>(TileShape{}) * cute::size<1>(TileShape{}) * num_accumulator_mtxs;
+    ElementAccumulator* tile_reduction_workspace =
+      reinterpret_cast<ElementAccumulator*>(params.reduction_workspace_) + peer_elements * tile_idx * peers_per_tile;
+    auto peer_reduction_workspace = [&](uint32_t peer) {
+      return reinterpret_cast<AccumulatorArrayT*>(tile_reduction_workspace + peer_elements * peer);
+    };
+    AccumulatorArrayT* accumulator_array = reinterpret_cast<AccumulatorArrayT*>(accumulators.data());
+
+    auto [first_peer, my_peer, last_peer] = tile_peer_range(params, static_cast<uint32_t>(tile_idx), work_tile_info.K_idx);
+
+    if (work_tile_info.is_reduction_unit()) {
+      uint32_t num_peers = last_peer - first_peer + 1;
+
+      // Wait until all peers have stored their partials
+      BarrierManager::wait_eq(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, num_peers);
+
+      BlockStripedReduceT::load(*accumulator_array, peer_reduction_workspace(0), barrier_group_thread_idx);
+      for (uint32_t peer = 1; peer < num_peers; ++peer) {
+        BlockStripedReduceT::load_add(*accumulator_array, peer_reduction_workspace(peer), barrier_group_thread_idx);
+      }
+    }
+    else {
+      BlockStripedReduceT::store(peer_reduction_workspace(my_peer - first_peer), *accumulator_array, barrier_group_thread_idx);
+
+      // Signal our arrival
+      BarrierManager::arrive_inc(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, 1);
+    }
+  }
+
   // Returns whether the block assigned this work should compute the epilogue for the corresponding
   // output tile. For the case of stream-K, this should only occur if the work is marked as the final split.
   CUTLASS_HOST_DEVICE
   static bool
   compute_epilogue(WorkTileInfo const& work_tile_info, Params const& params) {
+    // With separate reduction, only the reduction unit of a split tile computes its epilogue
+    if (work_tile_info.is_reduction_unit()) {
+      return true;
+    }
+    if (is_separately_reduced_tile(params, output_tile_index(params, work_tile_info))) {
+      return false;
+    }
+
     // `is_final_split` will be set to `true` for the following scenarios, all of which must compute the epilogue:
     //  1. The tile is computed in data-parallel mode
     //  2. The tile is computed in split-/stream-K mode and this work unit represents the final split of the tile
@@ -415,7 +610,7 @@ template <class FrgTensorC>
   }
 
   // Returns the linearized index of the output tile corresponding to the tile with offset [L, M, K]
-  CUTLASS_DEVICE
+  CUTLASS_HOST_DEVICE
   static int
   output_tile_index(Params const& params, WorkTileInfo const& work_tile_info) {
     uint64_t linear_idx_in_batch = Params::get_linear_idx_from_m_and_n(
@@ -452,7 +647,8 @@ template <class FrgTensorC>
       args.splits,
       args.decomposition_mode,
       sizeof_bits<BarrierType>::value,
-      sizeof_bits<ElementAccumulator>::value
+      sizeof_bits<ElementAccumulator>::value,
+      args.reduction_mode
     );
   }
 
@@ -485,7 +681,8 @@ template <class FrgTensorC>
       args.splits,
       args.decomposition_mode,
       sizeof_bits<BarrierType>::value,
-      sizeof_bits<ElementAccumulator>::value
+      sizeof_bits<ElementAccumulator>::value,
+      args.reduction_mode
     );
   }
 
@@ -526,7 +723,7 @@ private:
   // Sets the current stream-K work to compute within work_tile_info. If new_unit is true, work_tile_info
   // is populated as a new unit of work. Otherwise, state existing in work_tile_info (e.g., remaining
   // iterations) is used to find the next tile in the current work unit.
-CUTLASS_DEVICE
+  CUTLASS_HOST_DEVICE
   static void
   assign_work(
     Params const& params,
@@ -534,7 +731,17 @@ CUTLASS_DEVICE
     WorkTileInfo& work_tile_info) {
 
     uint64_t output_tile_id = linear_idx;
-    if (linear_idx >= params.sk_units_ && params.divmod_splits_.divisor == 1) {
+    uint64_t total_units = params.units_per_problem_ * params.divmod_splits_.divisor;
+    if (linear_idx >= total_units) {
+      // Separate reduction work. Reduction units are assigned to split tiles in order, and split
+      // tiles are the leading tiles of the linearized tile space.
+      output_tile_id = linear_idx - total_units;
+      work_tile_info.K_idx = 0;
+      work_tile_info.k_tile_count = 0;
+      work_tile_info.k_tile_remaining = 0;
+      work_tile_info.is_separate_reduction = true;
+    }
+    else if (linear_idx >= params.sk_units_ && params.divmod_splits_.divisor == 1) {
       // Data-parallel work
       output_tile_id = linear_idx - params.sk_units_ + params.sk_tiles_;
       work_tile_info.K_idx = 0;
@@ -543,15 +750,24 @@ CUTLASS_DEVICE
     }
     else {
 
+      // Stream-K units are interleaved across groups: consecutive units belong to consecutive groups.
+      // Split-K decompositions always use a single group.
+      uint64_t unit_idx_in_group, group_idx;
+      params.divmod_sk_groups_(unit_idx_in_group, group_idx, linear_idx);
+
       // Determine whether we are in a "big unit" within the group, that will process
-      // an additional K chunk in the group.
-      auto sk_tiles_in_group = params.sk_tiles_;
+      // an additional K chunk in the group. The first big_groups_ groups cover one
+      // extra stream-K tile.
+      auto sk_tiles_in_group = params.divmod_sk_groups_.divide(params.sk_tiles_);
+      if (group_idx < params.big_groups_) {
+        ++sk_tiles_in_group;
+      }
       auto k_tiles_in_group = sk_tiles_in_group * params.divmod_tiles_per_output_tile_.divisor;
       auto k_tiles_per_unit_in_group = params.divmod_sk_units_per_group_.divide(k_tiles_in_group);
       auto big_units_in_group = k_tiles_in_group - (k_tiles_per_unit_in_group * params.divmod_sk_units_per_group_.divisor);
 
       uint64_t split;
-      params.divmod_sk_units_per_group_(split, output_tile_id, output_tile_id);
+      params.divmod_sk_units_per_group_(split, output_tile_id, unit_idx_in_group);
 
       bool is_split_k = params.divmod_splits_.divisor > 1;
       auto big_unit_cmp_lhs = is_split_k ? split : output_tile_id;
@@ -560,7 +776,7 @@ CUTLASS_DEVICE
       auto k_tiles_per_split = is_split_k ? params.divmod_k_tiles_per_sk_unit_.divisor : k_tiles_per_unit_in_group;
 
       // Determine the starting k iteration computed by this stream-K work unit
-      uint32_t unit_iter_start = (linear_idx_mult * linear_idx) + (k_tiles_per_split * split);
+      uint32_t unit_iter_start = (linear_idx_mult * unit_idx_in_group) + (k_tiles_per_split * split);
 
       // Adjust the starting position and number of k iterations for "big units," which
       // compute one extra iteration. If there are any big units, they will be the first
@@ -668,17 +884,17 @@ CUTLASS_DEVICE
 
       // Convert the output tile from the linearized space within each group to the
       // overall linearized space.
-      output_tile_id = output_tile_id_in_group * params.divmod_sk_groups_.divisor;
+      output_tile_id = output_tile_id_in_group * params.divmod_sk_groups_.divisor + group_idx;
 
       // The unit's starting k iteration in the current tile is either the starting
       // iteration for the tile as a whole, or the starting k iteration for the unit
       // as a whole (if the latter is greater than the former).
-      uint32_t tile_iter_start = max(output_tile_iter_start, unit_iter_start);
+      uint32_t tile_iter_start = cute::max(output_tile_iter_start, unit_iter_start);
 
       // Similarly, the unit's ending k iteration (exclusive) is either the end of
       // the current tile it is assigned, or the ending iteration of the unit as a whole
       // (if the latter is less than the former).
-      uint32_t tile_iter_end = min(output_tile_iter_end, unit_iter_end + 1);
+      uint32_t tile_iter_end = cute::min(output_tile_iter_end, unit_iter_end + 1);
 
       // Set the k offset to be the starting k tile for this output tile
       work_tile_info.K_idx = static_cast<int32_t>(tile_iter_start - output_tile_iter_start);
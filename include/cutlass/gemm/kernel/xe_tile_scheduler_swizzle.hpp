@@ -0,0 +1,265 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/fast_math.h"
+#include "cutlass/gemm_coord.hpp"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler_params.h"
+#include "cute/layout.hpp"
+#include "cute/tensor.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Parameters for the non-persistent swizzled Xe tile scheduler
+struct SwizzledTileSchedulerXeParams {
+  using RasterOrder = cutlass::gemm::kernel::detail::RasterOrder;
+  using RasterOrderOptions = cutlass::gemm::kernel::detail::RasterOrderOptions;
+  using UnderlyingParams = PersistentTileSchedulerSm90Params;
+
+  // Number of output tiles along the major (slow-moving) raster dimension
+  FastDivmodU64 divmod_blk_major_{};
+
+  // Number of work-groups launched per batch. The minor dimension is rounded up to
+  // a multiple of the swizzle size, so this may exceed problem_tiles_m_ * problem_tiles_n_.
+  uint64_t blocks_per_problem_ = 0;
+  int32_t log_swizzle_size_ = 0;
+  RasterOrder raster_order_ = RasterOrder::AlongN;
+
+  uint32_t problem_tiles_m_ = 0;
+  uint32_t problem_tiles_n_ = 0;
+  uint32_t problem_tiles_l_ = 0;
+
+  // Initializes members from the number of work-group tiles in the M, N and L dimensions.
+  void
+  initialize(
+    dim3 problem_blocks,
+    int max_swizzle_size,
+    RasterOrderOptions raster_order_option
+  ) {
+    auto log_swizzle_size = UnderlyingParams::get_log_swizzle_size(problem_blocks.x, problem_blocks.y, max_swizzle_size);
+    RasterOrder raster_order = UnderlyingParams::get_rasterization_order(
+      problem_blocks.x,
+      problem_blocks.y,
+      raster_order_option
+    );
+
+    // Only the minor dimension is traversed in units of the swizzle size, so only it needs padding
+    uint64_t blocks_minor, blocks_major;
+    if (raster_order == RasterOrder::AlongN) {
+      blocks_minor = problem_blocks.x;
+      blocks_major = problem_blocks.y;
+    }
+    else {
+      blocks_minor = problem_blocks.y;
+      blocks_major = problem_blocks.x;
+    }
+    blocks_minor = round_up(blocks_minor, uint64_t(1) << log_swizzle_size);
+
+    //
+    // Set members
+    //
+
+    divmod_blk_major_ = FastDivmodU64(blocks_major);
+    blocks_per_problem_ = blocks_minor * blocks_major;
+    log_swizzle_size_ = log_swizzle_size;
+    raster_order_ = raster_order;
+
+    problem_tiles_m_ = problem_blocks.x;
+    problem_tiles_n_ = problem_blocks.y;
+    problem_tiles_l_ = problem_blocks.z;
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Non-persistent scheduler for Intel Xe GEMMs. One work-group is launched per output tile
+// and the linear work-group index is remapped so that groups of 2^log_swizzle_size tiles
+// along the minor raster dimension are visited before moving along the major dimension.
+// This keeps the A (or B) tiles of a swizzle band resident in L2 while the other operand
+// is streamed.
+class SwizzledTileSchedulerXe {
+public:
+  struct WorkTileInfo {
+    int32_t M_idx = 0;
+    int32_t N_idx = 0;
+    int32_t L_idx = 0;
+    bool is_valid_tile = false;
+
+    CUTLASS_HOST_DEVICE
+    bool
+    is_valid() const {
+      return is_valid_tile;
+    }
+
+    CUTLASS_HOST_DEVICE
+    static WorkTileInfo
+    invalid_work_tile() {
+      return {-1, -1, -1, false};
+    }
+  };
+
+  using Params = SwizzledTileSchedulerXeParams;
+  using RasterOrder = typename Params::RasterOrder;
+  using RasterOrderOptions = typename Params::RasterOrderOptions;
+
+  struct Arguments {
+    int max_swizzle_size = 1;
+    RasterOrderOptions raster_order = RasterOrderOptions::Heuristic;
+  };
+
+  //
+  // Methods
+  //
+
+  template <class ProblemShapeMNKL, class TileShape, class ClusterShape>
+  static Params
+  to_underlying_arguments(
+    ProblemShapeMNKL problem_shape_mnkl,
+    TileShape tile_shape,
+    ClusterShape cluster_shape,
+    [[maybe_unused]] KernelHardwareInfo const& hw_info,
+    Arguments const& arguments,
+    [[maybe_unused]] void* workspace = nullptr) {
+
+    // We only need the tile and cluster shape during scheduler setup, so let FTAD do the magic
+    static_assert(cute::is_static<TileShape>::value);
+    static_assert(cute::is_static<ClusterShape>::value);
+
+    dim3 problem_blocks = get_tiled_cta_shape_mnl(problem_shape_mnkl, tile_shape);
+
+    Params params;
+    params.initialize(
+      problem_blocks,
+      arguments.max_swizzle_size,
+      arguments.raster_order
+    );
+
+    return params;
+  }
+
+  static bool
+  can_implement(Arguments const& args) {
+    return args.max_swizzle_size >= 1;
+  }
+
+  // Given the inputs, computes the number of output tiles along M, N and L.
+  template <class ProblemShapeMNKL, class BlockShape>
+  CUTLASS_HOST_DEVICE static
+  dim3
+  get_tiled_cta_shape_mnl(ProblemShapeMNKL problem_shape_mnkl, BlockShape cta_shape) {
+    auto cta_m = cute::size(cute::ceil_div(cute::shape<0>(problem_shape_mnkl), cute::shape<0>(cta_shape)));
+    auto cta_n = cute::size(cute::ceil_div(cute::shape<1>(problem_shape_mnkl), cute::shape<1>(cta_shape)));
+    auto cta_l = cute::size(cute::get<3>(problem_shape_mnkl));
+
+    return {
+      static_cast<uint32_t>(cta_m),
+      static_cast<uint32_t>(cta_n),
+      static_cast<uint32_t>(cta_l)
+    };
+  }
+
+  // Computes the physical grid: a 1D range of work-groups per batch, batches along Z.
+  CUTLASS_HOST_DEVICE static
+  dim3
+  get_grid_shape(Params const& params) {
+    return {
+      static_cast<uint32_t>(params.blocks_per_problem_),
+      1u,
+      params.problem_tiles_l_
+    };
+  }
+
+  // Maps a linear work-group index within a batch to (work_idx_m, work_idx_n) while applying swizzle
+  CUTLASS_HOST_DEVICE static
+  cute::tuple<int32_t, int32_t>
+  get_work_idx_m_and_n(
+      uint64_t linear_idx,
+      FastDivmodU64 const& divmod_blk_major,
+      int32_t log_swizzle_size,
+      RasterOrder raster_order) {
+
+    uint64_t offset = linear_idx & ((uint64_t(1) << log_swizzle_size) - 1);
+    uint64_t extra = linear_idx >> log_swizzle_size;
+
+    uint64_t blk_idx_minor_div_swizzle, blk_idx_major;
+    divmod_blk_major(blk_idx_minor_div_swizzle, blk_idx_major, extra);
+
+    auto minor_work_idx = static_cast<int32_t>((blk_idx_minor_div_swizzle << log_swizzle_size) + offset);
+    auto major_work_idx = static_cast<int32_t>(blk_idx_major);
+
+    if (raster_order == RasterOrder::AlongN) {
+      return {minor_work_idx, major_work_idx};
+    }
+    else {
+      return {major_work_idx, minor_work_idx};
+    }
+  }
+
+  // Returns the work tile for a given linear work-group index and batch. Work-groups that fall into
+  // the swizzle padding of the minor dimension receive an invalid tile.
+  CUTLASS_HOST_DEVICE static
+  WorkTileInfo
+  get_work_for_linear_idx(Params const& params, uint64_t linear_idx, int32_t l_idx) {
+    if (linear_idx >= params.blocks_per_problem_) {
+      return WorkTileInfo::invalid_work_tile();
+    }
+
+    auto [work_idx_m, work_idx_n] = get_work_idx_m_and_n(linear_idx,
+                                                         params.divmod_blk_major_,
+                                                         params.log_swizzle_size_,
+                                                         params.raster_order_);
+
+    if (work_idx_m >= static_cast<int32_t>(params.problem_tiles_m_) ||
+        work_idx_n >= static_cast<int32_t>(params.problem_tiles_n_)) {
+      return WorkTileInfo::invalid_work_tile();
+    }
+
+    return {work_idx_m, work_idx_n, l_idx, true};
+  }
+
+  SwizzledTileSchedulerXe() = default;
+
+  CUTLASS_DEVICE explicit SwizzledTileSchedulerXe(Params const& params) : scheduler_params(params) {}
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work() const {
+    return get_work_for_linear_idx(scheduler_params, uint64_t(BlockIdxX()), int32_t(BlockIdxZ()));
+  }
+
+private:
+  Params scheduler_params;
+};
+
+} // namespace cutlass::gemm::kernel::detail
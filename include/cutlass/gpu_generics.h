@@ -373,6 +373,21 @@ CUTLASS_DEVICE T atomicSub(T *address, T val) {
   return static_cast<T>(0);
 }
 
+template <typename T>
+CUTLASS_DEVICE T atomicMax(T *address, T val) {
+#if defined(__SYCL_DEVICE_ONLY__)
+  return compat::atomic_fetch_max<sycl::access::address_space::global_space>(address, val);
+#endif
+  return static_cast<T>(0);
+}
+
+template <typename T>
+CUTLASS_DEVICE T atomicMin(T *address, T val) {
+#if defined(__SYCL_DEVICE_ONLY__)
+  return compat::atomic_fetch_min<sycl::access::address_space::global_space>(address, val);
+#endif
+  return static_cast<T>(0);
+}
 
 CUTLASS_DEVICE int atomicCAS(int *address, int compare, int val) {
   int result = 0;
@@ -412,6 +427,9 @@ cudaError_t cudaGetLastError() {
 
 CUTLASS_HOST_DEVICE
 cudaError_t cudaGetDevice(int *device) {
+#if !defined(__SYCL_DEVICE_ONLY__)
+  *device = static_cast<int>(compat::get_current_device_id());
+#endif
   return cudaSuccess;
 }
 
@@ -109,7 +109,10 @@ fill_workspace(void* workspace, T fill_value, size_t fill_count, cudaStream_t st
 
     CUTLASS_TRACE_HOST("  filling workspace");
 
-#if defined(CUTLASS_ENABLE_CUDA_HOST_ADAPTER) && CUTLASS_ENABLE_CUDA_HOST_ADAPTER
+#if defined (CUTLASS_ENABLE_SYCL)
+    auto q = stream ? *stream : compat::get_default_queue();
+    compat::fill_async(workspace, fill_value, fill_count, q);
+#elif defined(CUTLASS_ENABLE_CUDA_HOST_ADAPTER) && CUTLASS_ENABLE_CUDA_HOST_ADAPTER
     //
     // Use the cuda host adapter
     //
@@ -30,7 +30,9 @@
 #
 #################################################################################################
 
+from collections import namedtuple
 import ctypes
+import hashlib
 import json
 import pathlib
 import os
@@ -137,6 +139,9 @@ def CDLLBin(host_binary):
     return host_lib
 
 
+CacheInfo = namedtuple("CacheInfo", ["hits", "disk_hits", "misses"])
+
+
 class ArtifactManager:
     """
     Artifact manager
@@ -177,6 +182,7 @@ class ArtifactManager:
         self.nvcc()
         self.compiled_cache_device = {}
         self.compiled_cache_host = {}
+        self.reset_cache_info()
 
     def nvrtc(self):
         self.backend = "nvrtc"
@@ -193,6 +199,32 @@ class ArtifactManager:
     def _is_sycl(self):
         return self.backend == "dpcpp"
 
+    def cache_info(self):
+        """
+        Returns the number of operations served from the in-process cache (``hits``), of
+        which ``disk_hits`` were loaded from the on-disk cache, and the number that had to
+        be compiled (``misses``).
+        """
+        return CacheInfo(self._cache_hits, self._cache_disk_hits, self._cache_misses)
+
+    def reset_cache_info(self):
+        self._cache_hits = 0
+        self._cache_disk_hits = 0
+        self._cache_misses = 0
+
+    def operation_key(self, operation, compile_options):
+        """
+        Key of an operation in the compiled-operation caches: a hash of the emitted source,
+        the backend, the compilation flags and the target architecture
+        """
+        key = "\n".join([
+            operation.rt_module.emit(),
+            operation.procedural_name(),
+            self.backend,
+            compile_options.get_str(),
+        ])
+        return hashlib.sha256(key.encode()).hexdigest()
+
     def insert_operation(self, op_key, cubin, hostfile, op_name, op_attrs):
         connection = sqlite3.connect(CACHE_FILE)
         cursor = connection.cursor()
@@ -221,7 +253,8 @@ class ArtifactManager:
                 q = dpctl.SyclQueue(cutlass_cppgen.sycl_device())
                 module = dpctl.program.create_program_from_spirv(
                     q, cubin_image)
-                kernel = module.get_sycl_kernel(operation_name)
+                # Free function kernels always have a name prefix.
+                kernel = module.get_sycl_kernel(f"__sycl_kernel_{operation_name}")
             else:
                 err, module = cuda.cuModuleLoadData(cubin_image)
                 if err != cuda.CUresult.CUDA_SUCCESS:
@@ -454,9 +487,9 @@ class ArtifactManager:
 
         return cubin_image, host_lib, temp_dst
 
-    def add_module(self, operations, compile_options=None, bypass_cache=False):
+    def _compile_options(self, compile_options):
         """
-        Insert a new compiled device module
+        Returns the device and host compilation options for the current backend
         """
         include_paths = [
             CUTLASS_PATH + "/include",
@@ -481,23 +514,47 @@ class ArtifactManager:
         if compile_options is None:
             compile_options = CompilationOptions(
                 self.default_compile_options, arch, include_paths, self._is_sycl())
+
+        return compile_options, host_compile_options
+
+    def warmup(self, operations, compile_options=None):
+        """
+        Precompiles a list of operations so that later calls to ``add_module`` for them are
+        served from the cache. Operations missing from the on-disk cache are compiled and
+        stored, so the cost is only paid by the first process.
+
+        :return: cache statistics accumulated while warming up
+        :rtype: CacheInfo
+        """
+        before = self.cache_info()
+        for operation in operations:
+            self.add_module([operation,], compile_options)
+        after = self.cache_info()
+        return CacheInfo(*[a - b for a, b in zip(after, before)])
+
+    def add_module(self, operations, compile_options=None, bypass_cache=False):
+        """
+        Insert a new compiled device module
+        """
+        compile_options, host_compile_options = self._compile_options(compile_options)
+
         # save the cubin
         operation_key = []
         operation_list = []
         for operation in operations:
             # step 1: get kernel string as key
-            key = operation.rt_module.emit() + operation.procedural_name() + self.backend
+            key = self.operation_key(operation, compile_options)
             # step 1: check if the operation is in cache
             compiled_kernel = self.compiled_cache_device.get(key)
 
-            # TODO(Lukas): Caching is currently deactivated for SYCL and needs
-            #              to be enabled.
-            if compiled_kernel is None and not bypass_cache and not self._is_sycl():
+            if compiled_kernel is None and not bypass_cache:
                 hit = self.load_operation(key, getattr( operation.rt_module, "extra_funcs", {}))
                 if hit:
                     compiled_kernel = self.compiled_cache_device.get(key)
                     assert compiled_kernel is not None
+                    self._cache_disk_hits += 1
             if compiled_kernel is not None:
+                self._cache_hits += 1
                 operation.rt_module.kernel = compiled_kernel
                 compiled_host_fns = self.compiled_cache_host.get(key)
                 assert compiled_host_fns is not None
@@ -505,6 +562,7 @@ class ArtifactManager:
                     setattr(operation.rt_module, key, compiled_host_fns[key])
                 operation.rt_module.initialize()
             else:
+                self._cache_misses += 1
                 operation_list.append(operation.rt_module)
                 operation_key.append(key)
 
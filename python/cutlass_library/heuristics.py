@@ -93,6 +93,39 @@ def serialize_heuristics_results_to_json(problems_with_configs, outfile_path):
   with open(outfile_path, 'w') as f:
     json.dump(pc_copy, f, indent=2)
 
+def load_heuristics_problems(path):
+  """
+  Load a heuristics problem list from a JSON or CSV file
+
+  args:
+    path: Path to a JSON file containing a list of problem dictionaries, or a CSV file with one problem per row
+          and the same keys as column names
+
+  returns:
+    A list of dictionaries describing GEMM problems, as expected by `get_gemm_configs`
+  """
+  with open(path, 'r', newline='') as f:
+    if not path.lower().endswith('.csv'):
+      return json.load(f)
+
+    problems = []
+    for row in csv.DictReader(f):
+      problem = {}
+      for k, v in row.items():
+        if k is None or v is None or v.strip() == '':
+          continue
+        k, v = k.strip(), v.strip()
+        if k in ('m', 'n', 'k', 'batch_count', 'alignment_a', 'alignment_b'):
+          problem[k] = int(v)
+        elif k in ('alpha', 'beta'):
+          problem[k] = float(v)
+        elif k == 'use_fast_acc':
+          problem[k] = v.lower() in ('1', 'true', 'yes')
+        else:
+          problem[k] = v
+      problems.append(problem)
+    return problems
+
 def get_single_gemm_config(m, n, k, batch_count, layouts, dtypes, alignment_a, alignment_b, voidC=False, use_fast_acc=True, count=1, provider=None):
   """
   Get heuristic-suggested GEMM kernel configurations for a single GEMM problem.
@@ -117,6 +150,7 @@ def get_single_gemm_config(m, n, k, batch_count, layouts, dtypes, alignment_a, a
       - 'swizzle_size' : suggested threadblock swizzle 
       - 'split_k_slices': number of partitions of the k dimension for splitK
       - 'raster_order': raster order for CTAs over output tiles ('along_m' or 'along_n')
+      - 'tile_scheduler': tile scheduler to use ('persistent' or 'stream_k'), Intel Xe providers only
   """
   if provider is None:
     provider = MatmulHeuristics()
@@ -345,6 +379,62 @@ def generate_sm90_from_heuristics_configs(manifest, cuda_version, kernel_configs
 
   return configs, operations
 
+def generate_xe_from_heuristics_configs(manifest, cuda_version, kernel_configs, arch):
+  """
+  Generate CUTLASS operations for Intel Xe based on the given configs
+
+  Data-parallel configs use the default Xe kernel schedule with the persistent tile scheduler. Stream-K
+  and split-K configs use the cooperative Xe kernel with the stream-K tile scheduler; the split count is
+  a runtime argument of the scheduler and is reported in the testlist.
+
+  Returns tuple of (configs, operations)
+  """
+  configs = []
+  operations = []
+
+  for config in kernel_configs:
+    layout = ([config['layout_a'], config['alignment_a']], [config['layout_b'], config['alignment_b']], [config['layout_d'], 128 // DataTypeSize[config['dtype_d']]])
+    element_a, element_b, element_accumulator, element_c, element_d = config['dtype_a'], config['dtype_b'], config['dtype_acc'], config['dtype_c'], config['dtype_d']
+
+    math_instruction = MathInstruction(
+      [config['instr_tile_m'], config['instr_tile_n'], config['instr_tile_k']],
+      element_a, element_b, element_accumulator,
+      OpcodeClass.TensorOp,
+      MathOperation.multiply_add
+    )
+
+    tile_description = TileDescription(
+      [config['cta_tile_m'], config['cta_tile_n'], config['cta_tile_k']],
+      config['stages'],
+      [config['warp_count_m'], config['warp_count_n'], config['warp_count_k']],
+      math_instruction,
+      arch,
+      arch,
+      [config['cluster_m'], config['cluster_n'], config['cluster_k']]
+    )
+
+    data_type = {
+      "a_type": element_a,
+      "b_type": element_b,
+      "c_type": DataType.void if config['voidC'] else element_c,
+      "d_type": element_d,
+      "acc_type": element_accumulator,
+      "epi_type": element_accumulator
+    }
+
+    if config['tile_scheduler'] == 'stream_k':
+      schedules = [[KernelScheduleType.XeCooperative, EpilogueScheduleType.ScheduleAuto]]
+      tile_schedulers = [TileSchedulerType.StreamK]
+    else:
+      schedules = [[KernelScheduleType.ScheduleAuto, EpilogueScheduleType.ScheduleAuto]]
+      tile_schedulers = [TileSchedulerType.Persistent]
+
+    for o in CreateGemmUniversal3xOperator(manifest, [layout], [tile_description], data_type, schedules, tile_schedulers=tile_schedulers):
+      configs.append(config)
+      operations.append(o)
+
+  return configs, operations
+
 def filter_manifest_and_write_heuristics_file(manifest, args):
   """
   Prune a manifest according to heuristics suggestions from the problems file
@@ -359,21 +449,33 @@ def filter_manifest_and_write_heuristics_file(manifest, args):
   returns:
     A list of dictionaries, each of which has information about an operation and a problem from the input problems
   """
-  heuristics_problems = []
-  with open(args.heuristics_problems_file, 'r') as f:
-    heuristics_problems = json.load(f)
+  heuristics_problems = load_heuristics_problems(args.heuristics_problems_file)
   gpu = None if (args.heuristics_gpu == "auto" or args.heuristics_gpu == "") else args.heuristics_gpu
-  mmh = MatmulHeuristics(gpu=gpu)
-  if any(('100' in arch) for arch in args.architectures.split(';')):
-    mmh.set_cta_div_n(64)
+  architectures = args.architectures.split(';')
+  xe_arch = None
+  for arch, aliases in ((INTEL_XE20, ['20', 'bmg', 'xe2', 'intel_gpu_bmg_g21']), (INTEL_XE12, ['12', 'pvc', 'intel_gpu_pvc'])):
+    if any(a.lower() in aliases for a in architectures):
+      xe_arch = arch
+      break
+
+  if xe_arch is not None:
+    mmh = XeMatmulHeuristics(gpu=gpu if gpu is not None else xe_arch)
+    xe_arch = mmh.arch
+  else:
+    mmh = MatmulHeuristics(gpu=gpu)
+    if any(('100' in arch) for arch in architectures):
+      mmh.set_cta_div_n(64)
   problems_with_configs = get_gemm_configs(heuristics_problems, provider=mmh, count=args.heuristics_configs_per_problem)
 
   all_configs_and_operations = []
   operations = []
   for problem in problems_with_configs:
-    if any('90' in arch for arch in args.architectures.split(';')):
+    problem_configs, problem_operations = [], []
+    if xe_arch is not None:
+        problem_configs, problem_operations = generate_xe_from_heuristics_configs(None if args.heuristics_restrict_kernels else manifest, args.cuda_version, problem['configs'], xe_arch)
+    elif any('90' in arch for arch in architectures):
         problem_configs, problem_operations = generate_sm90_from_heuristics_configs(None if args.heuristics_restrict_kernels else manifest, args.cuda_version, problem['configs'])
-    if any(('100' in arch) or ('101' in arch) for arch in args.architectures.split(';')):
+    if any(('100' in arch) or ('101' in arch) for arch in architectures):
         problem_configs, problem_operations = generate_sm100_from_heuristics_configs(None if args.heuristics_restrict_kernels else manifest, args.cuda_version, problem['configs'])
         
     operations += problem_operations
@@ -46,9 +46,11 @@ try:
   import builtins
   if hasattr(builtins, "CUTLASS_IGNORE_PACKAGE") and CUTLASS_IGNORE_PACKAGE == True:
     raise ImportError("Disabling attempt to import cutlass_library")
-  from cutlass_library.library import DataType, LayoutType
+  from cutlass_library.library import DataType, DataTypeSize, LayoutType
+  from cutlass_library.arch_constants import INTEL_XE12, INTEL_XE20
 except ImportError:
-  from library import DataType, LayoutType
+  from library import DataType, DataTypeSize, LayoutType
+  from arch_constants import INTEL_XE12, INTEL_XE20
 
 class MatmulHeuristics:
 
@@ -173,3 +175,148 @@ class MatmulHeuristics:
 
     return ret
 
+
+class XeMatmulHeuristics:
+  """
+  Analytical kernel ranking for Intel Xe GPUs.
+
+  Scores the tile shapes emitted by GenerateIntelXe together with a data-parallel,
+  stream-K or split-K decomposition for each problem, using a roofline model of a
+  single Xe-core and the number of waves the decomposition needs across all Xe-cores.
+  Exposes the same `get_configs` interface as MatmulHeuristics.
+  """
+
+  # Per-device properties: Xe-core count, XMX throughput for 16-bit operands in FLOP per clock
+  # per Xe-core (doubled for 8-bit operands), clock in GHz and DRAM bandwidth in GB/s
+  devices = {
+    'BMG': {'arch': INTEL_XE20, 'xe_cores': 20, 'flops_per_clk': 2048, 'clock_ghz': 2.85, 'dram_gbps': 456},
+    'PVC': {'arch': INTEL_XE12, 'xe_cores': 128, 'flops_per_clk': 4096, 'clock_ghz': 1.6, 'dram_gbps': 3277},
+  }
+
+  # Work-group tile shapes (M, N) and subgroup layouts emitted by GenerateIntelXe, keyed by operand width in bits
+  tile_shapes = {
+    16: [((256, 256), [8, 4, 1]), ((128, 256), [4, 8, 1]), ((256, 128), [8, 4, 1]), ((128, 128), [4, 4, 1]), ((64, 128), [2, 4, 1])],
+    8:  [((256, 256), [8, 4, 1]), ((128, 256), [4, 8, 1]), ((256, 128), [8, 4, 1]), ((128, 128), [4, 4, 1])],
+  }
+
+  # Split-K factors considered when the output tiles cannot fill the device
+  split_k_candidates = [2, 3, 4, 8]
+
+  # Minimum number of K iterations per stream-K unit, matching PersistentTileSchedulerXeStreamKParams
+  min_iters_per_sk_unit = 8
+
+  def __init__(self, gpu = None):
+    if gpu is None:
+      gpu = 'BMG'
+    if isinstance(gpu, int):
+      gpu = next((name for name, props in self.devices.items() if props['arch'] == gpu), None)
+    if gpu not in self.devices:
+      raise ValueError(f"Unsupported Intel Xe device {gpu}. Supported: {list(self.devices.keys())}")
+    self.gpu = gpu
+    self.props = self.devices[gpu]
+
+  @property
+  def arch(self):
+    return self.props['arch']
+
+  def _tile_time(self, cta_m, cta_n, cta_k, bits_ab):
+    """Seconds one Xe-core needs for a single K iteration of one output tile"""
+    xe_cores = self.props['xe_cores']
+    flops_per_sec = self.props['flops_per_clk'] * (16 // bits_ab) * self.props['clock_ghz'] * 1e9
+    bytes_per_sec = self.props['dram_gbps'] * 1e9 / xe_cores
+    compute = 2 * cta_m * cta_n * cta_k / flops_per_sec
+    memory = (cta_m + cta_n) * cta_k * bits_ab / 8 / bytes_per_sec
+    return max(compute, memory)
+
+  def _decompositions(self, tiles, k_iters, iter_time, partial_time):
+    """
+    Yields (tile_scheduler, split_k_slices, runtime, waves) for each decomposition of `tiles`
+    output tiles of `k_iters` K iterations. `partial_time` is the time to store or load one
+    partial accumulator tile.
+    """
+    xe_cores = self.props['xe_cores']
+
+    # Data-parallel: one work-group per output tile
+    waves = (tiles + xe_cores - 1) // xe_cores
+    yield 'persistent', 1, waves * k_iters * iter_time, waves
+
+    # Stream-K: all but the last full wave remain data-parallel, and the remaining tiles'
+    # K iterations are spread evenly over the Xe-cores at the cost of one partial tile
+    # store and load per work unit
+    full_waves = tiles // xe_cores
+    if full_waves != waves and k_iters > self.min_iters_per_sk_unit:
+      dp_waves = max(full_waves - 1, 0)
+      sk_tiles = tiles - dp_waves * xe_cores
+      sk_units = min(xe_cores, sk_tiles * k_iters // self.min_iters_per_sk_unit)
+      if sk_units > 0:
+        sk_iters = (sk_tiles * k_iters + sk_units - 1) // sk_units
+        runtime = (dp_waves * k_iters + sk_iters) * iter_time + 2 * partial_time
+        yield 'stream_k', 1, runtime, dp_waves + 1
+
+    # Split-K: every output tile is split into equal K ranges and reduced through the workspace
+    if tiles < xe_cores:
+      for splits in self.split_k_candidates:
+        if splits > k_iters:
+          break
+        units = tiles * splits
+        split_waves = (units + xe_cores - 1) // xe_cores
+        split_iters = (k_iters + splits - 1) // splits
+        runtime = split_waves * split_iters * iter_time + splits * partial_time
+        yield 'stream_k', splits, runtime, split_waves
+
+  def get_configs(self, m, n, k, batch_count, dtypes, layouts, align_a, align_b, voidC=False, use_fast_acc=True, count=1):
+    dtype_a, dtype_b, dtype_acc, dtype_c, dtype_d = dtypes
+    bits_ab = DataTypeSize[dtype_a]
+    if DataTypeSize[dtype_b] != bits_ab or bits_ab not in self.tile_shapes:
+      raise ValueError(f"Unsupported operand types {dtype_a}, {dtype_b} for Intel Xe heuristics")
+
+    # DPAS consumes 32 bytes of K per instruction
+    instr_k = 256 // bits_ab
+    cta_k = 2 * instr_k
+    bytes_per_sec = self.props['dram_gbps'] * 1e9 / self.props['xe_cores']
+
+    ret = []
+    for (cta_m, cta_n), warp_count in self.tile_shapes[bits_ab]:
+      tiles = ((m + cta_m - 1) // cta_m) * ((n + cta_n - 1) // cta_n) * batch_count
+      k_iters = (k + cta_k - 1) // cta_k
+      iter_time = self._tile_time(cta_m, cta_n, cta_k, bits_ab)
+      partial_time = cta_m * cta_n * DataTypeSize[dtype_acc] / 8 / bytes_per_sec
+
+      for tile_scheduler, splits, runtime, waves in self._decompositions(tiles, k_iters, iter_time, partial_time):
+        r = {}
+        r['estimated_runtime'] = runtime
+        r['cta_tile_m'] = cta_m
+        r['cta_tile_n'] = cta_n
+        r['cta_tile_k'] = cta_k
+        r['instr_tile_m'] = 8
+        r['instr_tile_n'] = 16
+        r['instr_tile_k'] = instr_k
+        r['warp_count_m'], r['warp_count_n'], r['warp_count_k'] = warp_count
+        r['cluster_m'] = 1
+        r['cluster_n'] = 1
+        r['cluster_k'] = 1
+        # Stage count is selected by the Xe collective builder
+        r['stages'] = 0
+        r['layout_a'] = layouts[0]
+        r['layout_b'] = layouts[1]
+        r['layout_d'] = layouts[2]
+        r['dtype_a'] = dtype_a
+        r['dtype_b'] = dtype_b
+        r['dtype_acc'] = dtype_acc
+        r['dtype_c'] = dtype_c
+        r['dtype_d'] = dtype_d
+        r['alignment_a'] = align_a
+        r['alignment_b'] = align_b
+        r['swizzle_size'] = 1
+        r['raster_order'] = 'along_n'
+        r['split_k_slices'] = splits
+        r['tile_scheduler'] = tile_scheduler
+        r['waves'] = waves
+        # Fraction of the MMA work spent on padding in M, N and K
+        r['padding_waste'] = 1.0 - (m * n * k * batch_count) / (tiles * cta_m * cta_n * k_iters * cta_k)
+        r['use_fast_acc'] = use_fast_acc
+        r['voidC'] = voidC
+        ret.append(r)
+
+    ret.sort(key=lambda r: r['estimated_runtime'])
+    return ret[:count]
@@ -0,0 +1,158 @@
+#################################################################################################
+#
+# Copyright (C) 2025 Intel Corporation, All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+Tests the kernel configurations chosen by XeMatmulHeuristics for representative GEMM shapes.
+The heuristics are purely analytical, so these tests do not need a device.
+"""
+
+import unittest
+
+from cutlass_library.arch_constants import INTEL_XE12, INTEL_XE20
+from cutlass_library.heuristics_provider import XeMatmulHeuristics
+from cutlass_library.library import DataType, LayoutType
+
+
+layouts = (LayoutType.RowMajor, LayoutType.RowMajor, LayoutType.RowMajor)
+bf16_dtypes = (DataType.bf16, DataType.bf16, DataType.f32, DataType.f32, DataType.f32)
+s8_dtypes = (DataType.s8, DataType.s8, DataType.s32, DataType.s32, DataType.s32)
+
+
+def best_config(gpu, m, n, k, batch_count=1, dtypes=bf16_dtypes, count=1):
+    heuristics = XeMatmulHeuristics(gpu)
+    return heuristics.get_configs(m, n, k, batch_count, dtypes, layouts, 8, 8, count=count)
+
+
+def summary(config):
+    """
+    Returns the fields that identify a kernel: (tile M, N, K), tile scheduler and split-K slices
+    """
+    return ((config['cta_tile_m'], config['cta_tile_n'], config['cta_tile_k']),
+            config['tile_scheduler'], config['split_k_slices'])
+
+
+class XeHeuristicsConfigs(unittest.TestCase):
+    """
+    Pins the top-ranked configuration for representative shapes. A change to the cost model
+    that moves any of these picks should be deliberate and update the expectations here.
+    """
+
+    def check(self, gpu, shape, dtypes, expected):
+        configs = best_config(gpu, *shape, dtypes=dtypes)
+        self.assertEqual(len(configs), 1)
+        self.assertEqual(summary(configs[0]), expected, f'{gpu} {shape}')
+
+    def test_bmg_bf16(self):
+        cases = [
+            # Large square problems keep the largest tile; the partial last wave is stream-K
+            ((4096, 4096, 4096, 1), ((256, 256, 32), 'stream_k', 1)),
+            ((8192, 8192, 8192, 1), ((256, 256, 32), 'stream_k', 1)),
+            # Whole waves stay data-parallel
+            ((2560, 2560, 2048, 1), ((256, 256, 32), 'persistent', 1)),
+            ((1024, 1024, 1024, 1), ((256, 256, 32), 'persistent', 1)),
+            ((512, 512, 512, 8), ((256, 256, 32), 'persistent', 1)),
+            # Too few output tiles to fill the device: spread K with stream-K
+            ((128, 128, 8192, 1), ((128, 128, 32), 'stream_k', 1)),
+            ((64, 4096, 4096, 1), ((64, 128, 32), 'stream_k', 1)),
+        ]
+        for shape, expected in cases:
+            self.check('BMG', shape, bf16_dtypes, expected)
+
+    def test_bmg_s8(self):
+        cases = [
+            ((4096, 4096, 4096, 1), ((256, 256, 64), 'persistent', 1)),
+            ((8192, 8192, 8192, 1), ((256, 256, 64), 'stream_k', 1)),
+            ((128, 128, 8192, 1), ((128, 128, 64), 'stream_k', 1)),
+            ((64, 4096, 4096, 1), ((128, 256, 64), 'stream_k', 1)),
+        ]
+        for shape, expected in cases:
+            self.check('BMG', shape, s8_dtypes, expected)
+
+    def test_pvc_bf16(self):
+        cases = [
+            ((4096, 4096, 4096, 1), ((256, 256, 32), 'persistent', 1)),
+            ((8192, 8192, 8192, 1), ((256, 256, 32), 'persistent', 1)),
+            # 128 Xe-cores: medium problems drop to smaller tiles to fill the device
+            ((1024, 1024, 1024, 1), ((128, 128, 32), 'stream_k', 1)),
+            ((512, 512, 512, 8), ((128, 128, 32), 'persistent', 1)),
+            ((128, 128, 8192, 1), ((64, 128, 32), 'stream_k', 1)),
+            ((64, 4096, 4096, 1), ((64, 128, 32), 'stream_k', 1)),
+        ]
+        for shape, expected in cases:
+            self.check('PVC', shape, bf16_dtypes, expected)
+
+    def test_pvc_s8(self):
+        cases = [
+            ((4096, 4096, 4096, 1), ((256, 256, 64), 'persistent', 1)),
+            ((1024, 1024, 1024, 1), ((128, 128, 64), 'persistent', 1)),
+        ]
+        for shape, expected in cases:
+            self.check('PVC', shape, s8_dtypes, expected)
+
+
+class XeHeuristicsInterface(unittest.TestCase):
+    """
+    Tests the provider interface shared with MatmulHeuristics
+    """
+
+    def test_device_selection(self):
+        self.assertEqual(XeMatmulHeuristics().gpu, 'BMG')
+        self.assertEqual(XeMatmulHeuristics(INTEL_XE20).gpu, 'BMG')
+        self.assertEqual(XeMatmulHeuristics(INTEL_XE12).gpu, 'PVC')
+        with self.assertRaises(ValueError):
+            XeMatmulHeuristics('A100')
+
+    def test_mixed_operand_widths(self):
+        dtypes = (DataType.bf16, DataType.s8, DataType.f32, DataType.f32, DataType.f32)
+        with self.assertRaises(ValueError):
+            best_config('BMG', 1024, 1024, 1024, dtypes=dtypes)
+
+    def test_ranking(self):
+        configs = best_config('BMG', 4096, 4096, 4096, count=4)
+        self.assertEqual(len(configs), 4)
+        runtimes = [config['estimated_runtime'] for config in configs]
+        self.assertEqual(runtimes, sorted(runtimes))
+        for config in configs:
+            # Stage count is left to the Xe collective builder
+            self.assertEqual(config['stages'], 0)
+            self.assertEqual(config['instr_tile_k'], 16)
+
+    def test_padding_waste(self):
+        exact, = best_config('BMG', 2560, 2560, 2048)
+        self.assertEqual(exact['padding_waste'], 0.0)
+        # 100 rows in a 128- or 256-row tile
+        padded, = best_config('BMG', 100, 4096, 4096)
+        self.assertGreater(padded['padding_waste'], 0.2)
+
+
+if __name__ == '__main__':
+    unittest.main()
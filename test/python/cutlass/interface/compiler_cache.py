@@ -0,0 +1,195 @@
+#################################################################################################
+#
+# Copyright (C) 2025 Intel Corporation, All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+Tests the compiled-operation cache of the backend ArtifactManager: cache keys, in-process and
+on-disk hits, misses and warmup statistics. Compilation and program loading are mocked, so
+these tests do not need a device.
+"""
+
+from types import SimpleNamespace
+import unittest
+from unittest import mock
+
+from cutlass_cppgen.backend import compiler
+from cutlass_cppgen.backend.compiler import ArtifactManager, CacheInfo, CompilationOptions
+
+
+class FakeHostFunction:
+    """
+    Stand-in for a ctypes function from the compiled host library
+    """
+    def __call__(self, *args):
+        return 8
+
+
+class FakeHostLibrary:
+    def __getattr__(self, name):
+        return FakeHostFunction()
+
+
+class FakeRtModule:
+    def __init__(self, source, name):
+        self.source = source
+        self._name = name
+        self.argtype = None
+        self.kernel = None
+        self.initialized = 0
+
+    def emit(self):
+        return self.source
+
+    def name(self):
+        return self._name
+
+    def initialize(self):
+        self.initialized += 1
+
+
+class FakeOperation:
+    def __init__(self, source, name):
+        self.rt_module = FakeRtModule(source, name)
+
+    def procedural_name(self):
+        return self.rt_module.name()
+
+
+def make_manager():
+    """
+    Returns a SYCL ArtifactManager with empty in-process caches, without touching the on-disk cache
+    """
+    manager = ArtifactManager.__new__(ArtifactManager)
+    manager._dpcpp_compile_options = ["-fsycl", "-std=c++17"]
+    manager._nvcc_compile_options = []
+    manager.dpcpp()
+    manager.compiled_cache_device = {}
+    manager.compiled_cache_host = {}
+    manager.reset_cache_info()
+    return manager
+
+
+def options(flags=("-fsycl", "-std=c++17"), arch="intel_gpu_bmg_g21"):
+    return CompilationOptions(list(flags), arch, ["/cutlass/include"], True)
+
+
+class CompilerCacheTest(unittest.TestCase):
+
+    def setUp(self):
+        patches = [
+            mock.patch.object(compiler.cutlass_cppgen, "initialize_sycl_context"),
+            mock.patch.object(compiler.cutlass_cppgen, "sycl_device"),
+            mock.patch.object(compiler.dpctl, "SyclQueue"),
+            mock.patch.object(compiler.dpctl.program, "create_program_from_spirv"),
+            mock.patch.object(ArtifactManager, "insert_operation"),
+            mock.patch.object(ArtifactManager, "emit_compile_",
+                              return_value=(b"spirv", FakeHostLibrary(), SimpleNamespace(name="host.so"))),
+        ]
+        for p in patches:
+            p.start()
+            self.addCleanup(p.stop)
+
+    def test_cache_key(self):
+        manager = make_manager()
+        op = FakeOperation("kernel source", "gemm_a")
+
+        key = manager.operation_key(op, options())
+        self.assertEqual(key, manager.operation_key(FakeOperation("kernel source", "gemm_a"), options()))
+
+        # Source, name, flags, target and backend all take part in the key
+        self.assertNotEqual(key, manager.operation_key(FakeOperation("other source", "gemm_a"), options()))
+        self.assertNotEqual(key, manager.operation_key(FakeOperation("kernel source", "gemm_b"), options()))
+        self.assertNotEqual(key, manager.operation_key(op, options(flags=("-fsycl", "-std=c++17", "-O3"))))
+        self.assertNotEqual(key, manager.operation_key(op, options(arch="intel_gpu_pvc")))
+
+        manager.backend = "nvcc"
+        self.assertNotEqual(key, manager.operation_key(op, options()))
+
+    def test_miss_then_hit(self):
+        manager = make_manager()
+        with mock.patch.object(ArtifactManager, "load_operation", return_value=False) as load:
+            manager.add_module([FakeOperation("kernel source", "gemm_a")], options())
+            self.assertEqual(manager.cache_info(), CacheInfo(hits=0, disk_hits=0, misses=1))
+            ArtifactManager.insert_operation.assert_called_once()
+
+            # The second request is served from the in-process cache without touching the disk
+            op = FakeOperation("kernel source", "gemm_a")
+            manager.add_module([op], options())
+            self.assertEqual(manager.cache_info(), CacheInfo(hits=1, disk_hits=0, misses=1))
+            self.assertEqual(load.call_count, 1)
+            self.assertIsNotNone(op.rt_module.kernel)
+            self.assertEqual(op.rt_module.initialized, 1)
+
+        # A different target is a different kernel
+        with mock.patch.object(ArtifactManager, "load_operation", return_value=False):
+            manager.add_module([FakeOperation("kernel source", "gemm_a")], options(arch="intel_gpu_pvc"))
+        self.assertEqual(manager.cache_info().misses, 2)
+
+    def test_disk_hit(self):
+        manager = make_manager()
+        op = FakeOperation("kernel source", "gemm_a")
+        key = manager.operation_key(op, options())
+
+        def load_operation(op_key, extra_funcs):
+            self.assertEqual(op_key, key)
+            manager.compiled_cache_device[op_key] = "kernel"
+            manager.compiled_cache_host[op_key] = {"get_args": FakeHostFunction(), "shared_memory_capacity": 0}
+            return True
+
+        with mock.patch.object(manager, "load_operation", side_effect=load_operation):
+            manager.add_module([op], options())
+
+        self.assertEqual(manager.cache_info(), CacheInfo(hits=1, disk_hits=1, misses=0))
+        self.assertEqual(op.rt_module.kernel, "kernel")
+        ArtifactManager.emit_compile_.assert_not_called()
+
+    def test_bypass_cache(self):
+        manager = make_manager()
+        with mock.patch.object(ArtifactManager, "load_operation") as load:
+            manager.add_module([FakeOperation("kernel source", "gemm_a")], options(), bypass_cache=True)
+            load.assert_not_called()
+        self.assertEqual(manager.cache_info(), CacheInfo(hits=0, disk_hits=0, misses=1))
+
+    def test_warmup(self):
+        manager = make_manager()
+        ops = [FakeOperation("kernel source", "gemm_a"), FakeOperation("other source", "gemm_b")]
+        with mock.patch.object(ArtifactManager, "load_operation", return_value=False):
+            self.assertEqual(manager.warmup(ops, options()), CacheInfo(hits=0, disk_hits=0, misses=2))
+            # Statistics are relative to the start of the warmup pass
+            self.assertEqual(manager.warmup(ops, options()), CacheInfo(hits=2, disk_hits=0, misses=0))
+        self.assertEqual(manager.cache_info(), CacheInfo(hits=2, disk_hits=0, misses=2))
+
+        manager.reset_cache_info()
+        self.assertEqual(manager.cache_info(), CacheInfo(hits=0, disk_hits=0, misses=0))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -103,13 +103,17 @@ struct Shape_h192 {
 using GmemTiledCopyQU16 = cute::XE_2D_U16x1x16_LD_N;
 using GmemTiledCopyKU16 = cute::XE_2D_U16x16x16_LD_T;
 using GmemTiledCopyVU16 = cute::XE_2D_U16x32x32_LD_V;
+using GmemTiledCopyKU8 = cute::XE_2D_U8x16x16_LD_T;
+using GmemTiledCopyKU4 = cute::XE_2D_U4x16x16_LD_T;
+using GmemTiledCopyVU8 = cute::XE_2D_U8x32x32_LD_V;
 using GmemTiledCopyStoreU32 = cute::XE_2D_U32x1x16_ST_N;
 using GmemTiledCopyStoreU16 = cute::XE_2D_U16x1x16_ST_N;
 
 template<typename ElementInputType, typename ElementAccumulatorType, typename ElementOutputType,  
          typename TileShapeQK, typename TileShapePV, typename TileShapeOutput, typename SubgroupLayout, 
          typename MMAOperation, bool HasCausalMask, bool isVarLen, typename TiledCopyQ, typename TiledCopyK,
-         typename TiledCopyV, typename TiledCopyStore, bool PagedKV>
+         typename TiledCopyV, typename TiledCopyStore, bool PagedKV, typename ElementInputKVType = ElementInputType,
+         typename TileScheduler = void, typename ElementInputVType = ElementInputKVType>
 struct XE_Flash_Attention_Decode {
   using LayoutQ = cutlass::layout::RowMajor;
   using LayoutK = cutlass::layout::ColumnMajor;
@@ -119,7 +123,8 @@ struct XE_Flash_Attention_Decode {
   using ElementAccumulator = ElementAccumulatorType;
   using ElementComputeEpilogue = ElementAccumulatorType;
   using ElementInputQ = ElementInputType;
-  using ElementInputKV = ElementInputType;
+  using ElementInputKV = ElementInputKVType;
+  using ElementInputV = ElementInputVType;
   using ElementOutput = ElementOutputType;
 
   using ProblemShapeRegular = cute::tuple<int, int, int, int, int, int, int, int>;
@@ -146,7 +151,7 @@ struct XE_Flash_Attention_Decode {
   using CollectiveMainloop = cutlass::flash_attention::collective::FlashDecodeMma<
         GEMMDispatchPolicy, ProblemShapeType, ElementInputQ,
         cutlass::gemm::TagToStrideA_t<LayoutQ>, ElementInputKV,
-        cutlass::gemm::TagToStrideB_t<LayoutK>, ElementInputKV,
+        cutlass::gemm::TagToStrideB_t<LayoutK>, ElementInputV,
         cutlass::gemm::TagToStrideB_t<LayoutV>, MMAOperation,
         TileShapeQK, TileShapePV, SubgroupLayout,
         GmemTiledCopyQ, // Q
@@ -155,7 +160,7 @@ struct XE_Flash_Attention_Decode {
         HasCausalMask, PagedKV>;
 
     using Kernel = cutlass::flash_attention::kernel::FMHADecode<ProblemShapeType, CollectiveMainloop,
-                                                       CollectiveSoftmaxEpilogue, CollectiveEpilogue>;
+                                                       CollectiveSoftmaxEpilogue, CollectiveEpilogue, TileScheduler>;
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -189,6 +194,13 @@ struct TestbedImpl {
   static constexpr bool HasCausalMask = CollectiveMainloop::CausalMask;
   static constexpr bool isVarLen = CollectiveMainloop::is_var_len;
   static constexpr bool PagedKV = CollectiveMainloop::PagedKV;
+  static constexpr bool IsQuantKV = CollectiveMainloop::QuantKV;
+  static constexpr bool IsQuantK = CollectiveMainloop::template is_quant_v<ElementK>;
+  static constexpr bool IsQuantV = CollectiveMainloop::template is_quant_v<ElementV>;
+
+  // The reference runs on INT8/INT4 K/V dequantized to the Q type.
+  using ElementKRef = cute::conditional_t<IsQuantK, ElementQ, ElementK>;
+  using ElementVRef = cute::conditional_t<IsQuantV, ElementQ, ElementV>;
 
   StrideQ stride_Q;
   StrideK stride_K;
@@ -197,6 +209,7 @@ struct TestbedImpl {
   StrideV stride_V_cache;
   StrideO stride_O;
   uint64_t seed = 0;
+  int window_size = 0;
   bool use_kv_cache;
 
   std::vector<int> cumulative_seqlen_q;
@@ -219,6 +232,23 @@ struct TestbedImpl {
       cutlass::DeviceAllocation<int> num_pages_per_seq;
   };
   PagedKVParams paged_kv_cache;
+  std::vector<int> host_page_table;
+
+  // Group-wise quantization data of one INT8/INT4 K/V tensor, laid out as [batch * num_heads_kv][groups].
+  struct GroupQuantParams {
+      cutlass::DeviceAllocation<float> scale;
+      cutlass::DeviceAllocation<float> zero;
+      int groups = 0;
+  };
+  int quant_group_size = 32;
+  GroupQuantParams quant_K;
+  GroupQuantParams quant_V;
+  GroupQuantParams quant_K_cache;
+  GroupQuantParams quant_V_cache;
+  cutlass::DeviceAllocation<ElementKRef> block_K_ref;
+  cutlass::DeviceAllocation<ElementVRef> block_V_ref;
+  cutlass::DeviceAllocation<ElementKRef> block_K_cache_ref;
+  cutlass::DeviceAllocation<ElementVRef> block_V_cache_ref;
 
   //
   // Methods
@@ -240,7 +270,7 @@ struct TestbedImpl {
     }
 
     if constexpr (isVarLen) {
-      auto [problem_shape_init, problem_shape_launch] = initialize_varlen(problem_shape_in);
+      auto [problem_shape_init, problem_shape_launch] = initialize_varlen(problem_shape_in, page_size);
       problem_shape = problem_shape_launch;
       problem_size = problem_shape_init;
     }
@@ -291,6 +321,7 @@ struct TestbedImpl {
         }
       }
       compat::memcpy(paged_kv_cache.page_table.get(), page_mapping.data(), page_mapping.size() * sizeof(int));
+      host_page_table = page_mapping;
 
       paged_kv_cache.num_pages_per_seq.reset(num_pages_per_seq.size());
       compat::memcpy(paged_kv_cache.num_pages_per_seq.get(), num_pages_per_seq.data(), num_pages_per_seq.size() * sizeof(int));
@@ -298,10 +329,40 @@ struct TestbedImpl {
     }
 
     initialize_block(block_Q, seed + 2023);
-    initialize_block(block_K, seed + 2022);
-    initialize_block(block_V, seed + 2021);
-    initialize_block(block_K_cache, seed + 2024);
-    initialize_block(block_V_cache, seed + 2025);
+    // K and V are quantized independently, e.g. INT4 keys with INT8 values.
+    if constexpr (IsQuantKV) {
+      // Varlen groups are sized by the longest sequence and a paged cache counts groups over its physical pages,
+      // matching FlashDecodeMma::to_underlying_arguments.
+      int batches = get<0>(problem_shape);
+      int max_seq_len_kv = static_cast<int>(get<4>(problem_shape));
+      int max_seq_len_kv_cache = static_cast<int>(get<5>(problem_shape));
+      int seq_len_cache_physical = PagedKV ? cutlass::round_up(max_seq_len_kv_cache, page_size) : max_seq_len_kv_cache;
+      int groups = ceil_div(max_seq_len_kv, quant_group_size);
+      int groups_cache = ceil_div(seq_len_cache_physical, quant_group_size);
+      if constexpr (IsQuantK) {
+        initialize_group_quant(block_K, block_K_ref, quant_K, cumulative_seqlen_kv, seq_len_kv, groups,
+                               batches, num_heads_kv, head_size_qk, seed + 2022);
+        initialize_group_quant(block_K_cache, block_K_cache_ref, quant_K_cache, cumulative_seqlen_kv_cache, seq_len_kv_cache, groups_cache,
+                               batches, num_heads_kv, head_size_qk, seed + 2024);
+      } else {
+        initialize_block(block_K, seed + 2022);
+        initialize_block(block_K_cache, seed + 2024);
+      }
+      if constexpr (IsQuantV) {
+        initialize_group_quant(block_V, block_V_ref, quant_V, cumulative_seqlen_kv, seq_len_kv, groups,
+                               batches, num_heads_kv, head_size_vo, seed + 2021);
+        initialize_group_quant(block_V_cache, block_V_cache_ref, quant_V_cache, cumulative_seqlen_kv_cache, seq_len_kv_cache, groups_cache,
+                               batches, num_heads_kv, head_size_vo, seed + 2025);
+      } else {
+        initialize_block(block_V, seed + 2021);
+        initialize_block(block_V_cache, seed + 2025);
+      }
+    } else {
+      initialize_block(block_K, seed + 2022);
+      initialize_block(block_V, seed + 2021);
+      initialize_block(block_K_cache, seed + 2024);
+      initialize_block(block_V_cache, seed + 2025);
+    }
 
     if (!cumulative_seqlen_q.empty()) {
       device_cumulative_seqlen_q.reset(cumulative_seqlen_q.size());
@@ -329,8 +390,55 @@ struct TestbedImpl {
     return problem_shape;
   }
 
+  /// Fills an INT8/INT4 K/V tensor plus random group scales and zero points, and keeps a dequantized copy
+  /// x = (q - zero) * scale for the reference. Tokens of sequence b and KV head h are grouped per (b, h).
+  template <class Element, class ElementRef>
+  void initialize_group_quant(cutlass::DeviceAllocation<Element>& block, cutlass::DeviceAllocation<ElementRef>& block_ref,
+                              GroupQuantParams& quant, std::vector<int> const& cumulative_seqlen, int seq_len, int groups,
+                              int batch, int num_heads_kv, int head_size, uint64_t seed) {
+    block_ref.reset(block.size());
+    if (block.size() == 0) {
+      return;
+    }
+    cutlass::initialize_mixed_dtype_block(block, block_ref, seed);
+
+    quant.groups = groups;
+    std::vector<float> host_scale(batch * num_heads_kv * groups);
+    std::vector<float> host_zero(host_scale.size());
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist_scale(0.05f, 0.25f);
+    std::uniform_int_distribution<int> dist_zero(-2, 2);
+    for (int i = 0; i < host_scale.size(); i++) {
+      host_scale[i] = dist_scale(rng);
+      host_zero[i] = static_cast<float>(dist_zero(rng));
+    }
+    quant.scale.reset(host_scale.size());
+    quant.scale.copy_from_host(host_scale.data(), host_scale.size());
+    quant.zero.reset(host_zero.size());
+    quant.zero.copy_from_host(host_zero.data(), host_zero.size());
+
+    std::vector<ElementRef> host_ref(block_ref.size());
+    compat::memcpy<ElementRef>(host_ref.data(), block_ref.get(), host_ref.size());
+    compat::wait();
+    for (int b = 0; b < batch; b++) {
+      int len = isVarLen ? cumulative_seqlen[b + 1] - cumulative_seqlen[b] : seq_len;
+      int offset = num_heads_kv * (isVarLen ? cumulative_seqlen[b] : b * seq_len) * head_size;
+      for (int h = 0; h < num_heads_kv; h++) {
+        for (int t = 0; t < len; t++) {
+          int group = (b * num_heads_kv + h) * groups + t / quant_group_size;
+          for (int d = 0; d < head_size; d++) {
+            auto& x = host_ref[offset + (h * len + t) * head_size + d];
+            x = static_cast<ElementRef>((static_cast<float>(x) - host_zero[group]) * host_scale[group]);
+          }
+        }
+      }
+    }
+    compat::memcpy<ElementRef>(block_ref.get(), host_ref.data(), host_ref.size());
+    compat::wait();
+  }
+
   template<class ProblemShape>
-  auto initialize_varlen(const ProblemShape& problem_size, const bool VarlenSame = true) {
+  auto initialize_varlen(const ProblemShape& problem_size, int page_size, const bool VarlenSame = true) {
     int num_batches = cute::get<0>(problem_size);
 
     // generate Q as --b times
@@ -344,7 +452,8 @@ struct TestbedImpl {
     // Use Cacheline Size to calculate alignment
     constexpr int cacheline_bytes = 64;
     constexpr int AlignmentQ = cacheline_bytes / sizeof(ElementQ);    // Alignment of Q matrix in units of elements
-    constexpr int AlignmentKV = cacheline_bytes / sizeof(ElementK);   // Alignment of Kand V matrix in units of elements
+    // Alignment of K and V matrix in units of elements, counted in bits so that sub-byte K/V keep whole cachelines
+    constexpr int AlignmentKV = cacheline_bytes * 8 / cute::min(cute::sizeof_bits_v<ElementK>, cute::sizeof_bits_v<ElementV>);
 
     auto generate_positive_int = [](auto& dist, auto& gen) {
       int result = 0;
@@ -369,7 +478,9 @@ struct TestbedImpl {
       //seqlen_q is usually set to 1 for decode.
       int seqlen_q = cute::get<3>(problem_size) == 1 ? 1 : std::min(cute::get<3>(problem_size), cutlass::round_up(generate_positive_int(dist_q, rng), AlignmentQ));
       int seqlen_kv = cutlass::round_up(generate_positive_int(dist_kv, rng), AlignmentKV);
-      int seqlen_kv_cache = cute::get<5>(problem_size) == 0 ? 0 : cutlass::round_up(generate_positive_int(dist_kv_cache, rng), AlignmentKV);
+      // A paged cache is read a whole page at a time, so keep it page aligned.
+      int seqlen_kv_cache = cute::get<5>(problem_size) == 0 ? 0 : cutlass::round_up(generate_positive_int(dist_kv_cache, rng),
+                                                                                      PagedKV ? page_size : AlignmentKV);
 
       total_seqlen_q += seqlen_q;
       total_seqlen_kv += seqlen_kv;
@@ -426,6 +537,21 @@ struct TestbedImpl {
     int offset_v_cache = 0;
     int offset_o = 0;
 
+    auto [ptr_K, ptr_K_cache] = [&]() {
+      if constexpr (IsQuantK) {
+        return cute::make_tuple(block_K_ref.get(), block_K_cache_ref.get());
+      } else {
+        return cute::make_tuple(block_K.get(), block_K_cache.get());
+      }
+    }();
+    auto [ptr_V, ptr_V_cache] = [&]() {
+      if constexpr (IsQuantV) {
+        return cute::make_tuple(block_V_ref.get(), block_V_cache_ref.get());
+      } else {
+        return cute::make_tuple(block_V.get(), block_V_cache.get());
+      }
+    }();
+
     int q_group_size = num_heads_q / num_heads_kv;
     // loop over the batch dimension to compute the output
     // to avoid the risk of running out of device memory
@@ -448,34 +574,42 @@ struct TestbedImpl {
         cutlass::DeviceAllocation<ElementAccumulator> block_S;
         block_S.reset(seq_len_qo * seq_len_kv_total);
 
-        ElementK* k_ptr;
-        ElementV* v_ptr;
+        ElementKRef* k_ptr;
+        ElementVRef* v_ptr;
 
+        cutlass::DeviceAllocation<ElementKRef> block_K_concat;
+        cutlass::DeviceAllocation<ElementVRef> block_V_concat;
         if (use_kv_cache) {
-            cutlass::DeviceAllocation<ElementK> block_K_concat(head_size_qk * seq_len_kv_total);
-            cutlass::DeviceAllocation<ElementV> block_V_concat(seq_len_kv_total * head_size_vo);
-
-            // Concatenate K_cache and K
-            compat::memcpy<ElementK>(
-                block_K_concat.get(),
-                block_K_cache.get() + offset_k_cache,
-                seq_len_kv_cache * head_size_qk
-            );
-            compat::memcpy<ElementK>(
+            block_K_concat.reset(head_size_qk * seq_len_kv_total);
+            block_V_concat.reset(seq_len_kv_total * head_size_vo);
+
+            // Concatenate K_cache and K. A paged cache is gathered page by page in logical order.
+            int cache_pages = PagedKV ? seq_len_kv_cache / paged_kv_cache.page_size : 1;
+            int cache_page_len = PagedKV ? paged_kv_cache.page_size : seq_len_kv_cache;
+            int page_table_offset = (isVarLen ? cumulative_seqlen_kv_cache[b] : b * seq_len_kv_cache) / cache_page_len;
+            for (int page = 0; page < cache_pages; page++) {
+              int physical_page = PagedKV ? host_page_table[page_table_offset + page] : page;
+              compat::memcpy<ElementKRef>(
+                  block_K_concat.get() + page * cache_page_len * head_size_qk,
+                  ptr_K_cache + offset_k_cache + physical_page * cache_page_len * head_size_qk,
+                  cache_page_len * head_size_qk
+              );
+              compat::memcpy<ElementVRef>(
+                  block_V_concat.get() + page * cache_page_len * head_size_vo,
+                  ptr_V_cache + offset_v_cache + physical_page * cache_page_len * head_size_vo,
+                  cache_page_len * head_size_vo
+              );
+            }
+            compat::memcpy<ElementKRef>(
                 block_K_concat.get() + seq_len_kv_cache * head_size_qk,
-                block_K.get() + offset_k,
+                ptr_K + offset_k,
                 seq_len_kv * head_size_qk
             );
 
             // Concatenate V_cache and V
-            compat::memcpy<ElementV>(
-                block_V_concat.get(),
-                block_V_cache.get() + offset_v_cache,
-                seq_len_kv_cache * head_size_vo
-            );
-            compat::memcpy<ElementV>(
+            compat::memcpy<ElementVRef>(
                 block_V_concat.get() + seq_len_kv_cache * head_size_vo,
-                block_V.get() + offset_v,
+                ptr_V + offset_v,
                 seq_len_kv * head_size_vo
             );
             compat::wait();
@@ -484,8 +618,8 @@ struct TestbedImpl {
             v_ptr = block_V_concat.get();
         }
         else {
-            k_ptr = block_K.get() + offset_k;
-            v_ptr = block_V.get() + offset_v;
+            k_ptr = ptr_K + offset_k;
+            v_ptr = ptr_V + offset_v;
         }
 
         cutlass::TensorRef ref_Q(block_Q.get() + offset_q, LayoutQ::packed({seq_len_qo, head_size_qk}));
@@ -526,6 +660,15 @@ struct TestbedImpl {
             }
           }
         }
+        if (window_size > 0) {
+          // apply sliding window mask to S, counting keys over [cache, new]
+          for (int row = 0; row < seq_len_qo; row++) {
+            for (int col = 0; col < seq_len_kv_total; col++) {
+              if ((row + start_col - discard_seq_coord + full_tile_offset) - col >= window_size)
+                host_S[col + row * seq_len_kv_total] = ElementAccumulator{-INFINITY};
+            }
+          }
+        }
 
         // compute max element per row of S
         std::vector<ElementAccumulator> max_vec(seq_len_qo, ElementAccumulator{-INFINITY});
@@ -569,14 +712,14 @@ struct TestbedImpl {
           }
         }
 
-        std::vector<ElementV> host_P(host_S.size());
+        std::vector<ElementVRef> host_P(host_S.size());
         for (int p = 0; p < host_P.size(); p++)
-          host_P[p] = static_cast<ElementV>(host_S[p]);
+          host_P[p] = static_cast<ElementVRef>(host_S[p]);
 
-        cutlass::DeviceAllocation<ElementV> block_P;
+        cutlass::DeviceAllocation<ElementVRef> block_P;
         block_P.reset(host_P.size());
 
-        compat::memcpy<ElementV>(block_P.get(), host_P.data(), host_P.size());
+        compat::memcpy<ElementVRef>(block_P.get(), host_P.data(), host_P.size());
         compat::wait();
 
         cutlass::TensorRef ref_P(block_P.get(), LayoutQ::packed({seq_len_qo, seq_len_kv_total}));
@@ -638,7 +781,7 @@ struct TestbedImpl {
 
   /// Executes one test
   template<class ProblemShape>
-  bool run(ProblemShape problem_size_init, float softmax_scale, int page_size)
+  bool run(ProblemShape problem_size_init, float softmax_scale, int page_size, int window_size_ = 0)
   {
 #if (CUTLASS_DEBUG_TRACE_LEVEL > 1)
     CUTLASS_TRACE_HOST("TestbedImpl::run"); 
@@ -657,6 +800,7 @@ struct TestbedImpl {
 #endif
 
     ProblemShapeType problem_size = this->initialize(problem_size_init, page_size);
+    window_size = window_size_;
 
 #if (CUTLASS_DEBUG_TRACE_LEVEL > 1)
     CUTLASS_TRACE_HOST("TestbedImpl::run: this->initialize() returned true");
@@ -676,7 +820,14 @@ struct TestbedImpl {
       block_V_cache.get(), stride_V_cache,
       PagedKV ? paged_kv_cache.page_table.get() : nullptr,
       PagedKV ? paged_kv_cache.page_size : 0,
-      PagedKV ? paged_kv_cache.num_pages_per_seq.get() : nullptr},
+      PagedKV ? paged_kv_cache.num_pages_per_seq.get() : nullptr,
+      window_size,
+      nullptr, nullptr,
+      {quant_K.scale.get(), quant_K.zero.get()},
+      {quant_V.scale.get(), quant_V.zero.get()},
+      {quant_K_cache.scale.get(), quant_K_cache.zero.get()},
+      {quant_V_cache.scale.get(), quant_V_cache.zero.get()},
+      IsQuantKV ? quant_group_size : 0},
       {softmax_scale},
       {block_O.get(), stride_O},
       hw_info};
@@ -703,6 +854,13 @@ struct TestbedImpl {
     // Run Flash attention
     //
 
+#if (CUTLASS_DEBUG_TRACE_LEVEL > 1)
+    CUTLASS_TRACE_HOST("TestbedImpl::run: Calling FlashDecode::initialize_workspace");
+#endif
+    if (FlashDecode::initialize_workspace(arguments, workspace.get()) != cutlass::Status::kSuccess) {
+      return false;
+    }
+
 #if (CUTLASS_DEBUG_TRACE_LEVEL > 1)
     CUTLASS_TRACE_HOST("TestbedImpl::run: Calling to_underlying_arguments");
 #endif
@@ -790,15 +948,16 @@ struct Testbed3x {
   bool run(
    ProblemShape problem_size,
    float softmax_scale,
-   int page_size
+   int page_size,
+   int window_size = 0
     )
   {
-    return impl_.run(problem_size, softmax_scale, page_size);
+    return impl_.run(problem_size, softmax_scale, page_size, window_size);
   }
 };
 
 template <typename FlashDecode>
-bool TestFlashDecodeAll(int head_size) {
+bool TestFlashDecodeAll(int head_size, int window_size = 0) {
   Testbed3x<FlashDecode> testbed;
 
   std::vector<int> problem_size_batch{16};
@@ -826,14 +985,14 @@ bool TestFlashDecodeAll(int head_size) {
               auto problem_size = cute::make_tuple(
                 batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, seq_len_kv_cache, head_size_qk, head_size_vo);
               try {
-                passed = testbed.run(problem_size, softmax_scale, page_size);
+                passed = testbed.run(problem_size, softmax_scale, page_size, window_size);
               }
               catch (std::exception const& e) {
                 EXPECT_TRUE(false) << "TestFlashDecodeAll: testbed.run {"
                   << "batch: " << batch << ", num_heads_q: " << num_heads_q << ", num_heads_kv: " << num_heads_kv
                   << ", seq_len_qo: " << seq_len_qo << ", seq_len_kv: " << seq_len_kv << ", seq_len_kv_cache: "
                   << seq_len_cache << ", head_size_vo: " << head_size_vo << ", head_size_qk: " << head_size_qk
-                  << ", scale: " << softmax_scale << ", page_size: " << page_size
+                  << ", scale: " << softmax_scale << ", page_size: " << page_size << ", window_size: " << window_size
                   << "} threw an exception: " << e.what();
                 throw;
               }
@@ -842,7 +1001,7 @@ bool TestFlashDecodeAll(int head_size) {
                   << "batch: " << batch << ", num_heads_q: " << num_heads_q << ", num_heads_kv: " << num_heads_kv
                   << ", seq_len_qo: " << seq_len_qo << ", seq_len_kv: " << seq_len_kv << ", seq_len_kv_cache: "
                   << seq_len_cache << ", head_size_vo: " << head_size_vo << ", head_size_qk: " << head_size_qk
-                  << ", scale: " << softmax_scale << ", page_size: " << page_size
+                  << ", scale: " << softmax_scale << ", page_size: " << page_size << ", window_size: " << window_size
                   << "} threw an exception (unknown)";
                 throw;
               }
@@ -851,7 +1010,7 @@ bool TestFlashDecodeAll(int head_size) {
                 << "batch: " << batch << ", num_heads_q: " << num_heads_q << ", num_heads_kv: " << num_heads_kv
                 << ", seq_len_qo: " << seq_len_qo << ", seq_len_kv: " << seq_len_kv << ", seq_len_kv_cache: "
                 << seq_len_cache << ", head_size_vo: " << head_size_vo << ", head_size_qk: " << head_size_qk
-                << ", scale: " << softmax_scale << ", page_size: " << page_size
+                << ", scale: " << softmax_scale << ", page_size: " << page_size << ", window_size: " << window_size
                 << "} failed";
 
               if (!passed) {
@@ -58,6 +58,13 @@ TEST(XE_Flash_Attention_Decode_bf16_fp32_fp32_NonPaged_KVTile512_h64, noncausal)
   EXPECT_TRUE(test::flash_attention::TestFlashDecodeAll<Kernel>(64));
 }
 
+TEST(XE_Flash_Attention_Decode_bf16_fp32_fp32_NonPaged_KVTile512_h64, causal_sliding_window) {
+  using Kernel = test::flash_attention::XE_Flash_Attention_Decode<bfloat16_t, float, float, typename Shape_h::ShapeQK, typename Shape_h::ShapePV,
+                                            typename Shape_h::ShapeOutput, typename Shape_h::SubgroupLayout, MMAOperationBF16, true, false,
+                                            GmemTiledCopyQ, GmemTiledCopyK, GmemTiledCopyV, GmemTiledCopyStore, false>::Kernel;
+  EXPECT_TRUE(test::flash_attention::TestFlashDecodeAll<Kernel>(64, 600));
+}
+
 TEST(XE_Flash_Attention_Decode_bf16_fp32_fp32_NonPaged_KVTile512_h64, varlen_causal) {
   using Kernel = test::flash_attention::XE_Flash_Attention_Decode<bfloat16_t, float, float, typename Shape_h::ShapeQK, typename Shape_h::ShapePV,
                                             typename Shape_h::ShapeOutput, typename Shape_h::SubgroupLayout, MMAOperationBF16, true, true,
@@ -72,4 +79,12 @@ TEST(XE_Flash_Attention_Decode_bf16_fp32_fp32_NonPaged_KVTile512_h64, varlen_non
   EXPECT_TRUE(test::flash_attention::TestFlashDecodeAll<Kernel>(64));
 }
 
+TEST(XE_Flash_Attention_Decode_bf16_fp32_fp32_NonPaged_KVTile512_h64, varlen_noncausal_lpt_scheduler) {
+  using Kernel = test::flash_attention::XE_Flash_Attention_Decode<bfloat16_t, float, float, typename Shape_h::ShapeQK, typename Shape_h::ShapePV,
+                                            typename Shape_h::ShapeOutput, typename Shape_h::SubgroupLayout, MMAOperationBF16, false, true,
+                                            GmemTiledCopyQ, GmemTiledCopyK, GmemTiledCopyV, GmemTiledCopyStore, false, bfloat16_t,
+                                            cutlass::flash_attention::PersistentLPTScheduler>::Kernel;
+  EXPECT_TRUE(test::flash_attention::TestFlashDecodeAll<Kernel>(64));
+}
+
 } // namespace cutlass
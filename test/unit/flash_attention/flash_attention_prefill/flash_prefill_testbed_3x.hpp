@@ -141,7 +141,8 @@ struct Shape_h192 {
 
 template<typename ElementInputType, typename ElementAccumulatorType, typename ElementOutputType,  
         typename TileShapeQK, typename TileShapePV, typename TileShapeOutput, typename SubgroupLayout, 
-        typename MMAOperation, bool HasCausalMask, bool isVarLen, int PipelineStages>
+        typename MMAOperation, bool HasCausalMask, bool isVarLen, int PipelineStages,
+        typename ScoreMod = cutlass::flash_attention::collective::NoScoreMod, typename TileScheduler = void>
 struct XE_Flash_Attention_Prefill {
   using LayoutQ = cutlass::layout::RowMajor;
   using LayoutK = cutlass::layout::ColumnMajor;
@@ -170,7 +171,7 @@ struct XE_Flash_Attention_Prefill {
         EpilogueDispatchPolicy, MMAOperation, TileShapeOutput, SubgroupLayout, ElementAccumulator, ElementOutput, cutlass::gemm::TagToStrideC_t<LayoutO>, ElementOutput,
         GmemTiledCopyStore>;
   using CollectiveSoftmaxEpilogue = cutlass::flash_attention::collective::FlashPrefillSoftmaxEpilogue<
-        HasCausalMask, EpilogueDispatchPolicy, ElementAccumulator>;
+        HasCausalMask, EpilogueDispatchPolicy, ElementAccumulator, ScoreMod>;
 
   // Mainloop
   using CollectiveMainloop = cutlass::flash_attention::collective::FlashPrefillMma<
@@ -185,7 +186,7 @@ struct XE_Flash_Attention_Prefill {
         HasCausalMask>;
 
   using Kernel = cutlass::flash_attention::kernel::FMHAPrefill<ProblemShapeType, CollectiveMainloop,
-                                                      CollectiveSoftmaxEpilogue, CollectiveEpilogue>;
+                                                      CollectiveSoftmaxEpilogue, CollectiveEpilogue, TileScheduler>;
 };
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -217,12 +218,16 @@ struct TestbedImpl {
   using ProblemShapeType = typename FlashAttention::ProblemShape;
   static constexpr bool HasCausalMask = CollectiveMainloop::CausalMask;
   static constexpr bool isVarLen = CollectiveMainloop::is_var_len;
+  using ScoreMod = typename FlashAttention::CollectiveSoftmaxEpilogue::ScoreMod;
+  static constexpr bool HasSoftCap = cute::is_same_v<ScoreMod, cutlass::flash_attention::collective::SoftCapScoreMod>;
 
   StrideQ stride_Q;
   StrideK stride_K;
   StrideV stride_V;
   StrideO stride_O;
   uint64_t seed = 0;
+  int window_size = 0;
+  float softcap = 10.f;
 
   std::vector<int> cumulative_seqlen_q;
   std::vector<int> cumulative_seqlen_kv;
@@ -432,6 +437,15 @@ struct TestbedImpl {
 
         // delete this memory as it is no longer needed
         block_S.reset();
+        if constexpr (HasSoftCap) {
+          // soft-cap the scaled scores; a non-positive cap leaves them unchanged
+          if (softcap > 0.f) {
+            for (auto& s : host_S) {
+              s = softcap / softmax_scale * std::tanh(s * softmax_scale / softcap);
+            }
+          }
+        }
+
         auto offset = cute::min(seq_len_qo, seq_len_kv);
         auto discard_seq_coord = seq_len_qo - offset;
         auto full_tile_offset = seq_len_kv - offset;
@@ -444,6 +458,15 @@ struct TestbedImpl {
             }
           }
         }
+        if (window_size > 0) {
+          // apply sliding window mask to S
+          for (int row = 0; row < seq_len_qo; row++) {
+            for (int col = 0; col < seq_len_kv; col++) {
+              if ((row - discard_seq_coord) - (col - full_tile_offset) >= window_size)
+                host_S[col + row * seq_len_kv] = ElementAccumulator{-INFINITY};
+            }
+          }
+        }
 
         // compute max element per row of S
         std::vector<ElementAccumulator> max_vec(seq_len_qo, -INFINITY);
@@ -551,7 +574,7 @@ struct TestbedImpl {
 
   /// Executes one test
   template<class ProblemShape>
-  bool run(ProblemShape problem_size_init, float softmax_scale)
+  bool run(ProblemShape problem_size_init, float softmax_scale, int window_size_ = 0)
   {
 #if (CUTLASS_DEBUG_TRACE_LEVEL > 1)
     CUTLASS_TRACE_HOST("TestbedImpl::run"); 
@@ -570,6 +593,7 @@ struct TestbedImpl {
 #endif
 
     ProblemShapeType problem_size = this->initialize(problem_size_init);
+    window_size = window_size_;
 
 #if (CUTLASS_DEBUG_TRACE_LEVEL > 1)
     CUTLASS_TRACE_HOST("TestbedImpl::run: this->initialize() returned true");
@@ -579,11 +603,15 @@ struct TestbedImpl {
     // Initialize the Flash attention operator
     //
     cutlass::KernelHardwareInfo hw_info;
+    typename ScoreMod::Arguments score_mod_args{};
+    if constexpr (HasSoftCap) {
+      score_mod_args.softcap = softcap;
+    }
     typename FlashAttention::Arguments arguments{
       cutlass::gemm::GemmUniversalMode::kGemm,
       problem_size,
-      {block_Q.get(), stride_Q, block_K.get(), stride_K, block_V.get(), stride_V},
-      {softmax_scale},
+      {block_Q.get(), stride_Q, block_K.get(), stride_K, block_V.get(), stride_V, window_size},
+      {softmax_scale, score_mod_args},
       {block_O.get(), stride_O},
       hw_info};
 
@@ -609,6 +637,13 @@ struct TestbedImpl {
     // Run Flash attention
     //
 
+#if (CUTLASS_DEBUG_TRACE_LEVEL > 1)
+    CUTLASS_TRACE_HOST("TestbedImpl::run: Calling FlashAttention::initialize_workspace");
+#endif
+    if (FlashAttention::initialize_workspace(arguments, workspace.get()) != cutlass::Status::kSuccess) {
+      return false;
+    }
+
 #if (CUTLASS_DEBUG_TRACE_LEVEL > 1)
     CUTLASS_TRACE_HOST("TestbedImpl::run: Calling to_underlying_arguments");
 #endif
@@ -696,15 +731,16 @@ struct Testbed3x {
   template <class ProblemShape>
   bool run(
    ProblemShape problem_size,
-   float softmax_scale
+   float softmax_scale,
+   int window_size = 0
     )
   {
-    return impl_.run(problem_size, softmax_scale);
+    return impl_.run(problem_size, softmax_scale, window_size);
   }
 };
 
 template <typename FlashAttention>
-bool TestFlashPrefillAll(int head_size, std::string config="default") {
+bool TestFlashPrefillAll(int head_size, std::string config="default", int window_size = 0) {
   Testbed3x<FlashAttention> testbed;
 
   std::vector<int> problem_size_batch;
@@ -738,14 +774,14 @@ bool TestFlashPrefillAll(int head_size, std::string config="default") {
           auto problem_size = cute::make_tuple(
             batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, head_size_qk, head_size_vo);
           try {
-            passed = testbed.run(problem_size, softmax_scale);
+            passed = testbed.run(problem_size, softmax_scale, window_size);
           }
           catch (std::exception const& e) {
             EXPECT_TRUE(false) << "TestAll: testbed.run {"
               << "batch: " << batch << ", num_heads_q: " << num_heads_q << ", num_heads_kv: " << num_heads_kv
               << ", seq_len_qo: " << seq_len_qo << ", seq_len_kv: " << seq_len_kv
               << ", head_size_vo: " << head_size_vo << ", head_size_qk: " << head_size_qk
-              << ", scale: " << softmax_scale
+              << ", scale: " << softmax_scale << ", window_size: " << window_size
               << "} threw an exception: " << e.what();
             throw;
           }
@@ -754,7 +790,7 @@ bool TestFlashPrefillAll(int head_size, std::string config="default") {
               << "batch: " << batch << ", num_heads_q: " << num_heads_q << ", num_heads_kv: " << num_heads_kv
               << ", seq_len_qo: " << seq_len_qo << ", seq_len_kv: " << seq_len_kv
               << ", head_size_vo: " << head_size_vo << ", head_size_qk: " << head_size_qk
-              << ", scale: " << softmax_scale
+              << ", scale: " << softmax_scale << ", window_size: " << window_size
               << "} threw an exception (unknown)";
             throw;
           }
@@ -763,7 +799,7 @@ bool TestFlashPrefillAll(int head_size, std::string config="default") {
             << "batch: " << batch << ", num_heads_q: " << num_heads_q << ", num_heads_kv: " << num_heads_kv
             << ", seq_len_qo: " << seq_len_qo << ", seq_len_kv: " << seq_len_kv
             << ", head_size_vo: " << head_size_vo << ", head_size_qk: " << head_size_qk
-            << ", scale: " << softmax_scale
+            << ", scale: " << softmax_scale << ", window_size: " << window_size
             << "} failed";
 
           if (!passed) {
@@ -0,0 +1,88 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Host tests for the work ranking of the Xe flash attention LPT tile scheduler
+*/
+
+#include "flash_attention_v2/kernel/tile_scheduler.hpp"
+
+#include "../common/cutlass_unit_test.h"
+
+namespace cutlass {
+
+using LPTScheduler = cutlass::flash_attention::kernel::XeFlashPersistentLPTTileScheduler;
+
+// Entries are batch * num_seq_len_blocks + seq_len_block.
+TEST(XE_Flash_Attention_LPT_Tile_Scheduler, varlen_longest_sequence_first) {
+  std::vector<int> seq_len_qo{128, 512, 256};
+  std::vector<int> seq_len_kv{128, 512, 256};
+  std::vector<int> seq_len_kv_cache{0, 0, 0};
+  auto work_list = LPTScheduler::make_work_list(seq_len_qo, seq_len_kv, seq_len_kv_cache, 128, 4, false);
+  EXPECT_EQ(work_list, (std::vector<int>{4, 5, 6, 7, 8, 9, 0}));
+}
+
+TEST(XE_Flash_Attention_LPT_Tile_Scheduler, causal_last_query_block_first) {
+  std::vector<int> seq_len_qo{512, 512};
+  std::vector<int> seq_len_kv{512, 512};
+  std::vector<int> seq_len_kv_cache{0, 0};
+  auto work_list = LPTScheduler::make_work_list(seq_len_qo, seq_len_kv, seq_len_kv_cache, 128, 4, true);
+  EXPECT_EQ(work_list, (std::vector<int>{3, 7, 2, 6, 1, 5, 0, 4}));
+}
+
+TEST(XE_Flash_Attention_LPT_Tile_Scheduler, kv_cache_counts_towards_cost) {
+  std::vector<int> seq_len_qo{1, 1, 1};
+  std::vector<int> seq_len_kv{64, 64, 256};
+  std::vector<int> seq_len_kv_cache{0, 1024, 512};
+  auto work_list = LPTScheduler::make_work_list(seq_len_qo, seq_len_kv, seq_len_kv_cache, 8, 1, false);
+  EXPECT_EQ(work_list, (std::vector<int>{1, 2, 0}));
+}
+
+TEST(XE_Flash_Attention_LPT_Tile_Scheduler, empty_query_blocks_are_skipped) {
+  std::vector<int> seq_len_qo{0, 200};
+  std::vector<int> seq_len_kv{300, 300};
+  std::vector<int> seq_len_kv_cache{0, 0};
+  auto work_list = LPTScheduler::make_work_list(seq_len_qo, seq_len_kv, seq_len_kv_cache, 128, 2, false);
+  EXPECT_EQ(work_list, (std::vector<int>{2, 3}));
+}
+
+// The kernel launches every (batch, query block) pair of the longest sequence; the pairs past the end of
+// shorter sequences follow the ranked ones.
+TEST(XE_Flash_Attention_LPT_Tile_Scheduler, padding_covers_every_launched_block) {
+  std::vector<int> seq_len_qo{128, 512, 256};
+  std::vector<int> seq_len_kv{128, 512, 256};
+  std::vector<int> seq_len_kv_cache{0, 0, 0};
+  auto work_list = LPTScheduler::make_work_list(seq_len_qo, seq_len_kv, seq_len_kv_cache, 128, 4, false);
+  LPTScheduler::pad_work_list(work_list, 12);
+  EXPECT_EQ(work_list, (std::vector<int>{4, 5, 6, 7, 8, 9, 0, 1, 2, 3, 10, 11}));
+}
+
+} // namespace cutlass
@@ -66,7 +66,8 @@ namespace flash_attention {
 /////////////////////////////////////////////////////////////////////////////////////////////////
 template<typename ElementInputType, typename ElementAccumulatorType, typename ElementOutputType,  
          typename TileShapeQK, typename TileShapePV, typename TileShapeOutput, typename SubgroupLayout, 
-         typename MMAOperation, bool HasCausalMask, bool UsePagedKV, bool isVarLen, int PipelineStages>
+         typename MMAOperation, bool HasCausalMask, bool UsePagedKV, bool isVarLen, int PipelineStages,
+         typename ElementInputKVType = ElementInputType>
 struct XE_Flash_Attention_Prefill_CachedKV {
   using LayoutQ = cutlass::layout::RowMajor;
   using LayoutK = cutlass::layout::ColumnMajor;
@@ -76,7 +77,8 @@ struct XE_Flash_Attention_Prefill_CachedKV {
   using ElementAccumulator = ElementAccumulatorType;
   using ElementComputeEpilogue = ElementOutputType;
   using ElementInputQ = ElementInputType;
-  using ElementInputKV = ElementInputType;
+  using ElementInputKV = ElementInputKVType;
+  static constexpr bool IsFP8KV = cute::sizeof_bits_v<ElementInputKV> == 8;
   using ElementOutput = ElementOutputType;
 
   using ProblemShapeRegular = cute::tuple<int, int, int, int, int, int, int, int>;
@@ -89,8 +91,9 @@ struct XE_Flash_Attention_Prefill_CachedKV {
   using EpilogueDispatchPolicy = cutlass::epilogue::IntelXeXMX16;
 
   using GmemTiledCopyQ = cute::XE_2D_U16x8x32_LD_N;
-  using GmemTiledCopyK = cute::XE_2D_U16x16x16_LD_T; // _T designates a transposed block load operation
-  using GmemTiledCopyV = cute::XE_2D_U16x16x32_LD_V;
+  // _T designates a transposed block load operation
+  using GmemTiledCopyK = cute::conditional_t<IsFP8KV, cute::XE_2D_U8x16x16_LD_T, cute::XE_2D_U16x16x16_LD_T>;
+  using GmemTiledCopyV = cute::conditional_t<IsFP8KV, cute::XE_2D_U8x32x32_LD_V, cute::XE_2D_U16x16x32_LD_V>;
   using GmemTiledCopyStore = cute::XE_2D_U32x8x16_ST_N;
   using CollectiveEpilogue = cutlass::flash_attention::collective::FlashPrefillCachedEpilogue<
         EpilogueDispatchPolicy, MMAOperation, TileShapeOutput, SubgroupLayout, ElementAccumulator, ElementOutput, cutlass::gemm::TagToStrideC_t<LayoutO>, ElementOutput,
@@ -133,6 +136,9 @@ struct TestbedImpl {
   using ElementK = typename FlashPrefillCachedKV::ElementK;
   using ElementV = typename FlashPrefillCachedKV::ElementV;
   using ElementAcc = typename FlashPrefillCachedKV::ElementAccumulator;
+  // FP8 K/V are dequantized with per-KV-head scales and P stays in the Q type, as in the kernel.
+  static constexpr bool isFP8KV = cute::is_any_of_v<ElementK, cutlass::float_e4m3_t, cutlass::float_e5m2_t>;
+  using ElementP = cute::conditional_t<isFP8KV, ElementQ, ElementV>;
 
   using CollectiveMainloop = typename FlashPrefillCachedKV::CollectiveMainloop;
   using CollectiveEpilogue = typename FlashPrefillCachedKV::CollectiveEpilogue;
@@ -152,6 +158,7 @@ struct TestbedImpl {
   StrideV stride_V_cache;
   StrideO stride_O;
   uint64_t seed = 0;
+  int window_size = 0;
   bool use_kv_cache;
 
   std::vector<int> cumulative_seqlen_q;
@@ -167,6 +174,10 @@ struct TestbedImpl {
   cutlass::DeviceAllocation<ElementV> block_V_cache;
   cutlass::DeviceAllocation<ElementOutput> block_O;
   cutlass::DeviceAllocation<ElementOutput> block_ref_O;
+  std::vector<float> host_K_scale;
+  std::vector<float> host_V_scale;
+  cutlass::DeviceAllocation<float> block_K_scale;
+  cutlass::DeviceAllocation<float> block_V_scale;
 
   struct PagedKVParams {
       cutlass::DeviceAllocation<int> page_table;
@@ -174,6 +185,7 @@ struct TestbedImpl {
       cutlass::DeviceAllocation<int> num_pages_per_seq;
   };
   PagedKVParams paged_kv_cache;
+  std::vector<int> host_page_table;
 
   //
   // Methods
@@ -245,6 +257,7 @@ struct TestbedImpl {
         }
       }
       compat::memcpy(paged_kv_cache.page_table.get(), page_mapping.data(), page_mapping.size() * sizeof(int));
+      host_page_table = page_mapping;
 
       paged_kv_cache.num_pages_per_seq.reset(num_pages_per_seq.size());
       compat::memcpy(paged_kv_cache.num_pages_per_seq.get(), num_pages_per_seq.data(), num_pages_per_seq.size() * sizeof(int));
@@ -256,6 +269,19 @@ struct TestbedImpl {
     initialize_block(block_K_cache, seed + 2024);
     initialize_block(block_V_cache, seed + 2025);
 
+    if constexpr (isFP8KV) {
+      host_K_scale.resize(num_heads_kv);
+      host_V_scale.resize(num_heads_kv);
+      for (int h = 0; h < num_heads_kv; h++) {
+        host_K_scale[h] = 0.5f + 0.25f * (h % 4);
+        host_V_scale[h] = 1.5f - 0.25f * (h % 4);
+      }
+      block_K_scale.reset(num_heads_kv);
+      block_V_scale.reset(num_heads_kv);
+      block_K_scale.copy_from_host(host_K_scale.data(), num_heads_kv);
+      block_V_scale.copy_from_host(host_V_scale.data(), num_heads_kv);
+    }
+
     if (!cumulative_seqlen_q.empty()) {
       device_cumulative_seqlen_q.reset(cumulative_seqlen_q.size());
       device_cumulative_seqlen_q.copy_from_host(
@@ -321,7 +347,9 @@ struct TestbedImpl {
     for (int i = 0; i < num_batches; i++) {
       int seqlen_q = cutlass::round_up(generate_positive_int(dist_q, rng), AlignmentQ);
       int seqlen_kv = cutlass::round_up(generate_positive_int(dist_kv, rng), AlignmentKV);
-      int seqlen_kv_cache = !use_kv_cache ? 0 : cutlass::round_up(generate_positive_int(dist_kv_cache, rng), AlignmentKV);
+      // A paged cache is read a whole page at a time, so keep it page aligned.
+      int seqlen_kv_cache = !use_kv_cache ? 0 : cutlass::round_up(generate_positive_int(dist_kv_cache, rng),
+                                                                  UsePagedKV ? paged_kv_cache.page_size : AlignmentKV);
 
       total_seqlen_q += seqlen_q;
       total_seqlen_kv += seqlen_kv;
@@ -401,29 +429,35 @@ struct TestbedImpl {
 
         ElementK* k_ptr;
         ElementV* v_ptr;
+        cutlass::DeviceAllocation<ElementK> block_K_concat;
+        cutlass::DeviceAllocation<ElementV> block_V_concat;
 
         if (use_kv_cache) {
-          cutlass::DeviceAllocation<ElementK> block_K_concat(head_size_qk * seq_len_kv_total);
-          cutlass::DeviceAllocation<ElementV> block_V_concat(seq_len_kv_total * head_size_vo);
-
-          // Concatenate K_cache and K
-          compat::memcpy<ElementK>(
-              block_K_concat.get(),
-              block_K_cache.get() + offset_k_cache,
-              seq_len_kv_cache * head_size_qk
-          );
+          block_K_concat.reset(head_size_qk * seq_len_kv_total);
+          block_V_concat.reset(seq_len_kv_total * head_size_vo);
+
+          // Concatenate K_cache and K. A paged cache is gathered page by page in logical order.
+          int cache_pages = UsePagedKV ? seq_len_kv_cache / paged_kv_cache.page_size : 1;
+          int cache_page_len = UsePagedKV ? paged_kv_cache.page_size : seq_len_kv_cache;
+          int page_table_offset = (isVarLen ? cumulative_seqlen_kv_cache[b] : b * seq_len_kv_cache) / cache_page_len;
+          for (int page = 0; page < cache_pages; page++) {
+            int physical_page = UsePagedKV ? host_page_table[page_table_offset + page] : page;
+            compat::memcpy<ElementK>(
+                block_K_concat.get() + page * cache_page_len * head_size_qk,
+                block_K_cache.get() + offset_k_cache + physical_page * cache_page_len * head_size_qk,
+                cache_page_len * head_size_qk
+            );
+            compat::memcpy<ElementV>(
+                block_V_concat.get() + page * cache_page_len * head_size_vo,
+                block_V_cache.get() + offset_v_cache + physical_page * cache_page_len * head_size_vo,
+                cache_page_len * head_size_vo
+            );
+          }
           compat::memcpy<ElementK>(
               block_K_concat.get() + seq_len_kv_cache * head_size_qk,
               block_K.get() + offset_k,
               seq_len_kv * head_size_qk
           );
-
-          // Concatenate V_cache and V
-          compat::memcpy<ElementV>(
-              block_V_concat.get(),
-              block_V_cache.get() + offset_v_cache,
-              seq_len_kv_cache * head_size_vo
-          );
           compat::memcpy<ElementV>(
               block_V_concat.get() + seq_len_kv_cache * head_size_vo,
               block_V.get() + offset_v,
@@ -457,6 +491,12 @@ struct TestbedImpl {
         std::vector<ElementAccumulator> host_S(block_S.size());
         compat::memcpy<ElementAccumulator>(host_S.data(), block_S.get(), host_S.size());
 
+        if constexpr (isFP8KV) {
+          for (auto& s : host_S) {
+            s *= host_K_scale[h / q_group_size];
+          }
+        }
+
         // delete this memory as it is no longer needed
         block_S.reset();
         auto offset = cute::min(seq_len_qo, seq_len_kv);
@@ -472,6 +512,15 @@ struct TestbedImpl {
             }
           }
         }
+        if (window_size > 0) {
+          // apply sliding window mask to S, counting keys over [cache, new]
+          for (int row = 0; row < seq_len_qo; row++) {
+            for (int col = 0; col < seq_len_kv_total; col++) {
+              if ((row + start_col - discard_seq_coord + full_tile_offset) - col >= window_size)
+                host_S[col + row * seq_len_kv_total] = ElementAccumulator{-INFINITY};
+            }
+          }
+        }
 
         // compute max element per row of S
         std::vector<ElementAccumulator> max_vec(seq_len_qo, ElementAccumulator{-INFINITY});
@@ -515,14 +564,14 @@ struct TestbedImpl {
           }
         }
 
-        std::vector<ElementV> host_P(host_S.size());
+        std::vector<ElementP> host_P(host_S.size());
         for (int p = 0; p < host_P.size(); p++)
-          host_P[p] = static_cast<ElementV>(host_S[p]);
+          host_P[p] = static_cast<ElementP>(host_S[p]);
 
-        cutlass::DeviceAllocation<ElementV> block_P;
+        cutlass::DeviceAllocation<ElementP> block_P;
         block_P.reset(host_P.size());
 
-        compat::memcpy<ElementV>(block_P.get(), host_P.data(), host_P.size());
+        compat::memcpy<ElementP>(block_P.get(), host_P.data(), host_P.size());
 
         cutlass::TensorRef ref_P(block_P.get(), LayoutQ::packed({seq_len_qo, seq_len_kv_total}));
 
@@ -547,6 +596,12 @@ struct TestbedImpl {
         std::vector<ElementAccumulator> vec_acc(block_acc.size());
         compat::memcpy<ElementAccumulator>(vec_acc.data(), block_acc.get(), vec_acc.size());
 
+        if constexpr (isFP8KV) {
+          for (auto& acc : vec_acc) {
+            acc *= host_V_scale[h / q_group_size];
+          }
+        }
+
         // delete this memory as it is no longer needed
         block_acc.reset();
         std::vector<ElementOutput> vec_out(vec_acc.size());
@@ -581,7 +636,7 @@ struct TestbedImpl {
 
   /// Executes one test
   template<class ProblemShape>
-  bool run(ProblemShape problem_size_init, float softmax_scale)
+  bool run(ProblemShape problem_size_init, float softmax_scale, int window_size_ = 0)
   {
 #if (CUTLASS_DEBUG_TRACE_LEVEL > 1)
     CUTLASS_TRACE_HOST("TestbedImpl::run"); 
@@ -600,6 +655,7 @@ struct TestbedImpl {
 #endif
 
     ProblemShapeType problem_size = this->initialize(problem_size_init);
+    window_size = window_size_;
 
 #if (CUTLASS_DEBUG_TRACE_LEVEL > 1)
     CUTLASS_TRACE_HOST("TestbedImpl::run: this->initialize() returned true");
@@ -619,7 +675,9 @@ struct TestbedImpl {
       block_V_cache.get(), stride_V_cache,
       UsePagedKV ? paged_kv_cache.page_table.get() : nullptr,
       UsePagedKV ? paged_kv_cache.page_size : 0,
-      UsePagedKV ? paged_kv_cache.num_pages_per_seq.get() : nullptr},
+      UsePagedKV ? paged_kv_cache.num_pages_per_seq.get() : nullptr,
+      window_size,
+      block_K_scale.get(), block_V_scale.get()},
       {softmax_scale},
       {block_O.get(), stride_O},
       hw_info};
@@ -732,15 +790,16 @@ struct Testbed3x {
   template <class ProblemShape>
   bool run(
    ProblemShape problem_size,
-   float softmax_scale
+   float softmax_scale,
+   int window_size = 0
     )
   {
-    return impl_.run(problem_size, softmax_scale);
+    return impl_.run(problem_size, softmax_scale, window_size);
   }
 };
 
 template <typename FlashPrefillCachedKV>
-bool TestFlashPrefillCachedKVAll(int head_size) {
+bool TestFlashPrefillCachedKVAll(int head_size, int window_size = 0) {
   Testbed3x<FlashPrefillCachedKV> testbed;
 
   std::vector<int> problem_size_batch{8};
@@ -766,14 +825,14 @@ bool TestFlashPrefillCachedKVAll(int head_size) {
             auto problem_size = cute::make_tuple(
               batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, seq_len_kv_cache, head_size_qk, head_size_vo);
             try {
-              passed = testbed.run(problem_size, softmax_scale);
+              passed = testbed.run(problem_size, softmax_scale, window_size);
             }
             catch (std::exception const& e) {
               EXPECT_TRUE(false) << "TestFlashPrefillCachedKVAll: testbed.run {"
                 << "batch: " << batch << ", num_heads_q: " << num_heads_q << ", num_heads_kv: " << num_heads_kv
                 << ", seq_len_qo: " << seq_len_qo << ", seq_len_kv: " << seq_len_kv << ", seq_len_kv_cache: "
                 << seq_len_cache << ", head_size_vo: " << head_size_vo << ", head_size_qk: " << head_size_qk
-                << ", scale: " << softmax_scale
+                << ", scale: " << softmax_scale << ", window_size: " << window_size
                 << "} threw an exception: " << e.what();
               throw;
             }
@@ -782,7 +841,7 @@ bool TestFlashPrefillCachedKVAll(int head_size) {
                 << "batch: " << batch << ", num_heads_q: " << num_heads_q << ", num_heads_kv: " << num_heads_kv
                 << ", seq_len_qo: " << seq_len_qo << ", seq_len_kv: " << seq_len_kv << ", seq_len_kv_cache: "
                 << seq_len_cache << ", head_size_vo: " << head_size_vo << ", head_size_qk: " << head_size_qk
-                << ", scale: " << softmax_scale
+                << ", scale: " << softmax_scale << ", window_size: " << window_size
                 << "} threw an exception (unknown)";
               throw;
             }
@@ -791,7 +850,7 @@ bool TestFlashPrefillCachedKVAll(int head_size) {
               << "batch: " << batch << ", num_heads_q: " << num_heads_q << ", num_heads_kv: " << num_heads_kv
               << ", seq_len_qo: " << seq_len_qo << ", seq_len_kv: " << seq_len_kv << ", seq_len_kv_cache: "
               << seq_len_cache << ", head_size_vo: " << head_size_vo << ", head_size_qk: " << head_size_qk
-              << ", scale: " << softmax_scale
+              << ", scale: " << softmax_scale << ", window_size: " << window_size
               << "} failed";
 
             if (!passed) {
@@ -86,4 +86,40 @@ TEST(XE_Flash_Attention_Prefill_bf16_128, varlen_noncausal) {
   EXPECT_TRUE(test::flash_attention::TestFlashPrefillCachedKVAll<Kernel>(128));
 }
 
+TEST(XE_Flash_Attention_Prefill_bf16_128, paged_causal) {
+  constexpr int PipelineStages = 2;
+  using ShapeQK = Shape<_128, _64, _64>;
+  using ShapePV = Shape<_128, _32, _64>;
+  using ShapeOutPut = Shape<_128, _128, _64>;
+  using SubgroupLayout = Layout<Shape<_16, _1, _1>, Stride<_1, _1, _1>>;
+  using MMAOperation = XE_8x16x16_F32BF16BF16F32_TT;
+  using Kernel = test::flash_attention::XE_Flash_Attention_Prefill_CachedKV<bfloat16_t, float, float, ShapeQK, ShapePV,ShapeOutPut, 
+                                            SubgroupLayout, MMAOperation, true, true, false, 2>::Kernel;
+  EXPECT_TRUE(test::flash_attention::TestFlashPrefillCachedKVAll<Kernel>(128));
+}
+
+TEST(XE_Flash_Attention_Prefill_bf16_128, paged_noncausal) {
+  constexpr int PipelineStages = 2;
+  using ShapeQK = Shape<_128, _64, _64>;
+  using ShapePV = Shape<_128, _32, _64>;
+  using ShapeOutPut = Shape<_128, _128, _64>;
+  using SubgroupLayout = Layout<Shape<_16, _1, _1>, Stride<_1, _1, _1>>;
+  using MMAOperation = XE_8x16x16_F32BF16BF16F32_TT;
+  using Kernel = test::flash_attention::XE_Flash_Attention_Prefill_CachedKV<bfloat16_t, float, float, ShapeQK, ShapePV,ShapeOutPut, 
+                                            SubgroupLayout, MMAOperation, false, true, false, 2>::Kernel;
+  EXPECT_TRUE(test::flash_attention::TestFlashPrefillCachedKVAll<Kernel>(128));
+}
+
+TEST(XE_Flash_Attention_Prefill_bf16_128, varlen_paged_noncausal) {
+  constexpr int PipelineStages = 2;
+  using ShapeQK = Shape<_128, _64, _64>;
+  using ShapePV = Shape<_128, _32, _64>;
+  using ShapeOutPut = Shape<_128, _128, _64>;
+  using SubgroupLayout = Layout<Shape<_16, _1, _1>, Stride<_1, _1, _1>>;
+  using MMAOperation = XE_8x16x16_F32BF16BF16F32_TT;
+  using Kernel = test::flash_attention::XE_Flash_Attention_Prefill_CachedKV<bfloat16_t, float, float, ShapeQK, ShapePV,ShapeOutPut, 
+                                            SubgroupLayout, MMAOperation, false, true, true, 2>::Kernel;
+  EXPECT_TRUE(test::flash_attention::TestFlashPrefillCachedKVAll<Kernel>(128));
+}
+
 } // namespace cutlass
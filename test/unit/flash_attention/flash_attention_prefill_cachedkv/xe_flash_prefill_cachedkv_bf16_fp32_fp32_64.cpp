@@ -61,6 +61,30 @@ TEST(XE_Flash_Attention_Prefill_bf16_64, noncausal) {
   EXPECT_TRUE(test::flash_attention::TestFlashPrefillCachedKVAll<Kernel>(64));
 }
 
+TEST(XE_Flash_Attention_Prefill_bf16_64, causal_sliding_window) {
+  constexpr int PipelineStages = 2;
+  using ShapeQK = Shape<_128, _64, _64>;
+  using ShapePV = Shape<_128, _32, _64>;
+  using ShapeOutPut = Shape<_128, _64, _64>;
+  using SubgroupLayout = Layout<Shape<_8, _1, _1>, Stride<_1, _1, _1>>; 
+  using MMAOperation = XE_8x16x16_F32BF16BF16F32_TT;
+  using Kernel = test::flash_attention::XE_Flash_Attention_Prefill_CachedKV<bfloat16_t, float, float, ShapeQK, ShapePV,ShapeOutPut, 
+                                            SubgroupLayout, MMAOperation, true, false, false, 2>::Kernel;
+  EXPECT_TRUE(test::flash_attention::TestFlashPrefillCachedKVAll<Kernel>(64, 300));
+}
+
+TEST(XE_Flash_Attention_Prefill_bf16_64, causal_fp8_e4m3_kv) {
+  constexpr int PipelineStages = 2;
+  using ShapeQK = Shape<_128, _64, _64>;
+  using ShapePV = Shape<_128, _32, _64>;
+  using ShapeOutPut = Shape<_128, _64, _64>;
+  using SubgroupLayout = Layout<Shape<_8, _1, _1>, Stride<_1, _1, _1>>; 
+  using MMAOperation = XE_8x16x16_F32BF16BF16F32_TT;
+  using Kernel = test::flash_attention::XE_Flash_Attention_Prefill_CachedKV<bfloat16_t, float, float, ShapeQK, ShapePV,ShapeOutPut, 
+                                            SubgroupLayout, MMAOperation, true, false, false, 2, float_e4m3_t>::Kernel;
+  EXPECT_TRUE(test::flash_attention::TestFlashPrefillCachedKVAll<Kernel>(64));
+}
+
 TEST(DISABLED_XE_Flash_Attention_Prefill_bf16_64, varlen_causal) {
   constexpr int PipelineStages = 2;
   using ShapeQK = Shape<_128, _64, _64>;
@@ -86,4 +110,52 @@ TEST(XE_Flash_Attention_Prefill_bf16_64, varlen_noncausal) {
   EXPECT_TRUE(test::flash_attention::TestFlashPrefillCachedKVAll<Kernel>(64));
 }
 
+TEST(XE_Flash_Attention_Prefill_bf16_64, paged_causal) {
+  constexpr int PipelineStages = 2;
+  using ShapeQK = Shape<_128, _64, _64>;
+  using ShapePV = Shape<_128, _32, _64>;
+  using ShapeOutPut = Shape<_128, _64, _64>;
+  using SubgroupLayout = Layout<Shape<_8, _1, _1>, Stride<_1, _1, _1>>;
+  using MMAOperation = XE_8x16x16_F32BF16BF16F32_TT;
+  using Kernel = test::flash_attention::XE_Flash_Attention_Prefill_CachedKV<bfloat16_t, float, float, ShapeQK, ShapePV,ShapeOutPut, 
+                                            SubgroupLayout, MMAOperation, true, true, false, 2>::Kernel;
+  EXPECT_TRUE(test::flash_attention::TestFlashPrefillCachedKVAll<Kernel>(64));
+}
+
+TEST(XE_Flash_Attention_Prefill_bf16_64, paged_noncausal) {
+  constexpr int PipelineStages = 2;
+  using ShapeQK = Shape<_128, _64, _64>;
+  using ShapePV = Shape<_128, _32, _64>;
+  using ShapeOutPut = Shape<_128, _64, _64>;
+  using SubgroupLayout = Layout<Shape<_8, _1, _1>, Stride<_1, _1, _1>>;
+  using MMAOperation = XE_8x16x16_F32BF16BF16F32_TT;
+  using Kernel = test::flash_attention::XE_Flash_Attention_Prefill_CachedKV<bfloat16_t, float, float, ShapeQK, ShapePV,ShapeOutPut, 
+                                            SubgroupLayout, MMAOperation, false, true, false, 2>::Kernel;
+  EXPECT_TRUE(test::flash_attention::TestFlashPrefillCachedKVAll<Kernel>(64));
+}
+
+TEST(XE_Flash_Attention_Prefill_bf16_64, paged_causal_sliding_window) {
+  constexpr int PipelineStages = 2;
+  using ShapeQK = Shape<_128, _64, _64>;
+  using ShapePV = Shape<_128, _32, _64>;
+  using ShapeOutPut = Shape<_128, _64, _64>;
+  using SubgroupLayout = Layout<Shape<_8, _1, _1>, Stride<_1, _1, _1>>;
+  using MMAOperation = XE_8x16x16_F32BF16BF16F32_TT;
+  using Kernel = test::flash_attention::XE_Flash_Attention_Prefill_CachedKV<bfloat16_t, float, float, ShapeQK, ShapePV,ShapeOutPut, 
+                                            SubgroupLayout, MMAOperation, true, true, false, 2>::Kernel;
+  EXPECT_TRUE(test::flash_attention::TestFlashPrefillCachedKVAll<Kernel>(64, 300));
+}
+
+TEST(XE_Flash_Attention_Prefill_bf16_64, varlen_paged_noncausal) {
+  constexpr int PipelineStages = 2;
+  using ShapeQK = Shape<_128, _64, _64>;
+  using ShapePV = Shape<_128, _32, _64>;
+  using ShapeOutPut = Shape<_128, _64, _64>;
+  using SubgroupLayout = Layout<Shape<_8, _1, _1>, Stride<_1, _1, _1>>;
+  using MMAOperation = XE_8x16x16_F32BF16BF16F32_TT;
+  using Kernel = test::flash_attention::XE_Flash_Attention_Prefill_CachedKV<bfloat16_t, float, float, ShapeQK, ShapePV,ShapeOutPut, 
+                                            SubgroupLayout, MMAOperation, false, true, true, 2>::Kernel;
+  EXPECT_TRUE(test::flash_attention::TestFlashPrefillCachedKVAll<Kernel>(64));
+}
+
 } // namespace cutlass
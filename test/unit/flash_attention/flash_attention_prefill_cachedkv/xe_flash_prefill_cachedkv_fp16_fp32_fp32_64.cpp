@@ -61,6 +61,18 @@ TEST(XE_Flash_Attention_Prefill_fp16_64, noncausal) {
   EXPECT_TRUE(test::flash_attention::TestFlashPrefillCachedKVAll<Kernel>(64));
 }
 
+TEST(XE_Flash_Attention_Prefill_fp16_64, causal_sliding_window) {
+  constexpr int PipelineStages = 2;
+  using ShapeQK = Shape<_128, _64, _64>;
+  using ShapePV = Shape<_128, _32, _64>;
+  using ShapeOutPut = Shape<_128, _64, _64>;
+  using SubgroupLayout = Layout<Shape<_8, _1, _1>, Stride<_1, _1, _1>>; 
+  using MMAOperation = XE_8x16x16_F32F16F16F32_TT;
+  using Kernel = test::flash_attention::XE_Flash_Attention_Prefill_CachedKV<half_t, float, float, ShapeQK, ShapePV,ShapeOutPut, 
+                                            SubgroupLayout, MMAOperation, true, false, false, 2>::Kernel;
+  EXPECT_TRUE(test::flash_attention::TestFlashPrefillCachedKVAll<Kernel>(64, 300));
+}
+
 TEST(DISABLED_XE_Flash_Attention_Prefill_fp16_64, varlen_causal) {
   constexpr int PipelineStages = 2;
   using ShapeQK = Shape<_128, _64, _64>;
@@ -2831,7 +2831,7 @@ struct TestbedImpl {
     auto mainloop_params = collective_mma_inputs.to_host_args(problem_size);
     auto epilogue_params = collective_epilogue.to_host_args(problem_size);
 
-    cutlass::reference::host::Gemm3x(mainloop_params, epilogue_params);
+    cutlass::reference::host::Gemm3xParallel(mainloop_params, epilogue_params);
 
     bool passed = compare_reference(problem_shape_MNKL, alpha, beta);
     return passed;
@@ -4107,6 +4107,12 @@ bool TestXe(
   using RasterOrderOptions = typename cutlass::gemm::kernel::detail::PersistentTileSchedulerSm90::RasterOrderOptions;
   std::vector<RasterOrderOptions> raster_orders = {RasterOrderOptions::AlongM};
   std::vector max_swizzle_sizes{detail::MaxSwizzleSize{1}};
+  static constexpr bool UsesSwizzleScheduler = cute::is_same_v<typename Gemm::GemmKernel::TileSchedulerTag, cutlass::gemm::SwizzleScheduler>;
+  if constexpr (UsesSwizzleScheduler) {
+    raster_orders.push_back(RasterOrderOptions::AlongN);
+    max_swizzle_sizes.push_back(detail::MaxSwizzleSize{2});
+    max_swizzle_sizes.push_back(detail::MaxSwizzleSize{4});
+  }
 
   bool passed = true;
 
@@ -1399,8 +1399,12 @@ public:
     cutlass::Status status = gemm_op.can_implement(arguments);
 
     if (status != cutlass::Status::kSuccess) {
+#if defined(CUTLASS_ENABLE_SYCL)
+      std::cerr << "This test is not supported." << "\n";
+#else
       cudaError_t error = cudaGetLastError();
       std::cerr << "This test is not supported: " << cudaGetErrorString(error) << "\n";
+#endif
       return true;
     }
     
@@ -1411,14 +1415,22 @@ public:
       return impl_.profile(problem_size, iterations, gemm_op, arguments, workspace);
     }
     else {
-      cudaError_t result;
       status = gemm_op.initialize(arguments, workspace.get());
       status = gemm_op.run();
-      result = cudaDeviceSynchronize();
+#if defined(CUTLASS_ENABLE_SYCL)
+      try {
+        compat::wait_and_throw();
+      } catch (std::exception const &e) {
+        ADD_FAILURE() << "Error at Kernel Sync.";
+        return false;
+      }
+#else
+      cudaError_t result = cudaDeviceSynchronize();
       if (result != cudaSuccess) {
         EXPECT_EQ(result, cudaSuccess) << "Error at Kernel Sync.";
         return false;
       }
+#endif
     }
 
     EXPECT_TRUE(status == cutlass::Status::kSuccess) << to_string(status);
@@ -1642,8 +1654,12 @@ public:
     cutlass::Status status = gemm_op.can_implement(arguments);
 
     if (status != cutlass::Status::kSuccess) {
+#if defined(CUTLASS_ENABLE_SYCL)
+      std::cerr << "This test is not supported." << "\n";
+#else
       cudaError_t error = cudaGetLastError();
       std::cerr << "This test is not supported: " << cudaGetErrorString(error) << "\n";
+#endif
       return true;
     }
     
@@ -1654,14 +1670,22 @@ public:
       return impl_.profile(problem_size, iterations, gemm_op, arguments, workspace);
     }
     else {
-      cudaError_t result;
       status = gemm_op.initialize(arguments, workspace.get());
       status = gemm_op.run();
-      result = cudaDeviceSynchronize();
+#if defined(CUTLASS_ENABLE_SYCL)
+      try {
+        compat::wait_and_throw();
+      } catch (std::exception const &e) {
+        ADD_FAILURE() << "Error at Kernel Sync.";
+        return false;
+      }
+#else
+      cudaError_t result = cudaDeviceSynchronize();
       if (result != cudaSuccess) {
         EXPECT_EQ(result, cudaSuccess) << "Error at Kernel Sync.";
         return false;
       }
+#endif
     }
 
     EXPECT_TRUE(status == cutlass::Status::kSuccess) << to_string(status);
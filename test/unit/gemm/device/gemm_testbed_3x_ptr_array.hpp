@@ -2003,7 +2003,7 @@ struct TestbedImpl {
       auto mainloop_params = collective_mma_inputs.to_host_args(problem_shapes, i);
       auto epilogue_params = collective_epilogue.to_host_args(problem_shapes, i);
 
-      cutlass::reference::host::Gemm3x(mainloop_params, epilogue_params);
+      cutlass::reference::host::Gemm3xParallel(mainloop_params, epilogue_params);
 
       passed &= compare_reference(problem_shapes, alpha, beta, i);
     }
@@ -44,7 +44,7 @@
 
 namespace cutlass {
 namespace {
-template <typename LayoutA, typename LayoutB>
+template <typename LayoutA, typename LayoutB, typename TileScheduler = void>
 struct XE_Device_Gemm_bf16_bf16_f32_tensor_op_f32 {
   using Config =
     gemm::device::DefaultGemmConfigurationToCutlass3Types<
@@ -58,7 +58,8 @@ struct XE_Device_Gemm_bf16_bf16_f32_tensor_op_f32 {
     gemm::kernel::GemmUniversal<
       cute::Shape<int,int,int,int>,
       typename Config::CollectiveMainloop,
-      typename Config::CollectiveEpilogue>>;
+      typename Config::CollectiveEpilogue,
+      TileScheduler>>;
 };
 
 TEST(XE_Device_Gemm_bf16t_bf16t_f32t_tensor_op_f32, 256x256x32) {
@@ -85,5 +86,11 @@ TEST(XE_Device_Gemm_bf16n_bf16n_f32t_tensor_op_f32, 256x256x32) {
   EXPECT_TRUE(test::gemm::device::TestXe<Gemm>());
 }
 
+TEST(XE_Device_Gemm_bf16t_bf16n_f32t_tensor_op_f32_swizzle, 256x256x32) {
+  using Gemm = XE_Device_Gemm_bf16_bf16_f32_tensor_op_f32<
+    layout::RowMajor, layout::ColumnMajor, gemm::SwizzleScheduler>::Gemm;
+  EXPECT_TRUE(test::gemm::device::TestXe<Gemm>());
+}
+
 }
 } // namespace cutlass
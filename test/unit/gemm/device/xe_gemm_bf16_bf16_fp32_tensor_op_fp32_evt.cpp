@@ -31,7 +31,7 @@
 
 /*! \file
     \brief Tests for Xe bf16t_bf16t_f32 with EVT epilogue
-    LinCombEltAct
+    LinCombEltAct, ColBroadcast, AuxStore, RowReduction and ColReduction
 */
 
 #include <iostream>
@@ -43,7 +43,7 @@
 #include "cutlass/epilogue/collective/collective_builder.hpp"
 #include "cutlass/gemm/collective/collective_builder.hpp"
 
-#include "gemm_testbed_3x.hpp"
+#include "gemm_testbed_3x_evt.hpp"
 
 namespace cutlass {
 namespace {
@@ -198,5 +198,119 @@ TEST(XE_Device_Gemm_bf16t_bf16t_f32_tensor_op_gmma_f32_epilogue, 256x256x32_LinC
   bool passed = test::gemm::device::TestXe<Gemm>(1.0, 0.0);
   EXPECT_TRUE(passed);
 }
+
+// Z = acc + bias (bias broadcast along N), Aux = Z, D = ReLU(Z)
+TEST(XE_Device_Gemm_bf16t_bf16t_f32_tensor_op_gmma_f32_epilogue, 256x256x32_ColBroadcastAuxStore) {
+  using namespace test::gemm::device;
+  using ElementBias = float;
+  using ElementAux = float;
+  using LayoutAux = layout::RowMajor;
+  constexpr auto RoundStyle = FloatRoundStyle::round_to_nearest;
+
+  using EVTPreAct = epilogue::fusion::Sm90EVT<
+      epilogue::fusion::Sm90Compute<plus, ElementComputeEpilogue, ElementComputeEpilogue, RoundStyle>,
+      epilogue::fusion::Sm90AccFetch,
+      epilogue::fusion::XeColBroadcast<0, TileShape_MNK, ElementBias, ElementComputeEpilogue>>;
+  using EVTAux = epilogue::fusion::Sm90EVT<
+      epilogue::fusion::XeAuxStore<ElementAux, gemm::TagToStrideC_t<LayoutAux>, RoundStyle>,
+      EVTPreAct>;
+  using FusionCallbacks = epilogue::fusion::Sm90EVT<
+      epilogue::fusion::Sm90Compute<epilogue::thread::ReLu, ElementOutput, ElementComputeEpilogue, RoundStyle>,
+      EVTAux>;
+
+  using CollectiveEpilogue = typename epilogue::collective::CollectiveBuilder<
+      arch::IntelXe, arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      epilogue::collective::EpilogueTileAuto,
+      ElementComputeEpilogue, ElementAccumulator,
+      ElementAccumulator, LayoutC, AlignmentC,
+      ElementOutput, LayoutD, AlignmentD,
+      EpilogueSchedule,
+      FusionCallbacks
+    >::CollectiveOp;
+
+  using Gemm = XE_Device_Gemm_bf16_bf16_f32_tensor_op_gmma_f32_epilogue<CollectiveEpilogue>::Gemm;
+
+  struct HostReference {
+    using EVTModule = HostTreeVisitor<
+      HostAuxStore<ElementOutput, LayoutD, true>,
+      HostTreeVisitor<
+        HostCompute<epilogue::thread::ReLu>,
+        HostTreeVisitor<
+          HostAuxStore<ElementAux, LayoutAux>,
+          HostTreeVisitor<HostCompute<plus>, HostAccumulator<>, HostColBroadcast<ElementBias>>>>>;
+  };
+
+  bool passed = TestAllEVT<Gemm, HostReference>(true);
+  EXPECT_TRUE(passed);
+}
+
+// D = acc, RowReduce = sum of D along M
+TEST(XE_Device_Gemm_bf16t_bf16t_f32_tensor_op_gmma_f32_epilogue, 256x256x32_RowReduction) {
+  using namespace test::gemm::device;
+  using ElementReduce = float;
+  constexpr auto RoundStyle = FloatRoundStyle::round_to_nearest;
+
+  using FusionCallbacks = epilogue::fusion::Sm90EVT<
+      epilogue::fusion::XeRowReduction<plus, atomic_add, 0, TileShape_MNK,
+                                       ElementReduce, ElementComputeEpilogue, RoundStyle>,
+      epilogue::fusion::Sm90AccFetch>;
+
+  using CollectiveEpilogue = typename epilogue::collective::CollectiveBuilder<
+      arch::IntelXe, arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      epilogue::collective::EpilogueTileAuto,
+      ElementComputeEpilogue, ElementAccumulator,
+      ElementAccumulator, LayoutC, AlignmentC,
+      ElementOutput, LayoutD, AlignmentD,
+      EpilogueSchedule,
+      FusionCallbacks
+    >::CollectiveOp;
+
+  using Gemm = XE_Device_Gemm_bf16_bf16_f32_tensor_op_gmma_f32_epilogue<CollectiveEpilogue>::Gemm;
+
+  struct HostReference {
+    using EVTModule = HostTreeVisitor<
+      HostAuxStore<ElementOutput, LayoutD, true>,
+      HostTreeVisitor<HostRowReduce<plus, ElementReduce>, HostAccumulator<>>>;
+  };
+
+  bool passed = TestAllEVT<Gemm, HostReference>(true);
+  EXPECT_TRUE(passed);
+}
+
+// D = acc, ColReduce = sum of D along N
+TEST(XE_Device_Gemm_bf16t_bf16t_f32_tensor_op_gmma_f32_epilogue, 256x256x32_ColReduction) {
+  using namespace test::gemm::device;
+  using ElementReduce = float;
+  constexpr auto RoundStyle = FloatRoundStyle::round_to_nearest;
+
+  using FusionCallbacks = epilogue::fusion::Sm90EVT<
+      epilogue::fusion::XeColReduction<plus, atomic_add, 0, TileShape_MNK,
+                                       ElementReduce, ElementComputeEpilogue, RoundStyle>,
+      epilogue::fusion::Sm90AccFetch>;
+
+  using CollectiveEpilogue = typename epilogue::collective::CollectiveBuilder<
+      arch::IntelXe, arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      epilogue::collective::EpilogueTileAuto,
+      ElementComputeEpilogue, ElementAccumulator,
+      ElementAccumulator, LayoutC, AlignmentC,
+      ElementOutput, LayoutD, AlignmentD,
+      EpilogueSchedule,
+      FusionCallbacks
+    >::CollectiveOp;
+
+  using Gemm = XE_Device_Gemm_bf16_bf16_f32_tensor_op_gmma_f32_epilogue<CollectiveEpilogue>::Gemm;
+
+  struct HostReference {
+    using EVTModule = HostTreeVisitor<
+      HostAuxStore<ElementOutput, LayoutD, true>,
+      HostTreeVisitor<HostColumnReduce<plus, ElementReduce>, HostAccumulator<>>>;
+  };
+
+  bool passed = TestAllEVT<Gemm, HostReference>(true);
+  EXPECT_TRUE(passed);
+}
 }
 } // namespace cutlass
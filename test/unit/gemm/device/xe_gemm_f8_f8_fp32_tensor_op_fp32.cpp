@@ -38,6 +38,7 @@
 
 #include "cutlass/gemm/device/gemm_universal_adapter.h"
 #include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
 #include "default_gemm_configuration.hpp"
 
 #include "gemm_testbed_3x.hpp"
@@ -104,5 +105,44 @@ TEST(XE_Device_Gemm_f8n_f8n_fp32t_tensor_op_fp32, 256x256x32) {
   using Gemm_float_e4m3_t = XE_Device_Gemm_f8_f8_fp32_tensor_op_fp32<float_e4m3_t, LayoutA, LayoutB>::Gemm;
   EXPECT_TRUE(test::gemm::device::TestXe<Gemm_float_e4m3_t>());
 }
+
+// fp8 output with the fused amax and per-tensor output scaling:
+// amax_d = max(abs(relu(Z))), D = scale_d * relu(Z)
+template <typename fp8_out, typename LayoutA, typename LayoutB>
+struct XE_Device_Gemm_f8_f8_f8_tensor_op_fp32_amax {
+  using Config = typename XE_Device_Gemm_f8_f8_fp32_tensor_op_fp32<float_e4m3_t, LayoutA, LayoutB>::Config;
+
+  using FusionOperation = epilogue::fusion::ScaledLinCombEltActAmax<
+    epilogue::thread::ReLu, fp8_out, float, float, float>;
+
+  using CollectiveEpilogue = typename epilogue::collective::CollectiveBuilder<
+    arch::IntelXe, arch::OpClassTensorOp,
+    typename Config::TileShape, cute::Shape<cute::_1, cute::_1, cute::_1>,
+    epilogue::collective::EpilogueTileAuto,
+    float, float,
+    float, layout::RowMajor, 128 / sizeof_bits_v<float>,
+    fp8_out, layout::RowMajor, 128 / sizeof_bits_v<fp8_out>,
+    epilogue::collective::EpilogueScheduleAuto,
+    FusionOperation
+  >::CollectiveOp;
+
+  using GemmKernel = gemm::kernel::GemmUniversal<
+    cute::Shape<int, int, int, int>,
+    typename Config::CollectiveMainloop,
+    CollectiveEpilogue>;
+
+  using Gemm = gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+TEST(XE_Device_Gemm_f8t_f8t_f8t_tensor_op_fp32, 256x256x32_ScaledLinCombEltActAmax) {
+  using LayoutA = layout::RowMajor;
+  using LayoutB = layout::RowMajor;
+
+  using Gemm_float_e4m3_t = XE_Device_Gemm_f8_f8_f8_tensor_op_fp32_amax<float_e4m3_t, LayoutA, LayoutB>::Gemm;
+  EXPECT_TRUE((test::gemm::device::TestXe<Gemm_float_e4m3_t, epilogue::thread::ReLu>()));
+
+  using Gemm_float_e5m2_t = XE_Device_Gemm_f8_f8_f8_tensor_op_fp32_amax<float_e5m2_t, LayoutA, LayoutB>::Gemm;
+  EXPECT_TRUE((test::gemm::device::TestXe<Gemm_float_e5m2_t, epilogue::thread::ReLu>()));
+}
 }
 } // namespace cutlass
@@ -0,0 +1,155 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Host tests for the group lookup of the persistent Xe group tile scheduler
+*/
+
+#include <random>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/group_array_problem_shape.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler.hpp"
+
+#include "cutlass_unit_test.h"
+
+namespace cutlass {
+namespace {
+
+using ProblemShape = gemm::GroupProblemShape<cute::Shape<int, int, int>>;
+using Scheduler = gemm::kernel::detail::PersistentTileSchedulerXeGroup<ProblemShape>;
+using GroupInfo = Scheduler::GroupInfo;
+
+// Random MoE-like groups: mostly small M, some empty groups, shared N and K
+std::vector<ProblemShape::UnderlyingProblemShape>
+make_random_groups(int groups, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist_m(0, 1024);
+  std::uniform_int_distribution<int> dist_n(1, 4096);
+  int n = dist_n(gen);
+
+  std::vector<ProblemShape::UnderlyingProblemShape> shapes;
+  for (int group = 0; group < groups; ++group) {
+    int m = (group % 7 == 3) ? 0 : dist_m(gen);
+    shapes.push_back({m, n, 4096});
+  }
+  return shapes;
+}
+
+// Replays the tile fetches of persistent work-groups and checks that the offsets table
+// locates the same group as the linear walk for every tile
+void
+check_lookup_matches_linear_walk(int groups, unsigned seed, int grid_size, gemm::GemmCoord cta_shape, int32_t log_swizzle_size) {
+  auto shapes = make_random_groups(groups, seed);
+  ProblemShape problem_shapes{groups, shapes.data(), shapes.data()};
+  gemm::GemmCoord cluster_shape{1, 1, 1};
+  FastDivmodU64 divmod_cta_shape_m(cta_shape.m());
+  FastDivmodU64 divmod_cta_shape_n(cta_shape.n());
+
+  std::vector<uint64_t> group_tile_offsets(groups + 1);
+  Scheduler::get_group_tile_offsets(problem_shapes, cta_shape, cluster_shape, log_swizzle_size, group_tile_offsets.data());
+  uint64_t total_tiles = group_tile_offsets[groups];
+
+  for (int worker = 0; worker < grid_size; ++worker) {
+    GroupInfo walk_info, table_info;
+    auto [blocks_m, blocks_n] = Scheduler::get_problem_blocks_m_and_n(
+      shapes[0], cta_shape, cluster_shape, divmod_cta_shape_m, divmod_cta_shape_n, log_swizzle_size);
+    table_info.total_tiles = blocks_m * blocks_n;
+
+    for (uint64_t linear_idx = worker; linear_idx < total_tiles + grid_size; linear_idx += grid_size) {
+      bool walk_valid = Scheduler::advance_group_linear(
+        linear_idx, walk_info, problem_shapes, cta_shape, cluster_shape,
+        divmod_cta_shape_m, divmod_cta_shape_n, log_swizzle_size);
+      bool table_valid = Scheduler::advance_group_from_offsets(
+        linear_idx, table_info, group_tile_offsets.data(), groups);
+
+      ASSERT_EQ(walk_valid, linear_idx < total_tiles) << "linear_idx=" << linear_idx;
+      ASSERT_EQ(walk_valid, table_valid) << "linear_idx=" << linear_idx;
+      if (!walk_valid) {
+        break;
+      }
+      ASSERT_EQ(walk_info.group_idx, table_info.group_idx) << "linear_idx=" << linear_idx;
+      ASSERT_EQ(walk_info.start_linear_idx, table_info.start_linear_idx) << "linear_idx=" << linear_idx;
+      ASSERT_EQ(walk_info.total_tiles, table_info.total_tiles) << "linear_idx=" << linear_idx;
+    }
+  }
+}
+
+} // namespace
+
+TEST(XE_Tile_Scheduler_Group, offsets_match_linear_walk) {
+  for (int groups : {1, 8, 128, 256}) {
+    for (unsigned seed : {1u, 2u, 3u}) {
+      for (int grid_size : {1, 20, 160}) {
+        check_lookup_matches_linear_walk(groups, seed, grid_size, {256, 256, 32}, 0);
+        check_lookup_matches_linear_walk(groups, seed, grid_size, {128, 512, 32}, 1);
+      }
+    }
+  }
+}
+
+TEST(XE_Tile_Scheduler_Group, offsets_table) {
+  std::vector<ProblemShape::UnderlyingProblemShape> shapes{{512, 512, 64}, {0, 512, 64}, {257, 300, 64}};
+  ProblemShape problem_shapes{3, shapes.data(), shapes.data()};
+
+  std::vector<uint64_t> group_tile_offsets(4);
+  Scheduler::get_group_tile_offsets(problem_shapes, {256, 256, 32}, {1, 1, 1}, 0, group_tile_offsets.data());
+  EXPECT_EQ(group_tile_offsets[0], 0u);
+  EXPECT_EQ(group_tile_offsets[1], 4u);
+  EXPECT_EQ(group_tile_offsets[2], 4u);
+  EXPECT_EQ(group_tile_offsets[3], 8u);
+
+  // The empty group is never selected
+  GroupInfo info;
+  EXPECT_TRUE(Scheduler::advance_group_from_offsets(4, info, group_tile_offsets.data(), 3));
+  EXPECT_EQ(info.group_idx, 2);
+  EXPECT_EQ(info.start_linear_idx, 4u);
+  EXPECT_EQ(info.total_tiles, 4u);
+  EXPECT_FALSE(Scheduler::advance_group_from_offsets(8, info, group_tile_offsets.data(), 3));
+}
+
+TEST(XE_Tile_Scheduler_Group, workspace_size) {
+  std::vector<ProblemShape::UnderlyingProblemShape> shapes(5, {256, 256, 32});
+  ProblemShape host_shapes{5, shapes.data(), shapes.data()};
+  ProblemShape device_only_shapes{5, shapes.data(), nullptr};
+  using TileShape = cute::Shape<cute::_256, cute::_256, cute::_32>;
+  using ClusterShape = cute::Shape<cute::_1, cute::_1, cute::_1>;
+
+  Scheduler::Arguments args{};
+  EXPECT_EQ(Scheduler::get_workspace_size(args, host_shapes, TileShape{}, ClusterShape{}, KernelHardwareInfo{}), 0u);
+
+  args.use_group_tile_offsets = true;
+  EXPECT_EQ(Scheduler::get_workspace_size(args, host_shapes, TileShape{}, ClusterShape{}, KernelHardwareInfo{}), 48u);
+  EXPECT_EQ(Scheduler::get_workspace_size(args, device_only_shapes, TileShape{}, ClusterShape{}, KernelHardwareInfo{}), 0u);
+}
+
+} // namespace cutlass
@@ -0,0 +1,212 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Host tests for the work decomposition of the persistent Xe stream-K tile scheduler
+*/
+
+#include <algorithm>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/kernel/tile_scheduler.hpp"
+
+#include "cutlass_unit_test.h"
+
+namespace cutlass {
+namespace {
+
+using TileShape = cute::Shape<cute::_256, cute::_256, cute::_32>;
+using Scheduler = gemm::kernel::detail::PersistentTileSchedulerXeStreamK<TileShape, 512>;
+using Params = Scheduler::Params;
+using WorkTileInfo = Scheduler::WorkTileInfo;
+using ReductionMode = Scheduler::ReductionMode;
+using DecompositionMode = Scheduler::DecompositionMode;
+
+Params
+make_params(dim3 problem_blocks, uint32_t k_tiles, int sm_count, int splits,
+            ReductionMode reduction_mode, DecompositionMode decomposition_mode) {
+  KernelHardwareInfo hw_info;
+  hw_info.sm_count = sm_count;
+
+  Params params;
+  params.initialize(problem_blocks, k_tiles, hw_info, splits, reduction_mode, decomposition_mode, nullptr);
+  return params;
+}
+
+// Replays every work unit of the decomposition and checks that each K tile of each output tile
+// is computed exactly once, that exactly one unit computes the epilogue of each output tile and,
+// with separate reduction, that the peers of each split tile map onto distinct workspace slots.
+void
+check_decomposition(dim3 problem_blocks, uint32_t k_tiles, int sm_count, int splits,
+                    ReductionMode reduction_mode, DecompositionMode decomposition_mode) {
+  Params params = make_params(problem_blocks, k_tiles, sm_count, splits, reduction_mode, decomposition_mode);
+  uint64_t output_tiles = uint64_t(problem_blocks.x) * problem_blocks.y * problem_blocks.z;
+  uint64_t total_units = params.units_per_problem_ * params.divmod_splits_.divisor + params.separate_reduction_units_;
+
+  std::vector<uint32_t> k_tile_coverage(output_tiles * k_tiles, 0);
+  std::vector<uint32_t> epilogues(output_tiles, 0);
+  std::vector<uint32_t> reduction_units(output_tiles, 0);
+  std::vector<std::vector<uint32_t>> peer_slots(output_tiles);
+
+  for (uint64_t linear_idx = 0; linear_idx < total_units; ++linear_idx) {
+    WorkTileInfo work = Scheduler::get_current_work_for_linear_idx(linear_idx, params);
+    ASSERT_TRUE(work.is_valid()) << "linear_idx=" << linear_idx;
+
+    do {
+      auto tile_idx = static_cast<uint64_t>(Scheduler::output_tile_index(params, work));
+      ASSERT_LT(tile_idx, output_tiles) << "linear_idx=" << linear_idx;
+
+      if (work.is_reduction_unit()) {
+        EXPECT_FALSE(Scheduler::valid_warpgroup_in_work_tile(work));
+        ++reduction_units[tile_idx];
+      }
+      else {
+        for (uint32_t k = work.K_idx; k < work.K_idx + work.k_tile_count; ++k) {
+          ASSERT_LT(k, k_tiles) << "linear_idx=" << linear_idx;
+          ++k_tile_coverage[tile_idx * k_tiles + k];
+        }
+        if (Scheduler::is_separately_reduced_tile(params, tile_idx)) {
+          auto [first_peer, my_peer, last_peer] = Scheduler::tile_peer_range(params, uint32_t(tile_idx), work.K_idx);
+          ASSERT_LE(first_peer, my_peer);
+          ASSERT_LE(my_peer, last_peer);
+          peer_slots[tile_idx].push_back(my_peer - first_peer);
+        }
+      }
+
+      if (Scheduler::compute_epilogue(work, params)) {
+        ++epilogues[tile_idx];
+      }
+    } while (Scheduler::continue_current_work_for_linear_idx(linear_idx, work, params));
+  }
+
+  EXPECT_FALSE(Scheduler::get_current_work_for_linear_idx(total_units, params).is_valid());
+
+  for (uint64_t tile_idx = 0; tile_idx < output_tiles; ++tile_idx) {
+    for (uint32_t k = 0; k < k_tiles; ++k) {
+      ASSERT_EQ(k_tile_coverage[tile_idx * k_tiles + k], 1u) << "tile=" << tile_idx << " k=" << k;
+    }
+    ASSERT_EQ(epilogues[tile_idx], 1u) << "tile=" << tile_idx;
+
+    if (Scheduler::is_separately_reduced_tile(params, tile_idx)) {
+      ASSERT_EQ(reduction_units[tile_idx], 1u) << "tile=" << tile_idx;
+
+      // The reduction unit waits for last - first + 1 peers, which must each hold a distinct slot
+      auto [first_peer, my_peer, last_peer] = Scheduler::tile_peer_range(params, uint32_t(tile_idx), 0);
+      auto& slots = peer_slots[tile_idx];
+      std::sort(slots.begin(), slots.end());
+      ASSERT_EQ(slots.size(), last_peer - first_peer + 1) << "tile=" << tile_idx;
+      for (uint32_t slot = 0; slot < slots.size(); ++slot) {
+        ASSERT_EQ(slots[slot], slot) << "tile=" << tile_idx;
+      }
+      ASSERT_LE(slots.size(), Scheduler::reduction_peers_per_tile(params)) << "tile=" << tile_idx;
+    }
+    else {
+      ASSERT_EQ(reduction_units[tile_idx], 0u) << "tile=" << tile_idx;
+    }
+  }
+}
+
+} // namespace
+
+TEST(XE_Tile_Scheduler_StreamK, decomposition) {
+  for (ReductionMode reduction_mode : {ReductionMode::Deterministic, ReductionMode::Separate}) {
+    for (DecompositionMode decomposition_mode : {DecompositionMode::Heuristic, DecompositionMode::StreamK}) {
+      for (int sm_count : {8, 20, 64}) {
+        for (uint32_t blocks_m : {1u, 3u, 5u, 8u}) {
+          for (uint32_t blocks_n : {1u, 4u, 6u, 11u}) {
+            for (uint32_t k_tiles : {9u, 16u, 17u, 48u, 128u, 255u}) {
+              check_decomposition({blocks_m, blocks_n, 2}, k_tiles, sm_count, 1, reduction_mode, decomposition_mode);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(XE_Tile_Scheduler_StreamK, split_k_decomposition) {
+  for (ReductionMode reduction_mode : {ReductionMode::Deterministic, ReductionMode::Separate}) {
+    for (int splits : {2, 3, 7}) {
+      for (uint32_t k_tiles : {7u, 16u, 33u}) {
+        check_decomposition({3, 5, 1}, k_tiles, 20, splits, reduction_mode, DecompositionMode::SplitK);
+      }
+    }
+  }
+}
+
+TEST(XE_Tile_Scheduler_StreamK, groups) {
+  // 24 stream-K tiles over a 20 work-group wave: 4 groups of 5 units, each group covering 6 tiles
+  Params params = make_params({4, 6, 1}, 64, 20, 1, ReductionMode::Deterministic, DecompositionMode::Heuristic);
+  EXPECT_EQ(params.sk_tiles_, 24u);
+  EXPECT_EQ(params.sk_units_, 20u);
+  EXPECT_EQ(params.divmod_sk_groups_.divisor, 4u);
+  EXPECT_FALSE(params.requires_separate_reduction());
+
+  // Units and tiles are interleaved across groups
+  for (uint64_t linear_idx = 0; linear_idx < params.sk_units_; ++linear_idx) {
+    WorkTileInfo work = Scheduler::get_current_work_for_linear_idx(linear_idx, params);
+    do {
+      auto tile_idx = Scheduler::output_tile_index(params, work);
+      EXPECT_EQ(uint64_t(tile_idx) % 4, linear_idx % 4) << "linear_idx=" << linear_idx;
+    } while (Scheduler::continue_current_work_for_linear_idx(linear_idx, work, params));
+  }
+
+  // Grouping is disabled for separate reduction, which adds one reduction unit per stream-K tile
+  params = make_params({4, 6, 1}, 64, 20, 1, ReductionMode::Separate, DecompositionMode::Heuristic);
+  EXPECT_EQ(params.divmod_sk_groups_.divisor, 1u);
+  EXPECT_EQ(params.separate_reduction_units_, 24u);
+  EXPECT_EQ(Scheduler::reduction_peers_per_tile(params), 2u);
+}
+
+TEST(XE_Tile_Scheduler_StreamK, separate_reduction_workspace_size) {
+  KernelHardwareInfo hw_info;
+  hw_info.sm_count = 20;
+  gemm::GemmCoord tile_shape{256, 256, 32};
+  uint32_t barrier_bits = sizeof_bits<Scheduler::BarrierType>::value;
+  size_t tile_bytes = 256 * 256 * sizeof(float);
+
+  // Split-K: one partial tile per split and one barrier per output tile
+  size_t size = Params::get_workspace_size(dim3{3, 5, 1}, 16, tile_shape, hw_info, 4, DecompositionMode::SplitK,
+                                           barrier_bits, 32, ReductionMode::Separate);
+  EXPECT_EQ(size, 15 * 4 * tile_bytes + Params::get_barrier_workspace_size(15, barrier_bits));
+
+  size = Params::get_workspace_size(dim3{3, 5, 1}, 16, tile_shape, hw_info, 4, DecompositionMode::SplitK,
+                                    barrier_bits, 32, ReductionMode::Deterministic);
+  EXPECT_EQ(size, 15 * tile_bytes + Params::get_barrier_workspace_size(15, barrier_bits));
+
+  // Stream-K: max_peers_per_tile partial tiles per stream-K tile
+  size = Params::get_workspace_size(dim3{4, 6, 1}, 64, tile_shape, hw_info, 1, DecompositionMode::Heuristic,
+                                    barrier_bits, 32, ReductionMode::Separate);
+  EXPECT_EQ(size, 24 * Params::max_peers_per_tile(20, 24) * tile_bytes + Params::get_barrier_workspace_size(24, barrier_bits));
+}
+
+} // namespace cutlass
@@ -0,0 +1,159 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Host tests for the work-group to output tile mapping of the swizzled Xe tile scheduler
+*/
+
+#include <set>
+#include <utility>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/kernel/tile_scheduler.hpp"
+
+#include "cutlass_unit_test.h"
+
+namespace cutlass {
+namespace {
+
+using Scheduler = gemm::kernel::detail::SwizzledTileSchedulerXe;
+using RasterOrder = Scheduler::RasterOrder;
+using RasterOrderOptions = Scheduler::RasterOrderOptions;
+using TileShape = cute::Shape<cute::_256, cute::_256, cute::_32>;
+using ClusterShape = cute::Shape<cute::_1, cute::_1, cute::_1>;
+
+Scheduler::Params
+make_params(int m, int n, int l, int max_swizzle_size, RasterOrderOptions raster_order) {
+  return Scheduler::to_underlying_arguments(
+    cute::make_shape(m, n, 32, l), TileShape{}, ClusterShape{},
+    KernelHardwareInfo{}, Scheduler::Arguments{max_swizzle_size, raster_order});
+}
+
+// Every output tile must be visited exactly once and padding work-groups must be invalid
+bool
+covers_every_tile_once(Scheduler::Params const& params) {
+  dim3 grid = Scheduler::get_grid_shape(params);
+  if (grid.z != params.problem_tiles_l_) {
+    return false;
+  }
+
+  std::set<std::pair<int, int>> visited;
+  for (uint64_t idx = 0; idx < grid.x; ++idx) {
+    auto work = Scheduler::get_work_for_linear_idx(params, idx, 0);
+    if (!work.is_valid()) {
+      continue;
+    }
+    if (work.M_idx < 0 || work.M_idx >= static_cast<int>(params.problem_tiles_m_) ||
+        work.N_idx < 0 || work.N_idx >= static_cast<int>(params.problem_tiles_n_)) {
+      return false;
+    }
+    if (!visited.insert({work.M_idx, work.N_idx}).second) {
+      return false;
+    }
+  }
+  return visited.size() == static_cast<size_t>(params.problem_tiles_m_) * params.problem_tiles_n_;
+}
+
+} // namespace
+
+TEST(XE_Tile_Scheduler_Swizzle, covers_all_tiles) {
+  for (int m : {1, 255, 256, 1000, 4096}) {
+    for (int n : {1, 300, 512, 14336}) {
+      for (int max_swizzle : {1, 2, 4, 8}) {
+        for (auto raster : {RasterOrderOptions::AlongM, RasterOrderOptions::AlongN, RasterOrderOptions::Heuristic}) {
+          auto params = make_params(m, n, 2, max_swizzle, raster);
+          EXPECT_TRUE(covers_every_tile_once(params))
+            << "m=" << m << " n=" << n << " max_swizzle=" << max_swizzle << " raster=" << int(raster);
+        }
+      }
+    }
+  }
+}
+
+TEST(XE_Tile_Scheduler_Swizzle, no_swizzle_is_linear) {
+  // 4x3 tiles
+  auto params_n = make_params(1024, 768, 1, 1, RasterOrderOptions::AlongN);
+  EXPECT_EQ(params_n.raster_order_, RasterOrder::AlongN);
+  EXPECT_EQ(params_n.log_swizzle_size_, 0);
+  EXPECT_EQ(Scheduler::get_grid_shape(params_n).x, 12u);
+  for (int idx = 0; idx < 12; ++idx) {
+    auto work = Scheduler::get_work_for_linear_idx(params_n, idx, 0);
+    EXPECT_TRUE(work.is_valid());
+    EXPECT_EQ(work.M_idx, idx / 3);
+    EXPECT_EQ(work.N_idx, idx % 3);
+  }
+
+  auto params_m = make_params(1024, 768, 1, 1, RasterOrderOptions::AlongM);
+  EXPECT_EQ(params_m.raster_order_, RasterOrder::AlongM);
+  for (int idx = 0; idx < 12; ++idx) {
+    auto work = Scheduler::get_work_for_linear_idx(params_m, idx, 0);
+    EXPECT_TRUE(work.is_valid());
+    EXPECT_EQ(work.M_idx, idx % 4);
+    EXPECT_EQ(work.N_idx, idx / 4);
+  }
+}
+
+TEST(XE_Tile_Scheduler_Swizzle, swizzle_band_order) {
+  // 16x56 tiles, e.g. a 4096x14336 MLP projection with 256x256 tiles
+  auto params = make_params(4096, 14336, 1, 8, RasterOrderOptions::AlongN);
+  EXPECT_EQ(params.log_swizzle_size_, 3);
+  EXPECT_EQ(Scheduler::get_grid_shape(params).x, 16u * 56u);
+
+  // Consecutive groups of 8 work-groups share an N tile and walk 8 M tiles,
+  // then the band advances along N before moving to the next 8 M tiles.
+  for (int idx = 0; idx < 16 * 56; ++idx) {
+    auto work = Scheduler::get_work_for_linear_idx(params, idx, 0);
+    int band = idx / (8 * 56);
+    EXPECT_EQ(work.M_idx, band * 8 + idx % 8);
+    EXPECT_EQ(work.N_idx, (idx / 8) % 56);
+  }
+}
+
+TEST(XE_Tile_Scheduler_Swizzle, swizzle_padding_is_invalid) {
+  // 5x7 tiles with swizzle 4 along M pads M up to 8 tiles
+  auto params = make_params(5 * 256, 7 * 256, 1, 4, RasterOrderOptions::AlongN);
+  EXPECT_EQ(params.log_swizzle_size_, 2);
+  EXPECT_EQ(Scheduler::get_grid_shape(params).x, 8u * 7u);
+
+  int valid_tiles = 0;
+  for (int idx = 0; idx < 8 * 7; ++idx) {
+    valid_tiles += Scheduler::get_work_for_linear_idx(params, idx, 0).is_valid();
+  }
+  EXPECT_EQ(valid_tiles, 5 * 7);
+  EXPECT_FALSE(Scheduler::get_work_for_linear_idx(params, 8 * 7, 0).is_valid());
+}
+
+TEST(XE_Tile_Scheduler_Swizzle, heuristic_raster_order) {
+  EXPECT_EQ(make_params(256, 4096, 1, 1, RasterOrderOptions::Heuristic).raster_order_, RasterOrder::AlongM);
+  EXPECT_EQ(make_params(4096, 256, 1, 1, RasterOrderOptions::Heuristic).raster_order_, RasterOrder::AlongN);
+}
+
+} // namespace cutlass
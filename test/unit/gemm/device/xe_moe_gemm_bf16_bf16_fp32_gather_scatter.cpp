@@ -0,0 +1,237 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 Intel Corporation. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Tests for the fused gather/scatter Xe MoE GEMM bf16_bf16_fp32
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <cute/tensor.hpp>
+#include <cute/util/compat.hpp>
+#include <sycl/ext/intel/experimental/grf_size_properties.hpp>
+
+#include "cutlass/device_kernel.h"
+#include "cutlass/gemm/kernel/xe_moe_gemm.hpp"
+#include "cutlass/kernel_hardware_info.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/sycl_event_manager.hpp"
+
+#include "cutlass_unit_test.h"
+
+namespace cutlass {
+namespace {
+
+using ElementA = cute::bfloat16_t;
+using ElementB = cute::bfloat16_t;
+using ElementD = float;
+
+// 256x128x32 work-group tile with 8x2 subgroups, as in the BMG MoE example
+using TiledMma = typename cute::TiledMMAHelper<
+  cute::MMA_Atom<cute::XE_DPAS_TT<8, float, ElementA, ElementB>>,
+  cute::Layout<cute::Shape<cute::_256, cute::_128, cute::_32>>,
+  cute::Layout<cute::Shape<cute::_8, cute::_2, cute::_1>, cute::Stride<cute::_2, cute::_1, cute::_0>>>::TiledMMA;
+
+using MoEKernel = gemm::kernel::XeMoEGemmGatherScatter<TiledMma, ElementA, ElementB, ElementD>;
+
+// Routes every token to top_k distinct experts, never to one of empty_experts, and lays the
+// (token, expert) pairs out in expert-sorted order
+struct Routing {
+  std::vector<int32_t> num_rows_per_expert;
+  std::vector<int32_t> gather_idx;
+  std::vector<float> topk_weights;
+
+  Routing(int num_tokens, int top_k, int num_experts, std::vector<int> const& empty_experts, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> expert_dist(0, num_experts - 1);
+    std::uniform_real_distribution<float> weight_dist(0.f, 1.f);
+
+    std::vector<std::vector<std::pair<int, float>>> routed(num_experts);
+    for (int t = 0; t < num_tokens; ++t) {
+      std::vector<int> experts;
+      while (int(experts.size()) < top_k) {
+        int e = expert_dist(gen);
+        bool empty = std::find(empty_experts.begin(), empty_experts.end(), e) != empty_experts.end();
+        if (!empty && std::find(experts.begin(), experts.end(), e) == experts.end()) {
+          experts.push_back(e);
+        }
+      }
+      for (int e : experts) {
+        routed[e].push_back({t, weight_dist(gen)});
+      }
+    }
+
+    for (auto const& rows : routed) {
+      num_rows_per_expert.push_back(int32_t(rows.size()));
+      for (auto [t, w] : rows) {
+        gather_idx.push_back(t);
+        topk_weights.push_back(w);
+      }
+    }
+  }
+};
+
+// Runs the fused kernel and compares D against D[t] = sum over the experts e routed to t of
+// w(t,e) * A[t] * B[e], with w = 1 when use_weights is false
+bool
+run_moe_gather_scatter(int num_tokens, int top_k, int num_experts, int N, int K,
+                       std::vector<int> const& empty_experts, bool use_weights, unsigned seed = 2025) {
+  Routing routing(num_tokens, top_k, num_experts, empty_experts, seed);
+
+  // The cases below are meant to cover these, check that the routing actually produced them
+  int constexpr tile_m = cute::size<0>(MoEKernel::TileShape{});
+  bool has_m_tail = std::any_of(routing.num_rows_per_expert.begin(), routing.num_rows_per_expert.end(),
+                                [](int32_t m) { return m % tile_m != 0; });
+  EXPECT_TRUE(has_m_tail);
+  for (int e : empty_experts) {
+    EXPECT_EQ(routing.num_rows_per_expert[e], 0);
+  }
+
+  std::mt19937 gen(seed + 1);
+  std::uniform_real_distribution<float> data_dist(-1.f, 1.f);
+  std::vector<ElementA> A_host(size_t(num_tokens) * K);
+  std::vector<ElementB> B_host(size_t(num_experts) * K * N);
+  for (auto& a : A_host) {
+    a = ElementA(data_dist(gen));
+  }
+  for (auto& b : B_host) {
+    b = ElementB(data_dist(gen));
+  }
+
+  DeviceAllocation<ElementA> A_device(A_host.size());
+  DeviceAllocation<ElementB> B_device(B_host.size());
+  DeviceAllocation<ElementD> D_device(size_t(num_tokens) * N);
+  DeviceAllocation<int32_t> num_rows_per_expert_device(num_experts);
+  DeviceAllocation<int32_t> gather_idx_device(routing.gather_idx.size());
+  DeviceAllocation<float> topk_weights_device(routing.topk_weights.size());
+  A_device.copy_from_host(A_host.data());
+  B_device.copy_from_host(B_host.data());
+  num_rows_per_expert_device.copy_from_host(routing.num_rows_per_expert.data());
+  gather_idx_device.copy_from_host(routing.gather_idx.data());
+  topk_weights_device.copy_from_host(routing.topk_weights.data());
+  compat::memset(D_device.get(), 0, D_device.size() * sizeof(ElementD));
+
+  KernelHardwareInfo hw_info{0, KernelHardwareInfo::query_device_multiprocessor_count(0)};
+  typename MoEKernel::Arguments arguments{
+    A_device.get(),
+    B_device.get(),
+    D_device.get(),
+    num_rows_per_expert_device.get(),
+    gather_idx_device.get(),
+    use_weights ? topk_weights_device.get() : nullptr,
+    num_experts,
+    N,
+    K,
+    hw_info
+  };
+  if (!MoEKernel::can_implement(arguments)) {
+    ADD_FAILURE() << "XeMoEGemmGatherScatter cannot implement N=" << N << " K=" << K;
+    return false;
+  }
+  auto params = MoEKernel::to_underlying_arguments(arguments, nullptr);
+
+  dim3 const block = MoEKernel::get_block_shape();
+  dim3 const grid = MoEKernel::get_grid_shape(params);
+  compat::dim3 sycl_grid(grid.x, grid.y, grid.z);
+  compat::dim3 sycl_block(block.x, block.y, block.z);
+
+  namespace syclex = sycl::ext::oneapi::experimental;
+  namespace intelex = sycl::ext::intel::experimental;
+
+  compat::experimental::launch_properties launch_props {
+    syclex::work_group_scratch_size(MoEKernel::SharedStorageSize),
+  };
+  compat::experimental::kernel_properties kernel_props {
+    syclex::sub_group_size<MoEKernel::SubgroupSize>,
+    intelex::grf_size<256>
+  };
+  compat::experimental::launch_policy policy{sycl_grid, sycl_block, launch_props, kernel_props};
+  auto event = compat::experimental::launch<device_kernel<MoEKernel>, MoEKernel>(policy, params);
+  EventManager::getInstance().addEvent(event);
+  compat::wait();
+
+  std::vector<float> D_ref(size_t(num_tokens) * N, 0.f);
+  int row = 0;
+  for (int e = 0; e < num_experts; ++e) {
+    for (int r = 0; r < routing.num_rows_per_expert[e]; ++r, ++row) {
+      int t = routing.gather_idx[row];
+      float w = use_weights ? routing.topk_weights[row] : 1.f;
+      for (int n = 0; n < N; ++n) {
+        float acc = 0.f;
+        for (int k = 0; k < K; ++k) {
+          acc += float(A_host[size_t(t) * K + k]) * float(B_host[(size_t(e) * K + k) * N + n]);
+        }
+        D_ref[size_t(t) * N + n] += w * acc;
+      }
+    }
+  }
+
+  std::vector<float> D_host(D_ref.size());
+  D_device.copy_to_host(D_host.data());
+  for (size_t i = 0; i < D_ref.size(); ++i) {
+    if (std::abs(D_host[i] - D_ref[i]) > 1e-2f * (1.f + std::abs(D_ref[i]))) {
+      ADD_FAILURE() << "D[" << i / N << "," << i % N << "] = " << D_host[i] << ", expected " << D_ref[i];
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+// Several experts per token are reduced into the same output row, and expert 3 gets no tokens
+TEST(XE_Device_MoE_Gemm_bf16t_bf16t_f32t_gather_scatter, topk2_empty_expert) {
+  EXPECT_TRUE(run_moe_gather_scatter(600, 2, 8, 256, 256, {3}, true));
+}
+
+// Empty first and last experts exercise the expert row offset and the end of the schedule
+TEST(XE_Device_MoE_Gemm_bf16t_bf16t_f32t_gather_scatter, topk4_empty_first_and_last_expert) {
+  EXPECT_TRUE(run_moe_gather_scatter(1000, 4, 16, 512, 128, {0, 15}, true));
+}
+
+// Fewer rows per expert than one work-group tile, so every expert is an M tail
+TEST(XE_Device_MoE_Gemm_bf16t_bf16t_f32t_gather_scatter, topk2_m_tail_only) {
+  EXPECT_TRUE(run_moe_gather_scatter(100, 2, 4, 128, 64, {}, true));
+}
+
+// Without routing weights every expert output is added with weight 1
+TEST(XE_Device_MoE_Gemm_bf16t_bf16t_f32t_gather_scatter, topk2_no_weights) {
+  EXPECT_TRUE(run_moe_gather_scatter(600, 2, 8, 256, 256, {5}, false));
+}
+
+TEST(XE_Device_MoE_Gemm_bf16t_bf16t_f32t_gather_scatter, topk1_no_weights) {
+  EXPECT_TRUE(run_moe_gather_scatter(300, 1, 4, 256, 128, {}, false));
+}
+
+} // namespace cutlass
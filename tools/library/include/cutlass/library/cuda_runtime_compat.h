@@ -0,0 +1,202 @@
+/***************************************************************************************************
+ * Copyright (C) 2025 Intel Corporation, All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/*! \file
+    \brief SYCL definitions of the CUDA runtime device, stream and memory calls used by the library
+      Handle and the profiler.
+
+    gpu_generics.h only provides the runtime subset that CUTLASS kernels and device-level operators
+    rely on. These host-side calls are kept out of it and are declared in namespace cutlass, so that
+    the unqualified calls in cutlass::library and cutlass::profiler resolve to them.
+*/
+
+#if defined(CUTLASS_ENABLE_SYCL)
+
+#include <cstring>
+#include <string>
+
+#include "cutlass/cutlass.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+
+// Device management
+inline CUTLASS_HOST
+cudaError_t cudaGetDeviceCount(int *count) {
+  *count = static_cast<int>(compat::device_count());
+  return cudaSuccess;
+}
+
+inline CUTLASS_HOST
+cudaError_t cudaSetDevice(int device) {
+  if (device < 0 || static_cast<unsigned int>(device) >= compat::device_count()) {
+    return cudaErrorUnknown;
+  }
+  compat::select_device(static_cast<unsigned int>(device));
+  return cudaSuccess;
+}
+
+// Subset of the CUDA device properties, populated from SYCL device queries. The Intel Xe
+// architecture is reported the way the library tags its kernels (PVC = 1.2, BMG = 2.0);
+// other devices, including the host/CPU device, report 0.0.
+struct cudaDeviceProp {
+  char name[256];
+  int major;
+  int minor;
+  int multiProcessorCount;  // Xe cores, or compute units on other devices
+  int l2CacheSize;
+  size_t totalGlobalMem;
+  int clockRate;            // kHz
+  int multiGpuBoardGroupID;
+};
+
+inline CUTLASS_HOST
+cudaError_t cudaGetDeviceProperties(cudaDeviceProp *prop, int device) {
+  using namespace sycl::ext::oneapi::experimental;
+
+  if (device < 0 || static_cast<unsigned int>(device) >= compat::device_count()) {
+    return cudaErrorUnknown;
+  }
+  sycl::device const &dev = compat::get_device(static_cast<unsigned int>(device));
+
+  *prop = cudaDeviceProp{};
+  std::string name = dev.get_info<sycl::info::device::name>();
+  name.copy(prop->name, sizeof(prop->name) - 1);
+
+  switch (dev.get_info<info::device::architecture>()) {
+    case architecture::intel_gpu_pvc:     prop->major = 1; prop->minor = 2; break;
+    case architecture::intel_gpu_bmg_g21: prop->major = 2; prop->minor = 0; break;
+    default: break;
+  }
+
+  if (dev.has(sycl::aspect::ext_intel_gpu_slices) && dev.has(sycl::aspect::ext_intel_gpu_subslices_per_slice)) {
+    prop->multiProcessorCount = static_cast<int>(dev.get_info<sycl::ext::intel::info::device::gpu_slices>() *
+                                                 dev.get_info<sycl::ext::intel::info::device::gpu_subslices_per_slice>());
+  }
+  else {
+    prop->multiProcessorCount = static_cast<int>(dev.get_info<sycl::info::device::max_compute_units>());
+  }
+
+  prop->l2CacheSize = static_cast<int>(dev.get_info<sycl::info::device::global_mem_cache_size>());
+  prop->totalGlobalMem = static_cast<size_t>(dev.get_info<sycl::info::device::global_mem_size>());
+  prop->clockRate = static_cast<int>(dev.get_info<sycl::info::device::max_clock_frequency>()) * 1000;
+  return cudaSuccess;
+}
+
+inline CUTLASS_HOST
+cudaError_t cudaDeviceSynchronize() {
+  compat::get_current_device().queues_wait_and_throw();
+  return cudaSuccess;
+}
+
+// Streams are in-order queues created on the current device
+constexpr unsigned int cudaStreamDefault = 0;
+constexpr unsigned int cudaStreamNonBlocking = 1;
+
+inline CUTLASS_HOST
+cudaError_t cudaStreamCreateWithFlags(cudaStream_t *stream, unsigned int flags) {
+  *stream = compat::get_current_device().create_queue();
+  return cudaSuccess;
+}
+
+inline CUTLASS_HOST
+cudaError_t cudaStreamDestroy(cudaStream_t stream) {
+  compat::get_current_device().destroy_queue(stream);
+  return cudaSuccess;
+}
+
+inline CUTLASS_HOST
+cudaError_t cudaStreamSynchronize(cudaStream_t stream) {
+  sycl::queue q = stream ? *stream : compat::get_default_queue();
+  q.wait();
+  return cudaSuccess;
+}
+
+// USM allocations on the default queue of the current device
+inline CUTLASS_HOST
+cudaError_t cudaMalloc(void **ptr, size_t size) {
+  *ptr = compat::malloc(size);
+  return *ptr ? cudaSuccess : cudaErrorUnknown;
+}
+
+inline CUTLASS_HOST
+cudaError_t cudaFree(void *ptr) {
+  compat::free(ptr);
+  return cudaSuccess;
+}
+
+inline CUTLASS_HOST
+cudaError_t cudaMemset(void *ptr, int value, size_t count) {
+  compat::memset(ptr, value, count);
+  return cudaSuccess;
+}
+
+namespace detail {
+
+// True if `ptr` is a USM allocation in the context of the default queue
+inline CUTLASS_HOST
+bool is_usm_pointer(void const *ptr) {
+  sycl::queue const &q = compat::get_default_queue();
+  return sycl::get_pointer_type(ptr, q.get_context()) != sycl::usm::alloc::unknown;
+}
+
+} // namespace detail
+
+// Copies are synchronous, as with CUDA. A SYCL copy infers the direction from the pointers, so
+// `kind` is checked against the USM type of the device-side pointers instead.
+inline CUTLASS_HOST
+cudaError_t cudaMemcpy(void *dst, void const *src, size_t count, cudaMemcpyKind kind) {
+  bool dst_device = kind == cudaMemcpyHostToDevice || kind == cudaMemcpyDeviceToDevice;
+  bool src_device = kind == cudaMemcpyDeviceToHost || kind == cudaMemcpyDeviceToDevice;
+  switch (kind) {
+    case cudaMemcpyHostToHost:
+      std::memcpy(dst, src, count);
+      return cudaSuccess;
+    case cudaMemcpyHostToDevice:
+    case cudaMemcpyDeviceToHost:
+    case cudaMemcpyDeviceToDevice:
+      if ((dst_device && !detail::is_usm_pointer(dst)) || (src_device && !detail::is_usm_pointer(src))) {
+        return cudaErrorUnknown;
+      }
+      compat::memcpy(dst, src, count);
+      return cudaSuccess;
+    default:
+      return cudaErrorUnknown;
+  }
+}
+
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // defined(CUTLASS_ENABLE_SYCL)
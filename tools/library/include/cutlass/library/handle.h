@@ -36,6 +36,9 @@
 
 #include <memory>
 #include "cutlass/library/library.h"
+#if defined(CUTLASS_ENABLE_SYCL)
+#include "cutlass/library/cuda_runtime_compat.h"
+#endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
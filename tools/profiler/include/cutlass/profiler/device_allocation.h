@@ -39,6 +39,9 @@
 #include <vector>
 
 #include "cutlass/library/library.h"
+#if defined(CUTLASS_ENABLE_SYCL)
+#include "cutlass/library/cuda_runtime_compat.h"
+#endif
 #include "cutlass/util/distribution.h"
 
 #include "enumerated_types.h"
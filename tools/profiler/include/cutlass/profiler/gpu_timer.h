@@ -34,7 +34,12 @@
 
 #pragma once
 
+#if defined(CUTLASS_ENABLE_SYCL)
+#include <chrono>
+#include "cutlass/library/cuda_runtime_compat.h"
+#else
 #include <cuda_runtime.h>
+#endif
 #include "cutlass/cutlass.h"
 
 namespace cutlass {
@@ -44,8 +49,18 @@ namespace profiler {
 
 struct GpuTimer {
 
+#if defined(CUTLASS_ENABLE_SYCL)
+  /// Host timestamps taken once the queue has drained. Events only carry profiling
+  /// information on queues created with enable_profiling, which the library does not use.
+  std::chrono::high_resolution_clock::time_point events[2];
+
+  static constexpr unsigned int kEventRecordDefault = 0;
+#else
   cudaEvent_t events[2];
 
+  static constexpr unsigned int kEventRecordDefault = cudaEventRecordDefault;
+#endif
+
   //
   // Methods
   //
@@ -59,13 +74,13 @@ struct GpuTimer {
   ~GpuTimer();
 
   /// Records a start event in the stream, the flag is for cudaEventRecordWithFlags
-  void start(cudaStream_t stream = nullptr, unsigned int flag = cudaEventRecordDefault);
+  void start(cudaStream_t stream = nullptr, unsigned int flag = kEventRecordDefault);
 
   /// Records a stop event in the stream, the flag is for cudaEventRecordWithFlags
-  void stop(cudaStream_t stream = nullptr, unsigned int flag = cudaEventRecordDefault);
+  void stop(cudaStream_t stream = nullptr, unsigned int flag = kEventRecordDefault);
 
   /// Records a stop event in the stream and synchronizes on the stream, the flag is for cudaEventRecordWithFlags
-  void stop_and_wait(cudaStream_t stream = nullptr, unsigned int flag = cudaEventRecordDefault);
+  void stop_and_wait(cudaStream_t stream = nullptr, unsigned int flag = kEventRecordDefault);
 
   /// Returns the duration in milliseconds
   double duration(int iterations = 1) const;
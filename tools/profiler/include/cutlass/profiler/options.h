@@ -38,7 +38,11 @@
 #include <vector>
 #include <map>
 
+#if !defined(CUTLASS_ENABLE_SYCL)
 #include <cuda_runtime.h>
+#else
+#include "cutlass/library/cuda_runtime_compat.h"
+#endif
 
 #include "cutlass/util/command_line.h"
 #include "cutlass/util/distribution.h"
@@ -36,18 +36,20 @@
 #include <stdexcept>
 
 // Profiler includes
+#include "cutlass/profiler/cutlass_profiler.h"
+#include "cutlass/profiler/gemm_operation_profiler.h"
+#if !defined(CUTLASS_ENABLE_SYCL)
 #include "cutlass/profiler/block_scaled_gemm_operation_profiler.h"
 #include "cutlass/profiler/blockwise_gemm_operation_profiler.h"
 #include "cutlass/profiler/conv2d_operation_profiler.h"
 #include "cutlass/profiler/conv3d_operation_profiler.h"
-#include "cutlass/profiler/cutlass_profiler.h"
-#include "cutlass/profiler/gemm_operation_profiler.h"
 #include "cutlass/profiler/grouped_gemm_operation_profiler.h"
 #include "cutlass/profiler/rank_2k_operation_profiler.h"
 #include "cutlass/profiler/rank_k_operation_profiler.h"
 #include "cutlass/profiler/sparse_gemm_operation_profiler.h"
 #include "cutlass/profiler/symm_operation_profiler.h"
 #include "cutlass/profiler/trmm_operation_profiler.h"
+#endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -63,6 +65,8 @@ CutlassProfiler::CutlassProfiler(
 
   operation_profilers_.emplace_back(new GemmOperationProfiler(options));
 
+  // The SYCL build only generates GEMM operations for Intel Xe
+#if !defined(CUTLASS_ENABLE_SYCL)
   operation_profilers_.emplace_back(new BlockScaledGemmOperationProfiler(options));   
 
   operation_profilers_.emplace_back(new BlockwiseGemmOperationProfiler(options));   
@@ -82,6 +86,7 @@ CutlassProfiler::CutlassProfiler(
   operation_profilers_.emplace_back(new SymmOperationProfiler(options));
 
   operation_profilers_.emplace_back(new GroupedGemmOperationProfiler(options));
+#endif
 }
 
 CutlassProfiler::~CutlassProfiler() {
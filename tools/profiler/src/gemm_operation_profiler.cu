@@ -39,8 +39,10 @@
 #include <vector>
 
 #include "cutlass/core_io.h"
+#if !defined(CUTLASS_ENABLE_SYCL)
 #include <cuda_runtime_api.h>
 #include <cuda/atomic>
+#endif
 
 #include "cutlass/profiler/cublas_helpers.h"
 #include "cutlass/profiler/gemm_operation_profiler.h"
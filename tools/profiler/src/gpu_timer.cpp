@@ -43,6 +43,44 @@ namespace profiler {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+#if defined(CUTLASS_ENABLE_SYCL)
+
+GpuTimer::GpuTimer() {
+  events[0] = events[1] = std::chrono::high_resolution_clock::now();
+}
+
+GpuTimer::GpuTimer(GpuTimer&& gpu_timer) noexcept {
+  events[0] = gpu_timer.events[0];
+  events[1] = gpu_timer.events[1];
+}
+
+GpuTimer::~GpuTimer() { }
+
+/// Drains the queue and records the start time; the flag is ignored for SYCL
+void GpuTimer::start(cudaStream_t stream, const unsigned int flag) {
+  cudaStreamSynchronize(stream);
+  events[0] = std::chrono::high_resolution_clock::now();
+}
+
+/// Drains the queue and records the stop time; the flag is ignored for SYCL
+void GpuTimer::stop(cudaStream_t stream, const unsigned int flag) {
+  cudaStreamSynchronize(stream);
+  events[1] = std::chrono::high_resolution_clock::now();
+}
+
+/// Stopping already synchronizes with the queue
+void GpuTimer::stop_and_wait(cudaStream_t stream, const unsigned int flag) {
+  stop(stream, flag);
+}
+
+/// Returns the duration in milliseconds
+double GpuTimer::duration(int iterations) const {
+  std::chrono::duration<double, std::milli> elapsed = events[1] - events[0];
+  return elapsed.count() / double(iterations);
+}
+
+#else
+
 GpuTimer::GpuTimer() {
   cudaError_t result;
 
@@ -116,6 +154,8 @@ double GpuTimer::duration(int iterations) const {
   return double(avg_ms) / double(iterations);
 }
 
+#endif // defined(CUTLASS_ENABLE_SYCL)
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 } // namespace profiler
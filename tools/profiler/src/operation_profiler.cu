@@ -47,7 +47,9 @@
 // sleep not supported
 #endif
 
+#if !defined(CUTLASS_ENABLE_SYCL)
 #include <cuda/atomic>
+#endif
 
 #include "cutlass/profiler/options.h"
 #include "cutlass/profiler/operation_profiler.h"
@@ -709,6 +711,7 @@ void OperationProfiler::save_workspace(
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace {
+#if !defined(CUTLASS_ENABLE_SYCL)
 extern "C" {
 __global__ void delay(cuda::atomic<bool> const *release) {
   while (release->load(cuda::memory_order_acquire) != true) {
@@ -718,6 +721,7 @@ __global__ void delay(cuda::atomic<bool> const *release) {
   }
 }
 }
+#endif
 
 Status predict_iters(
   int &iterations,
@@ -766,6 +770,10 @@ Status OperationProfiler::profile_kernel_w_cuda_graphs_(
   std::function<Status(int, cudaStream_t, int)> const& func,
   std::vector<cudaStream_t> const& streams) {
 
+#if defined(CUTLASS_ENABLE_SYCL)
+  // SYCL has no equivalent of stream capture, so simultaneous multi-device launches are unavailable
+  return Status::kErrorNotSupported;
+#else
   auto dev_count = streams.size();
 
   cuda::atomic<bool> *release;
@@ -868,6 +876,7 @@ Status OperationProfiler::profile_kernel_w_cuda_graphs_(
   }
 
   return Status::kSuccess;
+#endif
 }
 
 Status OperationProfiler::profile_kernel_(
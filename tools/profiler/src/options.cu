@@ -31,8 +31,10 @@
 /* \file
    \brief Command line options for performance test program
 */
+#if !defined(CUTLASS_ENABLE_SYCL)
 #include <cuda.h>
 #include <cuda_runtime_api.h>
+#endif
 #include <algorithm>
 #include <fstream>
 #include <set>
@@ -176,7 +178,11 @@ void Options::Device::print_usage(std::ostream &out) const {
       }
       else {
         int32_t clock_KHz;
+#if defined(CUTLASS_ENABLE_SYCL)
+        clock_KHz = prop.clockRate;
+#else
         cudaDeviceGetAttribute(&clock_KHz, cudaDevAttrClockRate, 0);
+#endif
         out << "    [" << idx << "] - "
           << prop.name << " - SM " << prop.major << "." << prop.minor << ", "
           << prop.multiProcessorCount << " SMs @ " << (clock_KHz / 1000.0) << " MHz, "
@@ -234,7 +240,11 @@ void Options::Device::print_options(std::ostream &out, int indent) const {
     out << device << ',';
   }
   int32_t clock_KHz;
+#if defined(CUTLASS_ENABLE_SYCL)
+  clock_KHz = properties[0].clockRate;
+#else
   cudaDeviceGetAttribute(&clock_KHz, cudaDevAttrClockRate, 0);
+#endif
   out
     << "\n"
     << indent_str(indent) << "clock: " << int(double(clock_KHz) / 1000.0) << "\n"
@@ -497,6 +507,11 @@ Options::Profiling::Profiling(cutlass::CommandLine const &cmdline) {
   cmdline.get_cmd_line_argument("profiling-duration", duration, 10);
   cmdline.get_cmd_line_argument("min-iterations", min_iterations, 10);
   cmdline.get_cmd_line_argument("use-cuda-graphs", use_cuda_graphs, false);
+#if defined(CUTLASS_ENABLE_SYCL)
+  if (use_cuda_graphs) {
+    throw std::runtime_error("--use-cuda-graphs is not supported by the SYCL build of the profiler");
+  }
+#endif
   cmdline.get_cmd_line_argument("enable-kernel-performance-search", enable_kernel_performance_search, false);
   cmdline.get_cmd_line_argument("enable-best-kernel-for-fixed-shape", enable_best_kernel_for_fixed_shape, false);
 
@@ -44,6 +44,12 @@
 #include "cute/tensor.hpp"
 #include "cute/pointer.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace cutlass::reference::host {
@@ -512,6 +518,70 @@ void Gett(
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// GETT - Load one element of A at the accumulator's precision, applying SFA and conjugation.
+/// Rows outside the problem return the additive identity.
+template <class ElementAccumulator, class MainloopParams>
+ElementAccumulator gett_load_A(
+    MainloopParams const& mainloop_params,
+    int64_t m,
+    int64_t k,
+    int64_t l)
+{
+  using ElementA = typename ElementTraits<typename MainloopParams::EngineA::value_type>::type;
+  using ElementSFA = typename ElementTraits<typename MainloopParams::EngineSfA::value_type>::type;
+
+  if (m >= cute::size<0>(mainloop_params.A.layout())) {
+    return ElementAccumulator(0); // RingOp::AdditionIdentity
+  }
+
+  // Perform reference GEMM calculations at the accumulator's precision. Cast A value to accumulator type.
+  ElementAccumulator a = static_cast<ElementAccumulator>(ElementA(mainloop_params.A(m, k, l)));
+
+  if constexpr (not cute::is_same_v<ElementSFA, ElementA>){
+    // Load SFA
+    auto sfa = static_cast<ElementAccumulator>(mainloop_params.SfA(m, k, l));
+    a *= sfa;
+  }
+
+  if (mainloop_params.transform_A == ComplexTransform::kConjugate) {
+    a = conj(a);
+  }
+  return a;
+}
+
+/// GETT - Load one element of B at the accumulator's precision, applying SFB and conjugation.
+/// Columns outside the problem return the additive identity.
+template <class ElementAccumulator, class MainloopParams>
+ElementAccumulator gett_load_B(
+    MainloopParams const& mainloop_params,
+    int64_t n,
+    int64_t k,
+    int64_t l)
+{
+  using ElementB = typename ElementTraits<typename MainloopParams::EngineB::value_type>::type;
+  using ElementSFB = typename ElementTraits<typename MainloopParams::EngineSfB::value_type>::type;
+
+  if (n >= cute::size<0>(mainloop_params.B.layout())) {
+    return ElementAccumulator(0); // RingOp::AdditionIdentity
+  }
+
+  // Perform reference GEMM calculations at the accumulator's precision. Cast B value to accumulator type.
+  ElementAccumulator b = static_cast<ElementAccumulator>(ElementB(mainloop_params.B(n, k, l)));
+
+  if constexpr (not cute::is_same_v<ElementSFB, ElementB>){
+    // Load SFB
+    auto sfb = static_cast<ElementAccumulator>(mainloop_params.SfB(n, k, l));
+    b *= sfb;
+  }
+
+  if (mainloop_params.transform_B == ComplexTransform::kConjugate) {
+    b = conj(b);
+  }
+  return b;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// GETT - Mainloop
 template <class MainloopParams, class ElementAccumulator, int kBlockM, int kBlockN>
 void gett_mainloop(
@@ -524,16 +594,6 @@ void gett_mainloop(
 
   static_assert(cute::rank(typename MainloopParams::LayoutA{}) == 3, "M, K, B");
   static_assert(cute::rank(typename MainloopParams::LayoutB{}) == 3, "N, K, B");
-  
-  using cute::raw_pointer_cast;
-
-  using ElementA = typename ElementTraits<typename MainloopParams::EngineA::value_type>::type;
-  using ElementB = typename ElementTraits<typename MainloopParams::EngineB::value_type>::type;
-
-  
-  using ElementSFA = typename ElementTraits<typename MainloopParams::EngineSfA::value_type>::type;
-  using ElementSFB = typename ElementTraits<typename MainloopParams::EngineSfB::value_type>::type;
-  
 
   using RingOp = multiply_add<ElementAccumulator, ElementAccumulator, ElementAccumulator>;
   RingOp fma_op;
@@ -550,47 +610,13 @@ void gett_mainloop(
     // Load A
     ElementAccumulator a_frag[kBlockM];
     for (int m_b = 0; m_b < kBlockM; ++m_b) {
-      if (m + m_b < cute::size<0>(mainloop_params.A.layout())) {
-        // Perform reference GEMM calculations at the accumulator's precision. Cast A value to accumulator type.
-        a_frag[m_b] = static_cast<ElementAccumulator>(ElementA(mainloop_params.A(m + m_b, k, l)));
-        
-        
-        if constexpr (not cute::is_same_v<ElementSFA, ElementA>){
-          // Load SFA
-          auto sfa = static_cast<ElementAccumulator>(mainloop_params.SfA(m + m_b, k, l));
-          a_frag[m_b] *= sfa;
-        }
-        
-
-        if (mainloop_params.transform_A == ComplexTransform::kConjugate) {
-          a_frag[m_b] = conj(a_frag[m_b]);
-        }
-      } else {
-        a_frag[m_b] = ElementAccumulator(0); // RingOp::AdditionIdentity
-      }
+      a_frag[m_b] = gett_load_A<ElementAccumulator>(mainloop_params, m + m_b, k, l);
     }
 
     // Load B
     ElementAccumulator b_frag[kBlockN];
     for (int n_b = 0; n_b < kBlockN; ++n_b) {
-      if (n + n_b < cute::size<0>(mainloop_params.B.layout())) {
-        // Perform reference GEMM calculations at the accumulator's precision. Cast A value to accumulator type.
-        b_frag[n_b] = static_cast<ElementAccumulator>(ElementB(mainloop_params.B(n + n_b, k, l)));
-
-        
-        if constexpr (not cute::is_same_v<ElementSFB, ElementB>){
-          // Load SFB
-          auto sfb = static_cast<ElementAccumulator>(mainloop_params.SfB(n + n_b, k, l));
-          b_frag[n_b] *= sfb;
-        }
-        
-
-        if (mainloop_params.transform_B == ComplexTransform::kConjugate) {
-          b_frag[n_b] = conj(b_frag[n_b]);
-        }
-      } else {
-        b_frag[n_b] = ElementAccumulator(0); // RingOp::AdditionIdentity
-      }
+      b_frag[n_b] = gett_load_B<ElementAccumulator>(mainloop_params, n + n_b, k, l);
     }
 
     // do compute
@@ -605,14 +631,78 @@ void gett_mainloop(
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// GETT - Mainloop over K-blocks of operands packed into contiguous panels.
+///
+/// Each panel holds kBlockK columns of A (kBlockM rows) or B (kBlockN rows), already converted
+/// by gett_load_A/gett_load_B, so loads are amortized over the tile while every accumulator still
+/// sees its products in increasing k, exactly as in gett_mainloop.
+template <int kBlockK, class MainloopParams, class ElementAccumulator, int kBlockM, int kBlockN>
+void gett_mainloop_packed(
+    MainloopParams const& mainloop_params,
+    int64_t m,
+    int64_t n,
+    int64_t l,
+    ElementAccumulator (&acc)[kBlockM][kBlockN],
+    ElementAccumulator* a_panel,  // [kBlockK][kBlockM]
+    ElementAccumulator* b_panel)  // [kBlockK][kBlockN]
+{
+  static_assert(cute::rank(typename MainloopParams::LayoutA{}) == 3, "M, K, B");
+  static_assert(cute::rank(typename MainloopParams::LayoutB{}) == 3, "N, K, B");
+
+  using RingOp = multiply_add<ElementAccumulator, ElementAccumulator, ElementAccumulator>;
+  RingOp fma_op;
+
+  for (int m_b = 0; m_b < kBlockM; ++m_b) {
+    for (int n_b = 0; n_b < kBlockN; ++n_b) {
+      acc[m_b][n_b] = ElementAccumulator(0); // RingOp::AdditionIdentity
+    }
+  }
+
+  int64_t const K = cute::size<1>(mainloop_params.A.layout());
+  for (int64_t k_blk = 0; k_blk < K; k_blk += kBlockK) {
+    int const k_size = static_cast<int>(std::min<int64_t>(kBlockK, K - k_blk));
+
+    // Pack A and B
+    for (int k_b = 0; k_b < k_size; ++k_b) {
+      for (int m_b = 0; m_b < kBlockM; ++m_b) {
+        a_panel[k_b * kBlockM + m_b] = gett_load_A<ElementAccumulator>(mainloop_params, m + m_b, k_blk + k_b, l);
+      }
+      for (int n_b = 0; n_b < kBlockN; ++n_b) {
+        b_panel[k_b * kBlockN + n_b] = gett_load_B<ElementAccumulator>(mainloop_params, n + n_b, k_blk + k_b, l);
+      }
+    }
+
+    // do compute
+    for (int k_b = 0; k_b < k_size; ++k_b) {
+      // Local copies let the compiler assume the fragments do not alias the accumulators
+      ElementAccumulator a_frag[kBlockM];
+      ElementAccumulator b_frag[kBlockN];
+      std::copy_n(a_panel + k_b * kBlockM, kBlockM, a_frag);
+      std::copy_n(b_panel + k_b * kBlockN, kBlockN, b_frag);
+
+      for (int m_b = 0; m_b < kBlockM; ++m_b) {
+        for (int n_b = 0; n_b < kBlockN; ++n_b) {
+          acc[m_b][n_b] = fma_op(a_frag[m_b], b_frag[n_b], acc[m_b][n_b]);
+        }
+      }
+    }
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// GETT - Epilogue
+///
+/// When called from threads that are not managed by OpenMP, abs_max_mutex serializes the
+/// amax updates that are otherwise guarded by the OpenMP critical section.
 template <class EpilogueParams, class ElementAccumulator, int kBlockM, int kBlockN>
 void gett_epilogue(
     EpilogueParams const& epilogue_params,
     int64_t m,
     int64_t n,
     int64_t l,
-    ElementAccumulator (&acc)[kBlockM][kBlockN])
+    ElementAccumulator (&acc)[kBlockM][kBlockN],
+    std::mutex* abs_max_mutex = nullptr)
 {
   static_assert(cute::rank(typename EpilogueParams::LayoutC{}) == 3, "M, K, B");
   static_assert(cute::rank(typename EpilogueParams::LayoutD{}) == 3, "N, K, B");
@@ -803,6 +893,11 @@ void gett_epilogue(
   #pragma omp critical(Abs_Max_Data_Update)
 #endif
   {
+    std::unique_lock<std::mutex> abs_max_lock;
+    if (abs_max_mutex) {
+      abs_max_lock = std::unique_lock<std::mutex>(*abs_max_mutex);
+    }
+
     if constexpr (IsScalingAndAmaxOutputNeeded) {
       if (epilogue_params.abs_max_D) {
         *epilogue_params.abs_max_D = maximum_with_nan_propogation<ElementAccumulator>{}(
@@ -821,6 +916,92 @@ void gett_epilogue(
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// GETT - Multithreaded, cache-blocked reference kernel
+///
+/// Produces the same results as Gett(): operands are converted by the same helpers and every
+/// output element accumulates its products in the same order; only the loads are hoisted into
+/// packed K-panels that are reused across the tile. Tiles are distributed over std::threads, so
+/// the speedup does not depend on building with OpenMP. num_threads <= 0 selects
+/// std::thread::hardware_concurrency().
+template <
+  class MainloopParams,
+  class EpilogueParams
+>
+void GettParallel(
+    MainloopParams const& mainloop_params,
+    EpilogueParams const& epilogue_params,
+    int num_threads = 0)
+{
+  using ElementAccumulator = typename MainloopParams::ElementAccumulator;
+  using ElementCompute = typename EpilogueParams::ElementCompute;
+  using ActivationFunctor = typename EpilogueParams::ActivationFunctor;
+
+  static int constexpr kBlockM = 64;
+  static int constexpr kBlockN = 64;
+  static int constexpr kBlockK = 128;
+
+  // The dBias reduction read-modify-writes Bias(m) once per N tile and batch. Giving each thread
+  // a whole row of tiles keeps those updates race free and in the same order as Gett().
+  constexpr bool IsBackpropFusion =
+      cute::is_same_v<ActivationFunctor, cutlass::epilogue::thread::dGELU<ElementCompute>> or
+      cute::is_same_v<ActivationFunctor, cutlass::epilogue::thread::dReLU<ElementCompute>>;
+
+  int64_t const M = cute::size<0>(mainloop_params.A.layout());
+  int64_t const N = cute::size<0>(mainloop_params.B.layout());
+  int64_t const L = cute::size<2>(mainloop_params.A.layout());
+  int64_t const tiles_m = (M + kBlockM - 1) / kBlockM;
+  int64_t const tiles_n = (N + kBlockN - 1) / kBlockN;
+  int64_t const num_work = IsBackpropFusion ? tiles_m : L * tiles_m * tiles_n;
+
+  if (num_threads <= 0) {
+    num_threads = static_cast<int>(std::thread::hardware_concurrency());
+  }
+  num_threads = static_cast<int>(std::max<int64_t>(1, std::min<int64_t>(num_threads, num_work)));
+
+  std::atomic<int64_t> next_work{0};
+  std::mutex abs_max_mutex;
+
+  auto worker = [&]() {
+    std::vector<ElementAccumulator> a_panel(kBlockK * kBlockM);
+    std::vector<ElementAccumulator> b_panel(kBlockK * kBlockN);
+    ElementAccumulator acc[kBlockM][kBlockN];
+
+    auto compute_tile = [&](int64_t m, int64_t n, int64_t l) {
+      gett_mainloop_packed<kBlockK>(mainloop_params, m, n, l, acc, a_panel.data(), b_panel.data());
+      gett_epilogue(epilogue_params, m, n, l, acc, &abs_max_mutex);
+    };
+
+    // Consecutive work items walk N fastest so that neighbouring tiles share their rows of A
+    for (int64_t work = next_work++; work < num_work; work = next_work++) {
+      if constexpr (IsBackpropFusion) {
+        for (int64_t l = 0; l < L; ++l) {
+          for (int64_t n = 0; n < N; n += kBlockN) {
+            compute_tile(work * kBlockM, n, l);
+          }
+        }
+      }
+      else {
+        int64_t const n = (work % tiles_n) * kBlockN;
+        int64_t const m = ((work / tiles_n) % tiles_m) * kBlockM;
+        int64_t const l = work / (tiles_n * tiles_m);
+        compute_tile(m, n, l);
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  for (int i = 1; i < num_threads; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 template <class TensorType>
 auto make_layout_rank3(const TensorType& tensor) {
   // append a batch mode of size 1 if we do not have tensors that are rank 3
@@ -829,14 +1010,16 @@ auto make_layout_rank3(const TensorType& tensor) {
       make_stride(cute::get<0>(tensor.stride()), cute::get<1>(tensor.stride()), int64_t(cosize(tensor.layout()))));
 }
 
-/// GEMM - General Matrix-Matrix contraction without conjugation options
+/// Calls gett(mainloop_params, epilogue_params) after appending a unit batch mode to rank-2 tensors
 template <
   class MainloopParams,
-  class EpilogueParams
+  class EpilogueParams,
+  class GettFunc
 >
-void Gemm3x(
+void gemm3x_dispatch(
     MainloopParams const& mainloop_params,
-    EpilogueParams const& epilogue_params)
+    EpilogueParams const& epilogue_params,
+    GettFunc&& gett)
 {
   using namespace cute;
 
@@ -901,14 +1084,43 @@ void Gemm3x(
                                   epilogue_params.scale_aux
                                   };
 
-    Gett(mainloop_params_converted, epilogue_params_converted);
+    gett(mainloop_params_converted, epilogue_params_converted);
   }
   else {
     // if we already have a batch mode, just pass it through
-    Gett(mainloop_params, epilogue_params);
+    gett(mainloop_params, epilogue_params);
   }
 }
 
+/// GEMM - General Matrix-Matrix contraction without conjugation options
+template <
+  class MainloopParams,
+  class EpilogueParams
+>
+void Gemm3x(
+    MainloopParams const& mainloop_params,
+    EpilogueParams const& epilogue_params)
+{
+  gemm3x_dispatch(mainloop_params, epilogue_params, [](auto const& mainloop, auto const& epilogue) {
+    Gett(mainloop, epilogue);
+  });
+}
+
+/// GEMM - Multithreaded variant of Gemm3x, see GettParallel()
+template <
+  class MainloopParams,
+  class EpilogueParams
+>
+void Gemm3xParallel(
+    MainloopParams const& mainloop_params,
+    EpilogueParams const& epilogue_params,
+    int num_threads = 0)
+{
+  gemm3x_dispatch(mainloop_params, epilogue_params, [num_threads](auto const& mainloop, auto const& epilogue) {
+    GettParallel(mainloop, epilogue, num_threads);
+  });
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 } // cutlass::reference::host